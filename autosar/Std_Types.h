@@ -12,6 +12,7 @@
 
 /* @reqs SWS_Std_00004*/
 #include "Platform_Types.h"
+#include "Compiler.h"
 
 /**
  * @brief  This type can be used as standard API return type which is shared between the RTE
@@ -0,0 +1,170 @@
+/**
+ * @file    SchM.c
+ * @brief   **Schedule manager exclusive areas**
+ *
+ * The nesting counter and the saved state of each area are updated with PRIMASK set for a few
+ * instructions, so an area can be entered from the task level and from an interrupt that is not
+ * on its mask without corrupting them. The areas with a mask clear on the NVIC only the lines
+ * that were enabled and the outermost exit enables those same lines again, so a driver shall not
+ * enable or disable a line masked by an area while the area is held: a line disabled in the
+ * meantime is enabled back by the exit and a line enabled in the meantime is not masked.
+ */
+#include "Std_Types.h"
+#include "Registers.h"
+#include "SchM.h"
+#include "Bfx_32bits.h"
+
+#ifndef UTEST
+/**
+ * @brief Wait until the NVIC takes the lines cleared, otherwise one of them could still be taken
+ * right after the write
+ */
+#define SCHM_SYNC_NVIC( ) __asm volatile( "dsb\n\tisb" : : : "memory" )
+#else
+#define SCHM_SYNC_NVIC( ) (void)0 /*!< No barriers needed when running the unit tests on the host */
+#endif
+
+/**
+ * @brief  Interrupt lines masked by each area, zero to mask all of them, defined in SchM_Lcfg.c
+ */
+extern const uint32 SchM_AreaMasks[ SCHM_NUMBER_OF_AREAS ];
+
+/**
+ * @brief  Runtime data of each exclusive area
+ */
+SCHM_STATIC SchM_AreaStateType SchM_Areas[ SCHM_NUMBER_OF_AREAS ];
+
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at SchM_Cfg.h */
+#if SCHM_MEASURE_HOLD_TIME == STD_ON
+/**
+ * @brief    **SysTick counts since a previous reading**
+ *
+ * SysTick counts down from LOAD to zero, when the current value is above the start value the
+ * counter has been reloaded once in between.
+ *
+ * @param   Start SysTick value at the beginning of the measure
+ *
+ * @retval  Elapsed SysTick counts
+ */
+static uint32 SchM_GetElapsed( uint32 Start )
+{
+    uint32 Now     = SYSTICK->VAL;
+    uint32 Elapsed = Start - Now;
+
+    if( Now > Start )
+    {
+        Elapsed += SYSTICK->LOAD + 1u;
+    }
+
+    return Elapsed;
+}
+#endif
+
+/**
+ * @brief    **Enter an exclusive area**
+ *
+ * The outermost enter masks the interrupts of the area, the nested ones only count the level.
+ * Each call shall be paired with a call to SchM_Exit for the same area.
+ *
+ * @param   Area Exclusive area id, one of the SCHM_<MODULE>_EXCLUSIVE_AREA_x values
+ */
+void SchM_Enter( SchM_AreaType Area )
+{
+    if( Area < SCHM_NUMBER_OF_AREAS )
+    {
+        SchM_AreaStateType *State = &SchM_Areas[ Area ];
+        uint32 Mask               = SchM_AreaMasks[ Area ];
+        uint32 PriMask            = Bfx_EnterAtomic_u32( );
+
+        if( State->Nesting == 0u )
+        {
+            if( Mask == 0u )
+            {
+                State->Saved = PriMask;
+            }
+            else
+            {
+                State->Saved     = NVIC->ISER[ 0u ] & Mask;
+                NVIC->ICER[ 0u ] = State->Saved;
+                SCHM_SYNC_NVIC( );
+            }
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at SchM_Cfg.h */
+#if SCHM_MEASURE_HOLD_TIME == STD_ON
+            State->Start = SYSTICK->VAL;
+#endif
+        }
+        State->Nesting++;
+
+        /*the areas without mask leave PRIMASK set until the outermost exit*/
+        if( Mask != 0u )
+        {
+            Bfx_ExitAtomic_u32( PriMask );
+        }
+    }
+}
+
+/**
+ * @brief    **Exit an exclusive area**
+ *
+ * The outermost exit restores the interrupts masked by its enter, the nested ones only count the
+ * level. An exit without its enter is ignored.
+ *
+ * @param   Area Exclusive area id, one of the SCHM_<MODULE>_EXCLUSIVE_AREA_x values
+ */
+void SchM_Exit( SchM_AreaType Area )
+{
+    if( Area < SCHM_NUMBER_OF_AREAS )
+    {
+        SchM_AreaStateType *State = &SchM_Areas[ Area ];
+        uint32 PriMask            = Bfx_EnterAtomic_u32( );
+
+        if( State->Nesting > 0u )
+        {
+            State->Nesting--;
+            if( State->Nesting == 0u )
+            {
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at SchM_Cfg.h */
+#if SCHM_MEASURE_HOLD_TIME == STD_ON
+                /*SysTick stopped with LOAD zero (its reset state) gives nothing to measure*/
+                if( SYSTICK->LOAD != 0u )
+                {
+                    uint32 HoldTime    = SchM_GetElapsed( State->Start );
+                    State->MaxHoldTime = ( HoldTime > State->MaxHoldTime ) ? HoldTime : State->MaxHoldTime;
+                }
+#endif
+                if( SchM_AreaMasks[ Area ] == 0u )
+                {
+                    PriMask = State->Saved;
+                }
+                else
+                {
+                    NVIC->ISER[ 0u ] = State->Saved;
+                }
+            }
+        }
+        Bfx_ExitAtomic_u32( PriMask );
+    }
+}
+
+/**
+ * @brief    **Longest time an area kept the interrupts masked**
+ *
+ * Measured from the outermost enter to its exit since reset, the value is zero when
+ * SCHM_MEASURE_HOLD_TIME is off or SysTick has not been started by the application (LOAD zero).
+ * Divide by the SysTick clock to get the time.
+ *
+ * @param   Area Exclusive area id, one of the SCHM_<MODULE>_EXCLUSIVE_AREA_x values
+ *
+ * @retval  Worst case hold time in SysTick counts, zero for an invalid area
+ */
+uint32 SchM_GetMaxHoldTime( SchM_AreaType Area )
+{
+    uint32 HoldTime = 0u;
+
+    if( Area < SCHM_NUMBER_OF_AREAS )
+    {
+        HoldTime = SchM_Areas[ Area ].MaxHoldTime;
+    }
+
+    return HoldTime;
+}
@@ -0,0 +1,56 @@
+/**
+ * @file    SchM.h
+ * @brief   **Schedule manager exclusive areas**
+ *
+ * Critical sections for the data the drivers share between their API and their interrupts. Each
+ * exclusive area either masks every interrupt with PRIMASK or, like a BASEPRI on bigger cores,
+ * only the interrupt lines set for it in SchM_Lcfg.c by clearing them on the NVIC, so the rest of
+ * the interrupts keep their latency. The areas can be nested, only the outermost enter masks the
+ * interrupts and only the outermost exit restores them, an area can also be entered inside a
+ * different one. The lines masked by an area shall not be enabled or disabled while it is held.
+ *
+ * The drivers call the areas with the AUTOSAR names SchM_Enter_<Module>_<Area> defined in
+ * SchM_Cfg.h. When SCHM_MEASURE_HOLD_TIME is on, the time from the outermost enter to its exit is
+ * measured with SysTick and the longest one of each area is kept, read it with
+ * SchM_GetMaxHoldTime to check the interrupt latency added by each driver. The startup leaves
+ * SysTick stopped, the application shall start it before, while LOAD is zero nothing is measured.
+ */
+#ifndef SCHM_H__
+#define SCHM_H__
+
+#include "Std_Types.h"
+#include "SchM_Cfg.h"
+
+/**
+ * @defgroup SCHM_STATIC SCHM static define for testing purposes
+ *
+ * @{ */
+#ifndef UTEST
+#define SCHM_STATIC static /*!< Add static when no testing */
+#else
+#define SCHM_STATIC /*!< remove static for testing purposes */
+#endif
+/**
+ * @} */
+
+/**
+ * @brief   **Exclusive area id**
+ */
+typedef uint8 SchM_AreaType;
+
+/**
+ * @brief   **Exclusive area runtime data**
+ */
+typedef struct _SchM_AreaStateType
+{
+    uint32 Saved;       /*!< PRIMASK or interrupt lines enabled before the outermost enter */
+    uint32 Start;       /*!< SysTick value at the outermost enter */
+    uint32 MaxHoldTime; /*!< Longest time with the interrupts masked in SysTick counts */
+    uint8 Nesting;      /*!< Number of enters without its exit */
+} SchM_AreaStateType;
+
+void SchM_Enter( SchM_AreaType Area );
+void SchM_Exit( SchM_AreaType Area );
+uint32 SchM_GetMaxHoldTime( SchM_AreaType Area );
+
+#endif /* SCHM_H__ */
@@ -0,0 +1,92 @@
+/**
+ * @file    Stack.c
+ * @brief   **Stack usage monitor**
+ *
+ * Reports the size of the stack reservation and how much of it has been used so far, the words
+ * still holding STACK_PAINT_PATTERN from the bottom of the stack up to the first overwritten one
+ * are the ones never reached. The scan time grows with the unused stack, so it is meant to be
+ * called from a background task or a debug session, not from an interrupt.
+ */
+#include "Std_Types.h"
+#include "Stack.h"
+
+/*external reference to linker script symbols, both are 4 bytes aligned*/
+extern uint32 _sstack; /*lowest address of the stack reservation*/
+extern uint32 _estack; /*stack init address*/
+
+/**
+ * @brief  Lowest word of the stack reservation
+ */
+STACK_STATIC const uint32 *Stack_Start = &_sstack;
+
+/**
+ * @brief  Word after the highest one of the stack reservation
+ */
+STACK_STATIC const uint32 *Stack_End = &_estack;
+
+STACK_STATIC uint32 Stack_CountPainted( const uint32 *Start, const uint32 *End );
+
+/**
+ * @brief    **Stack size**
+ *
+ * Size of the stack reservation set by _Min_Stack_Size in the linker script.
+ *
+ * @retval  Stack size in bytes
+ */
+uint32 Stack_GetSize( void )
+{
+    /* cppcheck-suppress misra-c2012-18.4 ; both pointers are on the same section */
+    return (uint32)( Stack_End - Stack_Start ) * sizeof( uint32 );
+}
+
+/**
+ * @brief    **Stack high water mark**
+ *
+ * Deepest stack usage since reset, main and interrupts included. When it reaches the stack size
+ * the reservation has been exhausted and the stack has probably grown over the memory below.
+ *
+ * @retval  Maximum number of stack bytes used
+ */
+uint32 Stack_GetHighWaterMark( void )
+{
+    return Stack_GetSize( ) - Stack_GetUnused( );
+}
+
+/**
+ * @brief    **Stack never used**
+ *
+ * Number of bytes at the bottom of the stack that still hold the paint pattern, this is the
+ * margin left that can be removed from _Min_Stack_Size.
+ *
+ * @retval  Number of stack bytes never used
+ */
+uint32 Stack_GetUnused( void )
+{
+    return Stack_CountPainted( Stack_Start, Stack_End ) * sizeof( uint32 );
+}
+
+/**
+ * @brief    **Count painted words**
+ *
+ * The stack grows downwards, so the scan goes from the lowest address up to the first word
+ * different from the paint pattern, words painted above it are holes left by the stack frames
+ * and are not counted.
+ *
+ * @param   Start First word of the stack reservation
+ * @param   End Word after the last one of the stack reservation
+ *
+ * @retval  Number of consecutive painted words from Start
+ */
+STACK_STATIC uint32 Stack_CountPainted( const uint32 *Start, const uint32 *End )
+{
+    const uint32 *Location = Start;
+
+    /* cppcheck-suppress misra-c2012-18.3 ; both pointers are on the same section */
+    while( ( Location < End ) && ( *Location == STACK_PAINT_PATTERN ) )
+    {
+        Location++;
+    }
+
+    /* cppcheck-suppress misra-c2012-18.4 ; both pointers are on the same section */
+    return (uint32)( Location - Start );
+}
@@ -0,0 +1,34 @@
+/**
+ * @file    Stack.h
+ * @brief   **Stack usage monitor**
+ *
+ * The startup code paints the stack reservation (_Min_Stack_Size bytes under _estack) with
+ * STACK_PAINT_PATTERN before calling main, the functions in this file look for the lowest word
+ * overwritten since then to report the deepest stack usage (high water mark). There is no RTOS,
+ * so main and the interrupts (nested ones included) run on the same main stack and a single
+ * high water mark covers both.
+ */
+#ifndef STACK_H__
+#define STACK_H__
+
+#include "Std_Types.h"
+
+/**
+ * @defgroup STACK_STATIC STACK static define for testing purposes
+ *
+ * @{ */
+#ifndef UTEST
+#define STACK_STATIC static /*!< Add static when no testing */
+#else
+#define STACK_STATIC /*!< remove static for testing purposes */
+#endif
+/**
+ * @} */
+
+#define STACK_PAINT_PATTERN 0xC5C5C5C5u /*!< Value written on each free stack word at startup */
+
+uint32 Stack_GetSize( void );
+uint32 Stack_GetHighWaterMark( void );
+uint32 Stack_GetUnused( void );
+
+#endif /* STACK_H__ */
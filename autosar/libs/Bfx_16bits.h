@@ -403,40 +403,31 @@ static inline void Bfx_PutBit_u16u8u8( uint16 *Data, uint8 BitPn, boolean Status
 }
 
 /**
- * @brief   **Counts consecutive ones**
+ * @brief   **Counts the ones**
  *
- * Count the number of consecutive ones in Data starting with the most significant bit and return
- * the result.
+ * Count the number of bits set in Data (population count) adding the bits in parallel in
+ * groups of 2, 4 and 8 bits, it takes the same time for any value and has no branches, the
+ * count leading and trailing functions are built on top of it.
  *
  * @param   Data Unsigned integer to check
  *
- * @retval  Counter
- *
- * @reqs   SWS_Bfx_91003, SWS_Bfx_00137
+ * @retval  Number of bits set
  */
-static inline uint8 Bfx_CountLeadingOnes_u16( uint16 Data )
+static inline uint8 Bfx_CountOnes_u16( uint16 Data )
 {
-    uint8 Counter = 0;
+    uint16 Value = (uint16)( Data - ( ( Data >> 1u ) & 0x5555u ) );
 
-    for( uint8 i = 16; i > 0; i-- )
-    {
-        if( ( Data & ( 0x01 << ( i - 1 ) ) ) != 0 )
-        {
-            Counter++;
-        }
-        else
-        {
-            i = 1;
-        }
-    }
-    return Counter;
+    Value = (uint16)( ( Value & 0x3333u ) + ( ( Value >> 2u ) & 0x3333u ) );
+    Value = (uint16)( ( Value + ( Value >> 4u ) ) & 0x0F0Fu );
+    return (uint8)( ( Value + ( Value >> 8u ) ) & 0x1Fu );
 }
 
 /**
  * @brief   **Counts consecutive zeros**
  *
  * Count the number of consecutive zeros in Data starting with the most significant bit and return
- * the result.
+ * the result. The most significant one is copied over all the bits below it, so the leading zeros
+ * are the bits still cleared, constant time since the core has no count leading zeros instruction.
  *
  * @param   Data Unsigned integer to check
  *
@@ -446,20 +437,30 @@ static inline uint8 Bfx_CountLeadingOnes_u16( uint16 Data )
  */
 static inline uint8 Bfx_CountLeadingZeros_u16( uint16 Data )
 {
-    uint8 Counter = 0;
+    uint16 Value = Data;
 
-    for( uint8 i = 16; i > 0; i-- )
-    {
-        if( ( Data & ( 0x01 << ( i - 1 ) ) ) != 0 )
-        {
-            i = 1;
-        }
-        else
-        {
-            Counter++;
-        }
-    }
-    return Counter;
+    Value |= Value >> 1u;
+    Value |= Value >> 2u;
+    Value |= Value >> 4u;
+    Value |= Value >> 8u;
+    return (uint8)( 16u - Bfx_CountOnes_u16( Value ) );
+}
+
+/**
+ * @brief   **Counts consecutive ones**
+ *
+ * Count the number of consecutive ones in Data starting with the most significant bit and return
+ * the result. It is the number of leading zeros of the inverted data, constant time.
+ *
+ * @param   Data Unsigned integer to check
+ *
+ * @retval  Counter
+ *
+ * @reqs   SWS_Bfx_91003, SWS_Bfx_00137
+ */
+static inline uint8 Bfx_CountLeadingOnes_u16( uint16 Data )
+{
+    return Bfx_CountLeadingZeros_u16( (uint16)~Data );
 }
 
 /**
@@ -467,7 +468,8 @@ static inline uint8 Bfx_CountLeadingZeros_u16( uint16 Data )
  *
  * Count the number of consecutive bits which have the same value as most significant bit in Data,
  * starting with bit at position msb minus one. Put the result in Data. It is the number of
- * leading sign bits minus one, giving the number of redundant sign bits in Data.
+ * leading sign bits minus one, giving the number of redundant sign bits in Data. The data is
+ * inverted when negative so the sign bits become leading zeros.
  *
  * @param   Data Signed integer to count from
  *
@@ -477,27 +479,26 @@ static inline uint8 Bfx_CountLeadingZeros_u16( uint16 Data )
  */
 static inline uint8 Bfx_CountLeadingSigns_s16( sint16 Data )
 {
-    uint8 Count = 0;
-    sint16 Mask = 32767;
+    uint16 Value = (uint16)Data;
+    uint16 Sign  = (uint16)( 0u - ( Value >> 15u ) );
 
-    if( Data >= 0 )
-    {
-        while( ( Data & Mask ) == 0 )
-        {
-            Count++;
-            Mask >>= 1;
-        }
-    }
-    else
-    {
-        while( ( Data & Mask ) == Mask )
-        {
-            Count++;
-            Mask >>= 1;
-        }
-    }
-    Data = Count - 1;
-    return Data;
+    return (uint8)( Bfx_CountLeadingZeros_u16( (uint16)( Value ^ Sign ) ) - 1u );
+}
+
+/**
+ * @brief   **Counts trailing zeros**
+ *
+ * Count the number of consecutive zeros in Data starting with the least significant bit and
+ * return the result, 16 when Data is zero. Clearing all bits but the lowest one and subtracting
+ * one leaves a mask with the trailing zeros set, constant time.
+ *
+ * @param   Data Unsigned integer to check
+ *
+ * @retval  Counter
+ */
+static inline uint8 Bfx_CountTrailingZeros_u16( uint16 Data )
+{
+    return Bfx_CountOnes_u16( (uint16)( ( Data & (uint16)( 0u - Data ) ) - 1u ) );
 }
 
 /**
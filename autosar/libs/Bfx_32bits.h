@@ -7,8 +7,24 @@
  * All bit functions are re-entrant and can handle several simultaneous requests from the
  * application.
  */
+#ifndef BFX_32BITS_H__
+#define BFX_32BITS_H__
+
 #include "Std_Types.h"
 
+/**
+ * @brief   **Bitfield descriptor**
+ *
+ * One field of a 32 bit register or memory word, used to update several fields of the same word
+ * with a single access.
+ */
+typedef struct _Bfx_FieldType
+{
+    uint8 BitStartPn; /*!< LSB of the field */
+    uint8 BitLn;      /*!< Lenght of the field, from 1 to 32 */
+    uint32 Pattern;   /*!< Value to put in the field, only the BitLn lower bits are used */
+} Bfx_FieldType;
+
 /**
  * @brief   **Set a single bit in Data pointer**
  *
@@ -369,6 +385,70 @@ static inline void Bfx_PutBitsMask_u32u32u32( uint32 *Data, uint32 Pattern, uint
     *Data = ( *Data & ~Mask ) | ( Pattern & Mask );
 }
 
+/**
+ * @brief   **Builds a value from a list of fields**
+ *
+ * This function puts each field of the list in its position of a value starting from zero and
+ * returns the bits affected by the fields in Mask, the fields shall not overlap.
+ *
+ * @param   Fields List of fields to put
+ * @param   Count Number of fields in the list
+ * @param   Mask Bits covered by the fields
+ *
+ * @retval  Value with all the fields in place and zero in the rest of the bits
+ */
+static inline uint32 Bfx_BuildFields_u32( const Bfx_FieldType *Fields, uint8 Count, uint32 *Mask )
+{
+    uint32 Value     = 0u;
+    uint32 FieldMask = 0u;
+
+    *Mask = 0u;
+    for( uint8 Field = 0u; Field < Count; Field++ )
+    {
+        FieldMask = ( 0xFFFFFFFFu >> ( 32u - Fields[ Field ].BitLn ) ) << Fields[ Field ].BitStartPn;
+        Value |= ( Fields[ Field ].Pattern << Fields[ Field ].BitStartPn ) & FieldMask;
+        *Mask |= FieldMask;
+    }
+    return Value;
+}
+
+/**
+ * @brief   **Puts a list of fields in an unsigned integer with one read and one write**
+ *
+ * This function does the same as calling Bfx_PutBits_u32u8u8u32 once per field, but the value is
+ * built first and Data is read and written only once, the bits not covered by the fields keep
+ * their value. Use it on registers with several fields to update.
+ *
+ * @param   Data Unsigned integer to modify
+ * @param   Fields List of fields to put
+ * @param   Count Number of fields in the list
+ */
+static inline void Bfx_PutFields_u32( uint32 *Data, const Bfx_FieldType *Fields, uint8 Count )
+{
+    uint32 Mask;
+    uint32 Value = Bfx_BuildFields_u32( Fields, Count, &Mask );
+
+    *Data = ( *Data & ~Mask ) | Value;
+}
+
+/**
+ * @brief   **Writes a list of fields in an unsigned integer with one write**
+ *
+ * This function replaces the whole Data with the value built from the fields, the bits not covered
+ * by the fields are cleared and Data is never read. Use it when the fields describe the complete
+ * word, like the message RAM elements or registers without fields to preserve.
+ *
+ * @param   Data Unsigned integer to write
+ * @param   Fields List of fields to write
+ * @param   Count Number of fields in the list
+ */
+static inline void Bfx_WriteFields_u32( uint32 *Data, const Bfx_FieldType *Fields, uint8 Count )
+{
+    uint32 Mask;
+
+    *Data = Bfx_BuildFields_u32( Fields, Count, &Mask );
+}
+
 /**
  * @brief   **Sets the bit of an unsigned integer according to Status**
  *
@@ -394,40 +474,31 @@ static inline void Bfx_PutBit_u32u8u8( uint32 *Data, uint8 BitPn, boolean Status
 }
 
 /**
- * @brief   **Counts consecutive ones**
+ * @brief   **Counts the ones**
  *
- * Count the number of consecutive ones in Data starting with the most significant bit and return
- * the result.
+ * Count the number of bits set in Data (population count) adding the bits in parallel in
+ * groups of 2, 4 and 8 bits, it takes the same time for any value and has no branches, the
+ * count leading and trailing functions are built on top of it.
  *
  * @param   Data Unsigned integer to check
  *
- * @retval  Counter
- *
- * @reqs   SWS_Bfx_91003, SWS_Bfx_00137
+ * @retval  Number of bits set
  */
-static inline uint8 Bfx_CountLeadingOnes_u32( uint32 Data )
+static inline uint8 Bfx_CountOnes_u32( uint32 Data )
 {
-    uint8 Counter = 0;
+    uint32 Value = Data - ( ( Data >> 1u ) & 0x55555555u );
 
-    for( uint8 i = 32; i > 0; i-- )
-    {
-        if( ( Data & ( 0x01 << ( i - 1 ) ) ) != 0 )
-        {
-            Counter++;
-        }
-        else
-        {
-            i = 1;
-        }
-    }
-    return Counter;
+    Value = ( Value & 0x33333333u ) + ( ( Value >> 2u ) & 0x33333333u );
+    Value = ( Value + ( Value >> 4u ) ) & 0x0F0F0F0Fu;
+    return (uint8)( ( Value * 0x01010101u ) >> 24u );
 }
 
 /**
  * @brief   **Counts consecutive zeros**
  *
  * Count the number of consecutive zeros in Data starting with the most significant bit and return
- * the result.
+ * the result. The most significant one is copied over all the bits below it, so the leading zeros
+ * are the bits still cleared, constant time since the core has no count leading zeros instruction.
  *
  * @param   Data Unsigned integer to check
  *
@@ -437,20 +508,31 @@ static inline uint8 Bfx_CountLeadingOnes_u32( uint32 Data )
  */
 static inline uint8 Bfx_CountLeadingZeros_u32( uint32 Data )
 {
-    uint8 Counter = 0;
+    uint32 Value = Data;
 
-    for( uint8 i = 32; i > 0; i-- )
-    {
-        if( ( Data & ( 0x01 << ( i - 1 ) ) ) != 0 )
-        {
-            i = 1;
-        }
-        else
-        {
-            Counter++;
-        }
-    }
-    return Counter;
+    Value |= Value >> 1u;
+    Value |= Value >> 2u;
+    Value |= Value >> 4u;
+    Value |= Value >> 8u;
+    Value |= Value >> 16u;
+    return (uint8)( 32u - Bfx_CountOnes_u32( Value ) );
+}
+
+/**
+ * @brief   **Counts consecutive ones**
+ *
+ * Count the number of consecutive ones in Data starting with the most significant bit and return
+ * the result. It is the number of leading zeros of the inverted data, constant time.
+ *
+ * @param   Data Unsigned integer to check
+ *
+ * @retval  Counter
+ *
+ * @reqs   SWS_Bfx_91003, SWS_Bfx_00137
+ */
+static inline uint8 Bfx_CountLeadingOnes_u32( uint32 Data )
+{
+    return Bfx_CountLeadingZeros_u32( (uint32)~Data );
 }
 
 /**
@@ -458,7 +540,8 @@ static inline uint8 Bfx_CountLeadingZeros_u32( uint32 Data )
  *
  * Count the number of consecutive bits which have the same value as most significant bit in Data,
  * starting with bit at position msb minus one. Put the result in Data. It is the number of
- * leading sign bits minus one, giving the number of redundant sign bits in Data.
+ * leading sign bits minus one, giving the number of redundant sign bits in Data. The data is
+ * inverted when negative so the sign bits become leading zeros.
  *
  * @param   Data Signed integer to count from
  *
@@ -468,27 +551,26 @@ static inline uint8 Bfx_CountLeadingZeros_u32( uint32 Data )
  */
 static inline uint8 Bfx_CountLeadingSigns_s32( sint32 Data )
 {
-    uint8 Count = 0;
-    sint32 Mask = 0x80000000;
+    uint32 Value = (uint32)Data;
+    uint32 Sign  = (uint32)( 0u - ( Value >> 31u ) );
 
-    if( Data >= 0 )
-    {
-        while( ( Data & Mask ) == 0 )
-        {
-            Count++;
-            Mask >>= 1;
-        }
-    }
-    else
-    {
-        while( ( Data & Mask ) == Mask )
-        {
-            Count++;
-            Mask >>= 1;
-        }
-    }
-    Data = Count - 1;
-    return Data;
+    return (uint8)( Bfx_CountLeadingZeros_u32( (uint32)( Value ^ Sign ) ) - 1u );
+}
+
+/**
+ * @brief   **Counts trailing zeros**
+ *
+ * Count the number of consecutive zeros in Data starting with the least significant bit and
+ * return the result, 32 when Data is zero. Clearing all bits but the lowest one and subtracting
+ * one leaves a mask with the trailing zeros set, constant time.
+ *
+ * @param   Data Unsigned integer to check
+ *
+ * @retval  Counter
+ */
+static inline uint8 Bfx_CountTrailingZeros_u32( uint32 Data )
+{
+    return Bfx_CountOnes_u32( (uint32)( ( Data & (uint32)( 0u - Data ) ) - 1u ) );
 }
 
 /**
@@ -591,4 +673,399 @@ static inline uint32 Bfx_ShiftBitSat_u32s8_u32( sint8 ShiftCnt, uint32 Data )
         Data >>= ShiftCnt;
     }
     return Data;
-}
\ No newline at end of file
+}
+
+
+/**
+ * @defgroup Bfx_Registers Volatile register functions
+ *
+ * Variants of the functions above for memory mapped registers, the tag vu32 stands for a volatile
+ * uint32 register. Each function reads the register once, modifies a local copy with its non
+ * volatile counterpart and writes it back once, so the drivers do not need to cast volatile away
+ * and the compiler can not merge or drop the accesses at any optimization level.
+ *
+ * The Atomic variants do the same read-modify-write with the interrupts masked through PRIMASK,
+ * use them on registers also modified from an interrupt, like the GPIO output data register. The
+ * previous PRIMASK value is restored, so they are safe to call with the interrupts already masked.
+ *
+ * @{ */
+
+/**
+ * @brief   **Masks the interrupts**
+ *
+ * Saves PRIMASK and sets it to mask all the interrupts but NMI and HardFault.
+ *
+ * @retval  PRIMASK value before masking the interrupts
+ */
+static inline uint32 Bfx_EnterAtomic_u32( void )
+{
+#ifndef UTEST
+    uint32 PriMask;
+
+    __asm volatile( "mrs %0, primask\n\tcpsid i" : "=r"( PriMask ) : : "memory" );
+    return PriMask;
+#else
+    /*there are no interrupts to mask when running the unit tests on the host*/
+    return 0u;
+#endif
+}
+
+/**
+ * @brief   **Restores the interrupts mask**
+ *
+ * @param   PriMask PRIMASK value returned by Bfx_EnterAtomic_u32
+ */
+static inline void Bfx_ExitAtomic_u32( uint32 PriMask )
+{
+#ifndef UTEST
+    __asm volatile( "msr primask, %0" : : "r"( PriMask ) : "memory" );
+#else
+    (void)PriMask;
+#endif
+}
+
+/**
+ * @brief   **Set a single bit in a register**
+ *
+ * Same as Bfx_SetBit_u32u8 with a single read and a single write of Reg, the bit BitPn is set to
+ * ’1’.
+ *
+ * @param   Reg Register to modify
+ * @param   BitPn Number of bit to modify
+ */
+static inline void Bfx_SetBit_vu32u8( volatile uint32 *Reg, uint8 BitPn )
+{
+    uint32 Value = *Reg;
+
+    Bfx_SetBit_u32u8( &Value, BitPn );
+    *Reg = Value;
+}
+
+/**
+ * @brief   **Clears a single bit in a register**
+ *
+ * Same as Bfx_ClrBit_u32u8 with a single read and a single write of Reg, the bit BitPn is cleared
+ * to ’0’.
+ *
+ * @param   Reg Register to modify
+ * @param   BitPn Number of bit to modify
+ */
+static inline void Bfx_ClrBit_vu32u8( volatile uint32 *Reg, uint8 BitPn )
+{
+    uint32 Value = *Reg;
+
+    Bfx_ClrBit_u32u8( &Value, BitPn );
+    *Reg = Value;
+}
+
+/**
+ * @brief   **Puts a single bit in a register**
+ *
+ * Same as Bfx_PutBit_u32u8u8 with a single read and a single write of Reg, the bit BitPn takes the
+ * value of Status.
+ *
+ * @param   Reg Register to modify
+ * @param   BitPn Number of bit to modify
+ * @param   Status Value to put in the bit
+ */
+static inline void Bfx_PutBit_vu32u8u8( volatile uint32 *Reg, uint8 BitPn, boolean Status )
+{
+    uint32 Value = *Reg;
+
+    Bfx_PutBit_u32u8u8( &Value, BitPn, Status );
+    *Reg = Value;
+}
+
+/**
+ * @brief   **Modifies consecutive bits of a register**
+ *
+ * Same as Bfx_SetBits_u32u8u8u8 with a single read and a single write of Reg, the BitLn bits from
+ * BitStartPn are set or cleared as per Status.
+ *
+ * @param   Reg Register to modify
+ * @param   BitStartPn LSB to start
+ * @param   BitLn Lenght of the chain of bits
+ * @param   Status ’1’ to set the bits or ’0’ to clear them
+ */
+static inline void Bfx_SetBits_vu32u8u8u8( volatile uint32 *Reg, uint8 BitStartPn, uint8 BitLn, uint8 Status )
+{
+    uint32 Value = *Reg;
+
+    Bfx_SetBits_u32u8u8u8( &Value, BitStartPn, BitLn, Status );
+    *Reg = Value;
+}
+
+/**
+ * @brief   **Sets the bits of a register using a mask**
+ *
+ * Same as Bfx_SetBitMask_u32u32 with a single read and a single write of Reg, the bits set in Mask
+ * are set to ’1’.
+ *
+ * @param   Reg Register to modify
+ * @param   Mask Bits to set
+ */
+static inline void Bfx_SetBitMask_vu32u32( volatile uint32 *Reg, uint32 Mask )
+{
+    uint32 Value = *Reg;
+
+    Bfx_SetBitMask_u32u32( &Value, Mask );
+    *Reg = Value;
+}
+
+/**
+ * @brief   **Clears the bits of a register using a mask**
+ *
+ * Same as Bfx_ClrBitMask_u32u32 with a single read and a single write of Reg, the bits set in Mask
+ * are cleared to ’0’.
+ *
+ * @param   Reg Register to modify
+ * @param   Mask Bits to clear
+ */
+static inline void Bfx_ClrBitMask_vu32u32( volatile uint32 *Reg, uint32 Mask )
+{
+    uint32 Value = *Reg;
+
+    Bfx_ClrBitMask_u32u32( &Value, Mask );
+    *Reg = Value;
+}
+
+/**
+ * @brief   **Puts a pattern in a register**
+ *
+ * Same as Bfx_PutBits_u32u8u8u32 with a single read and a single write of Reg, the BitLn bits from
+ * BitStartPn take the value of Pattern.
+ *
+ * @param   Reg Register to modify
+ * @param   BitStartPn LSB to start
+ * @param   BitLn Lenght of the chain of bits
+ * @param   Pattern Pattern to partially copy
+ */
+static inline void Bfx_PutBits_vu32u8u8u32( volatile uint32 *Reg, uint8 BitStartPn, uint8 BitLn, uint32 Pattern )
+{
+    uint32 Value = *Reg;
+
+    Bfx_PutBits_u32u8u8u32( &Value, BitStartPn, BitLn, Pattern );
+    *Reg = Value;
+}
+
+/**
+ * @brief   **Puts a pattern in a register using a mask**
+ *
+ * Same as Bfx_PutBitsMask_u32u32u32 with a single read and a single write of Reg, the bits set in
+ * Mask take the value of Pattern.
+ *
+ * @param   Reg Register to modify
+ * @param   Pattern Pattern to partially copy
+ * @param   Mask Mask that indicates the bits to copy
+ */
+static inline void Bfx_PutBitsMask_vu32u32u32( volatile uint32 *Reg, uint32 Pattern, uint32 Mask )
+{
+    uint32 Value = *Reg;
+
+    Bfx_PutBitsMask_u32u32u32( &Value, Pattern, Mask );
+    *Reg = Value;
+}
+
+/**
+ * @brief   **Puts a list of fields in a register**
+ *
+ * Same as Bfx_PutFields_u32 with a single read and a single write of Reg, the fields of the list
+ * take its patterns.
+ *
+ * @param   Reg Register to modify
+ * @param   Fields List of fields to put
+ * @param   Count Number of fields in the list
+ */
+static inline void Bfx_PutFields_vu32( volatile uint32 *Reg, const Bfx_FieldType *Fields, uint8 Count )
+{
+    uint32 Value = *Reg;
+
+    Bfx_PutFields_u32( &Value, Fields, Count );
+    *Reg = Value;
+}
+
+/**
+ * @brief   **Writes a list of fields in a register**
+ *
+ * Same as Bfx_WriteFields_u32, Reg is written once and never read.
+ *
+ * @param   Reg Register to write
+ * @param   Fields List of fields to write
+ * @param   Count Number of fields in the list
+ */
+static inline void Bfx_WriteFields_vu32( volatile uint32 *Reg, const Bfx_FieldType *Fields, uint8 Count )
+{
+    uint32 Mask;
+
+    *Reg = Bfx_BuildFields_u32( Fields, Count, &Mask );
+}
+
+/**
+ * @brief   **Gets a single bit from a register**
+ *
+ * Same as Bfx_GetBit_u32u8_u8 with a single read of Reg.
+ *
+ * @param   Reg Register to read
+ * @param   BitPn Number of bit to read
+ *
+ * @retval  Value of the bit
+ */
+static inline boolean Bfx_GetBit_vu32u8_u8( const volatile uint32 *Reg, uint8 BitPn )
+{
+    return Bfx_GetBit_u32u8_u8( *Reg, BitPn );
+}
+
+/**
+ * @brief   **Gets consecutive bits from a register**
+ *
+ * Same as Bfx_GetBits_u32u8u8_u32 with a single read of Reg.
+ *
+ * @param   Reg Register to read
+ * @param   BitStartPn LSB to start
+ * @param   BitLn Lenght of the chain of bits
+ *
+ * @retval  Value of the bits
+ */
+static inline uint32 Bfx_GetBits_vu32u8u8_u32( const volatile uint32 *Reg, uint8 BitStartPn, uint8 BitLn )
+{
+    return Bfx_GetBits_u32u8u8_u32( *Reg, BitStartPn, BitLn );
+}
+
+/**
+ * @brief   **Set a single bit in a register with the interrupts masked**
+ *
+ * Same as Bfx_SetBit_vu32u8 but no interrupt can modify Reg between the read and the write.
+ *
+ * @param   Reg Register to modify
+ * @param   BitPn Number of bit to modify
+ */
+static inline void Bfx_SetBitAtomic_vu32u8( volatile uint32 *Reg, uint8 BitPn )
+{
+    uint32 PriMask = Bfx_EnterAtomic_u32( );
+
+    Bfx_SetBit_vu32u8( Reg, BitPn );
+    Bfx_ExitAtomic_u32( PriMask );
+}
+
+/**
+ * @brief   **Clears a single bit in a register with the interrupts masked**
+ *
+ * Same as Bfx_ClrBit_vu32u8 but no interrupt can modify Reg between the read and the write.
+ *
+ * @param   Reg Register to modify
+ * @param   BitPn Number of bit to modify
+ */
+static inline void Bfx_ClrBitAtomic_vu32u8( volatile uint32 *Reg, uint8 BitPn )
+{
+    uint32 PriMask = Bfx_EnterAtomic_u32( );
+
+    Bfx_ClrBit_vu32u8( Reg, BitPn );
+    Bfx_ExitAtomic_u32( PriMask );
+}
+
+/**
+ * @brief   **Puts a single bit in a register with the interrupts masked**
+ *
+ * Same as Bfx_PutBit_vu32u8u8 but no interrupt can modify Reg between the read and the write.
+ *
+ * @param   Reg Register to modify
+ * @param   BitPn Number of bit to modify
+ * @param   Status Value to put in the bit
+ */
+static inline void Bfx_PutBitAtomic_vu32u8u8( volatile uint32 *Reg, uint8 BitPn, boolean Status )
+{
+    uint32 PriMask = Bfx_EnterAtomic_u32( );
+
+    Bfx_PutBit_vu32u8u8( Reg, BitPn, Status );
+    Bfx_ExitAtomic_u32( PriMask );
+}
+
+/**
+ * @brief   **Sets the bits of a register using a mask with the interrupts masked**
+ *
+ * Same as Bfx_SetBitMask_vu32u32 but no interrupt can modify Reg between the read and the write.
+ *
+ * @param   Reg Register to modify
+ * @param   Mask Bits to set
+ */
+static inline void Bfx_SetBitMaskAtomic_vu32u32( volatile uint32 *Reg, uint32 Mask )
+{
+    uint32 PriMask = Bfx_EnterAtomic_u32( );
+
+    Bfx_SetBitMask_vu32u32( Reg, Mask );
+    Bfx_ExitAtomic_u32( PriMask );
+}
+
+/**
+ * @brief   **Clears the bits of a register using a mask with the interrupts masked**
+ *
+ * Same as Bfx_ClrBitMask_vu32u32 but no interrupt can modify Reg between the read and the write.
+ *
+ * @param   Reg Register to modify
+ * @param   Mask Bits to clear
+ */
+static inline void Bfx_ClrBitMaskAtomic_vu32u32( volatile uint32 *Reg, uint32 Mask )
+{
+    uint32 PriMask = Bfx_EnterAtomic_u32( );
+
+    Bfx_ClrBitMask_vu32u32( Reg, Mask );
+    Bfx_ExitAtomic_u32( PriMask );
+}
+
+/**
+ * @brief   **Puts a pattern in a register with the interrupts masked**
+ *
+ * Same as Bfx_PutBits_vu32u8u8u32 but no interrupt can modify Reg between the read and the write.
+ *
+ * @param   Reg Register to modify
+ * @param   BitStartPn LSB to start
+ * @param   BitLn Lenght of the chain of bits
+ * @param   Pattern Pattern to partially copy
+ */
+static inline void Bfx_PutBitsAtomic_vu32u8u8u32( volatile uint32 *Reg, uint8 BitStartPn, uint8 BitLn, uint32 Pattern )
+{
+    uint32 PriMask = Bfx_EnterAtomic_u32( );
+
+    Bfx_PutBits_vu32u8u8u32( Reg, BitStartPn, BitLn, Pattern );
+    Bfx_ExitAtomic_u32( PriMask );
+}
+
+/**
+ * @brief   **Puts a pattern in a register using a mask with the interrupts masked**
+ *
+ * Same as Bfx_PutBitsMask_vu32u32u32 but no interrupt can modify Reg between the read and the
+ * write.
+ *
+ * @param   Reg Register to modify
+ * @param   Pattern Pattern to partially copy
+ * @param   Mask Mask that indicates the bits to copy
+ */
+static inline void Bfx_PutBitsMaskAtomic_vu32u32u32( volatile uint32 *Reg, uint32 Pattern, uint32 Mask )
+{
+    uint32 PriMask = Bfx_EnterAtomic_u32( );
+
+    Bfx_PutBitsMask_vu32u32u32( Reg, Pattern, Mask );
+    Bfx_ExitAtomic_u32( PriMask );
+}
+
+/**
+ * @brief   **Puts a list of fields in a register with the interrupts masked**
+ *
+ * Same as Bfx_PutFields_vu32 but no interrupt can modify Reg between the read and the write.
+ *
+ * @param   Reg Register to modify
+ * @param   Fields List of fields to put
+ * @param   Count Number of fields in the list
+ */
+static inline void Bfx_PutFieldsAtomic_vu32( volatile uint32 *Reg, const Bfx_FieldType *Fields, uint8 Count )
+{
+    uint32 PriMask = Bfx_EnterAtomic_u32( );
+
+    Bfx_PutFields_vu32( Reg, Fields, Count );
+    Bfx_ExitAtomic_u32( PriMask );
+}
+
+/**
+ * @} */
+
+#endif /* BFX_32BITS_H__ */
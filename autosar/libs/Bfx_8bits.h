@@ -402,11 +402,53 @@ static inline void Bfx_PutBit_u8u8u8( uint8 *Data, uint8 BitPn, boolean Status )
     }
 }
 
+/**
+ * @brief   **Counts the ones**
+ *
+ * Count the number of bits set in Data (population count) adding the bits in parallel in
+ * groups of 2, 4 and 8 bits, it takes the same time for any value and has no branches, the
+ * count leading and trailing functions are built on top of it.
+ *
+ * @param   Data Unsigned integer to check
+ *
+ * @retval  Number of bits set
+ */
+static inline uint8 Bfx_CountOnes_u8( uint8 Data )
+{
+    uint8 Value = (uint8)( Data - ( ( Data >> 1u ) & 0x55u ) );
+
+    Value = (uint8)( ( Value & 0x33u ) + ( ( Value >> 2u ) & 0x33u ) );
+    return (uint8)( ( Value + ( Value >> 4u ) ) & 0x0Fu );
+}
+
+/**
+ * @brief   **Counts consecutive zeros**
+ *
+ * Count the number of consecutive zeros in Data starting with the most significant bit and return
+ * the result. The most significant one is copied over all the bits below it, so the leading zeros
+ * are the bits still cleared, constant time since the core has no count leading zeros instruction.
+ *
+ * @param   Data Unsigned integer to check
+ *
+ * @retval  Counter
+ *
+ * @reqs   SWS_Bfx_91005, SWS_Bfx_00141
+ */
+static inline uint8 Bfx_CountLeadingZeros_u8( uint8 Data )
+{
+    uint8 Value = Data;
+
+    Value |= Value >> 1u;
+    Value |= Value >> 2u;
+    Value |= Value >> 4u;
+    return (uint8)( 8u - Bfx_CountOnes_u8( Value ) );
+}
+
 /**
  * @brief   **Counts consecutive ones**
  *
  * Count the number of consecutive ones in Data starting with the most significant bit and return
- * the result.
+ * the result. It is the number of leading zeros of the inverted data, constant time.
  *
  * @param   Data Unsigned integer to check
  *
@@ -416,87 +458,45 @@ static inline void Bfx_PutBit_u8u8u8( uint8 *Data, uint8 BitPn, boolean Status )
  */
 static inline uint8 Bfx_CountLeadingOnes_u8( uint8 Data )
 {
-    uint8 Counter = 0;
-    for( uint8 i = 8; i > 0; i-- )
-    {
-        if( ( Data & ( 0x01 << ( i - 1 ) ) ) != 0 )
-        {
-            Counter++;
-        }
-        else
-        {
-            i = 1;
-        }
-    }
-    return Counter;
+    return Bfx_CountLeadingZeros_u8( (uint8)~Data );
 }
 
 /**
- * @brief   **Count consecutive bits which have the same value as the MSB**
+ * @brief   **Counts leading signs**
  *
  * Count the number of consecutive bits which have the same value as most significant bit in Data,
- * starting with bit at position msb minus one. Put the result in Data. It is the number of leading
- * sign bits minus one, giving the number of redundant sign bits in Data.
+ * starting with bit at position msb minus one. Put the result in Data. It is the number of
+ * leading sign bits minus one, giving the number of redundant sign bits in Data. The data is
+ * inverted when negative so the sign bits become leading zeros.
  *
- * @param   Data Signed integer to check
+ * @param   Data Signed integer to count from
  *
- * @retval  Data
+ * @retval  Counter
  *
  * @reqs   SWS_Bfx_91004, SWS_Bfx_00139
  */
 static inline uint8 Bfx_CountLeadingSigns_s8( sint8 Data )
 {
-    uint8 Count = 0;
-    uint8 Mask  = 0x80;
+    uint8 Value = (uint8)Data;
+    uint8 Sign  = (uint8)( 0u - ( Value >> 7u ) );
 
-    if( Data >= 0 )
-    {
-        while( ( Data & Mask ) == 0 )
-        {
-            Count++;
-            Mask >>= 1;
-        }
-    }
-    else
-    {
-        while( ( Data & Mask ) == Mask )
-        {
-            Count++;
-            Mask >>= 1;
-        }
-    }
-
-    Data = Count - 1;
-    return Data;
+    return (uint8)( Bfx_CountLeadingZeros_u8( (uint8)( Value ^ Sign ) ) - 1u );
 }
 
 /**
- * @brief   **Counts consecutive zeros**
+ * @brief   **Counts trailing zeros**
  *
- * Count the number of consecutive zeros in Data starting with the most significant bit and return
- * the result.
+ * Count the number of consecutive zeros in Data starting with the least significant bit and
+ * return the result, 8 when Data is zero. Clearing all bits but the lowest one and subtracting
+ * one leaves a mask with the trailing zeros set, constant time.
  *
  * @param   Data Unsigned integer to check
  *
  * @retval  Counter
- *
- * @reqs   SWS_Bfx_91005, SWS_Bfx_00141
  */
-static inline uint8 Bfx_CountLeadingZeros_u8( uint8 Data )
+static inline uint8 Bfx_CountTrailingZeros_u8( uint8 Data )
 {
-    uint8 Counter = 0;
-    for( uint8 i = 8; i > 0; i-- )
-    {
-        if( ( Data & ( 0x01 << ( i - 1 ) ) ) != 0 )
-        {
-            i = 1;
-        }
-        else
-        {
-            Counter++;
-        }
-    }
-    return Counter;
+    return Bfx_CountOnes_u8( (uint8)( ( Data & (uint8)( 0u - Data ) ) - 1u ) );
 }
 
 /**
@@ -10,12 +10,27 @@
  * • CRC32P4: CRC32 0xF4ACFB13 polynomial
  * • CRC64: CRC-64-ECMA
  *
- * This library was designed like a Runtime calculation:
- * Slower execution, but small code size (no ROM table)
+ * Each routine can be calculated at runtime (slower execution, but small code size, no ROM
+ * table), using a 16 entries nibble table (a few bytes of ROM, around 4 times faster than
+ * runtime) or using a 256 entries lookup table (faster execution, bigger code size), CRC32,
+ * CRC32P4 and CRC64 can also use slicing by 4 tables for bulk buffers, and CRC8, CRC8H2F, CRC16
+ * and CRC32 can be calculated by the crc hardware unit, the method is selected per polynomial in
+ * Crc_Cfg.h. The CRC64 register is kept in two 32 bits halves with its tables split the same
+ * way, since the core has no 64 bits shifts, and CRC32P4 with the 256 entries table reads the
+ * aligned data one word at a time.
  */
 
 #include "Std_Types.h"
 #include "Crc.h"
+#include "Crc_Arch.h"
+#include "Bfx_32bits.h"
+
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Crc_Cfg.h */
+#if CRC_RAM_FUNCTIONS == STD_ON
+#define CRC_RAMFUNC RAMFUNC /*!< Hot functions executed from RAM */
+#else
+#define CRC_RAMFUNC /*!< Hot functions executed from flash */
+#endif
 
 /**
   * @defgroup Values_CRC8_SAEJ1850 this defines are values for the calculation of CRC with 8 bits
@@ -60,6 +75,7 @@
   * @defgroup Values_CRC32 this defines are values for the calculation of CRC with 16 bits and data reflected
   @{ */
 #define CRC_32BIT_POLYNOMIAL_REFLECTED    (uint32)0xEDB88320u /*!< Polynomial of CRC32 */
+#define CRC_32BIT_POLYNOMIAL              (uint32)0x04C11DB7u /*!< Polynomial of CRC32 not reflected */
 #define CRC_32BIT_XORVALUE                0xFFFFFFFFu         /*!< Value of CRC if is first call */
 #define CRC_32BIT_LSB                     0x00000001u         /*!< Less significant bit */
 /**
@@ -80,6 +96,13 @@
 #define CRC_CRC64_POLYNOMIAL_REFLECTED    (uint64)0xC96C5795D7870F42UL /*!< Polynomial of CRC64 */
 #define CRC_64BIT_XORVALUE                0xFFFFFFFFFFFFFFFFUL         /*!< Value of CRC if is first call */
 #define CRC_64BIT_LSB                     0x0000000000000001UL         /*!< Less significant bit */
+#define CRC_64BIT_POLYNOMIAL_LOW          0xD7870F42u                  /*!< Low half of the CRC64 reflected polynomial */
+#define CRC_64BIT_POLYNOMIAL_HIGH         0xC96C5795u                  /*!< High half of the CRC64 reflected polynomial */
+#define CRC_64BIT_HALF_LSB                0x00000001u                  /*!< Less significant bit of the low half */
+#define CRC_64BIT_HALF_BITS               32u                          /*!< Number of bits on each half of the crc register */
+#define CRC_64_HALVES                     2u                           /*!< Number of halves on each split table entry */
+#define CRC_64_LOW                        0u                           /*!< Index of the low half on the split tables */
+#define CRC_64_HIGH                       1u                           /*!< Index of the high half on the split tables */
 /**
   @} */
 
@@ -94,6 +117,1523 @@
 /**
   @} */
 
+/**
+  * @defgroup CRC_Table_Values this defines are values for the table driven calculation
+  @{ */
+#define CRC_TABLE_SIZE                    256u  /*!< Number of entries on each lookup table */
+#define CRC_TABLE_INDEX_MASK              0xFFu /*!< Mask to obtain the table index from the crc */
+#define CRC_TABLE_BYTE_SHIFT              8u    /*!< Number of bits processed on each table access */
+/**
+  @} */
+
+/**
+  * @defgroup CRC_Nibble_Values this defines are values for the nibble table driven calculation
+  @{ */
+#define CRC_NIBBLE_TABLE_SIZE             16u   /*!< Number of entries on each nibble lookup table */
+#define CRC_NIBBLE_INDEX_MASK             0x0Fu /*!< Mask to obtain the nibble table index from the crc */
+#define CRC_NIBBLE_SHIFT                  4u    /*!< Number of bits processed on each nibble table access */
+#define CRC8_NIBBLE_INDEX_SHIFT           4u    /*!< Shift to obtain the upper nibble of a 8 bits crc */
+#define CRC16_NIBBLE_INDEX_SHIFT          12u   /*!< Shift to obtain the upper nibble of a 16 bits crc */
+/**
+  @} */
+
+/**
+  * @defgroup CRC_Slice4_Values this defines are values for the slicing by 4 calculation
+  @{ */
+#define CRC_SLICE4_TABLES                 4u    /*!< Number of tables, one per byte of a word */
+#define CRC_SLICE4_MIN_LENGTH             16u   /*!< Shorter buffers are processed byte wise */
+#define CRC_WORD_SIZE                     4u    /*!< Number of bytes on a word */
+#define CRC_WORD_ALIGN_MASK               3u    /*!< Mask to know if an address is word aligned */
+#define CRC_WORD_BYTE1_SHIFT              8u    /*!< Shift to obtain the second byte of a word */
+#define CRC_WORD_BYTE2_SHIFT              16u   /*!< Shift to obtain the third byte of a word */
+#define CRC_WORD_BYTE3_SHIFT              24u   /*!< Shift to obtain the fourth byte of a word */
+/**
+  @} */
+
+/**
+  * @defgroup CRC_Combine_Values this defines are values for the combination of two crcs
+  @{ */
+#define CRC_32BIT_X0                      0x80000000u          /*!< Polynomial 1 (x^0) on reflected 32 bits representation */
+#define CRC_32BIT_X8                      0x00800000u          /*!< Polynomial x^8 (one byte) on reflected 32 bits representation */
+#define CRC_64BIT_X0                      0x8000000000000000UL /*!< Polynomial 1 (x^0) on reflected 64 bits representation */
+#define CRC_64BIT_X8                      0x0080000000000000UL /*!< Polynomial x^8 (one byte) on reflected 64 bits representation */
+/**
+  @} */
+
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Crc_Cfg.h */
+#if CRC_8_MODE == CRC_HARDWARE
+/**
+ * @brief  Crc unit configuration for CRC8 SAE-J1850
+ */
+/* clang-format off */
+static const Crc_Arch_ConfigType Crc_Hw8 =
+{
+    .Polynomial = CRC8_SAEJ1850_POLYNOMIAL,
+    .PolySize   = CRC_ARCH_POLYSIZE_8,
+    .Width      = 8u,
+    .Reflected  = FALSE
+};
+/* clang-format on */
+#endif
+
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Crc_Cfg.h */
+#if CRC_8H2F_MODE == CRC_HARDWARE
+/**
+ * @brief  Crc unit configuration for CRC8H2F
+ */
+/* clang-format off */
+static const Crc_Arch_ConfigType Crc_Hw8H2F =
+{
+    .Polynomial = CRC8H2F_POLYNOMIAL,
+    .PolySize   = CRC_ARCH_POLYSIZE_8,
+    .Width      = 8u,
+    .Reflected  = FALSE
+};
+/* clang-format on */
+#endif
+
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Crc_Cfg.h */
+#if CRC_16_MODE == CRC_HARDWARE
+/**
+ * @brief  Crc unit configuration for CRC16 CCITT
+ */
+/* clang-format off */
+static const Crc_Arch_ConfigType Crc_Hw16 =
+{
+    .Polynomial = CRC16_POLYNOMIAL,
+    .PolySize   = CRC_ARCH_POLYSIZE_16,
+    .Width      = 16u,
+    .Reflected  = FALSE
+};
+/* clang-format on */
+#endif
+
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Crc_Cfg.h */
+#if ( CRC_32_MODE == CRC_HARDWARE ) || ( CRC_REGION_API == STD_ON )
+/**
+ * @brief  Crc unit configuration for CRC32
+ */
+/* clang-format off */
+static const Crc_Arch_ConfigType Crc_Hw32 =
+{
+    .Polynomial = CRC_32BIT_POLYNOMIAL,
+    .PolySize   = CRC_ARCH_POLYSIZE_32,
+    .Width      = 32u,
+    .Reflected  = TRUE
+};
+/* clang-format on */
+#endif
+
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Crc_Cfg.h */
+#if CRC_REGION_API == STD_ON
+/**
+ * @defgroup CRC_Region_Values this defines are values for the region calculation
+  @{ */
+#define CRC_REGION_MIN_LENGTH             64u /*!< Shorter regions are calculated right away by the cpu */
+/**
+  @} */
+
+/**
+ * @brief  State of the region calculation
+ */
+/* cppcheck-suppress misra-c2012-8.4 ; qualifier is declared only for testing purposes */
+CRC_STATIC volatile Crc_RegionStateType Crc_RegionState = CRC_REGION_IDLE;
+
+/**
+ * @brief  Crc of the last region calculated
+ */
+/* cppcheck-suppress misra-c2012-8.4 ; qualifier is declared only for testing purposes */
+CRC_STATIC uint32 Crc_RegionResult = 0u;
+
+/**
+ * @brief  Notification to call when the region calculation finishes
+ */
+/* cppcheck-suppress misra-c2012-8.4 ; qualifier is declared only for testing purposes */
+CRC_STATIC Crc_RegionCallbackType Crc_RegionCallback = NULL_PTR;
+#endif
+
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Crc_Cfg.h */
+#if ( CRC_32_MODE == CRC_SLICE4 ) || ( CRC_32P4_MODE == CRC_SLICE4 )
+static uint32 Crc_Slice4Reflected32( const uint32 Table[ CRC_SLICE4_TABLES ][ CRC_TABLE_SIZE ], const uint8 *Crc_DataPtr, uint32 Crc_Length, uint32 Crc_Value );
+#endif
+
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Crc_Cfg.h */
+#if CRC_32P4_MODE == CRC_TABLE
+static uint32 Crc_WordReflected32( const uint32 Table[ CRC_TABLE_SIZE ], const uint8 *Crc_DataPtr, uint32 Crc_Length, uint32 Crc_Value );
+#endif
+
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Crc_Cfg.h */
+#if CRC_64_MODE == CRC_SLICE4
+static void Crc_Slice4Reflected64( const uint8 *Crc_DataPtr, uint32 Crc_Length, uint32 *Crc_Low, uint32 *Crc_High );
+#endif
+
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Crc_Cfg.h */
+#if CRC_8_MODE == CRC_TABLE
+/**
+ * @brief  Lookup table for CRC8 SAE-J1850, polynomial 0x1D
+ */
+/* clang-format off */
+static const uint8 Crc_Table8[ CRC_TABLE_SIZE ] =
+{
+    0x00u, 0x1Du, 0x3Au, 0x27u, 0x74u, 0x69u, 0x4Eu, 0x53u, 0xE8u, 0xF5u, 0xD2u, 0xCFu, 0x9Cu, 0x81u, 0xA6u, 0xBBu,
+    0xCDu, 0xD0u, 0xF7u, 0xEAu, 0xB9u, 0xA4u, 0x83u, 0x9Eu, 0x25u, 0x38u, 0x1Fu, 0x02u, 0x51u, 0x4Cu, 0x6Bu, 0x76u,
+    0x87u, 0x9Au, 0xBDu, 0xA0u, 0xF3u, 0xEEu, 0xC9u, 0xD4u, 0x6Fu, 0x72u, 0x55u, 0x48u, 0x1Bu, 0x06u, 0x21u, 0x3Cu,
+    0x4Au, 0x57u, 0x70u, 0x6Du, 0x3Eu, 0x23u, 0x04u, 0x19u, 0xA2u, 0xBFu, 0x98u, 0x85u, 0xD6u, 0xCBu, 0xECu, 0xF1u,
+    0x13u, 0x0Eu, 0x29u, 0x34u, 0x67u, 0x7Au, 0x5Du, 0x40u, 0xFBu, 0xE6u, 0xC1u, 0xDCu, 0x8Fu, 0x92u, 0xB5u, 0xA8u,
+    0xDEu, 0xC3u, 0xE4u, 0xF9u, 0xAAu, 0xB7u, 0x90u, 0x8Du, 0x36u, 0x2Bu, 0x0Cu, 0x11u, 0x42u, 0x5Fu, 0x78u, 0x65u,
+    0x94u, 0x89u, 0xAEu, 0xB3u, 0xE0u, 0xFDu, 0xDAu, 0xC7u, 0x7Cu, 0x61u, 0x46u, 0x5Bu, 0x08u, 0x15u, 0x32u, 0x2Fu,
+    0x59u, 0x44u, 0x63u, 0x7Eu, 0x2Du, 0x30u, 0x17u, 0x0Au, 0xB1u, 0xACu, 0x8Bu, 0x96u, 0xC5u, 0xD8u, 0xFFu, 0xE2u,
+    0x26u, 0x3Bu, 0x1Cu, 0x01u, 0x52u, 0x4Fu, 0x68u, 0x75u, 0xCEu, 0xD3u, 0xF4u, 0xE9u, 0xBAu, 0xA7u, 0x80u, 0x9Du,
+    0xEBu, 0xF6u, 0xD1u, 0xCCu, 0x9Fu, 0x82u, 0xA5u, 0xB8u, 0x03u, 0x1Eu, 0x39u, 0x24u, 0x77u, 0x6Au, 0x4Du, 0x50u,
+    0xA1u, 0xBCu, 0x9Bu, 0x86u, 0xD5u, 0xC8u, 0xEFu, 0xF2u, 0x49u, 0x54u, 0x73u, 0x6Eu, 0x3Du, 0x20u, 0x07u, 0x1Au,
+    0x6Cu, 0x71u, 0x56u, 0x4Bu, 0x18u, 0x05u, 0x22u, 0x3Fu, 0x84u, 0x99u, 0xBEu, 0xA3u, 0xF0u, 0xEDu, 0xCAu, 0xD7u,
+    0x35u, 0x28u, 0x0Fu, 0x12u, 0x41u, 0x5Cu, 0x7Bu, 0x66u, 0xDDu, 0xC0u, 0xE7u, 0xFAu, 0xA9u, 0xB4u, 0x93u, 0x8Eu,
+    0xF8u, 0xE5u, 0xC2u, 0xDFu, 0x8Cu, 0x91u, 0xB6u, 0xABu, 0x10u, 0x0Du, 0x2Au, 0x37u, 0x64u, 0x79u, 0x5Eu, 0x43u,
+    0xB2u, 0xAFu, 0x88u, 0x95u, 0xC6u, 0xDBu, 0xFCu, 0xE1u, 0x5Au, 0x47u, 0x60u, 0x7Du, 0x2Eu, 0x33u, 0x14u, 0x09u,
+    0x7Fu, 0x62u, 0x45u, 0x58u, 0x0Bu, 0x16u, 0x31u, 0x2Cu, 0x97u, 0x8Au, 0xADu, 0xB0u, 0xE3u, 0xFEu, 0xD9u, 0xC4u
+};
+/* clang-format on */
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Crc_Cfg.h */
+#elif CRC_8_MODE == CRC_NIBBLE
+/**
+ * @brief  Nibble lookup table for CRC8 SAE-J1850, polynomial 0x1D
+ */
+/* clang-format off */
+static const uint8 Crc_Nibble8[ CRC_NIBBLE_TABLE_SIZE ] =
+{
+    0x00u, 0x1Du, 0x3Au, 0x27u, 0x74u, 0x69u, 0x4Eu, 0x53u, 0xE8u, 0xF5u, 0xD2u, 0xCFu, 0x9Cu, 0x81u, 0xA6u, 0xBBu
+};
+/* clang-format on */
+#endif
+
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Crc_Cfg.h */
+#if CRC_8H2F_MODE == CRC_TABLE
+/**
+ * @brief  Lookup table for CRC8H2F, polynomial 0x2F
+ */
+/* clang-format off */
+static const uint8 Crc_Table8H2F[ CRC_TABLE_SIZE ] =
+{
+    0x00u, 0x2Fu, 0x5Eu, 0x71u, 0xBCu, 0x93u, 0xE2u, 0xCDu, 0x57u, 0x78u, 0x09u, 0x26u, 0xEBu, 0xC4u, 0xB5u, 0x9Au,
+    0xAEu, 0x81u, 0xF0u, 0xDFu, 0x12u, 0x3Du, 0x4Cu, 0x63u, 0xF9u, 0xD6u, 0xA7u, 0x88u, 0x45u, 0x6Au, 0x1Bu, 0x34u,
+    0x73u, 0x5Cu, 0x2Du, 0x02u, 0xCFu, 0xE0u, 0x91u, 0xBEu, 0x24u, 0x0Bu, 0x7Au, 0x55u, 0x98u, 0xB7u, 0xC6u, 0xE9u,
+    0xDDu, 0xF2u, 0x83u, 0xACu, 0x61u, 0x4Eu, 0x3Fu, 0x10u, 0x8Au, 0xA5u, 0xD4u, 0xFBu, 0x36u, 0x19u, 0x68u, 0x47u,
+    0xE6u, 0xC9u, 0xB8u, 0x97u, 0x5Au, 0x75u, 0x04u, 0x2Bu, 0xB1u, 0x9Eu, 0xEFu, 0xC0u, 0x0Du, 0x22u, 0x53u, 0x7Cu,
+    0x48u, 0x67u, 0x16u, 0x39u, 0xF4u, 0xDBu, 0xAAu, 0x85u, 0x1Fu, 0x30u, 0x41u, 0x6Eu, 0xA3u, 0x8Cu, 0xFDu, 0xD2u,
+    0x95u, 0xBAu, 0xCBu, 0xE4u, 0x29u, 0x06u, 0x77u, 0x58u, 0xC2u, 0xEDu, 0x9Cu, 0xB3u, 0x7Eu, 0x51u, 0x20u, 0x0Fu,
+    0x3Bu, 0x14u, 0x65u, 0x4Au, 0x87u, 0xA8u, 0xD9u, 0xF6u, 0x6Cu, 0x43u, 0x32u, 0x1Du, 0xD0u, 0xFFu, 0x8Eu, 0xA1u,
+    0xE3u, 0xCCu, 0xBDu, 0x92u, 0x5Fu, 0x70u, 0x01u, 0x2Eu, 0xB4u, 0x9Bu, 0xEAu, 0xC5u, 0x08u, 0x27u, 0x56u, 0x79u,
+    0x4Du, 0x62u, 0x13u, 0x3Cu, 0xF1u, 0xDEu, 0xAFu, 0x80u, 0x1Au, 0x35u, 0x44u, 0x6Bu, 0xA6u, 0x89u, 0xF8u, 0xD7u,
+    0x90u, 0xBFu, 0xCEu, 0xE1u, 0x2Cu, 0x03u, 0x72u, 0x5Du, 0xC7u, 0xE8u, 0x99u, 0xB6u, 0x7Bu, 0x54u, 0x25u, 0x0Au,
+    0x3Eu, 0x11u, 0x60u, 0x4Fu, 0x82u, 0xADu, 0xDCu, 0xF3u, 0x69u, 0x46u, 0x37u, 0x18u, 0xD5u, 0xFAu, 0x8Bu, 0xA4u,
+    0x05u, 0x2Au, 0x5Bu, 0x74u, 0xB9u, 0x96u, 0xE7u, 0xC8u, 0x52u, 0x7Du, 0x0Cu, 0x23u, 0xEEu, 0xC1u, 0xB0u, 0x9Fu,
+    0xABu, 0x84u, 0xF5u, 0xDAu, 0x17u, 0x38u, 0x49u, 0x66u, 0xFCu, 0xD3u, 0xA2u, 0x8Du, 0x40u, 0x6Fu, 0x1Eu, 0x31u,
+    0x76u, 0x59u, 0x28u, 0x07u, 0xCAu, 0xE5u, 0x94u, 0xBBu, 0x21u, 0x0Eu, 0x7Fu, 0x50u, 0x9Du, 0xB2u, 0xC3u, 0xECu,
+    0xD8u, 0xF7u, 0x86u, 0xA9u, 0x64u, 0x4Bu, 0x3Au, 0x15u, 0x8Fu, 0xA0u, 0xD1u, 0xFEu, 0x33u, 0x1Cu, 0x6Du, 0x42u
+};
+/* clang-format on */
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Crc_Cfg.h */
+#elif CRC_8H2F_MODE == CRC_NIBBLE
+/**
+ * @brief  Nibble lookup table for CRC8H2F, polynomial 0x2F
+ */
+/* clang-format off */
+static const uint8 Crc_Nibble8H2F[ CRC_NIBBLE_TABLE_SIZE ] =
+{
+    0x00u, 0x2Fu, 0x5Eu, 0x71u, 0xBCu, 0x93u, 0xE2u, 0xCDu, 0x57u, 0x78u, 0x09u, 0x26u, 0xEBu, 0xC4u, 0xB5u, 0x9Au
+};
+/* clang-format on */
+#endif
+
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Crc_Cfg.h */
+#if CRC_16_MODE == CRC_TABLE
+/**
+ * @brief  Lookup table for CRC16 CCITT, polynomial 0x1021
+ */
+/* clang-format off */
+static const uint16 Crc_Table16[ CRC_TABLE_SIZE ] =
+{
+    0x0000u, 0x1021u, 0x2042u, 0x3063u, 0x4084u, 0x50A5u, 0x60C6u, 0x70E7u,
+    0x8108u, 0x9129u, 0xA14Au, 0xB16Bu, 0xC18Cu, 0xD1ADu, 0xE1CEu, 0xF1EFu,
+    0x1231u, 0x0210u, 0x3273u, 0x2252u, 0x52B5u, 0x4294u, 0x72F7u, 0x62D6u,
+    0x9339u, 0x8318u, 0xB37Bu, 0xA35Au, 0xD3BDu, 0xC39Cu, 0xF3FFu, 0xE3DEu,
+    0x2462u, 0x3443u, 0x0420u, 0x1401u, 0x64E6u, 0x74C7u, 0x44A4u, 0x5485u,
+    0xA56Au, 0xB54Bu, 0x8528u, 0x9509u, 0xE5EEu, 0xF5CFu, 0xC5ACu, 0xD58Du,
+    0x3653u, 0x2672u, 0x1611u, 0x0630u, 0x76D7u, 0x66F6u, 0x5695u, 0x46B4u,
+    0xB75Bu, 0xA77Au, 0x9719u, 0x8738u, 0xF7DFu, 0xE7FEu, 0xD79Du, 0xC7BCu,
+    0x48C4u, 0x58E5u, 0x6886u, 0x78A7u, 0x0840u, 0x1861u, 0x2802u, 0x3823u,
+    0xC9CCu, 0xD9EDu, 0xE98Eu, 0xF9AFu, 0x8948u, 0x9969u, 0xA90Au, 0xB92Bu,
+    0x5AF5u, 0x4AD4u, 0x7AB7u, 0x6A96u, 0x1A71u, 0x0A50u, 0x3A33u, 0x2A12u,
+    0xDBFDu, 0xCBDCu, 0xFBBFu, 0xEB9Eu, 0x9B79u, 0x8B58u, 0xBB3Bu, 0xAB1Au,
+    0x6CA6u, 0x7C87u, 0x4CE4u, 0x5CC5u, 0x2C22u, 0x3C03u, 0x0C60u, 0x1C41u,
+    0xEDAEu, 0xFD8Fu, 0xCDECu, 0xDDCDu, 0xAD2Au, 0xBD0Bu, 0x8D68u, 0x9D49u,
+    0x7E97u, 0x6EB6u, 0x5ED5u, 0x4EF4u, 0x3E13u, 0x2E32u, 0x1E51u, 0x0E70u,
+    0xFF9Fu, 0xEFBEu, 0xDFDDu, 0xCFFCu, 0xBF1Bu, 0xAF3Au, 0x9F59u, 0x8F78u,
+    0x9188u, 0x81A9u, 0xB1CAu, 0xA1EBu, 0xD10Cu, 0xC12Du, 0xF14Eu, 0xE16Fu,
+    0x1080u, 0x00A1u, 0x30C2u, 0x20E3u, 0x5004u, 0x4025u, 0x7046u, 0x6067u,
+    0x83B9u, 0x9398u, 0xA3FBu, 0xB3DAu, 0xC33Du, 0xD31Cu, 0xE37Fu, 0xF35Eu,
+    0x02B1u, 0x1290u, 0x22F3u, 0x32D2u, 0x4235u, 0x5214u, 0x6277u, 0x7256u,
+    0xB5EAu, 0xA5CBu, 0x95A8u, 0x8589u, 0xF56Eu, 0xE54Fu, 0xD52Cu, 0xC50Du,
+    0x34E2u, 0x24C3u, 0x14A0u, 0x0481u, 0x7466u, 0x6447u, 0x5424u, 0x4405u,
+    0xA7DBu, 0xB7FAu, 0x8799u, 0x97B8u, 0xE75Fu, 0xF77Eu, 0xC71Du, 0xD73Cu,
+    0x26D3u, 0x36F2u, 0x0691u, 0x16B0u, 0x6657u, 0x7676u, 0x4615u, 0x5634u,
+    0xD94Cu, 0xC96Du, 0xF90Eu, 0xE92Fu, 0x99C8u, 0x89E9u, 0xB98Au, 0xA9ABu,
+    0x5844u, 0x4865u, 0x7806u, 0x6827u, 0x18C0u, 0x08E1u, 0x3882u, 0x28A3u,
+    0xCB7Du, 0xDB5Cu, 0xEB3Fu, 0xFB1Eu, 0x8BF9u, 0x9BD8u, 0xABBBu, 0xBB9Au,
+    0x4A75u, 0x5A54u, 0x6A37u, 0x7A16u, 0x0AF1u, 0x1AD0u, 0x2AB3u, 0x3A92u,
+    0xFD2Eu, 0xED0Fu, 0xDD6Cu, 0xCD4Du, 0xBDAAu, 0xAD8Bu, 0x9DE8u, 0x8DC9u,
+    0x7C26u, 0x6C07u, 0x5C64u, 0x4C45u, 0x3CA2u, 0x2C83u, 0x1CE0u, 0x0CC1u,
+    0xEF1Fu, 0xFF3Eu, 0xCF5Du, 0xDF7Cu, 0xAF9Bu, 0xBFBAu, 0x8FD9u, 0x9FF8u,
+    0x6E17u, 0x7E36u, 0x4E55u, 0x5E74u, 0x2E93u, 0x3EB2u, 0x0ED1u, 0x1EF0u
+};
+/* clang-format on */
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Crc_Cfg.h */
+#elif CRC_16_MODE == CRC_NIBBLE
+/**
+ * @brief  Nibble lookup table for CRC16 CCITT, polynomial 0x1021
+ */
+/* clang-format off */
+static const uint16 Crc_Nibble16[ CRC_NIBBLE_TABLE_SIZE ] =
+{
+    0x0000u, 0x1021u, 0x2042u, 0x3063u, 0x4084u, 0x50A5u, 0x60C6u, 0x70E7u,
+    0x8108u, 0x9129u, 0xA14Au, 0xB16Bu, 0xC18Cu, 0xD1ADu, 0xE1CEu, 0xF1EFu
+};
+/* clang-format on */
+#endif
+
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Crc_Cfg.h */
+#if CRC_16ARC_MODE == CRC_TABLE
+/**
+ * @brief  Lookup table for CRC16 ARC, reflected polynomial 0xA001
+ */
+/* clang-format off */
+static const uint16 Crc_Table16ARC[ CRC_TABLE_SIZE ] =
+{
+    0x0000u, 0xC0C1u, 0xC181u, 0x0140u, 0xC301u, 0x03C0u, 0x0280u, 0xC241u,
+    0xC601u, 0x06C0u, 0x0780u, 0xC741u, 0x0500u, 0xC5C1u, 0xC481u, 0x0440u,
+    0xCC01u, 0x0CC0u, 0x0D80u, 0xCD41u, 0x0F00u, 0xCFC1u, 0xCE81u, 0x0E40u,
+    0x0A00u, 0xCAC1u, 0xCB81u, 0x0B40u, 0xC901u, 0x09C0u, 0x0880u, 0xC841u,
+    0xD801u, 0x18C0u, 0x1980u, 0xD941u, 0x1B00u, 0xDBC1u, 0xDA81u, 0x1A40u,
+    0x1E00u, 0xDEC1u, 0xDF81u, 0x1F40u, 0xDD01u, 0x1DC0u, 0x1C80u, 0xDC41u,
+    0x1400u, 0xD4C1u, 0xD581u, 0x1540u, 0xD701u, 0x17C0u, 0x1680u, 0xD641u,
+    0xD201u, 0x12C0u, 0x1380u, 0xD341u, 0x1100u, 0xD1C1u, 0xD081u, 0x1040u,
+    0xF001u, 0x30C0u, 0x3180u, 0xF141u, 0x3300u, 0xF3C1u, 0xF281u, 0x3240u,
+    0x3600u, 0xF6C1u, 0xF781u, 0x3740u, 0xF501u, 0x35C0u, 0x3480u, 0xF441u,
+    0x3C00u, 0xFCC1u, 0xFD81u, 0x3D40u, 0xFF01u, 0x3FC0u, 0x3E80u, 0xFE41u,
+    0xFA01u, 0x3AC0u, 0x3B80u, 0xFB41u, 0x3900u, 0xF9C1u, 0xF881u, 0x3840u,
+    0x2800u, 0xE8C1u, 0xE981u, 0x2940u, 0xEB01u, 0x2BC0u, 0x2A80u, 0xEA41u,
+    0xEE01u, 0x2EC0u, 0x2F80u, 0xEF41u, 0x2D00u, 0xEDC1u, 0xEC81u, 0x2C40u,
+    0xE401u, 0x24C0u, 0x2580u, 0xE541u, 0x2700u, 0xE7C1u, 0xE681u, 0x2640u,
+    0x2200u, 0xE2C1u, 0xE381u, 0x2340u, 0xE101u, 0x21C0u, 0x2080u, 0xE041u,
+    0xA001u, 0x60C0u, 0x6180u, 0xA141u, 0x6300u, 0xA3C1u, 0xA281u, 0x6240u,
+    0x6600u, 0xA6C1u, 0xA781u, 0x6740u, 0xA501u, 0x65C0u, 0x6480u, 0xA441u,
+    0x6C00u, 0xACC1u, 0xAD81u, 0x6D40u, 0xAF01u, 0x6FC0u, 0x6E80u, 0xAE41u,
+    0xAA01u, 0x6AC0u, 0x6B80u, 0xAB41u, 0x6900u, 0xA9C1u, 0xA881u, 0x6840u,
+    0x7800u, 0xB8C1u, 0xB981u, 0x7940u, 0xBB01u, 0x7BC0u, 0x7A80u, 0xBA41u,
+    0xBE01u, 0x7EC0u, 0x7F80u, 0xBF41u, 0x7D00u, 0xBDC1u, 0xBC81u, 0x7C40u,
+    0xB401u, 0x74C0u, 0x7580u, 0xB541u, 0x7700u, 0xB7C1u, 0xB681u, 0x7640u,
+    0x7200u, 0xB2C1u, 0xB381u, 0x7340u, 0xB101u, 0x71C0u, 0x7080u, 0xB041u,
+    0x5000u, 0x90C1u, 0x9181u, 0x5140u, 0x9301u, 0x53C0u, 0x5280u, 0x9241u,
+    0x9601u, 0x56C0u, 0x5780u, 0x9741u, 0x5500u, 0x95C1u, 0x9481u, 0x5440u,
+    0x9C01u, 0x5CC0u, 0x5D80u, 0x9D41u, 0x5F00u, 0x9FC1u, 0x9E81u, 0x5E40u,
+    0x5A00u, 0x9AC1u, 0x9B81u, 0x5B40u, 0x9901u, 0x59C0u, 0x5880u, 0x9841u,
+    0x8801u, 0x48C0u, 0x4980u, 0x8941u, 0x4B00u, 0x8BC1u, 0x8A81u, 0x4A40u,
+    0x4E00u, 0x8EC1u, 0x8F81u, 0x4F40u, 0x8D01u, 0x4DC0u, 0x4C80u, 0x8C41u,
+    0x4400u, 0x84C1u, 0x8581u, 0x4540u, 0x8701u, 0x47C0u, 0x4680u, 0x8641u,
+    0x8201u, 0x42C0u, 0x4380u, 0x8341u, 0x4100u, 0x81C1u, 0x8081u, 0x4040u
+};
+/* clang-format on */
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Crc_Cfg.h */
+#elif CRC_16ARC_MODE == CRC_NIBBLE
+/**
+ * @brief  Nibble lookup table for CRC16 ARC, reflected polynomial 0xA001
+ */
+/* clang-format off */
+static const uint16 Crc_Nibble16ARC[ CRC_NIBBLE_TABLE_SIZE ] =
+{
+    0x0000u, 0xCC01u, 0xD801u, 0x1400u, 0xF001u, 0x3C00u, 0x2800u, 0xE401u,
+    0xA001u, 0x6C00u, 0x7800u, 0xB401u, 0x5000u, 0x9C01u, 0x8801u, 0x4400u
+};
+/* clang-format on */
+#endif
+
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Crc_Cfg.h */
+#if CRC_32_MODE == CRC_TABLE
+/**
+ * @brief  Lookup table for CRC32, reflected polynomial 0xEDB88320
+ */
+/* clang-format off */
+static const uint32 Crc_Table32[ CRC_TABLE_SIZE ] =
+{
+    0x00000000u, 0x77073096u, 0xEE0E612Cu, 0x990951BAu, 0x076DC419u, 0x706AF48Fu,
+    0xE963A535u, 0x9E6495A3u, 0x0EDB8832u, 0x79DCB8A4u, 0xE0D5E91Eu, 0x97D2D988u,
+    0x09B64C2Bu, 0x7EB17CBDu, 0xE7B82D07u, 0x90BF1D91u, 0x1DB71064u, 0x6AB020F2u,
+    0xF3B97148u, 0x84BE41DEu, 0x1ADAD47Du, 0x6DDDE4EBu, 0xF4D4B551u, 0x83D385C7u,
+    0x136C9856u, 0x646BA8C0u, 0xFD62F97Au, 0x8A65C9ECu, 0x14015C4Fu, 0x63066CD9u,
+    0xFA0F3D63u, 0x8D080DF5u, 0x3B6E20C8u, 0x4C69105Eu, 0xD56041E4u, 0xA2677172u,
+    0x3C03E4D1u, 0x4B04D447u, 0xD20D85FDu, 0xA50AB56Bu, 0x35B5A8FAu, 0x42B2986Cu,
+    0xDBBBC9D6u, 0xACBCF940u, 0x32D86CE3u, 0x45DF5C75u, 0xDCD60DCFu, 0xABD13D59u,
+    0x26D930ACu, 0x51DE003Au, 0xC8D75180u, 0xBFD06116u, 0x21B4F4B5u, 0x56B3C423u,
+    0xCFBA9599u, 0xB8BDA50Fu, 0x2802B89Eu, 0x5F058808u, 0xC60CD9B2u, 0xB10BE924u,
+    0x2F6F7C87u, 0x58684C11u, 0xC1611DABu, 0xB6662D3Du, 0x76DC4190u, 0x01DB7106u,
+    0x98D220BCu, 0xEFD5102Au, 0x71B18589u, 0x06B6B51Fu, 0x9FBFE4A5u, 0xE8B8D433u,
+    0x7807C9A2u, 0x0F00F934u, 0x9609A88Eu, 0xE10E9818u, 0x7F6A0DBBu, 0x086D3D2Du,
+    0x91646C97u, 0xE6635C01u, 0x6B6B51F4u, 0x1C6C6162u, 0x856530D8u, 0xF262004Eu,
+    0x6C0695EDu, 0x1B01A57Bu, 0x8208F4C1u, 0xF50FC457u, 0x65B0D9C6u, 0x12B7E950u,
+    0x8BBEB8EAu, 0xFCB9887Cu, 0x62DD1DDFu, 0x15DA2D49u, 0x8CD37CF3u, 0xFBD44C65u,
+    0x4DB26158u, 0x3AB551CEu, 0xA3BC0074u, 0xD4BB30E2u, 0x4ADFA541u, 0x3DD895D7u,
+    0xA4D1C46Du, 0xD3D6F4FBu, 0x4369E96Au, 0x346ED9FCu, 0xAD678846u, 0xDA60B8D0u,
+    0x44042D73u, 0x33031DE5u, 0xAA0A4C5Fu, 0xDD0D7CC9u, 0x5005713Cu, 0x270241AAu,
+    0xBE0B1010u, 0xC90C2086u, 0x5768B525u, 0x206F85B3u, 0xB966D409u, 0xCE61E49Fu,
+    0x5EDEF90Eu, 0x29D9C998u, 0xB0D09822u, 0xC7D7A8B4u, 0x59B33D17u, 0x2EB40D81u,
+    0xB7BD5C3Bu, 0xC0BA6CADu, 0xEDB88320u, 0x9ABFB3B6u, 0x03B6E20Cu, 0x74B1D29Au,
+    0xEAD54739u, 0x9DD277AFu, 0x04DB2615u, 0x73DC1683u, 0xE3630B12u, 0x94643B84u,
+    0x0D6D6A3Eu, 0x7A6A5AA8u, 0xE40ECF0Bu, 0x9309FF9Du, 0x0A00AE27u, 0x7D079EB1u,
+    0xF00F9344u, 0x8708A3D2u, 0x1E01F268u, 0x6906C2FEu, 0xF762575Du, 0x806567CBu,
+    0x196C3671u, 0x6E6B06E7u, 0xFED41B76u, 0x89D32BE0u, 0x10DA7A5Au, 0x67DD4ACCu,
+    0xF9B9DF6Fu, 0x8EBEEFF9u, 0x17B7BE43u, 0x60B08ED5u, 0xD6D6A3E8u, 0xA1D1937Eu,
+    0x38D8C2C4u, 0x4FDFF252u, 0xD1BB67F1u, 0xA6BC5767u, 0x3FB506DDu, 0x48B2364Bu,
+    0xD80D2BDAu, 0xAF0A1B4Cu, 0x36034AF6u, 0x41047A60u, 0xDF60EFC3u, 0xA867DF55u,
+    0x316E8EEFu, 0x4669BE79u, 0xCB61B38Cu, 0xBC66831Au, 0x256FD2A0u, 0x5268E236u,
+    0xCC0C7795u, 0xBB0B4703u, 0x220216B9u, 0x5505262Fu, 0xC5BA3BBEu, 0xB2BD0B28u,
+    0x2BB45A92u, 0x5CB36A04u, 0xC2D7FFA7u, 0xB5D0CF31u, 0x2CD99E8Bu, 0x5BDEAE1Du,
+    0x9B64C2B0u, 0xEC63F226u, 0x756AA39Cu, 0x026D930Au, 0x9C0906A9u, 0xEB0E363Fu,
+    0x72076785u, 0x05005713u, 0x95BF4A82u, 0xE2B87A14u, 0x7BB12BAEu, 0x0CB61B38u,
+    0x92D28E9Bu, 0xE5D5BE0Du, 0x7CDCEFB7u, 0x0BDBDF21u, 0x86D3D2D4u, 0xF1D4E242u,
+    0x68DDB3F8u, 0x1FDA836Eu, 0x81BE16CDu, 0xF6B9265Bu, 0x6FB077E1u, 0x18B74777u,
+    0x88085AE6u, 0xFF0F6A70u, 0x66063BCAu, 0x11010B5Cu, 0x8F659EFFu, 0xF862AE69u,
+    0x616BFFD3u, 0x166CCF45u, 0xA00AE278u, 0xD70DD2EEu, 0x4E048354u, 0x3903B3C2u,
+    0xA7672661u, 0xD06016F7u, 0x4969474Du, 0x3E6E77DBu, 0xAED16A4Au, 0xD9D65ADCu,
+    0x40DF0B66u, 0x37D83BF0u, 0xA9BCAE53u, 0xDEBB9EC5u, 0x47B2CF7Fu, 0x30B5FFE9u,
+    0xBDBDF21Cu, 0xCABAC28Au, 0x53B39330u, 0x24B4A3A6u, 0xBAD03605u, 0xCDD70693u,
+    0x54DE5729u, 0x23D967BFu, 0xB3667A2Eu, 0xC4614AB8u, 0x5D681B02u, 0x2A6F2B94u,
+    0xB40BBE37u, 0xC30C8EA1u, 0x5A05DF1Bu, 0x2D02EF8Du
+};
+/* clang-format on */
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Crc_Cfg.h */
+#elif CRC_32_MODE == CRC_SLICE4
+/**
+ * @brief  Slicing by 4 lookup tables for CRC32, reflected polynomial 0xEDB88320
+ */
+/* clang-format off */
+static const uint32 Crc_Table32Slice4[ CRC_SLICE4_TABLES ][ CRC_TABLE_SIZE ] =
+{
+    {
+        0x00000000u, 0x77073096u, 0xEE0E612Cu, 0x990951BAu, 0x076DC419u, 0x706AF48Fu,
+        0xE963A535u, 0x9E6495A3u, 0x0EDB8832u, 0x79DCB8A4u, 0xE0D5E91Eu, 0x97D2D988u,
+        0x09B64C2Bu, 0x7EB17CBDu, 0xE7B82D07u, 0x90BF1D91u, 0x1DB71064u, 0x6AB020F2u,
+        0xF3B97148u, 0x84BE41DEu, 0x1ADAD47Du, 0x6DDDE4EBu, 0xF4D4B551u, 0x83D385C7u,
+        0x136C9856u, 0x646BA8C0u, 0xFD62F97Au, 0x8A65C9ECu, 0x14015C4Fu, 0x63066CD9u,
+        0xFA0F3D63u, 0x8D080DF5u, 0x3B6E20C8u, 0x4C69105Eu, 0xD56041E4u, 0xA2677172u,
+        0x3C03E4D1u, 0x4B04D447u, 0xD20D85FDu, 0xA50AB56Bu, 0x35B5A8FAu, 0x42B2986Cu,
+        0xDBBBC9D6u, 0xACBCF940u, 0x32D86CE3u, 0x45DF5C75u, 0xDCD60DCFu, 0xABD13D59u,
+        0x26D930ACu, 0x51DE003Au, 0xC8D75180u, 0xBFD06116u, 0x21B4F4B5u, 0x56B3C423u,
+        0xCFBA9599u, 0xB8BDA50Fu, 0x2802B89Eu, 0x5F058808u, 0xC60CD9B2u, 0xB10BE924u,
+        0x2F6F7C87u, 0x58684C11u, 0xC1611DABu, 0xB6662D3Du, 0x76DC4190u, 0x01DB7106u,
+        0x98D220BCu, 0xEFD5102Au, 0x71B18589u, 0x06B6B51Fu, 0x9FBFE4A5u, 0xE8B8D433u,
+        0x7807C9A2u, 0x0F00F934u, 0x9609A88Eu, 0xE10E9818u, 0x7F6A0DBBu, 0x086D3D2Du,
+        0x91646C97u, 0xE6635C01u, 0x6B6B51F4u, 0x1C6C6162u, 0x856530D8u, 0xF262004Eu,
+        0x6C0695EDu, 0x1B01A57Bu, 0x8208F4C1u, 0xF50FC457u, 0x65B0D9C6u, 0x12B7E950u,
+        0x8BBEB8EAu, 0xFCB9887Cu, 0x62DD1DDFu, 0x15DA2D49u, 0x8CD37CF3u, 0xFBD44C65u,
+        0x4DB26158u, 0x3AB551CEu, 0xA3BC0074u, 0xD4BB30E2u, 0x4ADFA541u, 0x3DD895D7u,
+        0xA4D1C46Du, 0xD3D6F4FBu, 0x4369E96Au, 0x346ED9FCu, 0xAD678846u, 0xDA60B8D0u,
+        0x44042D73u, 0x33031DE5u, 0xAA0A4C5Fu, 0xDD0D7CC9u, 0x5005713Cu, 0x270241AAu,
+        0xBE0B1010u, 0xC90C2086u, 0x5768B525u, 0x206F85B3u, 0xB966D409u, 0xCE61E49Fu,
+        0x5EDEF90Eu, 0x29D9C998u, 0xB0D09822u, 0xC7D7A8B4u, 0x59B33D17u, 0x2EB40D81u,
+        0xB7BD5C3Bu, 0xC0BA6CADu, 0xEDB88320u, 0x9ABFB3B6u, 0x03B6E20Cu, 0x74B1D29Au,
+        0xEAD54739u, 0x9DD277AFu, 0x04DB2615u, 0x73DC1683u, 0xE3630B12u, 0x94643B84u,
+        0x0D6D6A3Eu, 0x7A6A5AA8u, 0xE40ECF0Bu, 0x9309FF9Du, 0x0A00AE27u, 0x7D079EB1u,
+        0xF00F9344u, 0x8708A3D2u, 0x1E01F268u, 0x6906C2FEu, 0xF762575Du, 0x806567CBu,
+        0x196C3671u, 0x6E6B06E7u, 0xFED41B76u, 0x89D32BE0u, 0x10DA7A5Au, 0x67DD4ACCu,
+        0xF9B9DF6Fu, 0x8EBEEFF9u, 0x17B7BE43u, 0x60B08ED5u, 0xD6D6A3E8u, 0xA1D1937Eu,
+        0x38D8C2C4u, 0x4FDFF252u, 0xD1BB67F1u, 0xA6BC5767u, 0x3FB506DDu, 0x48B2364Bu,
+        0xD80D2BDAu, 0xAF0A1B4Cu, 0x36034AF6u, 0x41047A60u, 0xDF60EFC3u, 0xA867DF55u,
+        0x316E8EEFu, 0x4669BE79u, 0xCB61B38Cu, 0xBC66831Au, 0x256FD2A0u, 0x5268E236u,
+        0xCC0C7795u, 0xBB0B4703u, 0x220216B9u, 0x5505262Fu, 0xC5BA3BBEu, 0xB2BD0B28u,
+        0x2BB45A92u, 0x5CB36A04u, 0xC2D7FFA7u, 0xB5D0CF31u, 0x2CD99E8Bu, 0x5BDEAE1Du,
+        0x9B64C2B0u, 0xEC63F226u, 0x756AA39Cu, 0x026D930Au, 0x9C0906A9u, 0xEB0E363Fu,
+        0x72076785u, 0x05005713u, 0x95BF4A82u, 0xE2B87A14u, 0x7BB12BAEu, 0x0CB61B38u,
+        0x92D28E9Bu, 0xE5D5BE0Du, 0x7CDCEFB7u, 0x0BDBDF21u, 0x86D3D2D4u, 0xF1D4E242u,
+        0x68DDB3F8u, 0x1FDA836Eu, 0x81BE16CDu, 0xF6B9265Bu, 0x6FB077E1u, 0x18B74777u,
+        0x88085AE6u, 0xFF0F6A70u, 0x66063BCAu, 0x11010B5Cu, 0x8F659EFFu, 0xF862AE69u,
+        0x616BFFD3u, 0x166CCF45u, 0xA00AE278u, 0xD70DD2EEu, 0x4E048354u, 0x3903B3C2u,
+        0xA7672661u, 0xD06016F7u, 0x4969474Du, 0x3E6E77DBu, 0xAED16A4Au, 0xD9D65ADCu,
+        0x40DF0B66u, 0x37D83BF0u, 0xA9BCAE53u, 0xDEBB9EC5u, 0x47B2CF7Fu, 0x30B5FFE9u,
+        0xBDBDF21Cu, 0xCABAC28Au, 0x53B39330u, 0x24B4A3A6u, 0xBAD03605u, 0xCDD70693u,
+        0x54DE5729u, 0x23D967BFu, 0xB3667A2Eu, 0xC4614AB8u, 0x5D681B02u, 0x2A6F2B94u,
+        0xB40BBE37u, 0xC30C8EA1u, 0x5A05DF1Bu, 0x2D02EF8Du
+    },
+    {
+        0x00000000u, 0x191B3141u, 0x32366282u, 0x2B2D53C3u, 0x646CC504u, 0x7D77F445u,
+        0x565AA786u, 0x4F4196C7u, 0xC8D98A08u, 0xD1C2BB49u, 0xFAEFE88Au, 0xE3F4D9CBu,
+        0xACB54F0Cu, 0xB5AE7E4Du, 0x9E832D8Eu, 0x87981CCFu, 0x4AC21251u, 0x53D92310u,
+        0x78F470D3u, 0x61EF4192u, 0x2EAED755u, 0x37B5E614u, 0x1C98B5D7u, 0x05838496u,
+        0x821B9859u, 0x9B00A918u, 0xB02DFADBu, 0xA936CB9Au, 0xE6775D5Du, 0xFF6C6C1Cu,
+        0xD4413FDFu, 0xCD5A0E9Eu, 0x958424A2u, 0x8C9F15E3u, 0xA7B24620u, 0xBEA97761u,
+        0xF1E8E1A6u, 0xE8F3D0E7u, 0xC3DE8324u, 0xDAC5B265u, 0x5D5DAEAAu, 0x44469FEBu,
+        0x6F6BCC28u, 0x7670FD69u, 0x39316BAEu, 0x202A5AEFu, 0x0B07092Cu, 0x121C386Du,
+        0xDF4636F3u, 0xC65D07B2u, 0xED705471u, 0xF46B6530u, 0xBB2AF3F7u, 0xA231C2B6u,
+        0x891C9175u, 0x9007A034u, 0x179FBCFBu, 0x0E848DBAu, 0x25A9DE79u, 0x3CB2EF38u,
+        0x73F379FFu, 0x6AE848BEu, 0x41C51B7Du, 0x58DE2A3Cu, 0xF0794F05u, 0xE9627E44u,
+        0xC24F2D87u, 0xDB541CC6u, 0x94158A01u, 0x8D0EBB40u, 0xA623E883u, 0xBF38D9C2u,
+        0x38A0C50Du, 0x21BBF44Cu, 0x0A96A78Fu, 0x138D96CEu, 0x5CCC0009u, 0x45D73148u,
+        0x6EFA628Bu, 0x77E153CAu, 0xBABB5D54u, 0xA3A06C15u, 0x888D3FD6u, 0x91960E97u,
+        0xDED79850u, 0xC7CCA911u, 0xECE1FAD2u, 0xF5FACB93u, 0x7262D75Cu, 0x6B79E61Du,
+        0x4054B5DEu, 0x594F849Fu, 0x160E1258u, 0x0F152319u, 0x243870DAu, 0x3D23419Bu,
+        0x65FD6BA7u, 0x7CE65AE6u, 0x57CB0925u, 0x4ED03864u, 0x0191AEA3u, 0x188A9FE2u,
+        0x33A7CC21u, 0x2ABCFD60u, 0xAD24E1AFu, 0xB43FD0EEu, 0x9F12832Du, 0x8609B26Cu,
+        0xC94824ABu, 0xD05315EAu, 0xFB7E4629u, 0xE2657768u, 0x2F3F79F6u, 0x362448B7u,
+        0x1D091B74u, 0x04122A35u, 0x4B53BCF2u, 0x52488DB3u, 0x7965DE70u, 0x607EEF31u,
+        0xE7E6F3FEu, 0xFEFDC2BFu, 0xD5D0917Cu, 0xCCCBA03Du, 0x838A36FAu, 0x9A9107BBu,
+        0xB1BC5478u, 0xA8A76539u, 0x3B83984Bu, 0x2298A90Au, 0x09B5FAC9u, 0x10AECB88u,
+        0x5FEF5D4Fu, 0x46F46C0Eu, 0x6DD93FCDu, 0x74C20E8Cu, 0xF35A1243u, 0xEA412302u,
+        0xC16C70C1u, 0xD8774180u, 0x9736D747u, 0x8E2DE606u, 0xA500B5C5u, 0xBC1B8484u,
+        0x71418A1Au, 0x685ABB5Bu, 0x4377E898u, 0x5A6CD9D9u, 0x152D4F1Eu, 0x0C367E5Fu,
+        0x271B2D9Cu, 0x3E001CDDu, 0xB9980012u, 0xA0833153u, 0x8BAE6290u, 0x92B553D1u,
+        0xDDF4C516u, 0xC4EFF457u, 0xEFC2A794u, 0xF6D996D5u, 0xAE07BCE9u, 0xB71C8DA8u,
+        0x9C31DE6Bu, 0x852AEF2Au, 0xCA6B79EDu, 0xD37048ACu, 0xF85D1B6Fu, 0xE1462A2Eu,
+        0x66DE36E1u, 0x7FC507A0u, 0x54E85463u, 0x4DF36522u, 0x02B2F3E5u, 0x1BA9C2A4u,
+        0x30849167u, 0x299FA026u, 0xE4C5AEB8u, 0xFDDE9FF9u, 0xD6F3CC3Au, 0xCFE8FD7Bu,
+        0x80A96BBCu, 0x99B25AFDu, 0xB29F093Eu, 0xAB84387Fu, 0x2C1C24B0u, 0x350715F1u,
+        0x1E2A4632u, 0x07317773u, 0x4870E1B4u, 0x516BD0F5u, 0x7A468336u, 0x635DB277u,
+        0xCBFAD74Eu, 0xD2E1E60Fu, 0xF9CCB5CCu, 0xE0D7848Du, 0xAF96124Au, 0xB68D230Bu,
+        0x9DA070C8u, 0x84BB4189u, 0x03235D46u, 0x1A386C07u, 0x31153FC4u, 0x280E0E85u,
+        0x674F9842u, 0x7E54A903u, 0x5579FAC0u, 0x4C62CB81u, 0x8138C51Fu, 0x9823F45Eu,
+        0xB30EA79Du, 0xAA1596DCu, 0xE554001Bu, 0xFC4F315Au, 0xD7626299u, 0xCE7953D8u,
+        0x49E14F17u, 0x50FA7E56u, 0x7BD72D95u, 0x62CC1CD4u, 0x2D8D8A13u, 0x3496BB52u,
+        0x1FBBE891u, 0x06A0D9D0u, 0x5E7EF3ECu, 0x4765C2ADu, 0x6C48916Eu, 0x7553A02Fu,
+        0x3A1236E8u, 0x230907A9u, 0x0824546Au, 0x113F652Bu, 0x96A779E4u, 0x8FBC48A5u,
+        0xA4911B66u, 0xBD8A2A27u, 0xF2CBBCE0u, 0xEBD08DA1u, 0xC0FDDE62u, 0xD9E6EF23u,
+        0x14BCE1BDu, 0x0DA7D0FCu, 0x268A833Fu, 0x3F91B27Eu, 0x70D024B9u, 0x69CB15F8u,
+        0x42E6463Bu, 0x5BFD777Au, 0xDC656BB5u, 0xC57E5AF4u, 0xEE530937u, 0xF7483876u,
+        0xB809AEB1u, 0xA1129FF0u, 0x8A3FCC33u, 0x9324FD72u
+    },
+    {
+        0x00000000u, 0x01C26A37u, 0x0384D46Eu, 0x0246BE59u, 0x0709A8DCu, 0x06CBC2EBu,
+        0x048D7CB2u, 0x054F1685u, 0x0E1351B8u, 0x0FD13B8Fu, 0x0D9785D6u, 0x0C55EFE1u,
+        0x091AF964u, 0x08D89353u, 0x0A9E2D0Au, 0x0B5C473Du, 0x1C26A370u, 0x1DE4C947u,
+        0x1FA2771Eu, 0x1E601D29u, 0x1B2F0BACu, 0x1AED619Bu, 0x18ABDFC2u, 0x1969B5F5u,
+        0x1235F2C8u, 0x13F798FFu, 0x11B126A6u, 0x10734C91u, 0x153C5A14u, 0x14FE3023u,
+        0x16B88E7Au, 0x177AE44Du, 0x384D46E0u, 0x398F2CD7u, 0x3BC9928Eu, 0x3A0BF8B9u,
+        0x3F44EE3Cu, 0x3E86840Bu, 0x3CC03A52u, 0x3D025065u, 0x365E1758u, 0x379C7D6Fu,
+        0x35DAC336u, 0x3418A901u, 0x3157BF84u, 0x3095D5B3u, 0x32D36BEAu, 0x331101DDu,
+        0x246BE590u, 0x25A98FA7u, 0x27EF31FEu, 0x262D5BC9u, 0x23624D4Cu, 0x22A0277Bu,
+        0x20E69922u, 0x2124F315u, 0x2A78B428u, 0x2BBADE1Fu, 0x29FC6046u, 0x283E0A71u,
+        0x2D711CF4u, 0x2CB376C3u, 0x2EF5C89Au, 0x2F37A2ADu, 0x709A8DC0u, 0x7158E7F7u,
+        0x731E59AEu, 0x72DC3399u, 0x7793251Cu, 0x76514F2Bu, 0x7417F172u, 0x75D59B45u,
+        0x7E89DC78u, 0x7F4BB64Fu, 0x7D0D0816u, 0x7CCF6221u, 0x798074A4u, 0x78421E93u,
+        0x7A04A0CAu, 0x7BC6CAFDu, 0x6CBC2EB0u, 0x6D7E4487u, 0x6F38FADEu, 0x6EFA90E9u,
+        0x6BB5866Cu, 0x6A77EC5Bu, 0x68315202u, 0x69F33835u, 0x62AF7F08u, 0x636D153Fu,
+        0x612BAB66u, 0x60E9C151u, 0x65A6D7D4u, 0x6464BDE3u, 0x662203BAu, 0x67E0698Du,
+        0x48D7CB20u, 0x4915A117u, 0x4B531F4Eu, 0x4A917579u, 0x4FDE63FCu, 0x4E1C09CBu,
+        0x4C5AB792u, 0x4D98DDA5u, 0x46C49A98u, 0x4706F0AFu, 0x45404EF6u, 0x448224C1u,
+        0x41CD3244u, 0x400F5873u, 0x4249E62Au, 0x438B8C1Du, 0x54F16850u, 0x55330267u,
+        0x5775BC3Eu, 0x56B7D609u, 0x53F8C08Cu, 0x523AAABBu, 0x507C14E2u, 0x51BE7ED5u,
+        0x5AE239E8u, 0x5B2053DFu, 0x5966ED86u, 0x58A487B1u, 0x5DEB9134u, 0x5C29FB03u,
+        0x5E6F455Au, 0x5FAD2F6Du, 0xE1351B80u, 0xE0F771B7u, 0xE2B1CFEEu, 0xE373A5D9u,
+        0xE63CB35Cu, 0xE7FED96Bu, 0xE5B86732u, 0xE47A0D05u, 0xEF264A38u, 0xEEE4200Fu,
+        0xECA29E56u, 0xED60F461u, 0xE82FE2E4u, 0xE9ED88D3u, 0xEBAB368Au, 0xEA695CBDu,
+        0xFD13B8F0u, 0xFCD1D2C7u, 0xFE976C9Eu, 0xFF5506A9u, 0xFA1A102Cu, 0xFBD87A1Bu,
+        0xF99EC442u, 0xF85CAE75u, 0xF300E948u, 0xF2C2837Fu, 0xF0843D26u, 0xF1465711u,
+        0xF4094194u, 0xF5CB2BA3u, 0xF78D95FAu, 0xF64FFFCDu, 0xD9785D60u, 0xD8BA3757u,
+        0xDAFC890Eu, 0xDB3EE339u, 0xDE71F5BCu, 0xDFB39F8Bu, 0xDDF521D2u, 0xDC374BE5u,
+        0xD76B0CD8u, 0xD6A966EFu, 0xD4EFD8B6u, 0xD52DB281u, 0xD062A404u, 0xD1A0CE33u,
+        0xD3E6706Au, 0xD2241A5Du, 0xC55EFE10u, 0xC49C9427u, 0xC6DA2A7Eu, 0xC7184049u,
+        0xC25756CCu, 0xC3953CFBu, 0xC1D382A2u, 0xC011E895u, 0xCB4DAFA8u, 0xCA8FC59Fu,
+        0xC8C97BC6u, 0xC90B11F1u, 0xCC440774u, 0xCD866D43u, 0xCFC0D31Au, 0xCE02B92Du,
+        0x91AF9640u, 0x906DFC77u, 0x922B422Eu, 0x93E92819u, 0x96A63E9Cu, 0x976454ABu,
+        0x9522EAF2u, 0x94E080C5u, 0x9FBCC7F8u, 0x9E7EADCFu, 0x9C381396u, 0x9DFA79A1u,
+        0x98B56F24u, 0x99770513u, 0x9B31BB4Au, 0x9AF3D17Du, 0x8D893530u, 0x8C4B5F07u,
+        0x8E0DE15Eu, 0x8FCF8B69u, 0x8A809DECu, 0x8B42F7DBu, 0x89044982u, 0x88C623B5u,
+        0x839A6488u, 0x82580EBFu, 0x801EB0E6u, 0x81DCDAD1u, 0x8493CC54u, 0x8551A663u,
+        0x8717183Au, 0x86D5720Du, 0xA9E2D0A0u, 0xA820BA97u, 0xAA6604CEu, 0xABA46EF9u,
+        0xAEEB787Cu, 0xAF29124Bu, 0xAD6FAC12u, 0xACADC625u, 0xA7F18118u, 0xA633EB2Fu,
+        0xA4755576u, 0xA5B73F41u, 0xA0F829C4u, 0xA13A43F3u, 0xA37CFDAAu, 0xA2BE979Du,
+        0xB5C473D0u, 0xB40619E7u, 0xB640A7BEu, 0xB782CD89u, 0xB2CDDB0Cu, 0xB30FB13Bu,
+        0xB1490F62u, 0xB08B6555u, 0xBBD72268u, 0xBA15485Fu, 0xB853F606u, 0xB9919C31u,
+        0xBCDE8AB4u, 0xBD1CE083u, 0xBF5A5EDAu, 0xBE9834EDu
+    },
+    {
+        0x00000000u, 0xB8BC6765u, 0xAA09C88Bu, 0x12B5AFEEu, 0x8F629757u, 0x37DEF032u,
+        0x256B5FDCu, 0x9DD738B9u, 0xC5B428EFu, 0x7D084F8Au, 0x6FBDE064u, 0xD7018701u,
+        0x4AD6BFB8u, 0xF26AD8DDu, 0xE0DF7733u, 0x58631056u, 0x5019579Fu, 0xE8A530FAu,
+        0xFA109F14u, 0x42ACF871u, 0xDF7BC0C8u, 0x67C7A7ADu, 0x75720843u, 0xCDCE6F26u,
+        0x95AD7F70u, 0x2D111815u, 0x3FA4B7FBu, 0x8718D09Eu, 0x1ACFE827u, 0xA2738F42u,
+        0xB0C620ACu, 0x087A47C9u, 0xA032AF3Eu, 0x188EC85Bu, 0x0A3B67B5u, 0xB28700D0u,
+        0x2F503869u, 0x97EC5F0Cu, 0x8559F0E2u, 0x3DE59787u, 0x658687D1u, 0xDD3AE0B4u,
+        0xCF8F4F5Au, 0x7733283Fu, 0xEAE41086u, 0x525877E3u, 0x40EDD80Du, 0xF851BF68u,
+        0xF02BF8A1u, 0x48979FC4u, 0x5A22302Au, 0xE29E574Fu, 0x7F496FF6u, 0xC7F50893u,
+        0xD540A77Du, 0x6DFCC018u, 0x359FD04Eu, 0x8D23B72Bu, 0x9F9618C5u, 0x272A7FA0u,
+        0xBAFD4719u, 0x0241207Cu, 0x10F48F92u, 0xA848E8F7u, 0x9B14583Du, 0x23A83F58u,
+        0x311D90B6u, 0x89A1F7D3u, 0x1476CF6Au, 0xACCAA80Fu, 0xBE7F07E1u, 0x06C36084u,
+        0x5EA070D2u, 0xE61C17B7u, 0xF4A9B859u, 0x4C15DF3Cu, 0xD1C2E785u, 0x697E80E0u,
+        0x7BCB2F0Eu, 0xC377486Bu, 0xCB0D0FA2u, 0x73B168C7u, 0x6104C729u, 0xD9B8A04Cu,
+        0x446F98F5u, 0xFCD3FF90u, 0xEE66507Eu, 0x56DA371Bu, 0x0EB9274Du, 0xB6054028u,
+        0xA4B0EFC6u, 0x1C0C88A3u, 0x81DBB01Au, 0x3967D77Fu, 0x2BD27891u, 0x936E1FF4u,
+        0x3B26F703u, 0x839A9066u, 0x912F3F88u, 0x299358EDu, 0xB4446054u, 0x0CF80731u,
+        0x1E4DA8DFu, 0xA6F1CFBAu, 0xFE92DFECu, 0x462EB889u, 0x549B1767u, 0xEC277002u,
+        0x71F048BBu, 0xC94C2FDEu, 0xDBF98030u, 0x6345E755u, 0x6B3FA09Cu, 0xD383C7F9u,
+        0xC1366817u, 0x798A0F72u, 0xE45D37CBu, 0x5CE150AEu, 0x4E54FF40u, 0xF6E89825u,
+        0xAE8B8873u, 0x1637EF16u, 0x048240F8u, 0xBC3E279Du, 0x21E91F24u, 0x99557841u,
+        0x8BE0D7AFu, 0x335CB0CAu, 0xED59B63Bu, 0x55E5D15Eu, 0x47507EB0u, 0xFFEC19D5u,
+        0x623B216Cu, 0xDA874609u, 0xC832E9E7u, 0x708E8E82u, 0x28ED9ED4u, 0x9051F9B1u,
+        0x82E4565Fu, 0x3A58313Au, 0xA78F0983u, 0x1F336EE6u, 0x0D86C108u, 0xB53AA66Du,
+        0xBD40E1A4u, 0x05FC86C1u, 0x1749292Fu, 0xAFF54E4Au, 0x322276F3u, 0x8A9E1196u,
+        0x982BBE78u, 0x2097D91Du, 0x78F4C94Bu, 0xC048AE2Eu, 0xD2FD01C0u, 0x6A4166A5u,
+        0xF7965E1Cu, 0x4F2A3979u, 0x5D9F9697u, 0xE523F1F2u, 0x4D6B1905u, 0xF5D77E60u,
+        0xE762D18Eu, 0x5FDEB6EBu, 0xC2098E52u, 0x7AB5E937u, 0x680046D9u, 0xD0BC21BCu,
+        0x88DF31EAu, 0x3063568Fu, 0x22D6F961u, 0x9A6A9E04u, 0x07BDA6BDu, 0xBF01C1D8u,
+        0xADB46E36u, 0x15080953u, 0x1D724E9Au, 0xA5CE29FFu, 0xB77B8611u, 0x0FC7E174u,
+        0x9210D9CDu, 0x2AACBEA8u, 0x38191146u, 0x80A57623u, 0xD8C66675u, 0x607A0110u,
+        0x72CFAEFEu, 0xCA73C99Bu, 0x57A4F122u, 0xEF189647u, 0xFDAD39A9u, 0x45115ECCu,
+        0x764DEE06u, 0xCEF18963u, 0xDC44268Du, 0x64F841E8u, 0xF92F7951u, 0x41931E34u,
+        0x5326B1DAu, 0xEB9AD6BFu, 0xB3F9C6E9u, 0x0B45A18Cu, 0x19F00E62u, 0xA14C6907u,
+        0x3C9B51BEu, 0x842736DBu, 0x96929935u, 0x2E2EFE50u, 0x2654B999u, 0x9EE8DEFCu,
+        0x8C5D7112u, 0x34E11677u, 0xA9362ECEu, 0x118A49ABu, 0x033FE645u, 0xBB838120u,
+        0xE3E09176u, 0x5B5CF613u, 0x49E959FDu, 0xF1553E98u, 0x6C820621u, 0xD43E6144u,
+        0xC68BCEAAu, 0x7E37A9CFu, 0xD67F4138u, 0x6EC3265Du, 0x7C7689B3u, 0xC4CAEED6u,
+        0x591DD66Fu, 0xE1A1B10Au, 0xF3141EE4u, 0x4BA87981u, 0x13CB69D7u, 0xAB770EB2u,
+        0xB9C2A15Cu, 0x017EC639u, 0x9CA9FE80u, 0x241599E5u, 0x36A0360Bu, 0x8E1C516Eu,
+        0x866616A7u, 0x3EDA71C2u, 0x2C6FDE2Cu, 0x94D3B949u, 0x090481F0u, 0xB1B8E695u,
+        0xA30D497Bu, 0x1BB12E1Eu, 0x43D23E48u, 0xFB6E592Du, 0xE9DBF6C3u, 0x516791A6u,
+        0xCCB0A91Fu, 0x740CCE7Au, 0x66B96194u, 0xDE0506F1u
+    }
+};
+/* clang-format on */
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Crc_Cfg.h */
+#elif CRC_32_MODE == CRC_NIBBLE
+/**
+ * @brief  Nibble lookup table for CRC32, reflected polynomial 0xEDB88320
+ */
+/* clang-format off */
+static const uint32 Crc_Nibble32[ CRC_NIBBLE_TABLE_SIZE ] =
+{
+    0x00000000u, 0x1DB71064u, 0x3B6E20C8u, 0x26D930ACu, 0x76DC4190u, 0x6B6B51F4u, 0x4DB26158u, 0x5005713Cu,
+    0xEDB88320u, 0xF00F9344u, 0xD6D6A3E8u, 0xCB61B38Cu, 0x9B64C2B0u, 0x86D3D2D4u, 0xA00AE278u, 0xBDBDF21Cu
+};
+/* clang-format on */
+#endif
+
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Crc_Cfg.h */
+#if CRC_32P4_MODE == CRC_TABLE
+/**
+ * @brief  Lookup table for CRC32P4, reflected polynomial 0xC8DF352F
+ */
+/* clang-format off */
+static const uint32 Crc_Table32P4[ CRC_TABLE_SIZE ] =
+{
+    0x00000000u, 0x30850FF5u, 0x610A1FEAu, 0x518F101Fu, 0xC2143FD4u, 0xF2913021u,
+    0xA31E203Eu, 0x939B2FCBu, 0x159615F7u, 0x25131A02u, 0x749C0A1Du, 0x441905E8u,
+    0xD7822A23u, 0xE70725D6u, 0xB68835C9u, 0x860D3A3Cu, 0x2B2C2BEEu, 0x1BA9241Bu,
+    0x4A263404u, 0x7AA33BF1u, 0xE938143Au, 0xD9BD1BCFu, 0x88320BD0u, 0xB8B70425u,
+    0x3EBA3E19u, 0x0E3F31ECu, 0x5FB021F3u, 0x6F352E06u, 0xFCAE01CDu, 0xCC2B0E38u,
+    0x9DA41E27u, 0xAD2111D2u, 0x565857DCu, 0x66DD5829u, 0x37524836u, 0x07D747C3u,
+    0x944C6808u, 0xA4C967FDu, 0xF54677E2u, 0xC5C37817u, 0x43CE422Bu, 0x734B4DDEu,
+    0x22C45DC1u, 0x12415234u, 0x81DA7DFFu, 0xB15F720Au, 0xE0D06215u, 0xD0556DE0u,
+    0x7D747C32u, 0x4DF173C7u, 0x1C7E63D8u, 0x2CFB6C2Du, 0xBF6043E6u, 0x8FE54C13u,
+    0xDE6A5C0Cu, 0xEEEF53F9u, 0x68E269C5u, 0x58676630u, 0x09E8762Fu, 0x396D79DAu,
+    0xAAF65611u, 0x9A7359E4u, 0xCBFC49FBu, 0xFB79460Eu, 0xACB0AFB8u, 0x9C35A04Du,
+    0xCDBAB052u, 0xFD3FBFA7u, 0x6EA4906Cu, 0x5E219F99u, 0x0FAE8F86u, 0x3F2B8073u,
+    0xB926BA4Fu, 0x89A3B5BAu, 0xD82CA5A5u, 0xE8A9AA50u, 0x7B32859Bu, 0x4BB78A6Eu,
+    0x1A389A71u, 0x2ABD9584u, 0x879C8456u, 0xB7198BA3u, 0xE6969BBCu, 0xD6139449u,
+    0x4588BB82u, 0x750DB477u, 0x2482A468u, 0x1407AB9Du, 0x920A91A1u, 0xA28F9E54u,
+    0xF3008E4Bu, 0xC38581BEu, 0x501EAE75u, 0x609BA180u, 0x3114B19Fu, 0x0191BE6Au,
+    0xFAE8F864u, 0xCA6DF791u, 0x9BE2E78Eu, 0xAB67E87Bu, 0x38FCC7B0u, 0x0879C845u,
+    0x59F6D85Au, 0x6973D7AFu, 0xEF7EED93u, 0xDFFBE266u, 0x8E74F279u, 0xBEF1FD8Cu,
+    0x2D6AD247u, 0x1DEFDDB2u, 0x4C60CDADu, 0x7CE5C258u, 0xD1C4D38Au, 0xE141DC7Fu,
+    0xB0CECC60u, 0x804BC395u, 0x13D0EC5Eu, 0x2355E3ABu, 0x72DAF3B4u, 0x425FFC41u,
+    0xC452C67Du, 0xF4D7C988u, 0xA558D997u, 0x95DDD662u, 0x0646F9A9u, 0x36C3F65Cu,
+    0x674CE643u, 0x57C9E9B6u, 0xC8DF352Fu, 0xF85A3ADAu, 0xA9D52AC5u, 0x99502530u,
+    0x0ACB0AFBu, 0x3A4E050Eu, 0x6BC11511u, 0x5B441AE4u, 0xDD4920D8u, 0xEDCC2F2Du,
+    0xBC433F32u, 0x8CC630C7u, 0x1F5D1F0Cu, 0x2FD810F9u, 0x7E5700E6u, 0x4ED20F13u,
+    0xE3F31EC1u, 0xD3761134u, 0x82F9012Bu, 0xB27C0EDEu, 0x21E72115u, 0x11622EE0u,
+    0x40ED3EFFu, 0x7068310Au, 0xF6650B36u, 0xC6E004C3u, 0x976F14DCu, 0xA7EA1B29u,
+    0x347134E2u, 0x04F43B17u, 0x557B2B08u, 0x65FE24FDu, 0x9E8762F3u, 0xAE026D06u,
+    0xFF8D7D19u, 0xCF0872ECu, 0x5C935D27u, 0x6C1652D2u, 0x3D9942CDu, 0x0D1C4D38u,
+    0x8B117704u, 0xBB9478F1u, 0xEA1B68EEu, 0xDA9E671Bu, 0x490548D0u, 0x79804725u,
+    0x280F573Au, 0x188A58CFu, 0xB5AB491Du, 0x852E46E8u, 0xD4A156F7u, 0xE4245902u,
+    0x77BF76C9u, 0x473A793Cu, 0x16B56923u, 0x263066D6u, 0xA03D5CEAu, 0x90B8531Fu,
+    0xC1374300u, 0xF1B24CF5u, 0x6229633Eu, 0x52AC6CCBu, 0x03237CD4u, 0x33A67321u,
+    0x646F9A97u, 0x54EA9562u, 0x0565857Du, 0x35E08A88u, 0xA67BA543u, 0x96FEAAB6u,
+    0xC771BAA9u, 0xF7F4B55Cu, 0x71F98F60u, 0x417C8095u, 0x10F3908Au, 0x20769F7Fu,
+    0xB3EDB0B4u, 0x8368BF41u, 0xD2E7AF5Eu, 0xE262A0ABu, 0x4F43B179u, 0x7FC6BE8Cu,
+    0x2E49AE93u, 0x1ECCA166u, 0x8D578EADu, 0xBDD28158u, 0xEC5D9147u, 0xDCD89EB2u,
+    0x5AD5A48Eu, 0x6A50AB7Bu, 0x3BDFBB64u, 0x0B5AB491u, 0x98C19B5Au, 0xA84494AFu,
+    0xF9CB84B0u, 0xC94E8B45u, 0x3237CD4Bu, 0x02B2C2BEu, 0x533DD2A1u, 0x63B8DD54u,
+    0xF023F29Fu, 0xC0A6FD6Au, 0x9129ED75u, 0xA1ACE280u, 0x27A1D8BCu, 0x1724D749u,
+    0x46ABC756u, 0x762EC8A3u, 0xE5B5E768u, 0xD530E89Du, 0x84BFF882u, 0xB43AF777u,
+    0x191BE6A5u, 0x299EE950u, 0x7811F94Fu, 0x4894F6BAu, 0xDB0FD971u, 0xEB8AD684u,
+    0xBA05C69Bu, 0x8A80C96Eu, 0x0C8DF352u, 0x3C08FCA7u, 0x6D87ECB8u, 0x5D02E34Du,
+    0xCE99CC86u, 0xFE1CC373u, 0xAF93D36Cu, 0x9F16DC99u
+};
+/* clang-format on */
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Crc_Cfg.h */
+#elif CRC_32P4_MODE == CRC_SLICE4
+/**
+ * @brief  Slicing by 4 lookup tables for CRC32P4, reflected polynomial 0xC8DF352F
+ */
+/* clang-format off */
+static const uint32 Crc_Table32P4Slice4[ CRC_SLICE4_TABLES ][ CRC_TABLE_SIZE ] =
+{
+    {
+        0x00000000u, 0x30850FF5u, 0x610A1FEAu, 0x518F101Fu, 0xC2143FD4u, 0xF2913021u,
+        0xA31E203Eu, 0x939B2FCBu, 0x159615F7u, 0x25131A02u, 0x749C0A1Du, 0x441905E8u,
+        0xD7822A23u, 0xE70725D6u, 0xB68835C9u, 0x860D3A3Cu, 0x2B2C2BEEu, 0x1BA9241Bu,
+        0x4A263404u, 0x7AA33BF1u, 0xE938143Au, 0xD9BD1BCFu, 0x88320BD0u, 0xB8B70425u,
+        0x3EBA3E19u, 0x0E3F31ECu, 0x5FB021F3u, 0x6F352E06u, 0xFCAE01CDu, 0xCC2B0E38u,
+        0x9DA41E27u, 0xAD2111D2u, 0x565857DCu, 0x66DD5829u, 0x37524836u, 0x07D747C3u,
+        0x944C6808u, 0xA4C967FDu, 0xF54677E2u, 0xC5C37817u, 0x43CE422Bu, 0x734B4DDEu,
+        0x22C45DC1u, 0x12415234u, 0x81DA7DFFu, 0xB15F720Au, 0xE0D06215u, 0xD0556DE0u,
+        0x7D747C32u, 0x4DF173C7u, 0x1C7E63D8u, 0x2CFB6C2Du, 0xBF6043E6u, 0x8FE54C13u,
+        0xDE6A5C0Cu, 0xEEEF53F9u, 0x68E269C5u, 0x58676630u, 0x09E8762Fu, 0x396D79DAu,
+        0xAAF65611u, 0x9A7359E4u, 0xCBFC49FBu, 0xFB79460Eu, 0xACB0AFB8u, 0x9C35A04Du,
+        0xCDBAB052u, 0xFD3FBFA7u, 0x6EA4906Cu, 0x5E219F99u, 0x0FAE8F86u, 0x3F2B8073u,
+        0xB926BA4Fu, 0x89A3B5BAu, 0xD82CA5A5u, 0xE8A9AA50u, 0x7B32859Bu, 0x4BB78A6Eu,
+        0x1A389A71u, 0x2ABD9584u, 0x879C8456u, 0xB7198BA3u, 0xE6969BBCu, 0xD6139449u,
+        0x4588BB82u, 0x750DB477u, 0x2482A468u, 0x1407AB9Du, 0x920A91A1u, 0xA28F9E54u,
+        0xF3008E4Bu, 0xC38581BEu, 0x501EAE75u, 0x609BA180u, 0x3114B19Fu, 0x0191BE6Au,
+        0xFAE8F864u, 0xCA6DF791u, 0x9BE2E78Eu, 0xAB67E87Bu, 0x38FCC7B0u, 0x0879C845u,
+        0x59F6D85Au, 0x6973D7AFu, 0xEF7EED93u, 0xDFFBE266u, 0x8E74F279u, 0xBEF1FD8Cu,
+        0x2D6AD247u, 0x1DEFDDB2u, 0x4C60CDADu, 0x7CE5C258u, 0xD1C4D38Au, 0xE141DC7Fu,
+        0xB0CECC60u, 0x804BC395u, 0x13D0EC5Eu, 0x2355E3ABu, 0x72DAF3B4u, 0x425FFC41u,
+        0xC452C67Du, 0xF4D7C988u, 0xA558D997u, 0x95DDD662u, 0x0646F9A9u, 0x36C3F65Cu,
+        0x674CE643u, 0x57C9E9B6u, 0xC8DF352Fu, 0xF85A3ADAu, 0xA9D52AC5u, 0x99502530u,
+        0x0ACB0AFBu, 0x3A4E050Eu, 0x6BC11511u, 0x5B441AE4u, 0xDD4920D8u, 0xEDCC2F2Du,
+        0xBC433F32u, 0x8CC630C7u, 0x1F5D1F0Cu, 0x2FD810F9u, 0x7E5700E6u, 0x4ED20F13u,
+        0xE3F31EC1u, 0xD3761134u, 0x82F9012Bu, 0xB27C0EDEu, 0x21E72115u, 0x11622EE0u,
+        0x40ED3EFFu, 0x7068310Au, 0xF6650B36u, 0xC6E004C3u, 0x976F14DCu, 0xA7EA1B29u,
+        0x347134E2u, 0x04F43B17u, 0x557B2B08u, 0x65FE24FDu, 0x9E8762F3u, 0xAE026D06u,
+        0xFF8D7D19u, 0xCF0872ECu, 0x5C935D27u, 0x6C1652D2u, 0x3D9942CDu, 0x0D1C4D38u,
+        0x8B117704u, 0xBB9478F1u, 0xEA1B68EEu, 0xDA9E671Bu, 0x490548D0u, 0x79804725u,
+        0x280F573Au, 0x188A58CFu, 0xB5AB491Du, 0x852E46E8u, 0xD4A156F7u, 0xE4245902u,
+        0x77BF76C9u, 0x473A793Cu, 0x16B56923u, 0x263066D6u, 0xA03D5CEAu, 0x90B8531Fu,
+        0xC1374300u, 0xF1B24CF5u, 0x6229633Eu, 0x52AC6CCBu, 0x03237CD4u, 0x33A67321u,
+        0x646F9A97u, 0x54EA9562u, 0x0565857Du, 0x35E08A88u, 0xA67BA543u, 0x96FEAAB6u,
+        0xC771BAA9u, 0xF7F4B55Cu, 0x71F98F60u, 0x417C8095u, 0x10F3908Au, 0x20769F7Fu,
+        0xB3EDB0B4u, 0x8368BF41u, 0xD2E7AF5Eu, 0xE262A0ABu, 0x4F43B179u, 0x7FC6BE8Cu,
+        0x2E49AE93u, 0x1ECCA166u, 0x8D578EADu, 0xBDD28158u, 0xEC5D9147u, 0xDCD89EB2u,
+        0x5AD5A48Eu, 0x6A50AB7Bu, 0x3BDFBB64u, 0x0B5AB491u, 0x98C19B5Au, 0xA84494AFu,
+        0xF9CB84B0u, 0xC94E8B45u, 0x3237CD4Bu, 0x02B2C2BEu, 0x533DD2A1u, 0x63B8DD54u,
+        0xF023F29Fu, 0xC0A6FD6Au, 0x9129ED75u, 0xA1ACE280u, 0x27A1D8BCu, 0x1724D749u,
+        0x46ABC756u, 0x762EC8A3u, 0xE5B5E768u, 0xD530E89Du, 0x84BFF882u, 0xB43AF777u,
+        0x191BE6A5u, 0x299EE950u, 0x7811F94Fu, 0x4894F6BAu, 0xDB0FD971u, 0xEB8AD684u,
+        0xBA05C69Bu, 0x8A80C96Eu, 0x0C8DF352u, 0x3C08FCA7u, 0x6D87ECB8u, 0x5D02E34Du,
+        0xCE99CC86u, 0xFE1CC373u, 0xAF93D36Cu, 0x9F16DC99u
+    },
+    {
+        0x00000000u, 0xEBBA538Bu, 0x46CACD49u, 0xAD709EC2u, 0x8D959A92u, 0x662FC919u,
+        0xCB5F57DBu, 0x20E50450u, 0x8A955F7Bu, 0x612F0CF0u, 0xCC5F9232u, 0x27E5C1B9u,
+        0x0700C5E9u, 0xECBA9662u, 0x41CA08A0u, 0xAA705B2Bu, 0x8494D4A9u, 0x6F2E8722u,
+        0xC25E19E0u, 0x29E44A6Bu, 0x09014E3Bu, 0xE2BB1DB0u, 0x4FCB8372u, 0xA471D0F9u,
+        0x0E018BD2u, 0xE5BBD859u, 0x48CB469Bu, 0xA3711510u, 0x83941140u, 0x682E42CBu,
+        0xC55EDC09u, 0x2EE48F82u, 0x9897C30Du, 0x732D9086u, 0xDE5D0E44u, 0x35E75DCFu,
+        0x1502599Fu, 0xFEB80A14u, 0x53C894D6u, 0xB872C75Du, 0x12029C76u, 0xF9B8CFFDu,
+        0x54C8513Fu, 0xBF7202B4u, 0x9F9706E4u, 0x742D556Fu, 0xD95DCBADu, 0x32E79826u,
+        0x1C0317A4u, 0xF7B9442Fu, 0x5AC9DAEDu, 0xB1738966u, 0x91968D36u, 0x7A2CDEBDu,
+        0xD75C407Fu, 0x3CE613F4u, 0x969648DFu, 0x7D2C1B54u, 0xD05C8596u, 0x3BE6D61Du,
+        0x1B03D24Du, 0xF0B981C6u, 0x5DC91F04u, 0xB6734C8Fu, 0xA091EC45u, 0x4B2BBFCEu,
+        0xE65B210Cu, 0x0DE17287u, 0x2D0476D7u, 0xC6BE255Cu, 0x6BCEBB9Eu, 0x8074E815u,
+        0x2A04B33Eu, 0xC1BEE0B5u, 0x6CCE7E77u, 0x87742DFCu, 0xA79129ACu, 0x4C2B7A27u,
+        0xE15BE4E5u, 0x0AE1B76Eu, 0x240538ECu, 0xCFBF6B67u, 0x62CFF5A5u, 0x8975A62Eu,
+        0xA990A27Eu, 0x422AF1F5u, 0xEF5A6F37u, 0x04E03CBCu, 0xAE906797u, 0x452A341Cu,
+        0xE85AAADEu, 0x03E0F955u, 0x2305FD05u, 0xC8BFAE8Eu, 0x65CF304Cu, 0x8E7563C7u,
+        0x38062F48u, 0xD3BC7CC3u, 0x7ECCE201u, 0x9576B18Au, 0xB593B5DAu, 0x5E29E651u,
+        0xF3597893u, 0x18E32B18u, 0xB2937033u, 0x592923B8u, 0xF459BD7Au, 0x1FE3EEF1u,
+        0x3F06EAA1u, 0xD4BCB92Au, 0x79CC27E8u, 0x92767463u, 0xBC92FBE1u, 0x5728A86Au,
+        0xFA5836A8u, 0x11E26523u, 0x31076173u, 0xDABD32F8u, 0x77CDAC3Au, 0x9C77FFB1u,
+        0x3607A49Au, 0xDDBDF711u, 0x70CD69D3u, 0x9B773A58u, 0xBB923E08u, 0x50286D83u,
+        0xFD58F341u, 0x16E2A0CAu, 0xD09DB2D5u, 0x3B27E15Eu, 0x96577F9Cu, 0x7DED2C17u,
+        0x5D082847u, 0xB6B27BCCu, 0x1BC2E50Eu, 0xF078B685u, 0x5A08EDAEu, 0xB1B2BE25u,
+        0x1CC220E7u, 0xF778736Cu, 0xD79D773Cu, 0x3C2724B7u, 0x9157BA75u, 0x7AEDE9FEu,
+        0x5409667Cu, 0xBFB335F7u, 0x12C3AB35u, 0xF979F8BEu, 0xD99CFCEEu, 0x3226AF65u,
+        0x9F5631A7u, 0x74EC622Cu, 0xDE9C3907u, 0x35266A8Cu, 0x9856F44Eu, 0x73ECA7C5u,
+        0x5309A395u, 0xB8B3F01Eu, 0x15C36EDCu, 0xFE793D57u, 0x480A71D8u, 0xA3B02253u,
+        0x0EC0BC91u, 0xE57AEF1Au, 0xC59FEB4Au, 0x2E25B8C1u, 0x83552603u, 0x68EF7588u,
+        0xC29F2EA3u, 0x29257D28u, 0x8455E3EAu, 0x6FEFB061u, 0x4F0AB431u, 0xA4B0E7BAu,
+        0x09C07978u, 0xE27A2AF3u, 0xCC9EA571u, 0x2724F6FAu, 0x8A546838u, 0x61EE3BB3u,
+        0x410B3FE3u, 0xAAB16C68u, 0x07C1F2AAu, 0xEC7BA121u, 0x460BFA0Au, 0xADB1A981u,
+        0x00C13743u, 0xEB7B64C8u, 0xCB9E6098u, 0x20243313u, 0x8D54ADD1u, 0x66EEFE5Au,
+        0x700C5E90u, 0x9BB60D1Bu, 0x36C693D9u, 0xDD7CC052u, 0xFD99C402u, 0x16239789u,
+        0xBB53094Bu, 0x50E95AC0u, 0xFA9901EBu, 0x11235260u, 0xBC53CCA2u, 0x57E99F29u,
+        0x770C9B79u, 0x9CB6C8F2u, 0x31C65630u, 0xDA7C05BBu, 0xF4988A39u, 0x1F22D9B2u,
+        0xB2524770u, 0x59E814FBu, 0x790D10ABu, 0x92B74320u, 0x3FC7DDE2u, 0xD47D8E69u,
+        0x7E0DD542u, 0x95B786C9u, 0x38C7180Bu, 0xD37D4B80u, 0xF3984FD0u, 0x18221C5Bu,
+        0xB5528299u, 0x5EE8D112u, 0xE89B9D9Du, 0x0321CE16u, 0xAE5150D4u, 0x45EB035Fu,
+        0x650E070Fu, 0x8EB45484u, 0x23C4CA46u, 0xC87E99CDu, 0x620EC2E6u, 0x89B4916Du,
+        0x24C40FAFu, 0xCF7E5C24u, 0xEF9B5874u, 0x04210BFFu, 0xA951953Du, 0x42EBC6B6u,
+        0x6C0F4934u, 0x87B51ABFu, 0x2AC5847Du, 0xC17FD7F6u, 0xE19AD3A6u, 0x0A20802Du,
+        0xA7501EEFu, 0x4CEA4D64u, 0xE69A164Fu, 0x0D2045C4u, 0xA050DB06u, 0x4BEA888Du,
+        0x6B0F8CDDu, 0x80B5DF56u, 0x2DC54194u, 0xC67F121Fu
+    },
+    {
+        0x00000000u, 0x8C2D8A94u, 0x89E57F77u, 0x05C8F5E3u, 0x827494B1u, 0x0E591E25u,
+        0x0B91EBC6u, 0x87BC6152u, 0x9557433Du, 0x197AC9A9u, 0x1CB23C4Au, 0x909FB6DEu,
+        0x1723D78Cu, 0x9B0E5D18u, 0x9EC6A8FBu, 0x12EB226Fu, 0xBB10EC25u, 0x373D66B1u,
+        0x32F59352u, 0xBED819C6u, 0x39647894u, 0xB549F200u, 0xB08107E3u, 0x3CAC8D77u,
+        0x2E47AF18u, 0xA26A258Cu, 0xA7A2D06Fu, 0x2B8F5AFBu, 0xAC333BA9u, 0x201EB13Du,
+        0x25D644DEu, 0xA9FBCE4Au, 0xE79FB215u, 0x6BB23881u, 0x6E7ACD62u, 0xE25747F6u,
+        0x65EB26A4u, 0xE9C6AC30u, 0xEC0E59D3u, 0x6023D347u, 0x72C8F128u, 0xFEE57BBCu,
+        0xFB2D8E5Fu, 0x770004CBu, 0xF0BC6599u, 0x7C91EF0Du, 0x79591AEEu, 0xF574907Au,
+        0x5C8F5E30u, 0xD0A2D4A4u, 0xD56A2147u, 0x5947ABD3u, 0xDEFBCA81u, 0x52D64015u,
+        0x571EB5F6u, 0xDB333F62u, 0xC9D81D0Du, 0x45F59799u, 0x403D627Au, 0xCC10E8EEu,
+        0x4BAC89BCu, 0xC7810328u, 0xC249F6CBu, 0x4E647C5Fu, 0x5E810E75u, 0xD2AC84E1u,
+        0xD7647102u, 0x5B49FB96u, 0xDCF59AC4u, 0x50D81050u, 0x5510E5B3u, 0xD93D6F27u,
+        0xCBD64D48u, 0x47FBC7DCu, 0x4233323Fu, 0xCE1EB8ABu, 0x49A2D9F9u, 0xC58F536Du,
+        0xC047A68Eu, 0x4C6A2C1Au, 0xE591E250u, 0x69BC68C4u, 0x6C749D27u, 0xE05917B3u,
+        0x67E576E1u, 0xEBC8FC75u, 0xEE000996u, 0x622D8302u, 0x70C6A16Du, 0xFCEB2BF9u,
+        0xF923DE1Au, 0x750E548Eu, 0xF2B235DCu, 0x7E9FBF48u, 0x7B574AABu, 0xF77AC03Fu,
+        0xB91EBC60u, 0x353336F4u, 0x30FBC317u, 0xBCD64983u, 0x3B6A28D1u, 0xB747A245u,
+        0xB28F57A6u, 0x3EA2DD32u, 0x2C49FF5Du, 0xA06475C9u, 0xA5AC802Au, 0x29810ABEu,
+        0xAE3D6BECu, 0x2210E178u, 0x27D8149Bu, 0xABF59E0Fu, 0x020E5045u, 0x8E23DAD1u,
+        0x8BEB2F32u, 0x07C6A5A6u, 0x807AC4F4u, 0x0C574E60u, 0x099FBB83u, 0x85B23117u,
+        0x97591378u, 0x1B7499ECu, 0x1EBC6C0Fu, 0x9291E69Bu, 0x152D87C9u, 0x99000D5Du,
+        0x9CC8F8BEu, 0x10E5722Au, 0xBD021CEAu, 0x312F967Eu, 0x34E7639Du, 0xB8CAE909u,
+        0x3F76885Bu, 0xB35B02CFu, 0xB693F72Cu, 0x3ABE7DB8u, 0x28555FD7u, 0xA478D543u,
+        0xA1B020A0u, 0x2D9DAA34u, 0xAA21CB66u, 0x260C41F2u, 0x23C4B411u, 0xAFE93E85u,
+        0x0612F0CFu, 0x8A3F7A5Bu, 0x8FF78FB8u, 0x03DA052Cu, 0x8466647Eu, 0x084BEEEAu,
+        0x0D831B09u, 0x81AE919Du, 0x9345B3F2u, 0x1F683966u, 0x1AA0CC85u, 0x968D4611u,
+        0x11312743u, 0x9D1CADD7u, 0x98D45834u, 0x14F9D2A0u, 0x5A9DAEFFu, 0xD6B0246Bu,
+        0xD378D188u, 0x5F555B1Cu, 0xD8E93A4Eu, 0x54C4B0DAu, 0x510C4539u, 0xDD21CFADu,
+        0xCFCAEDC2u, 0x43E76756u, 0x462F92B5u, 0xCA021821u, 0x4DBE7973u, 0xC193F3E7u,
+        0xC45B0604u, 0x48768C90u, 0xE18D42DAu, 0x6DA0C84Eu, 0x68683DADu, 0xE445B739u,
+        0x63F9D66Bu, 0xEFD45CFFu, 0xEA1CA91Cu, 0x66312388u, 0x74DA01E7u, 0xF8F78B73u,
+        0xFD3F7E90u, 0x7112F404u, 0xF6AE9556u, 0x7A831FC2u, 0x7F4BEA21u, 0xF36660B5u,
+        0xE383129Fu, 0x6FAE980Bu, 0x6A666DE8u, 0xE64BE77Cu, 0x61F7862Eu, 0xEDDA0CBAu,
+        0xE812F959u, 0x643F73CDu, 0x76D451A2u, 0xFAF9DB36u, 0xFF312ED5u, 0x731CA441u,
+        0xF4A0C513u, 0x788D4F87u, 0x7D45BA64u, 0xF16830F0u, 0x5893FEBAu, 0xD4BE742Eu,
+        0xD17681CDu, 0x5D5B0B59u, 0xDAE76A0Bu, 0x56CAE09Fu, 0x5302157Cu, 0xDF2F9FE8u,
+        0xCDC4BD87u, 0x41E93713u, 0x4421C2F0u, 0xC80C4864u, 0x4FB02936u, 0xC39DA3A2u,
+        0xC6555641u, 0x4A78DCD5u, 0x041CA08Au, 0x88312A1Eu, 0x8DF9DFFDu, 0x01D45569u,
+        0x8668343Bu, 0x0A45BEAFu, 0x0F8D4B4Cu, 0x83A0C1D8u, 0x914BE3B7u, 0x1D666923u,
+        0x18AE9CC0u, 0x94831654u, 0x133F7706u, 0x9F12FD92u, 0x9ADA0871u, 0x16F782E5u,
+        0xBF0C4CAFu, 0x3321C63Bu, 0x36E933D8u, 0xBAC4B94Cu, 0x3D78D81Eu, 0xB155528Au,
+        0xB49DA769u, 0x38B02DFDu, 0x2A5B0F92u, 0xA6768506u, 0xA3BE70E5u, 0x2F93FA71u,
+        0xA82F9B23u, 0x240211B7u, 0x21CAE454u, 0xADE76EC0u
+    },
+    {
+        0x00000000u, 0x216B0C9Fu, 0x42D6193Eu, 0x63BD15A1u, 0x85AC327Cu, 0xA4C73EE3u,
+        0xC77A2B42u, 0xE61127DDu, 0x9AE60EA7u, 0xBB8D0238u, 0xD8301799u, 0xF95B1B06u,
+        0x1F4A3CDBu, 0x3E213044u, 0x5D9C25E5u, 0x7CF7297Au, 0xA4727711u, 0x85197B8Eu,
+        0xE6A46E2Fu, 0xC7CF62B0u, 0x21DE456Du, 0x00B549F2u, 0x63085C53u, 0x426350CCu,
+        0x3E9479B6u, 0x1FFF7529u, 0x7C426088u, 0x5D296C17u, 0xBB384BCAu, 0x9A534755u,
+        0xF9EE52F4u, 0xD8855E6Bu, 0xD95A847Du, 0xF83188E2u, 0x9B8C9D43u, 0xBAE791DCu,
+        0x5CF6B601u, 0x7D9DBA9Eu, 0x1E20AF3Fu, 0x3F4BA3A0u, 0x43BC8ADAu, 0x62D78645u,
+        0x016A93E4u, 0x20019F7Bu, 0xC610B8A6u, 0xE77BB439u, 0x84C6A198u, 0xA5ADAD07u,
+        0x7D28F36Cu, 0x5C43FFF3u, 0x3FFEEA52u, 0x1E95E6CDu, 0xF884C110u, 0xD9EFCD8Fu,
+        0xBA52D82Eu, 0x9B39D4B1u, 0xE7CEFDCBu, 0xC6A5F154u, 0xA518E4F5u, 0x8473E86Au,
+        0x6262CFB7u, 0x4309C328u, 0x20B4D689u, 0x01DFDA16u, 0x230B62A5u, 0x02606E3Au,
+        0x61DD7B9Bu, 0x40B67704u, 0xA6A750D9u, 0x87CC5C46u, 0xE47149E7u, 0xC51A4578u,
+        0xB9ED6C02u, 0x9886609Du, 0xFB3B753Cu, 0xDA5079A3u, 0x3C415E7Eu, 0x1D2A52E1u,
+        0x7E974740u, 0x5FFC4BDFu, 0x877915B4u, 0xA612192Bu, 0xC5AF0C8Au, 0xE4C40015u,
+        0x02D527C8u, 0x23BE2B57u, 0x40033EF6u, 0x61683269u, 0x1D9F1B13u, 0x3CF4178Cu,
+        0x5F49022Du, 0x7E220EB2u, 0x9833296Fu, 0xB95825F0u, 0xDAE53051u, 0xFB8E3CCEu,
+        0xFA51E6D8u, 0xDB3AEA47u, 0xB887FFE6u, 0x99ECF379u, 0x7FFDD4A4u, 0x5E96D83Bu,
+        0x3D2BCD9Au, 0x1C40C105u, 0x60B7E87Fu, 0x41DCE4E0u, 0x2261F141u, 0x030AFDDEu,
+        0xE51BDA03u, 0xC470D69Cu, 0xA7CDC33Du, 0x86A6CFA2u, 0x5E2391C9u, 0x7F489D56u,
+        0x1CF588F7u, 0x3D9E8468u, 0xDB8FA3B5u, 0xFAE4AF2Au, 0x9959BA8Bu, 0xB832B614u,
+        0xC4C59F6Eu, 0xE5AE93F1u, 0x86138650u, 0xA7788ACFu, 0x4169AD12u, 0x6002A18Du,
+        0x03BFB42Cu, 0x22D4B8B3u, 0x4616C54Au, 0x677DC9D5u, 0x04C0DC74u, 0x25ABD0EBu,
+        0xC3BAF736u, 0xE2D1FBA9u, 0x816CEE08u, 0xA007E297u, 0xDCF0CBEDu, 0xFD9BC772u,
+        0x9E26D2D3u, 0xBF4DDE4Cu, 0x595CF991u, 0x7837F50Eu, 0x1B8AE0AFu, 0x3AE1EC30u,
+        0xE264B25Bu, 0xC30FBEC4u, 0xA0B2AB65u, 0x81D9A7FAu, 0x67C88027u, 0x46A38CB8u,
+        0x251E9919u, 0x04759586u, 0x7882BCFCu, 0x59E9B063u, 0x3A54A5C2u, 0x1B3FA95Du,
+        0xFD2E8E80u, 0xDC45821Fu, 0xBFF897BEu, 0x9E939B21u, 0x9F4C4137u, 0xBE274DA8u,
+        0xDD9A5809u, 0xFCF15496u, 0x1AE0734Bu, 0x3B8B7FD4u, 0x58366A75u, 0x795D66EAu,
+        0x05AA4F90u, 0x24C1430Fu, 0x477C56AEu, 0x66175A31u, 0x80067DECu, 0xA16D7173u,
+        0xC2D064D2u, 0xE3BB684Du, 0x3B3E3626u, 0x1A553AB9u, 0x79E82F18u, 0x58832387u,
+        0xBE92045Au, 0x9FF908C5u, 0xFC441D64u, 0xDD2F11FBu, 0xA1D83881u, 0x80B3341Eu,
+        0xE30E21BFu, 0xC2652D20u, 0x24740AFDu, 0x051F0662u, 0x66A213C3u, 0x47C91F5Cu,
+        0x651DA7EFu, 0x4476AB70u, 0x27CBBED1u, 0x06A0B24Eu, 0xE0B19593u, 0xC1DA990Cu,
+        0xA2678CADu, 0x830C8032u, 0xFFFBA948u, 0xDE90A5D7u, 0xBD2DB076u, 0x9C46BCE9u,
+        0x7A579B34u, 0x5B3C97ABu, 0x3881820Au, 0x19EA8E95u, 0xC16FD0FEu, 0xE004DC61u,
+        0x83B9C9C0u, 0xA2D2C55Fu, 0x44C3E282u, 0x65A8EE1Du, 0x0615FBBCu, 0x277EF723u,
+        0x5B89DE59u, 0x7AE2D2C6u, 0x195FC767u, 0x3834CBF8u, 0xDE25EC25u, 0xFF4EE0BAu,
+        0x9CF3F51Bu, 0xBD98F984u, 0xBC472392u, 0x9D2C2F0Du, 0xFE913AACu, 0xDFFA3633u,
+        0x39EB11EEu, 0x18801D71u, 0x7B3D08D0u, 0x5A56044Fu, 0x26A12D35u, 0x07CA21AAu,
+        0x6477340Bu, 0x451C3894u, 0xA30D1F49u, 0x826613D6u, 0xE1DB0677u, 0xC0B00AE8u,
+        0x18355483u, 0x395E581Cu, 0x5AE34DBDu, 0x7B884122u, 0x9D9966FFu, 0xBCF26A60u,
+        0xDF4F7FC1u, 0xFE24735Eu, 0x82D35A24u, 0xA3B856BBu, 0xC005431Au, 0xE16E4F85u,
+        0x077F6858u, 0x261464C7u, 0x45A97166u, 0x64C27DF9u
+    }
+};
+/* clang-format on */
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Crc_Cfg.h */
+#elif CRC_32P4_MODE == CRC_NIBBLE
+/**
+ * @brief  Nibble lookup table for CRC32P4, reflected polynomial 0xC8DF352F
+ */
+/* clang-format off */
+static const uint32 Crc_Nibble32P4[ CRC_NIBBLE_TABLE_SIZE ] =
+{
+    0x00000000u, 0x2B2C2BEEu, 0x565857DCu, 0x7D747C32u, 0xACB0AFB8u, 0x879C8456u, 0xFAE8F864u, 0xD1C4D38Au,
+    0xC8DF352Fu, 0xE3F31EC1u, 0x9E8762F3u, 0xB5AB491Du, 0x646F9A97u, 0x4F43B179u, 0x3237CD4Bu, 0x191BE6A5u
+};
+/* clang-format on */
+#endif
+
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Crc_Cfg.h */
+#if CRC_64_MODE == CRC_TABLE
+/**
+ * @brief  Lookup table for CRC64 ECMA, reflected polynomial 0xC96C5795D7870F42, each entry split
+ * in its low and high halves, kept next to each other so both are loaded from the same address
+ */
+/* clang-format off */
+static const uint32 Crc_Table64[ CRC_TABLE_SIZE ][ CRC_64_HALVES ] =
+{
+    { 0x00000000u, 0x00000000u }, { 0x03A75F6Fu, 0xB32E4CBEu }, { 0xA840A05Bu, 0xF4843657u }, { 0xABE7FF34u, 0x47AA7AE9u },
+    { 0xFF8F5E33u, 0x7BD0C384u }, { 0xFC28015Cu, 0xC8FE8F3Au }, { 0x57CFFE68u, 0x8F54F5D3u }, { 0x5468A107u, 0x3C7AB96Du },
+    { 0xFF1EBC66u, 0xF7A18709u }, { 0xFCB9E309u, 0x448FCBB7u }, { 0x575E1C3Du, 0x0325B15Eu }, { 0x54F94352u, 0xB00BFDE0u },
+    { 0x0091E255u, 0x8C71448Du }, { 0x0336BD3Au, 0x3F5F0833u }, { 0xA8D1420Eu, 0x78F572DAu }, { 0xAB761D61u, 0xCBDB3E64u },
+    { 0x51336649u, 0x7D9BA138u }, { 0x52943926u, 0xCEB5ED86u }, { 0xF973C612u, 0x891F976Fu }, { 0xFAD4997Du, 0x3A31DBD1u },
+    { 0xAEBC387Au, 0x064B62BCu }, { 0xAD1B6715u, 0xB5652E02u }, { 0x06FC9821u, 0xF2CF54EBu }, { 0x055BC74Eu, 0x41E11855u },
+    { 0xAE2DDA2Fu, 0x8A3A2631u }, { 0xAD8A8540u, 0x39146A8Fu }, { 0x066D7A74u, 0x7EBE1066u }, { 0x05CA251Bu, 0xCD905CD8u },
+    { 0x51A2841Cu, 0xF1EAE5B5u }, { 0x5205DB73u, 0x42C4A90Bu }, { 0xF9E22447u, 0x056ED3E2u }, { 0xFA457B28u, 0xB6409F5Cu },
+    { 0xA266CC92u, 0xFB374270u }, { 0xA1C193FDu, 0x48190ECEu }, { 0x0A266CC9u, 0x0FB37427u }, { 0x098133A6u, 0xBC9D3899u },
+    { 0x5DE992A1u, 0x80E781F4u }, { 0x5E4ECDCEu, 0x33C9CD4Au }, { 0xF5A932FAu, 0x7463B7A3u }, { 0xF60E6D95u, 0xC74DFB1Du },
+    { 0x5D7870F4u, 0x0C96C579u }, { 0x5EDF2F9Bu, 0xBFB889C7u }, { 0xF538D0AFu, 0xF812F32Eu }, { 0xF69F8FC0u, 0x4B3CBF90u },
+    { 0xA2F72EC7u, 0x774606FDu }, { 0xA15071A8u, 0xC4684A43u }, { 0x0AB78E9Cu, 0x83C230AAu }, { 0x0910D1F3u, 0x30EC7C14u },
+    { 0xF355AADBu, 0x86ACE348u }, { 0xF0F2F5B4u, 0x3582AFF6u }, { 0x5B150A80u, 0x7228D51Fu }, { 0x58B255EFu, 0xC10699A1u },
+    { 0x0CDAF4E8u, 0xFD7C20CCu }, { 0x0F7DAB87u, 0x4E526C72u }, { 0xA49A54B3u, 0x09F8169Bu }, { 0xA73D0BDCu, 0xBAD65A25u },
+    { 0x0C4B16BDu, 0x710D6441u }, { 0x0FEC49D2u, 0xC22328FFu }, { 0xA40BB6E6u, 0x85895216u }, { 0xA7ACE989u, 0x36A71EA8u },
+    { 0xF3C4488Eu, 0x0ADDA7C5u }, { 0xF06317E1u, 0xB9F3EB7Bu }, { 0x5B84E8D5u, 0xFE599192u }, { 0x5823B7BAu, 0x4D77DD2Cu },
+    { 0xEBC387A1u, 0x64B62BCAu }, { 0xE864D8CEu, 0xD7986774u }, { 0x438327FAu, 0x90321D9Du }, { 0x40247895u, 0x231C5123u },
+    { 0x144CD992u, 0x1F66E84Eu }, { 0x17EB86FDu, 0xAC48A4F0u }, { 0xBC0C79C9u, 0xEBE2DE19u }, { 0xBFAB26A6u, 0x58CC92A7u },
+    { 0x14DD3BC7u, 0x9317ACC3u }, { 0x177A64A8u, 0x2039E07Du }, { 0xBC9D9B9Cu, 0x67939A94u }, { 0xBF3AC4F3u, 0xD4BDD62Au },
+    { 0xEB5265F4u, 0xE8C76F47u }, { 0xE8F53A9Bu, 0x5BE923F9u }, { 0x4312C5AFu, 0x1C435910u }, { 0x40B59AC0u, 0xAF6D15AEu },
+    { 0xBAF0E1E8u, 0x192D8AF2u }, { 0xB957BE87u, 0xAA03C64Cu }, { 0x12B041B3u, 0xEDA9BCA5u }, { 0x11171EDCu, 0x5E87F01Bu },
+    { 0x457FBFDBu, 0x62FD4976u }, { 0x46D8E0B4u, 0xD1D305C8u }, { 0xED3F1F80u, 0x96797F21u }, { 0xEE9840EFu, 0x2557339Fu },
+    { 0x45EE5D8Eu, 0xEE8C0DFBu }, { 0x464902E1u, 0x5DA24145u }, { 0xEDAEFDD5u, 0x1A083BACu }, { 0xEE09A2BAu, 0xA9267712u },
+    { 0xBA6103BDu, 0x955CCE7Fu }, { 0xB9C65CD2u, 0x267282C1u }, { 0x1221A3E6u, 0x61D8F828u }, { 0x1186FC89u, 0xD2F6B496u },
+    { 0x49A54B33u, 0x9F8169BAu }, { 0x4A02145Cu, 0x2CAF2504u }, { 0xE1E5EB68u, 0x6B055FEDu }, { 0xE242B407u, 0xD82B1353u },
+    { 0xB62A1500u, 0xE451AA3Eu }, { 0xB58D4A6Fu, 0x577FE680u }, { 0x1E6AB55Bu, 0x10D59C69u }, { 0x1DCDEA34u, 0xA3FBD0D7u },
+    { 0xB6BBF755u, 0x6820EEB3u }, { 0xB51CA83Au, 0xDB0EA20Du }, { 0x1EFB570Eu, 0x9CA4D8E4u }, { 0x1D5C0861u, 0x2F8A945Au },
+    { 0x4934A966u, 0x13F02D37u }, { 0x4A93F609u, 0xA0DE6189u }, { 0xE174093Du, 0xE7741B60u }, { 0xE2D35652u, 0x545A57DEu },
+    { 0x18962D7Au, 0xE21AC882u }, { 0x1B317215u, 0x5134843Cu }, { 0xB0D68D21u, 0x169EFED5u }, { 0xB371D24Eu, 0xA5B0B26Bu },
+    { 0xE7197349u, 0x99CA0B06u }, { 0xE4BE2C26u, 0x2AE447B8u }, { 0x4F59D312u, 0x6D4E3D51u }, { 0x4CFE8C7Du, 0xDE6071EFu },
+    { 0xE788911Cu, 0x15BB4F8Bu }, { 0xE42FCE73u, 0xA6950335u }, { 0x4FC83147u, 0xE13F79DCu }, { 0x4C6F6E28u, 0x52113562u },
+    { 0x1807CF2Fu, 0x6E6B8C0Fu }, { 0x1BA09040u, 0xDD45C0B1u }, { 0xB0476F74u, 0x9AEFBA58u }, { 0xB3E0301Bu, 0x29C1F6E6u },
+    { 0xD7870F42u, 0xC96C5795u }, { 0xD420502Du, 0x7A421B2Bu }, { 0x7FC7AF19u, 0x3DE861C2u }, { 0x7C60F076u, 0x8EC62D7Cu },
+    { 0x28085171u, 0xB2BC9411u }, { 0x2BAF0E1Eu, 0x0192D8AFu }, { 0x8048F12Au, 0x4638A246u }, { 0x83EFAE45u, 0xF516EEF8u },
+    { 0x2899B324u, 0x3ECDD09Cu }, { 0x2B3EEC4Bu, 0x8DE39C22u }, { 0x80D9137Fu, 0xCA49E6CBu }, { 0x837E4C10u, 0x7967AA75u },
+    { 0xD716ED17u, 0x451D1318u }, { 0xD4B1B278u, 0xF6335FA6u }, { 0x7F564D4Cu, 0xB199254Fu }, { 0x7CF11223u, 0x02B769F1u },
+    { 0x86B4690Bu, 0xB4F7F6ADu }, { 0x85133664u, 0x07D9BA13u }, { 0x2EF4C950u, 0x4073C0FAu }, { 0x2D53963Fu, 0xF35D8C44u },
+    { 0x793B3738u, 0xCF273529u }, { 0x7A9C6857u, 0x7C097997u }, { 0xD17B9763u, 0x3BA3037Eu }, { 0xD2DCC80Cu, 0x888D4FC0u },
+    { 0x79AAD56Du, 0x435671A4u }, { 0x7A0D8A02u, 0xF0783D1Au }, { 0xD1EA7536u, 0xB7D247F3u }, { 0xD24D2A59u, 0x04FC0B4Du },
+    { 0x86258B5Eu, 0x3886B220u }, { 0x8582D431u, 0x8BA8FE9Eu }, { 0x2E652B05u, 0xCC028477u }, { 0x2DC2746Au, 0x7F2CC8C9u },
+    { 0x75E1C3D0u, 0x325B15E5u }, { 0x76469CBFu, 0x8175595Bu }, { 0xDDA1638Bu, 0xC6DF23B2u }, { 0xDE063CE4u, 0x75F16F0Cu },
+    { 0x8A6E9DE3u, 0x498BD661u }, { 0x89C9C28Cu, 0xFAA59ADFu }, { 0x222E3DB8u, 0xBD0FE036u }, { 0x218962D7u, 0x0E21AC88u },
+    { 0x8AFF7FB6u, 0xC5FA92ECu }, { 0x895820D9u, 0x76D4DE52u }, { 0x22BFDFEDu, 0x317EA4BBu }, { 0x21188082u, 0x8250E805u },
+    { 0x75702185u, 0xBE2A5168u }, { 0x76D77EEAu, 0x0D041DD6u }, { 0xDD3081DEu, 0x4AAE673Fu }, { 0xDE97DEB1u, 0xF9802B81u },
+    { 0x24D2A599u, 0x4FC0B4DDu }, { 0x2775FAF6u, 0xFCEEF863u }, { 0x8C9205C2u, 0xBB44828Au }, { 0x8F355AADu, 0x086ACE34u },
+    { 0xDB5DFBAAu, 0x34107759u }, { 0xD8FAA4C5u, 0x873E3BE7u }, { 0x731D5BF1u, 0xC094410Eu }, { 0x70BA049Eu, 0x73BA0DB0u },
+    { 0xDBCC19FFu, 0xB86133D4u }, { 0xD86B4690u, 0x0B4F7F6Au }, { 0x738CB9A4u, 0x4CE50583u }, { 0x702BE6CBu, 0xFFCB493Du },
+    { 0x244347CCu, 0xC3B1F050u }, { 0x27E418A3u, 0x709FBCEEu }, { 0x8C03E797u, 0x3735C607u }, { 0x8FA4B8F8u, 0x841B8AB9u },
+    { 0x3C4488E3u, 0xADDA7C5Fu }, { 0x3FE3D78Cu, 0x1EF430E1u }, { 0x940428B8u, 0x595E4A08u }, { 0x97A377D7u, 0xEA7006B6u },
+    { 0xC3CBD6D0u, 0xD60ABFDBu }, { 0xC06C89BFu, 0x6524F365u }, { 0x6B8B768Bu, 0x228E898Cu }, { 0x682C29E4u, 0x91A0C532u },
+    { 0xC35A3485u, 0x5A7BFB56u }, { 0xC0FD6BEAu, 0xE955B7E8u }, { 0x6B1A94DEu, 0xAEFFCD01u }, { 0x68BDCBB1u, 0x1DD181BFu },
+    { 0x3CD56AB6u, 0x21AB38D2u }, { 0x3F7235D9u, 0x9285746Cu }, { 0x9495CAEDu, 0xD52F0E85u }, { 0x97329582u, 0x6601423Bu },
+    { 0x6D77EEAAu, 0xD041DD67u }, { 0x6ED0B1C5u, 0x636F91D9u }, { 0xC5374EF1u, 0x24C5EB30u }, { 0xC690119Eu, 0x97EBA78Eu },
+    { 0x92F8B099u, 0xAB911EE3u }, { 0x915FEFF6u, 0x18BF525Du }, { 0x3AB810C2u, 0x5F1528B4u }, { 0x391F4FADu, 0xEC3B640Au },
+    { 0x926952CCu, 0x27E05A6Eu }, { 0x91CE0DA3u, 0x94CE16D0u }, { 0x3A29F297u, 0xD3646C39u }, { 0x398EADF8u, 0x604A2087u },
+    { 0x6DE60CFFu, 0x5C3099EAu }, { 0x6E415390u, 0xEF1ED554u }, { 0xC5A6ACA4u, 0xA8B4AFBDu }, { 0xC601F3CBu, 0x1B9AE303u },
+    { 0x9E224471u, 0x56ED3E2Fu }, { 0x9D851B1Eu, 0xE5C37291u }, { 0x3662E42Au, 0xA2690878u }, { 0x35C5BB45u, 0x114744C6u },
+    { 0x61AD1A42u, 0x2D3DFDABu }, { 0x620A452Du, 0x9E13B115u }, { 0xC9EDBA19u, 0xD9B9CBFCu }, { 0xCA4AE576u, 0x6A978742u },
+    { 0x613CF817u, 0xA14CB926u }, { 0x629BA778u, 0x1262F598u }, { 0xC97C584Cu, 0x55C88F71u }, { 0xCADB0723u, 0xE6E6C3CFu },
+    { 0x9EB3A624u, 0xDA9C7AA2u }, { 0x9D14F94Bu, 0x69B2361Cu }, { 0x36F3067Fu, 0x2E184CF5u }, { 0x35545910u, 0x9D36004Bu },
+    { 0xCF112238u, 0x2B769F17u }, { 0xCCB67D57u, 0x9858D3A9u }, { 0x67518263u, 0xDFF2A940u }, { 0x64F6DD0Cu, 0x6CDCE5FEu },
+    { 0x309E7C0Bu, 0x50A65C93u }, { 0x33392364u, 0xE388102Du }, { 0x98DEDC50u, 0xA4226AC4u }, { 0x9B79833Fu, 0x170C267Au },
+    { 0x300F9E5Eu, 0xDCD7181Eu }, { 0x33A8C131u, 0x6FF954A0u }, { 0x984F3E05u, 0x28532E49u }, { 0x9BE8616Au, 0x9B7D62F7u },
+    { 0xCF80C06Du, 0xA707DB9Au }, { 0xCC279F02u, 0x14299724u }, { 0x67C06036u, 0x5383EDCDu }, { 0x64673F59u, 0xE0ADA173u }
+};
+/* clang-format on */
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Crc_Cfg.h */
+#elif CRC_64_MODE == CRC_SLICE4
+/**
+ * @brief  Slicing by 4 lookup tables for CRC64 ECMA, reflected polynomial 0xC96C5795D7870F42,
+ * split in low and high halves of each entry
+ */
+/* clang-format off */
+static const uint32 Crc_Table64Slice4[ CRC_SLICE4_TABLES ][ CRC_64_HALVES ][ CRC_TABLE_SIZE ] =
+{
+    {
+        {
+            0x00000000u, 0x03A75F6Fu, 0xA840A05Bu, 0xABE7FF34u, 0xFF8F5E33u, 0xFC28015Cu,
+            0x57CFFE68u, 0x5468A107u, 0xFF1EBC66u, 0xFCB9E309u, 0x575E1C3Du, 0x54F94352u,
+            0x0091E255u, 0x0336BD3Au, 0xA8D1420Eu, 0xAB761D61u, 0x51336649u, 0x52943926u,
+            0xF973C612u, 0xFAD4997Du, 0xAEBC387Au, 0xAD1B6715u, 0x06FC9821u, 0x055BC74Eu,
+            0xAE2DDA2Fu, 0xAD8A8540u, 0x066D7A74u, 0x05CA251Bu, 0x51A2841Cu, 0x5205DB73u,
+            0xF9E22447u, 0xFA457B28u, 0xA266CC92u, 0xA1C193FDu, 0x0A266CC9u, 0x098133A6u,
+            0x5DE992A1u, 0x5E4ECDCEu, 0xF5A932FAu, 0xF60E6D95u, 0x5D7870F4u, 0x5EDF2F9Bu,
+            0xF538D0AFu, 0xF69F8FC0u, 0xA2F72EC7u, 0xA15071A8u, 0x0AB78E9Cu, 0x0910D1F3u,
+            0xF355AADBu, 0xF0F2F5B4u, 0x5B150A80u, 0x58B255EFu, 0x0CDAF4E8u, 0x0F7DAB87u,
+            0xA49A54B3u, 0xA73D0BDCu, 0x0C4B16BDu, 0x0FEC49D2u, 0xA40BB6E6u, 0xA7ACE989u,
+            0xF3C4488Eu, 0xF06317E1u, 0x5B84E8D5u, 0x5823B7BAu, 0xEBC387A1u, 0xE864D8CEu,
+            0x438327FAu, 0x40247895u, 0x144CD992u, 0x17EB86FDu, 0xBC0C79C9u, 0xBFAB26A6u,
+            0x14DD3BC7u, 0x177A64A8u, 0xBC9D9B9Cu, 0xBF3AC4F3u, 0xEB5265F4u, 0xE8F53A9Bu,
+            0x4312C5AFu, 0x40B59AC0u, 0xBAF0E1E8u, 0xB957BE87u, 0x12B041B3u, 0x11171EDCu,
+            0x457FBFDBu, 0x46D8E0B4u, 0xED3F1F80u, 0xEE9840EFu, 0x45EE5D8Eu, 0x464902E1u,
+            0xEDAEFDD5u, 0xEE09A2BAu, 0xBA6103BDu, 0xB9C65CD2u, 0x1221A3E6u, 0x1186FC89u,
+            0x49A54B33u, 0x4A02145Cu, 0xE1E5EB68u, 0xE242B407u, 0xB62A1500u, 0xB58D4A6Fu,
+            0x1E6AB55Bu, 0x1DCDEA34u, 0xB6BBF755u, 0xB51CA83Au, 0x1EFB570Eu, 0x1D5C0861u,
+            0x4934A966u, 0x4A93F609u, 0xE174093Du, 0xE2D35652u, 0x18962D7Au, 0x1B317215u,
+            0xB0D68D21u, 0xB371D24Eu, 0xE7197349u, 0xE4BE2C26u, 0x4F59D312u, 0x4CFE8C7Du,
+            0xE788911Cu, 0xE42FCE73u, 0x4FC83147u, 0x4C6F6E28u, 0x1807CF2Fu, 0x1BA09040u,
+            0xB0476F74u, 0xB3E0301Bu, 0xD7870F42u, 0xD420502Du, 0x7FC7AF19u, 0x7C60F076u,
+            0x28085171u, 0x2BAF0E1Eu, 0x8048F12Au, 0x83EFAE45u, 0x2899B324u, 0x2B3EEC4Bu,
+            0x80D9137Fu, 0x837E4C10u, 0xD716ED17u, 0xD4B1B278u, 0x7F564D4Cu, 0x7CF11223u,
+            0x86B4690Bu, 0x85133664u, 0x2EF4C950u, 0x2D53963Fu, 0x793B3738u, 0x7A9C6857u,
+            0xD17B9763u, 0xD2DCC80Cu, 0x79AAD56Du, 0x7A0D8A02u, 0xD1EA7536u, 0xD24D2A59u,
+            0x86258B5Eu, 0x8582D431u, 0x2E652B05u, 0x2DC2746Au, 0x75E1C3D0u, 0x76469CBFu,
+            0xDDA1638Bu, 0xDE063CE4u, 0x8A6E9DE3u, 0x89C9C28Cu, 0x222E3DB8u, 0x218962D7u,
+            0x8AFF7FB6u, 0x895820D9u, 0x22BFDFEDu, 0x21188082u, 0x75702185u, 0x76D77EEAu,
+            0xDD3081DEu, 0xDE97DEB1u, 0x24D2A599u, 0x2775FAF6u, 0x8C9205C2u, 0x8F355AADu,
+            0xDB5DFBAAu, 0xD8FAA4C5u, 0x731D5BF1u, 0x70BA049Eu, 0xDBCC19FFu, 0xD86B4690u,
+            0x738CB9A4u, 0x702BE6CBu, 0x244347CCu, 0x27E418A3u, 0x8C03E797u, 0x8FA4B8F8u,
+            0x3C4488E3u, 0x3FE3D78Cu, 0x940428B8u, 0x97A377D7u, 0xC3CBD6D0u, 0xC06C89BFu,
+            0x6B8B768Bu, 0x682C29E4u, 0xC35A3485u, 0xC0FD6BEAu, 0x6B1A94DEu, 0x68BDCBB1u,
+            0x3CD56AB6u, 0x3F7235D9u, 0x9495CAEDu, 0x97329582u, 0x6D77EEAAu, 0x6ED0B1C5u,
+            0xC5374EF1u, 0xC690119Eu, 0x92F8B099u, 0x915FEFF6u, 0x3AB810C2u, 0x391F4FADu,
+            0x926952CCu, 0x91CE0DA3u, 0x3A29F297u, 0x398EADF8u, 0x6DE60CFFu, 0x6E415390u,
+            0xC5A6ACA4u, 0xC601F3CBu, 0x9E224471u, 0x9D851B1Eu, 0x3662E42Au, 0x35C5BB45u,
+            0x61AD1A42u, 0x620A452Du, 0xC9EDBA19u, 0xCA4AE576u, 0x613CF817u, 0x629BA778u,
+            0xC97C584Cu, 0xCADB0723u, 0x9EB3A624u, 0x9D14F94Bu, 0x36F3067Fu, 0x35545910u,
+            0xCF112238u, 0xCCB67D57u, 0x67518263u, 0x64F6DD0Cu, 0x309E7C0Bu, 0x33392364u,
+            0x98DEDC50u, 0x9B79833Fu, 0x300F9E5Eu, 0x33A8C131u, 0x984F3E05u, 0x9BE8616Au,
+            0xCF80C06Du, 0xCC279F02u, 0x67C06036u, 0x64673F59u
+        },
+        {
+            0x00000000u, 0xB32E4CBEu, 0xF4843657u, 0x47AA7AE9u, 0x7BD0C384u, 0xC8FE8F3Au,
+            0x8F54F5D3u, 0x3C7AB96Du, 0xF7A18709u, 0x448FCBB7u, 0x0325B15Eu, 0xB00BFDE0u,
+            0x8C71448Du, 0x3F5F0833u, 0x78F572DAu, 0xCBDB3E64u, 0x7D9BA138u, 0xCEB5ED86u,
+            0x891F976Fu, 0x3A31DBD1u, 0x064B62BCu, 0xB5652E02u, 0xF2CF54EBu, 0x41E11855u,
+            0x8A3A2631u, 0x39146A8Fu, 0x7EBE1066u, 0xCD905CD8u, 0xF1EAE5B5u, 0x42C4A90Bu,
+            0x056ED3E2u, 0xB6409F5Cu, 0xFB374270u, 0x48190ECEu, 0x0FB37427u, 0xBC9D3899u,
+            0x80E781F4u, 0x33C9CD4Au, 0x7463B7A3u, 0xC74DFB1Du, 0x0C96C579u, 0xBFB889C7u,
+            0xF812F32Eu, 0x4B3CBF90u, 0x774606FDu, 0xC4684A43u, 0x83C230AAu, 0x30EC7C14u,
+            0x86ACE348u, 0x3582AFF6u, 0x7228D51Fu, 0xC10699A1u, 0xFD7C20CCu, 0x4E526C72u,
+            0x09F8169Bu, 0xBAD65A25u, 0x710D6441u, 0xC22328FFu, 0x85895216u, 0x36A71EA8u,
+            0x0ADDA7C5u, 0xB9F3EB7Bu, 0xFE599192u, 0x4D77DD2Cu, 0x64B62BCAu, 0xD7986774u,
+            0x90321D9Du, 0x231C5123u, 0x1F66E84Eu, 0xAC48A4F0u, 0xEBE2DE19u, 0x58CC92A7u,
+            0x9317ACC3u, 0x2039E07Du, 0x67939A94u, 0xD4BDD62Au, 0xE8C76F47u, 0x5BE923F9u,
+            0x1C435910u, 0xAF6D15AEu, 0x192D8AF2u, 0xAA03C64Cu, 0xEDA9BCA5u, 0x5E87F01Bu,
+            0x62FD4976u, 0xD1D305C8u, 0x96797F21u, 0x2557339Fu, 0xEE8C0DFBu, 0x5DA24145u,
+            0x1A083BACu, 0xA9267712u, 0x955CCE7Fu, 0x267282C1u, 0x61D8F828u, 0xD2F6B496u,
+            0x9F8169BAu, 0x2CAF2504u, 0x6B055FEDu, 0xD82B1353u, 0xE451AA3Eu, 0x577FE680u,
+            0x10D59C69u, 0xA3FBD0D7u, 0x6820EEB3u, 0xDB0EA20Du, 0x9CA4D8E4u, 0x2F8A945Au,
+            0x13F02D37u, 0xA0DE6189u, 0xE7741B60u, 0x545A57DEu, 0xE21AC882u, 0x5134843Cu,
+            0x169EFED5u, 0xA5B0B26Bu, 0x99CA0B06u, 0x2AE447B8u, 0x6D4E3D51u, 0xDE6071EFu,
+            0x15BB4F8Bu, 0xA6950335u, 0xE13F79DCu, 0x52113562u, 0x6E6B8C0Fu, 0xDD45C0B1u,
+            0x9AEFBA58u, 0x29C1F6E6u, 0xC96C5795u, 0x7A421B2Bu, 0x3DE861C2u, 0x8EC62D7Cu,
+            0xB2BC9411u, 0x0192D8AFu, 0x4638A246u, 0xF516EEF8u, 0x3ECDD09Cu, 0x8DE39C22u,
+            0xCA49E6CBu, 0x7967AA75u, 0x451D1318u, 0xF6335FA6u, 0xB199254Fu, 0x02B769F1u,
+            0xB4F7F6ADu, 0x07D9BA13u, 0x4073C0FAu, 0xF35D8C44u, 0xCF273529u, 0x7C097997u,
+            0x3BA3037Eu, 0x888D4FC0u, 0x435671A4u, 0xF0783D1Au, 0xB7D247F3u, 0x04FC0B4Du,
+            0x3886B220u, 0x8BA8FE9Eu, 0xCC028477u, 0x7F2CC8C9u, 0x325B15E5u, 0x8175595Bu,
+            0xC6DF23B2u, 0x75F16F0Cu, 0x498BD661u, 0xFAA59ADFu, 0xBD0FE036u, 0x0E21AC88u,
+            0xC5FA92ECu, 0x76D4DE52u, 0x317EA4BBu, 0x8250E805u, 0xBE2A5168u, 0x0D041DD6u,
+            0x4AAE673Fu, 0xF9802B81u, 0x4FC0B4DDu, 0xFCEEF863u, 0xBB44828Au, 0x086ACE34u,
+            0x34107759u, 0x873E3BE7u, 0xC094410Eu, 0x73BA0DB0u, 0xB86133D4u, 0x0B4F7F6Au,
+            0x4CE50583u, 0xFFCB493Du, 0xC3B1F050u, 0x709FBCEEu, 0x3735C607u, 0x841B8AB9u,
+            0xADDA7C5Fu, 0x1EF430E1u, 0x595E4A08u, 0xEA7006B6u, 0xD60ABFDBu, 0x6524F365u,
+            0x228E898Cu, 0x91A0C532u, 0x5A7BFB56u, 0xE955B7E8u, 0xAEFFCD01u, 0x1DD181BFu,
+            0x21AB38D2u, 0x9285746Cu, 0xD52F0E85u, 0x6601423Bu, 0xD041DD67u, 0x636F91D9u,
+            0x24C5EB30u, 0x97EBA78Eu, 0xAB911EE3u, 0x18BF525Du, 0x5F1528B4u, 0xEC3B640Au,
+            0x27E05A6Eu, 0x94CE16D0u, 0xD3646C39u, 0x604A2087u, 0x5C3099EAu, 0xEF1ED554u,
+            0xA8B4AFBDu, 0x1B9AE303u, 0x56ED3E2Fu, 0xE5C37291u, 0xA2690878u, 0x114744C6u,
+            0x2D3DFDABu, 0x9E13B115u, 0xD9B9CBFCu, 0x6A978742u, 0xA14CB926u, 0x1262F598u,
+            0x55C88F71u, 0xE6E6C3CFu, 0xDA9C7AA2u, 0x69B2361Cu, 0x2E184CF5u, 0x9D36004Bu,
+            0x2B769F17u, 0x9858D3A9u, 0xDFF2A940u, 0x6CDCE5FEu, 0x50A65C93u, 0xE388102Du,
+            0xA4226AC4u, 0x170C267Au, 0xDCD7181Eu, 0x6FF954A0u, 0x28532E49u, 0x9B7D62F7u,
+            0xA707DB9Au, 0x14299724u, 0x5383EDCDu, 0xE0ADA173u
+        }
+    },
+    {
+        {
+            0x00000000u, 0x5CD0F10Du, 0xB9A1E21Au, 0xE5711317u, 0xDC4DDAB1u, 0x809D2BBCu,
+            0x65EC38ABu, 0x393CC9A6u, 0x1795ABE7u, 0x4B455AEAu, 0xAE3449FDu, 0xF2E4B8F0u,
+            0xCBD87156u, 0x9708805Bu, 0x7279934Cu, 0x2EA96241u, 0x2F2B57CEu, 0x73FBA6C3u,
+            0x968AB5D4u, 0xCA5A44D9u, 0xF3668D7Fu, 0xAFB67C72u, 0x4AC76F65u, 0x16179E68u,
+            0x38BEFC29u, 0x646E0D24u, 0x811F1E33u, 0xDDCFEF3Eu, 0xE4F32698u, 0xB823D795u,
+            0x5D52C482u, 0x0182358Fu, 0x5E56AF9Cu, 0x02865E91u, 0xE7F74D86u, 0xBB27BC8Bu,
+            0x821B752Du, 0xDECB8420u, 0x3BBA9737u, 0x676A663Au, 0x49C3047Bu, 0x1513F576u,
+            0xF062E661u, 0xACB2176Cu, 0x958EDECAu, 0xC95E2FC7u, 0x2C2F3CD0u, 0x70FFCDDDu,
+            0x717DF852u, 0x2DAD095Fu, 0xC8DC1A48u, 0x940CEB45u, 0xAD3022E3u, 0xF1E0D3EEu,
+            0x1491C0F9u, 0x484131F4u, 0x66E853B5u, 0x3A38A2B8u, 0xDF49B1AFu, 0x839940A2u,
+            0xBAA58904u, 0xE6757809u, 0x03046B1Eu, 0x5FD49A13u, 0xBCAD5F38u, 0xE07DAE35u,
+            0x050CBD22u, 0x59DC4C2Fu, 0x60E08589u, 0x3C307484u, 0xD9416793u, 0x8591969Eu,
+            0xAB38F4DFu, 0xF7E805D2u, 0x129916C5u, 0x4E49E7C8u, 0x77752E6Eu, 0x2BA5DF63u,
+            0xCED4CC74u, 0x92043D79u, 0x938608F6u, 0xCF56F9FBu, 0x2A27EAECu, 0x76F71BE1u,
+            0x4FCBD247u, 0x131B234Au, 0xF66A305Du, 0xAABAC150u, 0x8413A311u, 0xD8C3521Cu,
+            0x3DB2410Bu, 0x6162B006u, 0x585E79A0u, 0x048E88ADu, 0xE1FF9BBAu, 0xBD2F6AB7u,
+            0xE2FBF0A4u, 0xBE2B01A9u, 0x5B5A12BEu, 0x078AE3B3u, 0x3EB62A15u, 0x6266DB18u,
+            0x8717C80Fu, 0xDBC73902u, 0xF56E5B43u, 0xA9BEAA4Eu, 0x4CCFB959u, 0x101F4854u,
+            0x292381F2u, 0x75F370FFu, 0x908263E8u, 0xCC5292E5u, 0xCDD0A76Au, 0x91005667u,
+            0x74714570u, 0x28A1B47Du, 0x119D7DDBu, 0x4D4D8CD6u, 0xA83C9FC1u, 0xF4EC6ECCu,
+            0xDA450C8Du, 0x8695FD80u, 0x63E4EE97u, 0x3F341F9Au, 0x0608D63Cu, 0x5AD82731u,
+            0xBFA93426u, 0xE379C52Bu, 0xD654A0F5u, 0x8A8451F8u, 0x6FF542EFu, 0x3325B3E2u,
+            0x0A197A44u, 0x56C98B49u, 0xB3B8985Eu, 0xEF686953u, 0xC1C10B12u, 0x9D11FA1Fu,
+            0x7860E908u, 0x24B01805u, 0x1D8CD1A3u, 0x415C20AEu, 0xA42D33B9u, 0xF8FDC2B4u,
+            0xF97FF73Bu, 0xA5AF0636u, 0x40DE1521u, 0x1C0EE42Cu, 0x25322D8Au, 0x79E2DC87u,
+            0x9C93CF90u, 0xC0433E9Du, 0xEEEA5CDCu, 0xB23AADD1u, 0x574BBEC6u, 0x0B9B4FCBu,
+            0x32A7866Du, 0x6E777760u, 0x8B066477u, 0xD7D6957Au, 0x88020F69u, 0xD4D2FE64u,
+            0x31A3ED73u, 0x6D731C7Eu, 0x544FD5D8u, 0x089F24D5u, 0xEDEE37C2u, 0xB13EC6CFu,
+            0x9F97A48Eu, 0xC3475583u, 0x26364694u, 0x7AE6B799u, 0x43DA7E3Fu, 0x1F0A8F32u,
+            0xFA7B9C25u, 0xA6AB6D28u, 0xA72958A7u, 0xFBF9A9AAu, 0x1E88BABDu, 0x42584BB0u,
+            0x7B648216u, 0x27B4731Bu, 0xC2C5600Cu, 0x9E159101u, 0xB0BCF340u, 0xEC6C024Du,
+            0x091D115Au, 0x55CDE057u, 0x6CF129F1u, 0x3021D8FCu, 0xD550CBEBu, 0x89803AE6u,
+            0x6AF9FFCDu, 0x36290EC0u, 0xD3581DD7u, 0x8F88ECDAu, 0xB6B4257Cu, 0xEA64D471u,
+            0x0F15C766u, 0x53C5366Bu, 0x7D6C542Au, 0x21BCA527u, 0xC4CDB630u, 0x981D473Du,
+            0xA1218E9Bu, 0xFDF17F96u, 0x18806C81u, 0x44509D8Cu, 0x45D2A803u, 0x1902590Eu,
+            0xFC734A19u, 0xA0A3BB14u, 0x999F72B2u, 0xC54F83BFu, 0x203E90A8u, 0x7CEE61A5u,
+            0x524703E4u, 0x0E97F2E9u, 0xEBE6E1FEu, 0xB73610F3u, 0x8E0AD955u, 0xD2DA2858u,
+            0x37AB3B4Fu, 0x6B7BCA42u, 0x34AF5051u, 0x687FA15Cu, 0x8D0EB24Bu, 0xD1DE4346u,
+            0xE8E28AE0u, 0xB4327BEDu, 0x514368FAu, 0x0D9399F7u, 0x233AFBB6u, 0x7FEA0ABBu,
+            0x9A9B19ACu, 0xC64BE8A1u, 0xFF772107u, 0xA3A7D00Au, 0x46D6C31Du, 0x1A063210u,
+            0x1B84079Fu, 0x4754F692u, 0xA225E585u, 0xFEF51488u, 0xC7C9DD2Eu, 0x9B192C23u,
+            0x7E683F34u, 0x22B8CE39u, 0x0C11AC78u, 0x50C15D75u, 0xB5B04E62u, 0xE960BF6Fu,
+            0xD05C76C9u, 0x8C8C87C4u, 0x69FD94D3u, 0x352D65DEu
+        },
+        {
+            0x00000000u, 0x54E97992u, 0xA9D2F324u, 0xFD3B8AB6u, 0xC17D4962u, 0x959430F0u,
+            0x68AFBA46u, 0x3C46C3D4u, 0x10223DEEu, 0x44CB447Cu, 0xB9F0CECAu, 0xED19B758u,
+            0xD15F748Cu, 0x85B60D1Eu, 0x788D87A8u, 0x2C64FE3Au, 0x20447BDCu, 0x74AD024Eu,
+            0x899688F8u, 0xDD7FF16Au, 0xE13932BEu, 0xB5D04B2Cu, 0x48EBC19Au, 0x1C02B808u,
+            0x30664632u, 0x648F3FA0u, 0x99B4B516u, 0xCD5DCC84u, 0xF11B0F50u, 0xA5F276C2u,
+            0x58C9FC74u, 0x0C2085E6u, 0x4088F7B8u, 0x14618E2Au, 0xE95A049Cu, 0xBDB37D0Eu,
+            0x81F5BEDAu, 0xD51CC748u, 0x28274DFEu, 0x7CCE346Cu, 0x50AACA56u, 0x0443B3C4u,
+            0xF9783972u, 0xAD9140E0u, 0x91D78334u, 0xC53EFAA6u, 0x38057010u, 0x6CEC0982u,
+            0x60CC8C64u, 0x3425F5F6u, 0xC91E7F40u, 0x9DF706D2u, 0xA1B1C506u, 0xF558BC94u,
+            0x08633622u, 0x5C8A4FB0u, 0x70EEB18Au, 0x2407C818u, 0xD93C42AEu, 0x8DD53B3Cu,
+            0xB193F8E8u, 0xE57A817Au, 0x18410BCCu, 0x4CA8725Eu, 0x8111EF70u, 0xD5F896E2u,
+            0x28C31C54u, 0x7C2A65C6u, 0x406CA612u, 0x1485DF80u, 0xE9BE5536u, 0xBD572CA4u,
+            0x9133D29Eu, 0xC5DAAB0Cu, 0x38E121BAu, 0x6C085828u, 0x504E9BFCu, 0x04A7E26Eu,
+            0xF99C68D8u, 0xAD75114Au, 0xA15594ACu, 0xF5BCED3Eu, 0x08876788u, 0x5C6E1E1Au,
+            0x6028DDCEu, 0x34C1A45Cu, 0xC9FA2EEAu, 0x9D135778u, 0xB177A942u, 0xE59ED0D0u,
+            0x18A55A66u, 0x4C4C23F4u, 0x700AE020u, 0x24E399B2u, 0xD9D81304u, 0x8D316A96u,
+            0xC19918C8u, 0x9570615Au, 0x684BEBECu, 0x3CA2927Eu, 0x00E451AAu, 0x540D2838u,
+            0xA936A28Eu, 0xFDDFDB1Cu, 0xD1BB2526u, 0x85525CB4u, 0x7869D602u, 0x2C80AF90u,
+            0x10C66C44u, 0x442F15D6u, 0xB9149F60u, 0xEDFDE6F2u, 0xE1DD6314u, 0xB5341A86u,
+            0x480F9030u, 0x1CE6E9A2u, 0x20A02A76u, 0x744953E4u, 0x8972D952u, 0xDD9BA0C0u,
+            0xF1FF5EFAu, 0xA5162768u, 0x582DADDEu, 0x0CC4D44Cu, 0x30821798u, 0x646B6E0Au,
+            0x9950E4BCu, 0xCDB99D2Eu, 0x90FB71CAu, 0xC4120858u, 0x392982EEu, 0x6DC0FB7Cu,
+            0x518638A8u, 0x056F413Au, 0xF854CB8Cu, 0xACBDB21Eu, 0x80D94C24u, 0xD43035B6u,
+            0x290BBF00u, 0x7DE2C692u, 0x41A40546u, 0x154D7CD4u, 0xE876F662u, 0xBC9F8FF0u,
+            0xB0BF0A16u, 0xE4567384u, 0x196DF932u, 0x4D8480A0u, 0x71C24374u, 0x252B3AE6u,
+            0xD810B050u, 0x8CF9C9C2u, 0xA09D37F8u, 0xF4744E6Au, 0x094FC4DCu, 0x5DA6BD4Eu,
+            0x61E07E9Au, 0x35090708u, 0xC8328DBEu, 0x9CDBF42Cu, 0xD0738672u, 0x849AFFE0u,
+            0x79A17556u, 0x2D480CC4u, 0x110ECF10u, 0x45E7B682u, 0xB8DC3C34u, 0xEC3545A6u,
+            0xC051BB9Cu, 0x94B8C20Eu, 0x698348B8u, 0x3D6A312Au, 0x012CF2FEu, 0x55C58B6Cu,
+            0xA8FE01DAu, 0xFC177848u, 0xF037FDAEu, 0xA4DE843Cu, 0x59E50E8Au, 0x0D0C7718u,
+            0x314AB4CCu, 0x65A3CD5Eu, 0x989847E8u, 0xCC713E7Au, 0xE015C040u, 0xB4FCB9D2u,
+            0x49C73364u, 0x1D2E4AF6u, 0x21688922u, 0x7581F0B0u, 0x88BA7A06u, 0xDC530394u,
+            0x11EA9EBAu, 0x4503E728u, 0xB8386D9Eu, 0xECD1140Cu, 0xD097D7D8u, 0x847EAE4Au,
+            0x794524FCu, 0x2DAC5D6Eu, 0x01C8A354u, 0x5521DAC6u, 0xA81A5070u, 0xFCF329E2u,
+            0xC0B5EA36u, 0x945C93A4u, 0x69671912u, 0x3D8E6080u, 0x31AEE566u, 0x65479CF4u,
+            0x987C1642u, 0xCC956FD0u, 0xF0D3AC04u, 0xA43AD596u, 0x59015F20u, 0x0DE826B2u,
+            0x218CD888u, 0x7565A11Au, 0x885E2BACu, 0xDCB7523Eu, 0xE0F191EAu, 0xB418E878u,
+            0x492362CEu, 0x1DCA1B5Cu, 0x51626902u, 0x058B1090u, 0xF8B09A26u, 0xAC59E3B4u,
+            0x901F2060u, 0xC4F659F2u, 0x39CDD344u, 0x6D24AAD6u, 0x414054ECu, 0x15A92D7Eu,
+            0xE892A7C8u, 0xBC7BDE5Au, 0x803D1D8Eu, 0xD4D4641Cu, 0x29EFEEAAu, 0x7D069738u,
+            0x712612DEu, 0x25CF6B4Cu, 0xD8F4E1FAu, 0x8C1D9868u, 0xB05B5BBCu, 0xE4B2222Eu,
+            0x1989A898u, 0x4D60D10Au, 0x61042F30u, 0x35ED56A2u, 0xC8D6DC14u, 0x9C3FA586u,
+            0xA0796652u, 0xF4901FC0u, 0x09AB9576u, 0x5D42ECE4u
+        }
+    },
+    {
+        {
+            0x00000000u, 0x916A6DCBu, 0x22D4DB96u, 0xB3BEB65Du, 0x45A9B72Cu, 0xD4C3DAE7u,
+            0x677D6CBAu, 0xF6170171u, 0x245D70DDu, 0xB5371D16u, 0x0689AB4Bu, 0x97E3C680u,
+            0x61F4C7F1u, 0xF09EAA3Au, 0x43201C67u, 0xD24A71ACu, 0x48BAE1BAu, 0xD9D08C71u,
+            0x6A6E3A2Cu, 0xFB0457E7u, 0x0D135696u, 0x9C793B5Du, 0x2FC78D00u, 0xBEADE0CBu,
+            0x6CE79167u, 0xFD8DFCACu, 0x4E334AF1u, 0xDF59273Au, 0x294E264Bu, 0xB8244B80u,
+            0x0B9AFDDDu, 0x9AF09016u, 0x3E7BDDF1u, 0xAF11B03Au, 0x1CAF0667u, 0x8DC56BACu,
+            0x7BD26ADDu, 0xEAB80716u, 0x5906B14Bu, 0xC86CDC80u, 0x1A26AD2Cu, 0x8B4CC0E7u,
+            0x38F276BAu, 0xA9981B71u, 0x5F8F1A00u, 0xCEE577CBu, 0x7D5BC196u, 0xEC31AC5Du,
+            0x76C13C4Bu, 0xE7AB5180u, 0x5415E7DDu, 0xC57F8A16u, 0x33688B67u, 0xA202E6ACu,
+            0x11BC50F1u, 0x80D63D3Au, 0x529C4C96u, 0xC3F6215Du, 0x70489700u, 0xE122FACBu,
+            0x1735FBBAu, 0x865F9671u, 0x35E1202Cu, 0xA48B4DE7u, 0x7CF7BBE2u, 0xED9DD629u,
+            0x5E236074u, 0xCF490DBFu, 0x395E0CCEu, 0xA8346105u, 0x1B8AD758u, 0x8AE0BA93u,
+            0x58AACB3Fu, 0xC9C0A6F4u, 0x7A7E10A9u, 0xEB147D62u, 0x1D037C13u, 0x8C6911D8u,
+            0x3FD7A785u, 0xAEBDCA4Eu, 0x344D5A58u, 0xA5273793u, 0x169981CEu, 0x87F3EC05u,
+            0x71E4ED74u, 0xE08E80BFu, 0x533036E2u, 0xC25A5B29u, 0x10102A85u, 0x817A474Eu,
+            0x32C4F113u, 0xA3AE9CD8u, 0x55B99DA9u, 0xC4D3F062u, 0x776D463Fu, 0xE6072BF4u,
+            0x428C6613u, 0xD3E60BD8u, 0x6058BD85u, 0xF132D04Eu, 0x0725D13Fu, 0x964FBCF4u,
+            0x25F10AA9u, 0xB49B6762u, 0x66D116CEu, 0xF7BB7B05u, 0x4405CD58u, 0xD56FA093u,
+            0x2378A1E2u, 0xB212CC29u, 0x01AC7A74u, 0x90C617BFu, 0x0A3687A9u, 0x9B5CEA62u,
+            0x28E25C3Fu, 0xB98831F4u, 0x4F9F3085u, 0xDEF55D4Eu, 0x6D4BEB13u, 0xFC2186D8u,
+            0x2E6BF774u, 0xBF019ABFu, 0x0CBF2CE2u, 0x9DD54129u, 0x6BC24058u, 0xFAA82D93u,
+            0x49169BCEu, 0xD87CF605u, 0xF9EF77C4u, 0x68851A0Fu, 0xDB3BAC52u, 0x4A51C199u,
+            0xBC46C0E8u, 0x2D2CAD23u, 0x9E921B7Eu, 0x0FF876B5u, 0xDDB20719u, 0x4CD86AD2u,
+            0xFF66DC8Fu, 0x6E0CB144u, 0x981BB035u, 0x0971DDFEu, 0xBACF6BA3u, 0x2BA50668u,
+            0xB155967Eu, 0x203FFBB5u, 0x93814DE8u, 0x02EB2023u, 0xF4FC2152u, 0x65964C99u,
+            0xD628FAC4u, 0x4742970Fu, 0x9508E6A3u, 0x04628B68u, 0xB7DC3D35u, 0x26B650FEu,
+            0xD0A1518Fu, 0x41CB3C44u, 0xF2758A19u, 0x631FE7D2u, 0xC794AA35u, 0x56FEC7FEu,
+            0xE54071A3u, 0x742A1C68u, 0x823D1D19u, 0x135770D2u, 0xA0E9C68Fu, 0x3183AB44u,
+            0xE3C9DAE8u, 0x72A3B723u, 0xC11D017Eu, 0x50776CB5u, 0xA6606DC4u, 0x370A000Fu,
+            0x84B4B652u, 0x15DEDB99u, 0x8F2E4B8Fu, 0x1E442644u, 0xADFA9019u, 0x3C90FDD2u,
+            0xCA87FCA3u, 0x5BED9168u, 0xE8532735u, 0x79394AFEu, 0xAB733B52u, 0x3A195699u,
+            0x89A7E0C4u, 0x18CD8D0Fu, 0xEEDA8C7Eu, 0x7FB0E1B5u, 0xCC0E57E8u, 0x5D643A23u,
+            0x8518CC26u, 0x1472A1EDu, 0xA7CC17B0u, 0x36A67A7Bu, 0xC0B17B0Au, 0x51DB16C1u,
+            0xE265A09Cu, 0x730FCD57u, 0xA145BCFBu, 0x302FD130u, 0x8391676Du, 0x12FB0AA6u,
+            0xE4EC0BD7u, 0x7586661Cu, 0xC638D041u, 0x5752BD8Au, 0xCDA22D9Cu, 0x5CC84057u,
+            0xEF76F60Au, 0x7E1C9BC1u, 0x880B9AB0u, 0x1961F77Bu, 0xAADF4126u, 0x3BB52CEDu,
+            0xE9FF5D41u, 0x7895308Au, 0xCB2B86D7u, 0x5A41EB1Cu, 0xAC56EA6Du, 0x3D3C87A6u,
+            0x8E8231FBu, 0x1FE85C30u, 0xBB6311D7u, 0x2A097C1Cu, 0x99B7CA41u, 0x08DDA78Au,
+            0xFECAA6FBu, 0x6FA0CB30u, 0xDC1E7D6Du, 0x4D7410A6u, 0x9F3E610Au, 0x0E540CC1u,
+            0xBDEABA9Cu, 0x2C80D757u, 0xDA97D626u, 0x4BFDBBEDu, 0xF8430DB0u, 0x6929607Bu,
+            0xF3D9F06Du, 0x62B39DA6u, 0xD10D2BFBu, 0x40674630u, 0xB6704741u, 0x271A2A8Au,
+            0x94A49CD7u, 0x05CEF11Cu, 0xD78480B0u, 0x46EEED7Bu, 0xF5505B26u, 0x643A36EDu,
+            0x922D379Cu, 0x03475A57u, 0xB0F9EC0Au, 0x219381C1u
+        },
+        {
+            0x00000000u, 0x3F0BE14Au, 0x7E17C295u, 0x411C23DFu, 0xFC2F852Au, 0xC3246460u,
+            0x823847BFu, 0xBD33A6F5u, 0x6A87A57Fu, 0x558C4435u, 0x149067EAu, 0x2B9B86A0u,
+            0x96A82055u, 0xA9A3C11Fu, 0xE8BFE2C0u, 0xD7B4038Au, 0xD50F4AFEu, 0xEA04ABB4u,
+            0xAB18886Bu, 0x94136921u, 0x2920CFD4u, 0x162B2E9Eu, 0x57370D41u, 0x683CEC0Bu,
+            0xBF88EF81u, 0x80830ECBu, 0xC19F2D14u, 0xFE94CC5Eu, 0x43A76AABu, 0x7CAC8BE1u,
+            0x3DB0A83Eu, 0x02BB4974u, 0x38C63AD7u, 0x07CDDB9Du, 0x46D1F842u, 0x79DA1908u,
+            0xC4E9BFFDu, 0xFBE25EB7u, 0xBAFE7D68u, 0x85F59C22u, 0x52419FA8u, 0x6D4A7EE2u,
+            0x2C565D3Du, 0x135DBC77u, 0xAE6E1A82u, 0x9165FBC8u, 0xD079D817u, 0xEF72395Du,
+            0xEDC97029u, 0xD2C29163u, 0x93DEB2BCu, 0xACD553F6u, 0x11E6F503u, 0x2EED1449u,
+            0x6FF13796u, 0x50FAD6DCu, 0x874ED556u, 0xB845341Cu, 0xF95917C3u, 0xC652F689u,
+            0x7B61507Cu, 0x446AB136u, 0x057692E9u, 0x3A7D73A3u, 0x718C75AEu, 0x4E8794E4u,
+            0x0F9BB73Bu, 0x30905671u, 0x8DA3F084u, 0xB2A811CEu, 0xF3B43211u, 0xCCBFD35Bu,
+            0x1B0BD0D1u, 0x2400319Bu, 0x651C1244u, 0x5A17F30Eu, 0xE72455FBu, 0xD82FB4B1u,
+            0x9933976Eu, 0xA6387624u, 0xA4833F50u, 0x9B88DE1Au, 0xDA94FDC5u, 0xE59F1C8Fu,
+            0x58ACBA7Au, 0x67A75B30u, 0x26BB78EFu, 0x19B099A5u, 0xCE049A2Fu, 0xF10F7B65u,
+            0xB01358BAu, 0x8F18B9F0u, 0x322B1F05u, 0x0D20FE4Fu, 0x4C3CDD90u, 0x73373CDAu,
+            0x494A4F79u, 0x7641AE33u, 0x375D8DECu, 0x08566CA6u, 0xB565CA53u, 0x8A6E2B19u,
+            0xCB7208C6u, 0xF479E98Cu, 0x23CDEA06u, 0x1CC60B4Cu, 0x5DDA2893u, 0x62D1C9D9u,
+            0xDFE26F2Cu, 0xE0E98E66u, 0xA1F5ADB9u, 0x9EFE4CF3u, 0x9C450587u, 0xA34EE4CDu,
+            0xE252C712u, 0xDD592658u, 0x606A80ADu, 0x5F6161E7u, 0x1E7D4238u, 0x2176A372u,
+            0xF6C2A0F8u, 0xC9C941B2u, 0x88D5626Du, 0xB7DE8327u, 0x0AED25D2u, 0x35E6C498u,
+            0x74FAE747u, 0x4BF1060Du, 0xE318EB5Cu, 0xDC130A16u, 0x9D0F29C9u, 0xA204C883u,
+            0x1F376E76u, 0x203C8F3Cu, 0x6120ACE3u, 0x5E2B4DA9u, 0x899F4E23u, 0xB694AF69u,
+            0xF7888CB6u, 0xC8836DFCu, 0x75B0CB09u, 0x4ABB2A43u, 0x0BA7099Cu, 0x34ACE8D6u,
+            0x3617A1A2u, 0x091C40E8u, 0x48006337u, 0x770B827Du, 0xCA382488u, 0xF533C5C2u,
+            0xB42FE61Du, 0x8B240757u, 0x5C9004DDu, 0x639BE597u, 0x2287C648u, 0x1D8C2702u,
+            0xA0BF81F7u, 0x9FB460BDu, 0xDEA84362u, 0xE1A3A228u, 0xDBDED18Bu, 0xE4D530C1u,
+            0xA5C9131Eu, 0x9AC2F254u, 0x27F154A1u, 0x18FAB5EBu, 0x59E69634u, 0x66ED777Eu,
+            0xB15974F4u, 0x8E5295BEu, 0xCF4EB661u, 0xF045572Bu, 0x4D76F1DEu, 0x727D1094u,
+            0x3361334Bu, 0x0C6AD201u, 0x0ED19B75u, 0x31DA7A3Fu, 0x70C659E0u, 0x4FCDB8AAu,
+            0xF2FE1E5Fu, 0xCDF5FF15u, 0x8CE9DCCAu, 0xB3E23D80u, 0x64563E0Au, 0x5B5DDF40u,
+            0x1A41FC9Fu, 0x254A1DD5u, 0x9879BB20u, 0xA7725A6Au, 0xE66E79B5u, 0xD96598FFu,
+            0x92949EF2u, 0xAD9F7FB8u, 0xEC835C67u, 0xD388BD2Du, 0x6EBB1BD8u, 0x51B0FA92u,
+            0x10ACD94Du, 0x2FA73807u, 0xF8133B8Du, 0xC718DAC7u, 0x8604F918u, 0xB90F1852u,
+            0x043CBEA7u, 0x3B375FEDu, 0x7A2B7C32u, 0x45209D78u, 0x479BD40Cu, 0x78903546u,
+            0x398C1699u, 0x0687F7D3u, 0xBBB45126u, 0x84BFB06Cu, 0xC5A393B3u, 0xFAA872F9u,
+            0x2D1C7173u, 0x12179039u, 0x530BB3E6u, 0x6C0052ACu, 0xD133F459u, 0xEE381513u,
+            0xAF2436CCu, 0x902FD786u, 0xAA52A425u, 0x9559456Fu, 0xD44566B0u, 0xEB4E87FAu,
+            0x567D210Fu, 0x6976C045u, 0x286AE39Au, 0x176102D0u, 0xC0D5015Au, 0xFFDEE010u,
+            0xBEC2C3CFu, 0x81C92285u, 0x3CFA8470u, 0x03F1653Au, 0x42ED46E5u, 0x7DE6A7AFu,
+            0x7F5DEEDBu, 0x40560F91u, 0x014A2C4Eu, 0x3E41CD04u, 0x83726BF1u, 0xBC798ABBu,
+            0xFD65A964u, 0xC26E482Eu, 0x15DA4BA4u, 0x2AD1AAEEu, 0x6BCD8931u, 0x54C6687Bu,
+            0xE9F5CE8Eu, 0xD6FE2FC4u, 0x97E20C1Bu, 0xA8E9ED51u
+        }
+    },
+    {
+        {
+            0x00000000u, 0x222CA1DCu, 0x445943B8u, 0x6675E264u, 0x88B28770u, 0xAA9E26ACu,
+            0xCCEBC4C8u, 0xEEC76514u, 0x11650EE0u, 0x3349AF3Cu, 0x553C4D58u, 0x7710EC84u,
+            0x99D78990u, 0xBBFB284Cu, 0xDD8ECA28u, 0xFFA26BF4u, 0x8DC40345u, 0xAFE8A299u,
+            0xC99D40FDu, 0xEBB1E121u, 0x05768435u, 0x275A25E9u, 0x412FC78Du, 0x63036651u,
+            0x9CA10DA5u, 0xBE8DAC79u, 0xD8F84E1Du, 0xFAD4EFC1u, 0x14138AD5u, 0x363F2B09u,
+            0x504AC96Du, 0x726668B1u, 0x1B88068Au, 0x39A4A756u, 0x5FD14532u, 0x7DFDE4EEu,
+            0x933A81FAu, 0xB1162026u, 0xD763C242u, 0xF54F639Eu, 0x0AED086Au, 0x28C1A9B6u,
+            0x4EB44BD2u, 0x6C98EA0Eu, 0x825F8F1Au, 0xA0732EC6u, 0xC606CCA2u, 0xE42A6D7Eu,
+            0x964C05CFu, 0xB460A413u, 0xD2154677u, 0xF039E7ABu, 0x1EFE82BFu, 0x3CD22363u,
+            0x5AA7C107u, 0x788B60DBu, 0x87290B2Fu, 0xA505AAF3u, 0xC3704897u, 0xE15CE94Bu,
+            0x0F9B8C5Fu, 0x2DB72D83u, 0x4BC2CFE7u, 0x69EE6E3Bu, 0x981E1391u, 0xBA32B24Du,
+            0xDC475029u, 0xFE6BF1F5u, 0x10AC94E1u, 0x3280353Du, 0x54F5D759u, 0x76D97685u,
+            0x897B1D71u, 0xAB57BCADu, 0xCD225EC9u, 0xEF0EFF15u, 0x01C99A01u, 0x23E53BDDu,
+            0x4590D9B9u, 0x67BC7865u, 0x15DA10D4u, 0x37F6B108u, 0x5183536Cu, 0x73AFF2B0u,
+            0x9D6897A4u, 0xBF443678u, 0xD931D41Cu, 0xFB1D75C0u, 0x04BF1E34u, 0x2693BFE8u,
+            0x40E65D8Cu, 0x62CAFC50u, 0x8C0D9944u, 0xAE213898u, 0xC854DAFCu, 0xEA787B20u,
+            0x8396151Bu, 0xA1BAB4C7u, 0xC7CF56A3u, 0xE5E3F77Fu, 0x0B24926Bu, 0x290833B7u,
+            0x4F7DD1D3u, 0x6D51700Fu, 0x92F31BFBu, 0xB0DFBA27u, 0xD6AA5843u, 0xF486F99Fu,
+            0x1A419C8Bu, 0x386D3D57u, 0x5E18DF33u, 0x7C347EEFu, 0x0E52165Eu, 0x2C7EB782u,
+            0x4A0B55E6u, 0x6827F43Au, 0x86E0912Eu, 0xA4CC30F2u, 0xC2B9D296u, 0xE095734Au,
+            0x1F3718BEu, 0x3D1BB962u, 0x5B6E5B06u, 0x7942FADAu, 0x97859FCEu, 0xB5A93E12u,
+            0xD3DCDC76u, 0xF1F07DAAu, 0x9F3239A7u, 0xBD1E987Bu, 0xDB6B7A1Fu, 0xF947DBC3u,
+            0x1780BED7u, 0x35AC1F0Bu, 0x53D9FD6Fu, 0x71F55CB3u, 0x8E573747u, 0xAC7B969Bu,
+            0xCA0E74FFu, 0xE822D523u, 0x06E5B037u, 0x24C911EBu, 0x42BCF38Fu, 0x60905253u,
+            0x12F63AE2u, 0x30DA9B3Eu, 0x56AF795Au, 0x7483D886u, 0x9A44BD92u, 0xB8681C4Eu,
+            0xDE1DFE2Au, 0xFC315FF6u, 0x03933402u, 0x21BF95DEu, 0x47CA77BAu, 0x65E6D666u,
+            0x8B21B372u, 0xA90D12AEu, 0xCF78F0CAu, 0xED545116u, 0x84BA3F2Du, 0xA6969EF1u,
+            0xC0E37C95u, 0xE2CFDD49u, 0x0C08B85Du, 0x2E241981u, 0x4851FBE5u, 0x6A7D5A39u,
+            0x95DF31CDu, 0xB7F39011u, 0xD1867275u, 0xF3AAD3A9u, 0x1D6DB6BDu, 0x3F411761u,
+            0x5934F505u, 0x7B1854D9u, 0x097E3C68u, 0x2B529DB4u, 0x4D277FD0u, 0x6F0BDE0Cu,
+            0x81CCBB18u, 0xA3E01AC4u, 0xC595F8A0u, 0xE7B9597Cu, 0x181B3288u, 0x3A379354u,
+            0x5C427130u, 0x7E6ED0ECu, 0x90A9B5F8u, 0xB2851424u, 0xD4F0F640u, 0xF6DC579Cu,
+            0x072C2A36u, 0x25008BEAu, 0x4375698Eu, 0x6159C852u, 0x8F9EAD46u, 0xADB20C9Au,
+            0xCBC7EEFEu, 0xE9EB4F22u, 0x164924D6u, 0x3465850Au, 0x5210676Eu, 0x703CC6B2u,
+            0x9EFBA3A6u, 0xBCD7027Au, 0xDAA2E01Eu, 0xF88E41C2u, 0x8AE82973u, 0xA8C488AFu,
+            0xCEB16ACBu, 0xEC9DCB17u, 0x025AAE03u, 0x20760FDFu, 0x4603EDBBu, 0x642F4C67u,
+            0x9B8D2793u, 0xB9A1864Fu, 0xDFD4642Bu, 0xFDF8C5F7u, 0x133FA0E3u, 0x3113013Fu,
+            0x5766E35Bu, 0x754A4287u, 0x1CA42CBCu, 0x3E888D60u, 0x58FD6F04u, 0x7AD1CED8u,
+            0x9416ABCCu, 0xB63A0A10u, 0xD04FE874u, 0xF26349A8u, 0x0DC1225Cu, 0x2FED8380u,
+            0x499861E4u, 0x6BB4C038u, 0x8573A52Cu, 0xA75F04F0u, 0xC12AE694u, 0xE3064748u,
+            0x91602FF9u, 0xB34C8E25u, 0xD5396C41u, 0xF715CD9Du, 0x19D2A889u, 0x3BFE0955u,
+            0x5D8BEB31u, 0x7FA74AEDu, 0x80052119u, 0xA22980C5u, 0xC45C62A1u, 0xE670C37Du,
+            0x08B7A669u, 0x2A9B07B5u, 0x4CEEE5D1u, 0x6EC2440Du
+        },
+        {
+            0x00000000u, 0x1DEE8A5Eu, 0x3BDD14BCu, 0x26339EE2u, 0x77BA2978u, 0x6A54A326u,
+            0x4C673DC4u, 0x5189B79Au, 0xEF7452F1u, 0xF29AD8AFu, 0xD4A9464Du, 0xC947CC13u,
+            0x98CE7B89u, 0x8520F1D7u, 0xA3136F35u, 0xBEFDE56Bu, 0x4C300AC9u, 0x51DE8097u,
+            0x77ED1E75u, 0x6A03942Bu, 0x3B8A23B1u, 0x2664A9EFu, 0x0057370Du, 0x1DB9BD53u,
+            0xA3445838u, 0xBEAAD266u, 0x98994C84u, 0x8577C6DAu, 0xD4FE7140u, 0xC910FB1Eu,
+            0xEF2365FCu, 0xF2CDEFA2u, 0x98601593u, 0x858E9FCDu, 0xA3BD012Fu, 0xBE538B71u,
+            0xEFDA3CEBu, 0xF234B6B5u, 0xD4072857u, 0xC9E9A209u, 0x77144762u, 0x6AFACD3Cu,
+            0x4CC953DEu, 0x5127D980u, 0x00AE6E1Au, 0x1D40E444u, 0x3B737AA6u, 0x269DF0F8u,
+            0xD4501F5Au, 0xC9BE9504u, 0xEF8D0BE6u, 0xF26381B8u, 0xA3EA3622u, 0xBE04BC7Cu,
+            0x9837229Eu, 0x85D9A8C0u, 0x3B244DABu, 0x26CAC7F5u, 0x00F95917u, 0x1D17D349u,
+            0x4C9E64D3u, 0x5170EE8Du, 0x7743706Fu, 0x6AADFA31u, 0xA218840Du, 0xBFF60E53u,
+            0x99C590B1u, 0x842B1AEFu, 0xD5A2AD75u, 0xC84C272Bu, 0xEE7FB9C9u, 0xF3913397u,
+            0x4D6CD6FCu, 0x50825CA2u, 0x76B1C240u, 0x6B5F481Eu, 0x3AD6FF84u, 0x273875DAu,
+            0x010BEB38u, 0x1CE56166u, 0xEE288EC4u, 0xF3C6049Au, 0xD5F59A78u, 0xC81B1026u,
+            0x9992A7BCu, 0x847C2DE2u, 0xA24FB300u, 0xBFA1395Eu, 0x015CDC35u, 0x1CB2566Bu,
+            0x3A81C889u, 0x276F42D7u, 0x76E6F54Du, 0x6B087F13u, 0x4D3BE1F1u, 0x50D56BAFu,
+            0x3A78919Eu, 0x27961BC0u, 0x01A58522u, 0x1C4B0F7Cu, 0x4DC2B8E6u, 0x502C32B8u,
+            0x761FAC5Au, 0x6BF12604u, 0xD50CC36Fu, 0xC8E24931u, 0xEED1D7D3u, 0xF33F5D8Du,
+            0xA2B6EA17u, 0xBF586049u, 0x996BFEABu, 0x848574F5u, 0x76489B57u, 0x6BA61109u,
+            0x4D958FEBu, 0x507B05B5u, 0x01F2B22Fu, 0x1C1C3871u, 0x3A2FA693u, 0x27C12CCDu,
+            0x993CC9A6u, 0x84D243F8u, 0xA2E1DD1Au, 0xBF0F5744u, 0xEE86E0DEu, 0xF3686A80u,
+            0xD55BF462u, 0xC8B57E3Cu, 0xD6E9A730u, 0xCB072D6Eu, 0xED34B38Cu, 0xF0DA39D2u,
+            0xA1538E48u, 0xBCBD0416u, 0x9A8E9AF4u, 0x876010AAu, 0x399DF5C1u, 0x24737F9Fu,
+            0x0240E17Du, 0x1FAE6B23u, 0x4E27DCB9u, 0x53C956E7u, 0x75FAC805u, 0x6814425Bu,
+            0x9AD9ADF9u, 0x873727A7u, 0xA104B945u, 0xBCEA331Bu, 0xED638481u, 0xF08D0EDFu,
+            0xD6BE903Du, 0xCB501A63u, 0x75ADFF08u, 0x68437556u, 0x4E70EBB4u, 0x539E61EAu,
+            0x0217D670u, 0x1FF95C2Eu, 0x39CAC2CCu, 0x24244892u, 0x4E89B2A3u, 0x536738FDu,
+            0x7554A61Fu, 0x68BA2C41u, 0x39339BDBu, 0x24DD1185u, 0x02EE8F67u, 0x1F000539u,
+            0xA1FDE052u, 0xBC136A0Cu, 0x9A20F4EEu, 0x87CE7EB0u, 0xD647C92Au, 0xCBA94374u,
+            0xED9ADD96u, 0xF07457C8u, 0x02B9B86Au, 0x1F573234u, 0x3964ACD6u, 0x248A2688u,
+            0x75039112u, 0x68ED1B4Cu, 0x4EDE85AEu, 0x53300FF0u, 0xEDCDEA9Bu, 0xF02360C5u,
+            0xD610FE27u, 0xCBFE7479u, 0x9A77C3E3u, 0x879949BDu, 0xA1AAD75Fu, 0xBC445D01u,
+            0x74F1233Du, 0x691FA963u, 0x4F2C3781u, 0x52C2BDDFu, 0x034B0A45u, 0x1EA5801Bu,
+            0x38961EF9u, 0x257894A7u, 0x9B8571CCu, 0x866BFB92u, 0xA0586570u, 0xBDB6EF2Eu,
+            0xEC3F58B4u, 0xF1D1D2EAu, 0xD7E24C08u, 0xCA0CC656u, 0x38C129F4u, 0x252FA3AAu,
+            0x031C3D48u, 0x1EF2B716u, 0x4F7B008Cu, 0x52958AD2u, 0x74A61430u, 0x69489E6Eu,
+            0xD7B57B05u, 0xCA5BF15Bu, 0xEC686FB9u, 0xF186E5E7u, 0xA00F527Du, 0xBDE1D823u,
+            0x9BD246C1u, 0x863CCC9Fu, 0xEC9136AEu, 0xF17FBCF0u, 0xD74C2212u, 0xCAA2A84Cu,
+            0x9B2B1FD6u, 0x86C59588u, 0xA0F60B6Au, 0xBD188134u, 0x03E5645Fu, 0x1E0BEE01u,
+            0x383870E3u, 0x25D6FABDu, 0x745F4D27u, 0x69B1C779u, 0x4F82599Bu, 0x526CD3C5u,
+            0xA0A13C67u, 0xBD4FB639u, 0x9B7C28DBu, 0x8692A285u, 0xD71B151Fu, 0xCAF59F41u,
+            0xECC601A3u, 0xF1288BFDu, 0x4FD56E96u, 0x523BE4C8u, 0x74087A2Au, 0x69E6F074u,
+            0x386F47EEu, 0x2581CDB0u, 0x03B25352u, 0x1E5CD90Cu
+        }
+    }
+};
+/* clang-format on */
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Crc_Cfg.h */
+#elif CRC_64_MODE == CRC_NIBBLE
+/**
+ * @brief  Nibble lookup table for CRC64 ECMA, reflected polynomial 0xC96C5795D7870F42, split in
+ * low and high halves of each entry
+ */
+/* clang-format off */
+static const uint32 Crc_Nibble64[ CRC_64_HALVES ][ CRC_NIBBLE_TABLE_SIZE ] =
+{
+    {
+        0x00000000u, 0x51336649u, 0xA266CC92u, 0xF355AADBu, 0xEBC387A1u, 0xBAF0E1E8u, 0x49A54B33u, 0x18962D7Au,
+        0xD7870F42u, 0x86B4690Bu, 0x75E1C3D0u, 0x24D2A599u, 0x3C4488E3u, 0x6D77EEAAu, 0x9E224471u, 0xCF112238u
+    },
+    {
+        0x00000000u, 0x7D9BA138u, 0xFB374270u, 0x86ACE348u, 0x64B62BCAu, 0x192D8AF2u, 0x9F8169BAu, 0xE21AC882u,
+        0xC96C5795u, 0xB4F7F6ADu, 0x325B15E5u, 0x4FC0B4DDu, 0xADDA7C5Fu, 0xD041DD67u, 0x56ED3E2Fu, 0x2B769F17u
+    }
+};
+/* clang-format on */
+#endif
+
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Crc_Cfg.h */
+#if ( CRC_32_MODE == CRC_SLICE4 ) || ( CRC_32P4_MODE == CRC_SLICE4 )
+/**
+ * @brief   **Slicing by 4 calculation of a reflected CRC of 32 bits**
+ *
+ * The function process the leading bytes one by one until the data pointer is word aligned, then
+ * the data is consumed one word at a time using four lookup tables, one per byte of the word, and
+ * the remaining bytes are processed one by one again. Buffers shorter than CRC_SLICE4_MIN_LENGTH
+ * are processed byte wise since the alignment overhead is not worth it (e.g. CAN frames). The
+ * word loop assumes a little endian cpu.
+ *
+ * @param   Table Four lookup tables of the polynomial, the first one is the byte wise table
+ * @param   Crc_DataPtr Pointer to start address of data block to be calculated.
+ * @param   Crc_Length Length of data block to be calculated in bytes.
+ * @param   Crc_Value Actual value of the crc register, already xored with the start value
+ *
+ * @retval  The value of the crc register after process all the bytes, without the final xor
+ */
+CRC_RAMFUNC static uint32 Crc_Slice4Reflected32( const uint32 Table[ CRC_SLICE4_TABLES ][ CRC_TABLE_SIZE ], const uint8 *Crc_DataPtr, uint32 Crc_Length, uint32 Crc_Value )
+{
+    const uint8 *dataPtr = Crc_DataPtr;
+    uint32 length        = Crc_Length;
+    uint32 crcValue      = Crc_Value;
+
+    if( length >= CRC_SLICE4_MIN_LENGTH )
+    {
+        /* cppcheck-suppress misra-c2012-11.4 ; the address is needed to know its alignment */
+        while( ( (uint32)dataPtr & CRC_WORD_ALIGN_MASK ) != 0u )
+        {
+            crcValue = ( crcValue >> CRC_TABLE_BYTE_SHIFT ) ^ Table[ 0 ][ ( crcValue ^ *dataPtr ) & CRC_TABLE_INDEX_MASK ];
+            dataPtr++;
+            length--;
+        }
+
+        /* cppcheck-suppress misra-c2012-11.3 ; the pointer is word aligned at this point */
+        const uint32 *wordPtr = (const uint32 *)dataPtr;
+        while( length >= CRC_WORD_SIZE )
+        {
+            crcValue ^= *wordPtr;
+            crcValue = Table[ 3 ][ crcValue & CRC_TABLE_INDEX_MASK ] ^
+                       Table[ 2 ][ ( crcValue >> CRC_WORD_BYTE1_SHIFT ) & CRC_TABLE_INDEX_MASK ] ^
+                       Table[ 1 ][ ( crcValue >> CRC_WORD_BYTE2_SHIFT ) & CRC_TABLE_INDEX_MASK ] ^
+                       Table[ 0 ][ crcValue >> CRC_WORD_BYTE3_SHIFT ];
+            wordPtr++;
+            length -= CRC_WORD_SIZE;
+        }
+        /* cppcheck-suppress misra-c2012-11.3 ; go back to byte access for the remaining bytes */
+        dataPtr = (const uint8 *)wordPtr;
+    }
+
+    for( uint32 i = 0; i < length; i++ )
+    {
+        crcValue = ( crcValue >> CRC_TABLE_BYTE_SHIFT ) ^ Table[ 0 ][ ( crcValue ^ dataPtr[ i ] ) & CRC_TABLE_INDEX_MASK ];
+    }
+
+    return crcValue;
+}
+#endif
+
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Crc_Cfg.h */
+#if CRC_32P4_MODE == CRC_TABLE
+/**
+ * @brief   **Word wise calculation of a reflected CRC of 32 bits with a single lookup table**
+ *
+ * Same head and tail handling as Crc_Slice4Reflected32, but each aligned word is xored into the
+ * crc register and then consumed with four lookups on the byte wise table. The core loads a word
+ * in the same time than a byte, so one load replaces four without any extra ROM table.
+ *
+ * @param   Table Byte wise lookup table of the polynomial
+ * @param   Crc_DataPtr Pointer to start address of data block to be calculated.
+ * @param   Crc_Length Length of data block to be calculated in bytes.
+ * @param   Crc_Value Actual value of the crc register, already xored with the start value
+ *
+ * @retval  The value of the crc register after process all the bytes, without the final xor
+ */
+CRC_RAMFUNC static uint32 Crc_WordReflected32( const uint32 Table[ CRC_TABLE_SIZE ], const uint8 *Crc_DataPtr, uint32 Crc_Length, uint32 Crc_Value )
+{
+    const uint8 *dataPtr = Crc_DataPtr;
+    uint32 length        = Crc_Length;
+    uint32 crcValue      = Crc_Value;
+
+    if( length >= CRC_SLICE4_MIN_LENGTH )
+    {
+        /* cppcheck-suppress misra-c2012-11.4 ; the address is needed to know its alignment */
+        while( ( (uint32)dataPtr & CRC_WORD_ALIGN_MASK ) != 0u )
+        {
+            crcValue = ( crcValue >> CRC_TABLE_BYTE_SHIFT ) ^ Table[ ( crcValue ^ *dataPtr ) & CRC_TABLE_INDEX_MASK ];
+            dataPtr++;
+            length--;
+        }
+
+        /* cppcheck-suppress misra-c2012-11.3 ; the pointer is word aligned at this point */
+        const uint32 *wordPtr = (const uint32 *)dataPtr;
+        while( length >= CRC_WORD_SIZE )
+        {
+            /* written out four times, compilers do not unroll the loop at -Os */
+            crcValue ^= *wordPtr;
+            crcValue = ( crcValue >> CRC_TABLE_BYTE_SHIFT ) ^ Table[ crcValue & CRC_TABLE_INDEX_MASK ];
+            crcValue = ( crcValue >> CRC_TABLE_BYTE_SHIFT ) ^ Table[ crcValue & CRC_TABLE_INDEX_MASK ];
+            crcValue = ( crcValue >> CRC_TABLE_BYTE_SHIFT ) ^ Table[ crcValue & CRC_TABLE_INDEX_MASK ];
+            crcValue = ( crcValue >> CRC_TABLE_BYTE_SHIFT ) ^ Table[ crcValue & CRC_TABLE_INDEX_MASK ];
+            wordPtr++;
+            length -= CRC_WORD_SIZE;
+        }
+        /* cppcheck-suppress misra-c2012-11.3 ; go back to byte access for the remaining bytes */
+        dataPtr = (const uint8 *)wordPtr;
+    }
+
+    for( uint32 i = 0; i < length; i++ )
+    {
+        crcValue = ( crcValue >> CRC_TABLE_BYTE_SHIFT ) ^ Table[ ( crcValue ^ dataPtr[ i ] ) & CRC_TABLE_INDEX_MASK ];
+    }
+
+    return crcValue;
+}
+#endif
+
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Crc_Cfg.h */
+#if CRC_64_MODE == CRC_SLICE4
+/**
+ * @brief   **Process a buffer with the CRC64 slicing by 4 tables**
+ *
+ * Same as Crc_Slice4Reflected32 for the CRC64 register kept in two 32 bits halves. Each aligned
+ * word is xored into the low half and looked up on the four split tables, the high half becomes
+ * the new low half, so a whole word is processed without any 64 bits shift.
+ *
+ * @param   Crc_DataPtr Pointer to start address of data block to be calculated.
+ * @param   Crc_Length Length of data block to be calculated in bytes.
+ * @param   Crc_Low Low half of the crc register, updated when the function returns
+ * @param   Crc_High High half of the crc register, updated when the function returns
+ */
+CRC_RAMFUNC static void Crc_Slice4Reflected64( const uint8 *Crc_DataPtr, uint32 Crc_Length, uint32 *Crc_Low, uint32 *Crc_High )
+{
+    const uint8 *dataPtr = Crc_DataPtr;
+    uint32 length        = Crc_Length;
+    uint32 crcLow        = *Crc_Low;
+    uint32 crcHigh       = *Crc_High;
+    uint32 index;
+
+    if( length >= CRC_SLICE4_MIN_LENGTH )
+    {
+        /* cppcheck-suppress misra-c2012-11.4 ; the address is needed to know its alignment */
+        while( ( (uint32)dataPtr & CRC_WORD_ALIGN_MASK ) != 0u )
+        {
+            index   = ( crcLow ^ *dataPtr ) & CRC_TABLE_INDEX_MASK;
+            crcLow  = ( ( crcLow >> CRC_TABLE_BYTE_SHIFT ) | ( crcHigh << ( CRC_64BIT_HALF_BITS - CRC_TABLE_BYTE_SHIFT ) ) ) ^ Crc_Table64Slice4[ 0 ][ CRC_64_LOW ][ index ];
+            crcHigh = ( crcHigh >> CRC_TABLE_BYTE_SHIFT ) ^ Crc_Table64Slice4[ 0 ][ CRC_64_HIGH ][ index ];
+            dataPtr++;
+            length--;
+        }
+
+        /* cppcheck-suppress misra-c2012-11.3 ; the pointer is word aligned at this point */
+        const uint32 *wordPtr = (const uint32 *)dataPtr;
+        while( length >= CRC_WORD_SIZE )
+        {
+            uint32 word   = crcLow ^ *wordPtr;
+            uint32 index0 = word & CRC_TABLE_INDEX_MASK;
+            uint32 index1 = ( word >> CRC_WORD_BYTE1_SHIFT ) & CRC_TABLE_INDEX_MASK;
+            uint32 index2 = ( word >> CRC_WORD_BYTE2_SHIFT ) & CRC_TABLE_INDEX_MASK;
+            uint32 index3 = word >> CRC_WORD_BYTE3_SHIFT;
+
+            crcLow = crcHigh ^ Crc_Table64Slice4[ 3 ][ CRC_64_LOW ][ index0 ] ^
+                     Crc_Table64Slice4[ 2 ][ CRC_64_LOW ][ index1 ] ^
+                     Crc_Table64Slice4[ 1 ][ CRC_64_LOW ][ index2 ] ^
+                     Crc_Table64Slice4[ 0 ][ CRC_64_LOW ][ index3 ];
+            crcHigh = Crc_Table64Slice4[ 3 ][ CRC_64_HIGH ][ index0 ] ^
+                      Crc_Table64Slice4[ 2 ][ CRC_64_HIGH ][ index1 ] ^
+                      Crc_Table64Slice4[ 1 ][ CRC_64_HIGH ][ index2 ] ^
+                      Crc_Table64Slice4[ 0 ][ CRC_64_HIGH ][ index3 ];
+            wordPtr++;
+            length -= CRC_WORD_SIZE;
+        }
+        /* cppcheck-suppress misra-c2012-11.3 ; go back to byte access for the remaining bytes */
+        dataPtr = (const uint8 *)wordPtr;
+    }
+
+    for( uint32 i = 0; i < length; i++ )
+    {
+        index   = ( crcLow ^ dataPtr[ i ] ) & CRC_TABLE_INDEX_MASK;
+        crcLow  = ( ( crcLow >> CRC_TABLE_BYTE_SHIFT ) | ( crcHigh << ( CRC_64BIT_HALF_BITS - CRC_TABLE_BYTE_SHIFT ) ) ) ^ Crc_Table64Slice4[ 0 ][ CRC_64_LOW ][ index ];
+        crcHigh = ( crcHigh >> CRC_TABLE_BYTE_SHIFT ) ^ Crc_Table64Slice4[ 0 ][ CRC_64_HIGH ][ index ];
+    }
+
+    *Crc_Low  = crcLow;
+    *Crc_High = crcHigh;
+}
+#endif
+
 /**
  * @brief   **Calculate a CRC of 8 bits**
  *
@@ -116,18 +1656,41 @@
  *
  * @reqs   SWS_Crc_00031, SWS_Crc_00032
  */
-uint8 Crc_CalculateCRC8( const uint8 *Crc_DataPtr, uint32 Crc_Length, uint8 Crc_StartValue8, boolean Crc_IsFirstCall )
+CRC_RAMFUNC uint8 Crc_CalculateCRC8( const uint8 *Crc_DataPtr, uint32 Crc_Length, uint8 Crc_StartValue8, boolean Crc_IsFirstCall )
 {
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Crc_Cfg.h */
+#if ( CRC_8_MODE == CRC_RUNTIME ) || ( CRC_8_MODE == CRC_HARDWARE )
     const uint8 Crc_Polynomial = CRC8_SAEJ1850_POLYNOMIAL;
-    uint8 crcValue             = Crc_StartValue8;
+#endif
+    uint8 crcValue = Crc_StartValue8;
 
     if( Crc_IsFirstCall == TRUE )
     {
         crcValue = FIRSTCALLCRC8;
     }
 
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Crc_Cfg.h */
+#if CRC_8_MODE == CRC_HARDWARE
+    uint32 hwValue = crcValue;
+    if( Crc_Arch_Calculate( &Crc_Hw8, Crc_DataPtr, Crc_Length, &hwValue ) == E_OK )
+    {
+        crcValue = (uint8)hwValue;
+        /* cppcheck-suppress misra-c2012-17.8 ; the unit did the calculation, nothing left for the software loop */
+        Crc_Length = 0u;
+    }
+#endif
+
     for( uint32 i = 0; i < Crc_Length; i++ )
     {
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Crc_Cfg.h */
+#if CRC_8_MODE == CRC_TABLE
+        crcValue = Crc_Table8[ crcValue ^ Crc_DataPtr[ i ] ];
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Crc_Cfg.h */
+#elif CRC_8_MODE == CRC_NIBBLE
+        crcValue ^= Crc_DataPtr[ i ];
+        crcValue = (uint8)( crcValue << CRC_NIBBLE_SHIFT ) ^ Crc_Nibble8[ crcValue >> CRC8_NIBBLE_INDEX_SHIFT ];
+        crcValue = (uint8)( crcValue << CRC_NIBBLE_SHIFT ) ^ Crc_Nibble8[ crcValue >> CRC8_NIBBLE_INDEX_SHIFT ];
+#else
         crcValue ^= Crc_DataPtr[ i ];
 
         for( uint8 bit = 0; bit < CRC8NBITS; bit++ )
@@ -141,6 +1704,7 @@ uint8 Crc_CalculateCRC8( const uint8 *Crc_DataPtr, uint32 Crc_Length, uint8 Crc_
                 crcValue <<= 1;
             }
         }
+#endif
     }
 
     return crcValue ^ 0xFF;
@@ -168,18 +1732,41 @@ uint8 Crc_CalculateCRC8( const uint8 *Crc_DataPtr, uint32 Crc_Length, uint8 Crc_
  *
  * @reqs   SWS_Crc_00043, SWS_Crc_00044
  */
-uint8 Crc_CalculateCRC8H2F( const uint8 *Crc_DataPtr, uint32 Crc_Length, uint8 Crc_StartValue8H2F, boolean Crc_IsFirstCall )
+CRC_RAMFUNC uint8 Crc_CalculateCRC8H2F( const uint8 *Crc_DataPtr, uint32 Crc_Length, uint8 Crc_StartValue8H2F, boolean Crc_IsFirstCall )
 {
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Crc_Cfg.h */
+#if ( CRC_8H2F_MODE == CRC_RUNTIME ) || ( CRC_8H2F_MODE == CRC_HARDWARE )
     const uint8 Crc_Polynomial = CRC8H2F_POLYNOMIAL;
-    uint8 crcValue             = Crc_StartValue8H2F;
+#endif
+    uint8 crcValue = Crc_StartValue8H2F;
 
     if( Crc_IsFirstCall == TRUE )
     {
         crcValue = FIRSTCALLCRC8H2F;
     }
 
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Crc_Cfg.h */
+#if CRC_8H2F_MODE == CRC_HARDWARE
+    uint32 hwValue = crcValue;
+    if( Crc_Arch_Calculate( &Crc_Hw8H2F, Crc_DataPtr, Crc_Length, &hwValue ) == E_OK )
+    {
+        crcValue = (uint8)hwValue;
+        /* cppcheck-suppress misra-c2012-17.8 ; the unit did the calculation, nothing left for the software loop */
+        Crc_Length = 0u;
+    }
+#endif
+
     for( uint32 i = 0; i < Crc_Length; i++ )
     {
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Crc_Cfg.h */
+#if CRC_8H2F_MODE == CRC_TABLE
+        crcValue = Crc_Table8H2F[ crcValue ^ Crc_DataPtr[ i ] ];
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Crc_Cfg.h */
+#elif CRC_8H2F_MODE == CRC_NIBBLE
+        crcValue ^= Crc_DataPtr[ i ];
+        crcValue = (uint8)( crcValue << CRC_NIBBLE_SHIFT ) ^ Crc_Nibble8H2F[ crcValue >> CRC8_NIBBLE_INDEX_SHIFT ];
+        crcValue = (uint8)( crcValue << CRC_NIBBLE_SHIFT ) ^ Crc_Nibble8H2F[ crcValue >> CRC8_NIBBLE_INDEX_SHIFT ];
+#else
         crcValue ^= Crc_DataPtr[ i ];
 
         for( uint8 bit = 0; bit < CRC8H2FNBITS; bit++ )
@@ -193,6 +1780,7 @@ uint8 Crc_CalculateCRC8H2F( const uint8 *Crc_DataPtr, uint32 Crc_Length, uint8 C
                 crcValue <<= 1;
             }
         }
+#endif
     }
     return ~crcValue;
 }
@@ -219,18 +1807,41 @@ uint8 Crc_CalculateCRC8H2F( const uint8 *Crc_DataPtr, uint32 Crc_Length, uint8 C
  *
  * @reqs   SWS_Crc_00019, SWS_Crc_00015
  */
-uint16 Crc_CalculateCRC16( const uint8 *Crc_DataPtr, uint32 Crc_Length, uint16 Crc_StartValue16, boolean Crc_IsFirstCall )
+CRC_RAMFUNC uint16 Crc_CalculateCRC16( const uint8 *Crc_DataPtr, uint32 Crc_Length, uint16 Crc_StartValue16, boolean Crc_IsFirstCall )
 {
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Crc_Cfg.h */
+#if ( CRC_16_MODE == CRC_RUNTIME ) || ( CRC_16_MODE == CRC_HARDWARE )
     const uint16 Crc_Polynomial = CRC16_POLYNOMIAL;
-    uint16 crcValue             = Crc_StartValue16;
+#endif
+    uint16 crcValue = Crc_StartValue16;
 
     if( Crc_IsFirstCall == TRUE )
     {
         crcValue = FIRSTCALLCRC16;
     }
 
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Crc_Cfg.h */
+#if CRC_16_MODE == CRC_HARDWARE
+    uint32 hwValue = crcValue;
+    if( Crc_Arch_Calculate( &Crc_Hw16, Crc_DataPtr, Crc_Length, &hwValue ) == E_OK )
+    {
+        crcValue = (uint16)hwValue;
+        /* cppcheck-suppress misra-c2012-17.8 ; the unit did the calculation, nothing left for the software loop */
+        Crc_Length = 0u;
+    }
+#endif
+
     for( uint32 i = 0; i < Crc_Length; i++ )
     {
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Crc_Cfg.h */
+#if CRC_16_MODE == CRC_TABLE
+        crcValue = (uint16)( crcValue << CRC_TABLE_BYTE_SHIFT ) ^ Crc_Table16[ ( crcValue >> CRC16_8LEFT ) ^ Crc_DataPtr[ i ] ];
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Crc_Cfg.h */
+#elif CRC_16_MODE == CRC_NIBBLE
+        crcValue ^= (uint16)Crc_DataPtr[ i ] << CRC16_8LEFT;
+        crcValue = (uint16)( crcValue << CRC_NIBBLE_SHIFT ) ^ Crc_Nibble16[ crcValue >> CRC16_NIBBLE_INDEX_SHIFT ];
+        crcValue = (uint16)( crcValue << CRC_NIBBLE_SHIFT ) ^ Crc_Nibble16[ crcValue >> CRC16_NIBBLE_INDEX_SHIFT ];
+#else
         crcValue ^= (uint16)Crc_DataPtr[ i ] << CRC16_8LEFT;
 
         for( uint8 bit = 0; bit < CRC16NBITS; bit++ )
@@ -244,6 +1855,7 @@ uint16 Crc_CalculateCRC16( const uint8 *Crc_DataPtr, uint32 Crc_Length, uint16 C
                 crcValue <<= 1;
             }
         }
+#endif
     }
 
     return crcValue;
@@ -274,10 +1886,13 @@ uint16 Crc_CalculateCRC16( const uint8 *Crc_DataPtr, uint32 Crc_Length, uint16 C
  *
  * @reqs   SWS_Crc_00071, SWS_Crc_00069
  */
-uint16 Crc_CalculateCRC16ARC( const uint8 *Crc_DataPtr, uint32 Crc_Length, uint16 Crc_StartValue16, boolean Crc_IsFirstCall )
+CRC_RAMFUNC uint16 Crc_CalculateCRC16ARC( const uint8 *Crc_DataPtr, uint32 Crc_Length, uint16 Crc_StartValue16, boolean Crc_IsFirstCall )
 {
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Crc_Cfg.h */
+#if CRC_16ARC_MODE == CRC_RUNTIME
     const uint16 Crc_Polynomial = CRC_16BITARC_POLYNOMIAL_REFLECTED;
-    uint16 crcValue             = Crc_StartValue16;
+#endif
+    uint16 crcValue = Crc_StartValue16;
 
     if( Crc_IsFirstCall == TRUE )
     {
@@ -285,6 +1900,15 @@ uint16 Crc_CalculateCRC16ARC( const uint8 *Crc_DataPtr, uint32 Crc_Length, uint1
     }
     for( uint32 i = Crc_Length; i != 0; i-- )
     {
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Crc_Cfg.h */
+#if CRC_16ARC_MODE == CRC_TABLE
+        crcValue = ( crcValue >> CRC_TABLE_BYTE_SHIFT ) ^ Crc_Table16ARC[ ( crcValue ^ *Crc_DataPtr ) & CRC_TABLE_INDEX_MASK ];
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Crc_Cfg.h */
+#elif CRC_16ARC_MODE == CRC_NIBBLE
+        crcValue ^= (uint16)*Crc_DataPtr;
+        crcValue = ( crcValue >> CRC_NIBBLE_SHIFT ) ^ Crc_Nibble16ARC[ crcValue & CRC_NIBBLE_INDEX_MASK ];
+        crcValue = ( crcValue >> CRC_NIBBLE_SHIFT ) ^ Crc_Nibble16ARC[ crcValue & CRC_NIBBLE_INDEX_MASK ];
+#else
         crcValue ^= (uint16)*Crc_DataPtr;
 
         for( uint8 bit = 0; bit < 8; bit++ )
@@ -298,6 +1922,7 @@ uint16 Crc_CalculateCRC16ARC( const uint8 *Crc_DataPtr, uint32 Crc_Length, uint1
                 crcValue >>= 1;
             }
         }
+#endif
         /* cppcheck-suppress misra-c2012-17.8 ; It's needed to increment the value of the variable*/
         Crc_DataPtr++;
     }
@@ -329,10 +1954,13 @@ uint16 Crc_CalculateCRC16ARC( const uint8 *Crc_DataPtr, uint32 Crc_Length, uint1
  *
  * @reqs   SWS_Crc_00020, SWS_Crc_00016
  */
-uint32 Crc_CalculateCRC32( const uint8 *Crc_DataPtr, uint32 Crc_Length, uint32 Crc_StartValue32, boolean Crc_IsFirstCall )
+CRC_RAMFUNC uint32 Crc_CalculateCRC32( const uint8 *Crc_DataPtr, uint32 Crc_Length, uint32 Crc_StartValue32, boolean Crc_IsFirstCall )
 {
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Crc_Cfg.h */
+#if ( CRC_32_MODE == CRC_RUNTIME ) || ( CRC_32_MODE == CRC_HARDWARE )
     const uint32 Crc_Polynomial = CRC_32BIT_POLYNOMIAL_REFLECTED;
-    uint32 crcValue             = Crc_StartValue32;
+#endif
+    uint32 crcValue = Crc_StartValue32;
 
     if( Crc_IsFirstCall == TRUE )
     {
@@ -343,8 +1971,32 @@ uint32 Crc_CalculateCRC32( const uint8 *Crc_DataPtr, uint32 Crc_Length, uint32 C
         crcValue ^= CRC_32BIT_XORVALUE;
     }
 
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Crc_Cfg.h */
+#if CRC_32_MODE == CRC_HARDWARE
+    uint32 hwValue = crcValue;
+    if( Crc_Arch_Calculate( &Crc_Hw32, Crc_DataPtr, Crc_Length, &hwValue ) == E_OK )
+    {
+        crcValue = hwValue;
+        /* cppcheck-suppress misra-c2012-17.8 ; the unit did the calculation, nothing left for the software loop */
+        Crc_Length = 0u;
+    }
+#endif
+
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Crc_Cfg.h */
+#if CRC_32_MODE == CRC_SLICE4
+    crcValue = Crc_Slice4Reflected32( Crc_Table32Slice4, Crc_DataPtr, Crc_Length, crcValue );
+#else
     for( uint32 i = Crc_Length; i != 0; i-- )
     {
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Crc_Cfg.h */
+#if CRC_32_MODE == CRC_TABLE
+        crcValue = ( crcValue >> CRC_TABLE_BYTE_SHIFT ) ^ Crc_Table32[ ( crcValue ^ *Crc_DataPtr ) & CRC_TABLE_INDEX_MASK ];
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Crc_Cfg.h */
+#elif CRC_32_MODE == CRC_NIBBLE
+        crcValue ^= (uint32)*Crc_DataPtr;
+        crcValue = ( crcValue >> CRC_NIBBLE_SHIFT ) ^ Crc_Nibble32[ crcValue & CRC_NIBBLE_INDEX_MASK ];
+        crcValue = ( crcValue >> CRC_NIBBLE_SHIFT ) ^ Crc_Nibble32[ crcValue & CRC_NIBBLE_INDEX_MASK ];
+#else
         crcValue ^= (uint32)*Crc_DataPtr;
 
         for( uint8 bit = 0; bit < 8; bit++ )
@@ -358,9 +2010,11 @@ uint32 Crc_CalculateCRC32( const uint8 *Crc_DataPtr, uint32 Crc_Length, uint32 C
                 crcValue >>= 1;
             }
         }
+#endif
         /* cppcheck-suppress misra-c2012-17.8 ; It's needed to increment the value of the variable*/
         Crc_DataPtr++;
     }
+#endif
     crcValue ^= CRC_32BIT_XORVALUE;
 
     return crcValue;
@@ -392,7 +2046,7 @@ uint32 Crc_CalculateCRC32( const uint8 *Crc_DataPtr, uint32 Crc_Length, uint32 C
  *
  * @reqs   SWS_Crc_00058, SWS_Crc_00059
  */
-uint32 Crc_CalculateCRC32P4( const uint8 *Crc_DataPtr, uint32 Crc_Length, uint32 Crc_StartValue32, boolean Crc_IsFirstCall )
+CRC_RAMFUNC uint32 Crc_CalculateCRC32P4( const uint8 *Crc_DataPtr, uint32 Crc_Length, uint32 Crc_StartValue32, boolean Crc_IsFirstCall )
 {
     uint32 crcValue;
     crcValue = Crc_StartValue32;
@@ -405,8 +2059,21 @@ uint32 Crc_CalculateCRC32P4( const uint8 *Crc_DataPtr, uint32 Crc_Length, uint32
     {
         crcValue ^= CRC_32BITP4_XORVALUE;
     }
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Crc_Cfg.h */
+#if CRC_32P4_MODE == CRC_SLICE4
+    crcValue = Crc_Slice4Reflected32( Crc_Table32P4Slice4, Crc_DataPtr, Crc_Length, crcValue );
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Crc_Cfg.h */
+#elif CRC_32P4_MODE == CRC_TABLE
+    crcValue = Crc_WordReflected32( Crc_Table32P4, Crc_DataPtr, Crc_Length, crcValue );
+#else
     for( uint32 i = Crc_Length; i != 0; i-- )
     {
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Crc_Cfg.h */
+#if CRC_32P4_MODE == CRC_NIBBLE
+        crcValue ^= (uint32)*Crc_DataPtr;
+        crcValue = ( crcValue >> CRC_NIBBLE_SHIFT ) ^ Crc_Nibble32P4[ crcValue & CRC_NIBBLE_INDEX_MASK ];
+        crcValue = ( crcValue >> CRC_NIBBLE_SHIFT ) ^ Crc_Nibble32P4[ crcValue & CRC_NIBBLE_INDEX_MASK ];
+#else
         crcValue ^= (uint32)*Crc_DataPtr;
         for( uint8 bit = 0; bit < 8; bit++ )
         {
@@ -419,9 +2086,11 @@ uint32 Crc_CalculateCRC32P4( const uint8 *Crc_DataPtr, uint32 Crc_Length, uint32
                 crcValue >>= 1;
             }
         }
+#endif
         /* cppcheck-suppress misra-c2012-17.8 ; It's needed to increment the value of the variable*/
         Crc_DataPtr++;
     }
+#endif
     crcValue ^= CRC_32BITP4_XORVALUE;
 
     return crcValue;
@@ -453,9 +2122,11 @@ uint32 Crc_CalculateCRC32P4( const uint8 *Crc_DataPtr, uint32 Crc_Length, uint32
  *
  * @reqs   SWS_Crc_00061, SWS_Crc_00064
  */
-uint64 Crc_CalculateCRC64( const uint8 *Crc_DataPtr, uint32 Crc_Length, uint64 Crc_StartValue64, boolean Crc_IsFirstCall )
+CRC_RAMFUNC uint64 Crc_CalculateCRC64( const uint8 *Crc_DataPtr, uint32 Crc_Length, uint64 Crc_StartValue64, boolean Crc_IsFirstCall )
 {
     uint64 crcValue;
+    uint32 crcLow;
+    uint32 crcHigh;
     crcValue = Crc_StartValue64;
     if( Crc_Length != 0 )
     {
@@ -467,28 +2138,269 @@ uint64 Crc_CalculateCRC64( const uint8 *Crc_DataPtr, uint32 Crc_Length, uint64 C
         {
             crcValue ^= CRC_64BIT_XORVALUE;
         }
+        /* the crc register is kept in two halves, the core has no 64 bits shifts nor compares */
+        crcLow  = (uint32)crcValue;
+        crcHigh = (uint32)( crcValue >> CRC_64BIT_HALF_BITS );
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Crc_Cfg.h */
+#if CRC_64_MODE == CRC_SLICE4
+        Crc_Slice4Reflected64( Crc_DataPtr, Crc_Length, &crcLow, &crcHigh );
+#else
         for( uint32 i = Crc_Length; i != 0; i-- )
         {
-            crcValue ^= (uint64)*Crc_DataPtr;
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Crc_Cfg.h */
+#if CRC_64_MODE == CRC_TABLE
+            uint32 index = ( crcLow ^ *Crc_DataPtr ) & CRC_TABLE_INDEX_MASK;
+            crcLow       = ( ( crcLow >> CRC_TABLE_BYTE_SHIFT ) | ( crcHigh << ( CRC_64BIT_HALF_BITS - CRC_TABLE_BYTE_SHIFT ) ) ) ^ Crc_Table64[ index ][ CRC_64_LOW ];
+            crcHigh      = ( crcHigh >> CRC_TABLE_BYTE_SHIFT ) ^ Crc_Table64[ index ][ CRC_64_HIGH ];
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Crc_Cfg.h */
+#elif CRC_64_MODE == CRC_NIBBLE
+            crcLow ^= (uint32)*Crc_DataPtr;
+            uint32 index = crcLow & CRC_NIBBLE_INDEX_MASK;
+            crcLow       = ( ( crcLow >> CRC_NIBBLE_SHIFT ) | ( crcHigh << ( CRC_64BIT_HALF_BITS - CRC_NIBBLE_SHIFT ) ) ) ^ Crc_Nibble64[ CRC_64_LOW ][ index ];
+            crcHigh      = ( crcHigh >> CRC_NIBBLE_SHIFT ) ^ Crc_Nibble64[ CRC_64_HIGH ][ index ];
+            index        = crcLow & CRC_NIBBLE_INDEX_MASK;
+            crcLow       = ( ( crcLow >> CRC_NIBBLE_SHIFT ) | ( crcHigh << ( CRC_64BIT_HALF_BITS - CRC_NIBBLE_SHIFT ) ) ) ^ Crc_Nibble64[ CRC_64_LOW ][ index ];
+            crcHigh      = ( crcHigh >> CRC_NIBBLE_SHIFT ) ^ Crc_Nibble64[ CRC_64_HIGH ][ index ];
+#else
+            crcLow ^= (uint32)*Crc_DataPtr;
             for( uint8 bit = 0; bit < 8; bit++ )
             {
-                if( ( crcValue & CRC_64BIT_LSB ) != FALSE )
-                {
-                    crcValue = ( crcValue >> 1 ) ^ CRC_CRC64_POLYNOMIAL_REFLECTED;
-                }
-                else
-                {
-                    crcValue >>= 1;
-                }
+                /* all ones when the polynomial shall be applied, avoids the branch on each bit */
+                uint32 mask = 0u - ( crcLow & CRC_64BIT_HALF_LSB );
+                crcLow      = ( ( crcLow >> 1 ) | ( crcHigh << ( CRC_64BIT_HALF_BITS - 1u ) ) ) ^ ( CRC_64BIT_POLYNOMIAL_LOW & mask );
+                crcHigh     = ( crcHigh >> 1 ) ^ ( CRC_64BIT_POLYNOMIAL_HIGH & mask );
             }
+#endif
             /* cppcheck-suppress misra-c2012-17.8 ; It's needed to increment the value of the variable*/
             Crc_DataPtr++;
         }
+#endif
+        crcValue = ( (uint64)crcHigh << CRC_64BIT_HALF_BITS ) | crcLow;
         crcValue ^= CRC_64BIT_XORVALUE;
     }
     return crcValue;
 }
 
+/**
+ * @brief   **Multiply two polynomials modulo a reflected 32 bits crc polynomial**
+ *
+ * Carry-less multiplication over GF(2) of two polynomials in the reflected representation used by
+ * the crc register (x^0 on the most significant bit), the result is reduced modulo the crc
+ * polynomial one bit at a time.
+ *
+ * @param   Crc_PolyA First polynomial
+ * @param   Crc_PolyB Second polynomial
+ * @param   Crc_Polynomial Reflected crc polynomial
+ *
+ * @retval  Crc_PolyA * Crc_PolyB modulo Crc_Polynomial
+ */
+static uint32 Crc_MultModP32( uint32 Crc_PolyA, uint32 Crc_PolyB, uint32 Crc_Polynomial )
+{
+    uint32 product = 0u;
+    uint32 polyB   = Crc_PolyB;
+    uint32 mask    = CRC_32BIT_X0;
+
+    while( mask != 0u )
+    {
+        if( ( Crc_PolyA & mask ) != 0u )
+        {
+            product ^= polyB;
+        }
+
+        if( ( polyB & CRC_32BIT_LSB ) != 0u )
+        {
+            polyB = ( polyB >> 1u ) ^ Crc_Polynomial;
+        }
+        else
+        {
+            polyB >>= 1u;
+        }
+        mask >>= 1u;
+    }
+
+    return product;
+}
+
+/**
+ * @brief   **Shift a 32 bits crc register over a number of zero bytes**
+ *
+ * Appending n zero bytes to the message multiplies the crc register by x^(8n) modulo the crc
+ * polynomial, the power is obtained by squaring x^8 once per bit of the length, so the cost is
+ * O(log n) multiplications regardless of the number of bytes.
+ *
+ * @param   Crc_Value Crc register value to shift
+ * @param   Crc_Length Number of zero bytes
+ * @param   Crc_Polynomial Reflected crc polynomial
+ *
+ * @retval  Crc_Value * x^(8 * Crc_Length) modulo Crc_Polynomial
+ */
+static uint32 Crc_ShiftZeros32( uint32 Crc_Value, uint32 Crc_Length, uint32 Crc_Polynomial )
+{
+    uint32 crcValue = Crc_Value;
+    uint32 power    = CRC_32BIT_X8;
+    uint32 length   = Crc_Length;
+
+    while( length != 0u )
+    {
+        if( ( length & 1u ) != 0u )
+        {
+            crcValue = Crc_MultModP32( power, crcValue, Crc_Polynomial );
+        }
+
+        length >>= 1u;
+        if( length != 0u )
+        {
+            power = Crc_MultModP32( power, power, Crc_Polynomial );
+        }
+    }
+
+    return crcValue;
+}
+
+/**
+ * @brief   **Multiply two polynomials modulo a reflected 64 bits crc polynomial**
+ *
+ * Same as Crc_MultModP32 for the 64 bits crc register.
+ *
+ * @param   Crc_PolyA First polynomial
+ * @param   Crc_PolyB Second polynomial
+ * @param   Crc_Polynomial Reflected crc polynomial
+ *
+ * @retval  Crc_PolyA * Crc_PolyB modulo Crc_Polynomial
+ */
+static uint64 Crc_MultModP64( uint64 Crc_PolyA, uint64 Crc_PolyB, uint64 Crc_Polynomial )
+{
+    uint64 product = 0u;
+    uint64 polyB   = Crc_PolyB;
+    uint64 mask    = CRC_64BIT_X0;
+
+    while( mask != 0u )
+    {
+        if( ( Crc_PolyA & mask ) != 0u )
+        {
+            product ^= polyB;
+        }
+
+        if( ( polyB & CRC_64BIT_LSB ) != 0u )
+        {
+            polyB = ( polyB >> 1u ) ^ Crc_Polynomial;
+        }
+        else
+        {
+            polyB >>= 1u;
+        }
+        mask >>= 1u;
+    }
+
+    return product;
+}
+
+/**
+ * @brief   **Shift a 64 bits crc register over a number of zero bytes**
+ *
+ * Same as Crc_ShiftZeros32 for the CRC64 polynomial.
+ *
+ * @param   Crc_Value Crc register value to shift
+ * @param   Crc_Length Number of zero bytes
+ *
+ * @retval  Crc_Value * x^(8 * Crc_Length) modulo the CRC64 polynomial
+ */
+static uint64 Crc_ShiftZeros64( uint64 Crc_Value, uint32 Crc_Length )
+{
+    uint64 crcValue = Crc_Value;
+    uint64 power    = CRC_64BIT_X8;
+    uint32 length   = Crc_Length;
+
+    while( length != 0u )
+    {
+        if( ( length & 1u ) != 0u )
+        {
+            crcValue = Crc_MultModP64( power, crcValue, CRC_CRC64_POLYNOMIAL_REFLECTED );
+        }
+
+        length >>= 1u;
+        if( length != 0u )
+        {
+            power = Crc_MultModP64( power, power, CRC_CRC64_POLYNOMIAL_REFLECTED );
+        }
+    }
+
+    return crcValue;
+}
+
+/**
+ * @brief   **Combine two CRC32 calculated over consecutive chunks**
+ *
+ * Gives the crc of the concatenation of two chunks from the crc of each one, without touching
+ * the data again. Both crcs shall be the result of Crc_CalculateCRC32 with Crc_IsFirstCall set
+ * to TRUE, so chunks can be calculated in any order (or by different bus masters) and merged
+ * later. The first crc is shifted over the length of the second chunk in O(log n) GF(2)
+ * polynomial multiplications, then both are added.
+ *
+ * @param   Crc_Crc1 Crc of the first chunk
+ * @param   Crc_Crc2 Crc of the second chunk
+ * @param   Crc_Length2 Length of the second chunk in bytes
+ *
+ * @retval  Crc of the first chunk followed by the second chunk
+ */
+uint32 Crc_CombineCRC32( uint32 Crc_Crc1, uint32 Crc_Crc2, uint32 Crc_Length2 )
+{
+    uint32 crcValue = Crc_Crc1;
+
+    if( Crc_Length2 != 0u )
+    {
+        crcValue = Crc_ShiftZeros32( Crc_Crc1, Crc_Length2, CRC_32BIT_POLYNOMIAL_REFLECTED ) ^ Crc_Crc2;
+    }
+
+    return crcValue;
+}
+
+/**
+ * @brief   **Combine two CRC32P4 calculated over consecutive chunks**
+ *
+ * Same as Crc_CombineCRC32 for crcs given by Crc_CalculateCRC32P4.
+ *
+ * @param   Crc_Crc1 Crc of the first chunk
+ * @param   Crc_Crc2 Crc of the second chunk
+ * @param   Crc_Length2 Length of the second chunk in bytes
+ *
+ * @retval  Crc of the first chunk followed by the second chunk
+ */
+uint32 Crc_CombineCRC32P4( uint32 Crc_Crc1, uint32 Crc_Crc2, uint32 Crc_Length2 )
+{
+    uint32 crcValue = Crc_Crc1;
+
+    if( Crc_Length2 != 0u )
+    {
+        crcValue = Crc_ShiftZeros32( Crc_Crc1, Crc_Length2, CRC_CRC32P4_POLYNOMIAL_REFLECTED ) ^ Crc_Crc2;
+    }
+
+    return crcValue;
+}
+
+/**
+ * @brief   **Combine two CRC64 calculated over consecutive chunks**
+ *
+ * Same as Crc_CombineCRC32 for crcs given by Crc_CalculateCRC64.
+ *
+ * @param   Crc_Crc1 Crc of the first chunk
+ * @param   Crc_Crc2 Crc of the second chunk
+ * @param   Crc_Length2 Length of the second chunk in bytes
+ *
+ * @retval  Crc of the first chunk followed by the second chunk
+ */
+uint64 Crc_CombineCRC64( uint64 Crc_Crc1, uint64 Crc_Crc2, uint32 Crc_Length2 )
+{
+    uint64 crcValue = Crc_Crc1;
+
+    if( Crc_Length2 != 0u )
+    {
+        crcValue = Crc_ShiftZeros64( Crc_Crc1, Crc_Length2 ) ^ Crc_Crc2;
+    }
+
+    return crcValue;
+}
+
 /**
  * @brief   **Fuunction to assign values to VersionInfo structure**
  *
@@ -526,4 +2438,131 @@ uint8 Crc_GetVersionInfo( Std_VersionInfoType *Versioninfo )
     }
 
     return status;
-}
\ No newline at end of file
+}
+
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Crc_Cfg.h */
+#if CRC_REGION_API == STD_ON
+/**
+ * @brief   **Start the calculation of a CRC32 over a memory region**
+ *
+ * The function starts an asynchronous CRC32 calculation, the region is fed to the crc unit by a
+ * DMA channel in chunks of CRC_REGION_CHUNK_WORDS words while the application keeps running. The
+ * result is the same Crc_CalculateCRC32 gives for the same parameters, and it can be polled with
+ * Crc_GetRegionResult or received through the callback. Regions shorter than
+ * CRC_REGION_MIN_LENGTH are not worth the DMA setup and are calculated right away by the cpu,
+ * the callback is called before the function returns. Otherwise Crc_RegionIsr is installed on
+ * the interrupt vector of CRC_REGION_DMA_CHANNEL, if not done yet, before the DMA starts.
+ *
+ * @param   Crc_DataPtr Pointer to start address of the region
+ * @param   Crc_Length Length of the region in bytes
+ * @param   Crc_StartValue32 Start value when the algorithm starts.
+ * @param   Crc_IsFirstCall boolean variable to know if is the first time that we used the function.
+ * @param   Crc_Callback Function to call when the calculation finishes, NULL_PTR if not needed
+ *
+ * @retval  E_OK if the calculation has been started, E_NOT_OK if a region calculation is already
+ *          in progress or the crc unit is busy
+ */
+Std_ReturnType Crc_StartRegionCRC32( const uint8 *Crc_DataPtr, uint32 Crc_Length, uint32 Crc_StartValue32, boolean Crc_IsFirstCall, Crc_RegionCallbackType Crc_Callback )
+{
+    Std_ReturnType Status = E_NOT_OK;
+    uint32 crcValue       = Crc_StartValue32 ^ CRC_32BIT_XORVALUE;
+
+    if( Crc_IsFirstCall == TRUE )
+    {
+        crcValue = CRC_32BIT_XORVALUE;
+    }
+
+    /* the region is claimed atomically, a caller from an interrupt may try at the same time */
+    uint32 PriMask                    = Bfx_EnterAtomic_u32( );
+    Crc_RegionStateType PreviousState = Crc_RegionState;
+    if( PreviousState != CRC_REGION_BUSY )
+    {
+        Crc_RegionState = CRC_REGION_BUSY;
+    }
+    Bfx_ExitAtomic_u32( PriMask );
+
+    if( PreviousState != CRC_REGION_BUSY )
+    {
+        Crc_RegionCallback = Crc_Callback;
+
+        if( Crc_Length < CRC_REGION_MIN_LENGTH )
+        {
+            Crc_RegionResult = Crc_CalculateCRC32( Crc_DataPtr, Crc_Length, Crc_StartValue32, Crc_IsFirstCall );
+            Crc_RegionState  = CRC_REGION_DONE;
+            Status           = E_OK;
+
+            if( Crc_RegionCallback != NULL_PTR )
+            {
+                Crc_RegionCallback( CRC_REGION_DONE, Crc_RegionResult );
+            }
+        }
+        else
+        {
+            /* the state is already busy before the DMA starts, its interrupt may come at any time */
+            Crc_Arch_InstallRegionIsr( Crc_RegionIsr );
+            Status = Crc_Arch_StartRegion( &Crc_Hw32, Crc_DataPtr, Crc_Length, crcValue );
+
+            if( Status == E_NOT_OK )
+            {
+                Crc_RegionState = PreviousState;
+            }
+        }
+    }
+
+    return Status;
+}
+
+/**
+ * @brief   **Get the state and result of the region calculation**
+ *
+ * @param   Crc_Result Crc of the region, only written when the calculation is done
+ *
+ * @retval  CRC_REGION_IDLE if no calculation has been requested, CRC_REGION_BUSY while the
+ *          calculation is in progress, CRC_REGION_DONE once finished or CRC_REGION_FAILED if
+ *          the DMA reported a transfer error
+ */
+Crc_RegionStateType Crc_GetRegionResult( uint32 *Crc_Result )
+{
+    Crc_RegionStateType State = Crc_RegionState;
+
+    if( State == CRC_REGION_DONE )
+    {
+        *Crc_Result = Crc_RegionResult;
+    }
+
+    return State;
+}
+
+/**
+ * @brief   **Interrupt handler of the region calculation**
+ *
+ * Installed on the interrupt vector of the DMA channel CRC_REGION_DMA_CHANNEL, it starts
+ * the next chunk of the region or, when the whole region has been fed, applies the final xor,
+ * stores the result and calls the notification. The other DMA channels sharing the vector are
+ * served by the handler Crc_Arch_RegionIsr chains.
+ */
+void Crc_RegionIsr( void )
+{
+    uint32 crcValue = 0u;
+    uint8 Status    = Crc_Arch_RegionIsr( &crcValue );
+
+    if( Status == CRC_ARCH_REGION_DONE )
+    {
+        Crc_RegionResult = crcValue ^ CRC_32BIT_XORVALUE;
+        Crc_RegionState  = CRC_REGION_DONE;
+    }
+    else if( Status == CRC_ARCH_REGION_ERROR )
+    {
+        Crc_RegionState = CRC_REGION_FAILED;
+    }
+    else
+    {
+        /* next chunk started, nothing else to do */
+    }
+
+    if( ( Status != CRC_ARCH_REGION_ONGOING ) && ( Crc_RegionCallback != NULL_PTR ) )
+    {
+        Crc_RegionCallback( Crc_RegionState, Crc_RegionResult );
+    }
+}
+#endif
@@ -10,12 +10,51 @@
  * • CRC32P4: CRC32 0xF4ACFB13 polynomial
  * • CRC64: CRC-64-ECMA
  *
- * This library was designed like a Runtime calculation:
- * Slower execution, but small code size (no ROM table)
+ * Each routine can be calculated at runtime (slower execution, but small code size, no ROM
+ * table), using a 16 entries nibble table (a few bytes of ROM, around 4 times faster than
+ * runtime) or using a 256 entries lookup table (faster execution, bigger code size), CRC32,
+ * CRC32P4 and CRC64 can also use slicing by 4 tables for bulk buffers, and CRC8, CRC8H2F, CRC16
+ * and CRC32 can be calculated by the crc hardware unit, the method is selected per polynomial in
+ * Crc_Cfg.h
  */
 #ifndef CRC_H_
 #define CRC_H_
 
+/**
+  * @defgroup CRC_Modes values to select the calculation method of each CRC routine
+  @{ */
+#define CRC_RUNTIME  0u /*!< Bit by bit calculation, no ROM table */
+#define CRC_TABLE    1u /*!< Byte wise calculation using a 256 entries ROM table */
+#define CRC_SLICE4   2u /*!< Word wise calculation using four 256 entries ROM tables (CRC32, CRC32P4 and CRC64 only) */
+#define CRC_NIBBLE   3u /*!< Nibble wise calculation using a 16 entries ROM table */
+#define CRC_HARDWARE 4u /*!< Calculation using the crc unit, bit by bit when the unit is busy (CRC8, CRC8H2F, CRC16 and CRC32 only) */
+/**
+  @} */
+
+#include "Crc_Cfg.h"
+
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Crc_Cfg.h */
+#if CRC_REGION_API == STD_ON
+/**
+ * @brief   **State of the asynchronous region calculation**
+ */
+typedef enum _Crc_RegionStateType
+{
+    CRC_REGION_IDLE = 0x00, /*!< No region calculation has been requested */
+    CRC_REGION_BUSY,        /*!< The region calculation is in progress    */
+    CRC_REGION_DONE,        /*!< The region calculation has finished      */
+    CRC_REGION_FAILED       /*!< The region calculation has been aborted  */
+} Crc_RegionStateType;
+
+/**
+ * @brief   **Notification called when a region calculation finishes**
+ *
+ * Receives the final state (CRC_REGION_DONE or CRC_REGION_FAILED) and the crc of the region, it
+ * is called from interrupt context.
+ */
+typedef void ( *Crc_RegionCallbackType )( Crc_RegionStateType Crc_State, uint32 Crc_Result );
+#endif
+
 uint8 Crc_CalculateCRC8( const uint8 *Crc_DataPtr, uint32 Crc_Length, uint8 Crc_StartValue8, boolean Crc_IsFirstCall );
 uint8 Crc_CalculateCRC8H2F( const uint8 *Crc_DataPtr, uint32 Crc_Length, uint8 Crc_StartValue8H2F, boolean Crc_IsFirstCall );
 uint16 Crc_CalculateCRC16( const uint8 *Crc_DataPtr, uint32 Crc_Length, uint16 Crc_StartValue16, boolean Crc_IsFirstCall );
@@ -24,5 +63,14 @@ uint32 Crc_CalculateCRC32( const uint8 *Crc_DataPtr, uint32 Crc_Length, uint32 C
 uint32 Crc_CalculateCRC32P4( const uint8 *Crc_DataPtr, uint32 Crc_Length, uint32 Crc_StartValue32, boolean Crc_IsFirstCall );
 uint64 Crc_CalculateCRC64( const uint8 *Crc_DataPtr, uint32 Crc_Length, uint64 Crc_StartValue64, boolean Crc_IsFirstCall );
 uint8 Crc_GetVersionInfo( Std_VersionInfoType *Versioninfo );
+uint32 Crc_CombineCRC32( uint32 Crc_Crc1, uint32 Crc_Crc2, uint32 Crc_Length2 );
+uint32 Crc_CombineCRC32P4( uint32 Crc_Crc1, uint32 Crc_Crc2, uint32 Crc_Length2 );
+uint64 Crc_CombineCRC64( uint64 Crc_Crc1, uint64 Crc_Crc2, uint32 Crc_Length2 );
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Crc_Cfg.h */
+#if CRC_REGION_API == STD_ON
+Std_ReturnType Crc_StartRegionCRC32( const uint8 *Crc_DataPtr, uint32 Crc_Length, uint32 Crc_StartValue32, boolean Crc_IsFirstCall, Crc_RegionCallbackType Crc_Callback );
+Crc_RegionStateType Crc_GetRegionResult( uint32 *Crc_Result );
+void Crc_RegionIsr( void );
+#endif
 
 #endif
\ No newline at end of file
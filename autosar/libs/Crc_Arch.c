@@ -0,0 +1,394 @@
+/**
+ * @file    Crc_Arch.c
+ * @brief   **Crc hardware calculation unit**
+ *
+ * Low level implementation of the CRC calculation using the CRC unit of the STM32G0xx family.
+ * The data is fed in 32 bits words (four bytes packed in stream order) and the remaining bytes
+ * using 8 bits writes. The unit is a single resource, so if it is already in use (e.g. the
+ * routine is called from an interrupt while a calculation is ongoing) the request is rejected
+ * and the caller shall calculate the crc by software.
+ *
+ * Big memory regions can also be fed by a DMA channel in memory to memory mode, in chunks of up to
+ * CRC_REGION_CHUNK_WORDS words, so the cpu is free while the crc unit does the calculation.
+ *
+ * The CRC unit clock (RCC_AHBENR CRCEN) shall be enabled before calling any Crc routine
+ * configured as CRC_HARDWARE, and the DMA1 clock (RCC_AHBENR DMA1EN) before starting a region
+ * calculation. The region handler is installed on the vector of the DMA channel and the vector
+ * enabled by Crc_Arch_InstallRegionIsr, channels 2 to 7 share their vector with other channels
+ * so the handler found on it is chained.
+ */
+#include "Std_Types.h"
+#include "Registers.h"
+#include "Bfx.h"
+#include "Crc_Cfg.h"
+#include "Crc_Arch.h"
+#include "Nvic.h"
+
+/**
+ * @defgroup CRC_CR_Bits CRC control register bits
+ *
+ * @{ */
+#define CR_RESET_BIT         0u /*!< Reset the crc unit, INIT is loaded into DR */
+#define CR_POLYSIZE_BIT      3u /*!< Polynomial size field */
+#define CR_POLYSIZE_SIZE     2u /*!< Polynomial size field size */
+#define CR_REV_IN_BIT        5u /*!< Reverse input data field */
+#define CR_REV_IN_SIZE       2u /*!< Reverse input data field size */
+#define CR_REV_OUT_BIT       7u /*!< Reverse output data bit */
+#define CR_REV_IN_BY_BYTE    1u /*!< Bit reversal done by byte */
+#define CR_REV_IN_BY_WORD    3u /*!< Bit reversal done by word */
+/**
+ * @} */
+
+/**
+ * @defgroup DMA_CCR_Bits DMA channel configuration register bits
+ *
+ * @{ */
+#define CCR_EN_BIT           0u  /*!< Channel enable */
+#define CCR_TCIE_BIT         1u  /*!< Transfer complete interrupt enable */
+#define CCR_TEIE_BIT         3u  /*!< Transfer error interrupt enable */
+#define CCR_DIR_BIT          4u  /*!< Read from memory (CMAR) and write to CPAR */
+#define CCR_MINC_BIT         7u  /*!< Memory increment mode */
+#define CCR_PSIZE_BIT        8u  /*!< Peripheral size field */
+#define CCR_MSIZE_BIT        10u /*!< Memory size field */
+#define CCR_SIZE_SIZE        2u  /*!< Size of the peripheral and memory size fields */
+#define CCR_SIZE_32BITS      2u  /*!< 32 bits transfers */
+#define CCR_MEM2MEM_BIT      14u /*!< Memory to memory mode */
+/**
+ * @} */
+
+/**
+ * @defgroup DMA_ISR_Bits DMA interrupt status and clear register bits
+ *
+ * @{ */
+#define ISR_GIF_BIT          0u /*!< Global interrupt flag of the channel */
+#define ISR_TCIF_BIT         1u /*!< Transfer complete flag of the channel */
+#define ISR_TEIF_BIT         3u /*!< Transfer error flag of the channel */
+#define ISR_CHANNEL_SIZE     4u /*!< Number of flags for each channel */
+/**
+ * @} */
+
+/**
+ * @defgroup CRC_Arch_Values values used to feed the crc unit
+ *
+ * @{ */
+#define CRC_ARCH_WORD_SIZE   4u  /*!< Number of bytes on each word written to the unit */
+#define CRC_ARCH_BYTE0_SHIFT 24u /*!< Shift of the first byte on the word written to the unit */
+#define CRC_ARCH_BYTE1_SHIFT 16u /*!< Shift of the second byte on the word written to the unit */
+#define CRC_ARCH_BYTE2_SHIFT 8u  /*!< Shift of the third byte on the word written to the unit */
+#define CRC_ARCH_MAX_WIDTH   32u /*!< Maximum width of the crc in bits */
+/**
+ * @} */
+
+/**
+ * @brief  Flag to know if the crc unit is already performing a calculation
+ */
+/* cppcheck-suppress misra-c2012-8.4 ; qualifier is declared only for testing purposes */
+CRC_STATIC volatile boolean Crc_Arch_Busy = FALSE;
+
+/**
+ * @brief  Next byte of the region to feed to the crc unit
+ */
+/* cppcheck-suppress misra-c2012-8.4 ; qualifier is declared only for testing purposes */
+CRC_STATIC const uint8 *Crc_Arch_RegionPtr = NULL_PTR;
+
+/**
+ * @brief  Number of bytes of the region not yet fed to the crc unit
+ */
+/* cppcheck-suppress misra-c2012-8.4 ; qualifier is declared only for testing purposes */
+CRC_STATIC uint32 Crc_Arch_RegionLength = 0u;
+
+/**
+ * @brief  Handler found on the DMA channel vector before the region handler was installed, the
+ *         vector is shared with other DMA channels so it is called on every interrupt.
+ */
+/* cppcheck-suppress misra-c2012-8.4 ; qualifier is declared only for testing purposes */
+CRC_STATIC Crc_Arch_IsrType Crc_Arch_RegionChained = NULL_PTR;
+
+static uint32 Crc_Arch_Reverse( uint32 Value, uint8 Width );
+static void Crc_Arch_RegionNextChunk( void );
+static uint32 Crc_Arch_RegionFinish( void );
+
+/**
+ * @brief   **Calculate a crc using the hardware unit**
+ *
+ * The function programs the polynomial, the initial value and the reflection options of the
+ * unit, then feeds the data and reads back the result. The crc register value is given and
+ * returned in the same representation the software routines use (reflected for reflected
+ * polynomials), no final xor is applied. If the unit is busy with another calculation the
+ * function returns immediately without touching the unit.
+ *
+ * @param   Config Polynomial configuration of the crc to calculate
+ * @param   Crc_DataPtr Pointer to start address of data block to be calculated.
+ * @param   Crc_Length Length of data block to be calculated in bytes.
+ * @param   Crc_Value Initial value of the crc register, and the result when the function returns E_OK
+ *
+ * @retval  E_OK if the calculation has been performed, E_NOT_OK if the unit is busy
+ */
+Std_ReturnType Crc_Arch_Calculate( const Crc_Arch_ConfigType *Config, const uint8 *Crc_DataPtr, uint32 Crc_Length, uint32 *Crc_Value )
+{
+    Std_ReturnType Status = E_NOT_OK;
+    uint32 Control        = 0u;
+    const uint8 *DataPtr  = Crc_DataPtr;
+    uint32 Length         = Crc_Length;
+
+    if( Crc_Arch_Busy == FALSE )
+    {
+        Crc_Arch_Busy = TRUE;
+
+        Bfx_PutBits_u32u8u8u32( &Control, CR_POLYSIZE_BIT, CR_POLYSIZE_SIZE, Config->PolySize );
+        Bfx_SetBit_u32u8( &Control, CR_RESET_BIT );
+        if( Config->Reflected == TRUE )
+        {
+            Bfx_PutBits_u32u8u8u32( &Control, CR_REV_IN_BIT, CR_REV_IN_SIZE, CR_REV_IN_BY_BYTE );
+            Bfx_SetBit_u32u8( &Control, CR_REV_OUT_BIT );
+            CRC->INIT = Crc_Arch_Reverse( *Crc_Value, Config->Width );
+        }
+        else
+        {
+            CRC->INIT = *Crc_Value;
+        }
+        CRC->POL = Config->Polynomial;
+        CRC->CR  = Control;
+
+        while( Length >= CRC_ARCH_WORD_SIZE )
+        {
+            CRC->DR = ( (uint32)DataPtr[ 0 ] << CRC_ARCH_BYTE0_SHIFT ) |
+                      ( (uint32)DataPtr[ 1 ] << CRC_ARCH_BYTE1_SHIFT ) |
+                      ( (uint32)DataPtr[ 2 ] << CRC_ARCH_BYTE2_SHIFT ) |
+                      (uint32)DataPtr[ 3 ];
+            DataPtr = &DataPtr[ CRC_ARCH_WORD_SIZE ];
+            Length -= CRC_ARCH_WORD_SIZE;
+        }
+
+        for( uint32 i = 0; i < Length; i++ )
+        {
+            /* cppcheck-suppress misra-c2012-11.3 ; 8 bits write access is needed to feed a single byte */
+            *(volatile uint8 *)&CRC->DR = DataPtr[ i ];
+        }
+
+        *Crc_Value = CRC->DR;
+
+        Crc_Arch_Busy = FALSE;
+        Status        = E_OK;
+    }
+
+    return Status;
+}
+
+/**
+ * @brief   **Start a crc calculation of a memory region using the DMA**
+ *
+ * The function programs the crc unit the same way Crc_Arch_Calculate does, feeds the leading bytes
+ * until the address is word aligned and then starts the first DMA chunk. Words are read from
+ * memory in little endian order, so the input reversal is switched to word mode while the DMA
+ * feeds the unit; only reflected polynomials of 32 bits can be calculated this way. The unit
+ * remains busy until the calculation finishes or fails on Crc_Arch_RegionIsr.
+ *
+ * @param   Config Polynomial configuration of the crc to calculate, reflected 32 bits only
+ * @param   Crc_DataPtr Pointer to start address of the region
+ * @param   Crc_Length Length of the region in bytes, at least 7 bytes to have one word to transfer
+ * @param   Crc_Value Initial value of the crc register
+ *
+ * @retval  E_OK if the calculation has been started, E_NOT_OK if the unit is busy
+ */
+Std_ReturnType Crc_Arch_StartRegion( const Crc_Arch_ConfigType *Config, const uint8 *Crc_DataPtr, uint32 Crc_Length, uint32 Crc_Value )
+{
+    Std_ReturnType Status = E_NOT_OK;
+    uint32 Control        = 0u;
+
+    if( Crc_Arch_Busy == FALSE )
+    {
+        Crc_Arch_Busy         = TRUE;
+        Crc_Arch_RegionPtr    = Crc_DataPtr;
+        Crc_Arch_RegionLength = Crc_Length;
+
+        Bfx_PutBits_u32u8u8u32( &Control, CR_POLYSIZE_BIT, CR_POLYSIZE_SIZE, Config->PolySize );
+        Bfx_PutBits_u32u8u8u32( &Control, CR_REV_IN_BIT, CR_REV_IN_SIZE, CR_REV_IN_BY_BYTE );
+        Bfx_SetBit_u32u8( &Control, CR_REV_OUT_BIT );
+        Bfx_SetBit_u32u8( &Control, CR_RESET_BIT );
+        CRC->INIT = Crc_Arch_Reverse( Crc_Value, Config->Width );
+        CRC->POL  = Config->Polynomial;
+        CRC->CR   = Control;
+
+        /* cppcheck-suppress misra-c2012-11.4 ; the address is needed to know its alignment */
+        while( ( (uint32)Crc_Arch_RegionPtr & ( CRC_ARCH_WORD_SIZE - 1u ) ) != 0u )
+        {
+            /* cppcheck-suppress misra-c2012-11.3 ; 8 bits write access is needed to feed a single byte */
+            *(volatile uint8 *)&CRC->DR = *Crc_Arch_RegionPtr;
+            Crc_Arch_RegionPtr          = &Crc_Arch_RegionPtr[ 1 ];
+            Crc_Arch_RegionLength--;
+        }
+
+        Crc_Arch_RegionNextChunk( );
+        Status = E_OK;
+    }
+
+    return Status;
+}
+
+/**
+ * @brief   **DMA interrupt handler of the region calculation**
+ *
+ * Shall be called from the interrupt of the DMA channel CRC_REGION_DMA_CHANNEL. When a chunk has
+ * been transferred the next one is started, and once no full words remain the trailing bytes
+ * are fed by the cpu and the crc register is read back. On a transfer error the calculation is
+ * aborted. In both cases the crc unit is released. The handler chained by
+ * Crc_Arch_InstallRegionIsr is called on every interrupt, the flags of other channels are its own.
+ *
+ * @param   Crc_Value The value of the crc register when the function returns CRC_ARCH_REGION_DONE
+ *
+ * @retval  CRC_ARCH_REGION_ONGOING, CRC_ARCH_REGION_DONE or CRC_ARCH_REGION_ERROR
+ */
+uint8 Crc_Arch_RegionIsr( uint32 *Crc_Value )
+{
+    uint8 Status      = CRC_ARCH_REGION_ONGOING;
+    uint8 FlagsOffset = ( CRC_REGION_DMA_CHANNEL - 1u ) * ISR_CHANNEL_SIZE;
+    uint32 Flags      = DMA1->ISR;
+
+    if( Bfx_GetBit_u32u8_u8( Flags, FlagsOffset + ISR_TEIF_BIT ) == TRUE )
+    {
+        DMA1->CH[ CRC_REGION_DMA_CHANNEL - 1u ].CCR = 0u;
+        DMA1->IFCR                                  = (uint32)1u << ( FlagsOffset + ISR_GIF_BIT );
+        Crc_Arch_Busy                               = FALSE;
+        Status                                      = CRC_ARCH_REGION_ERROR;
+    }
+    else if( Bfx_GetBit_u32u8_u8( Flags, FlagsOffset + ISR_TCIF_BIT ) == TRUE )
+    {
+        DMA1->CH[ CRC_REGION_DMA_CHANNEL - 1u ].CCR = 0u;
+        DMA1->IFCR                                  = (uint32)1u << ( FlagsOffset + ISR_GIF_BIT );
+
+        if( Crc_Arch_RegionLength >= CRC_ARCH_WORD_SIZE )
+        {
+            Crc_Arch_RegionNextChunk( );
+        }
+        else
+        {
+            *Crc_Value = Crc_Arch_RegionFinish( );
+            Status     = CRC_ARCH_REGION_DONE;
+        }
+    }
+    else
+    {
+        /* interrupt of another channel sharing the vector, nothing to do */
+    }
+
+    if( Crc_Arch_RegionChained != NULL_PTR )
+    {
+        Crc_Arch_RegionChained( );
+    }
+
+    return Status;
+}
+
+/**
+ * @brief   **Install the interrupt handler of the region calculation**
+ *
+ * Handler is installed once on the vector of CRC_REGION_DMA_CHANNEL and the vector is enabled,
+ * the handler already on the vector is kept to be chained from Crc_Arch_RegionIsr.
+ *
+ * @param   Handler Interrupt handler calling Crc_Arch_RegionIsr
+ */
+void Crc_Arch_InstallRegionIsr( Crc_Arch_IsrType Handler )
+{
+    Nvic_HandlerType Previous = CDD_Nvic_GetHandler( CRC_ARCH_REGION_IRQ );
+
+    if( Previous != Handler )
+    {
+        Crc_Arch_RegionChained = Previous;
+        CDD_Nvic_SetHandler( CRC_ARCH_REGION_IRQ, Handler );
+        CDD_Nvic_EnableIrq( CRC_ARCH_REGION_IRQ );
+    }
+}
+
+/**
+ * @brief   **Start the DMA transfer of the next chunk of the region**
+ *
+ * Transfers up to CRC_REGION_CHUNK_WORDS words from the region to the crc data register, the
+ * input reversal is switched to word mode since the DMA reads the words in little endian order.
+ */
+static void Crc_Arch_RegionNextChunk( void )
+{
+    uint32 Words   = Crc_Arch_RegionLength / CRC_ARCH_WORD_SIZE;
+    uint32 Control = CRC->CR;
+    uint32 Channel = 0u;
+
+    if( Words > CRC_REGION_CHUNK_WORDS )
+    {
+        Words = CRC_REGION_CHUNK_WORDS;
+    }
+
+    Bfx_PutBits_u32u8u8u32( &Control, CR_REV_IN_BIT, CR_REV_IN_SIZE, CR_REV_IN_BY_WORD );
+    Bfx_ClrBit_u32u8( &Control, CR_RESET_BIT );
+    CRC->CR = Control;
+
+    Bfx_SetBit_u32u8( &Channel, CCR_TCIE_BIT );
+    Bfx_SetBit_u32u8( &Channel, CCR_TEIE_BIT );
+    Bfx_SetBit_u32u8( &Channel, CCR_DIR_BIT );
+    Bfx_SetBit_u32u8( &Channel, CCR_MINC_BIT );
+    Bfx_PutBits_u32u8u8u32( &Channel, CCR_PSIZE_BIT, CCR_SIZE_SIZE, CCR_SIZE_32BITS );
+    Bfx_PutBits_u32u8u8u32( &Channel, CCR_MSIZE_BIT, CCR_SIZE_SIZE, CCR_SIZE_32BITS );
+    Bfx_SetBit_u32u8( &Channel, CCR_MEM2MEM_BIT );
+    Bfx_SetBit_u32u8( &Channel, CCR_EN_BIT );
+
+    /* cppcheck-suppress misra-c2012-11.4 ; the DMA needs the address of the data register */
+    DMA1->CH[ CRC_REGION_DMA_CHANNEL - 1u ].CPAR  = (uint32)&CRC->DR;
+    /* cppcheck-suppress misra-c2012-11.4 ; the DMA needs the address of the region */
+    DMA1->CH[ CRC_REGION_DMA_CHANNEL - 1u ].CMAR  = (uint32)Crc_Arch_RegionPtr;
+    DMA1->CH[ CRC_REGION_DMA_CHANNEL - 1u ].CNDTR = Words;
+    DMA1->CH[ CRC_REGION_DMA_CHANNEL - 1u ].CCR   = Channel;
+
+    Crc_Arch_RegionPtr = &Crc_Arch_RegionPtr[ Words * CRC_ARCH_WORD_SIZE ];
+    Crc_Arch_RegionLength -= Words * CRC_ARCH_WORD_SIZE;
+}
+
+/**
+ * @brief   **Feed the trailing bytes of the region and read the result**
+ *
+ * The input reversal goes back to byte mode for the trailing bytes written by the cpu, then the
+ * crc register is read and the unit is released.
+ *
+ * @retval  The value of the crc register after feeding the whole region
+ */
+static uint32 Crc_Arch_RegionFinish( void )
+{
+    uint32 Control = CRC->CR;
+    uint32 Value;
+
+    Bfx_PutBits_u32u8u8u32( &Control, CR_REV_IN_BIT, CR_REV_IN_SIZE, CR_REV_IN_BY_BYTE );
+    CRC->CR = Control;
+
+    for( uint32 i = 0; i < Crc_Arch_RegionLength; i++ )
+    {
+        /* cppcheck-suppress misra-c2012-11.3 ; 8 bits write access is needed to feed a single byte */
+        *(volatile uint8 *)&CRC->DR = Crc_Arch_RegionPtr[ i ];
+    }
+    Crc_Arch_RegionLength = 0u;
+
+    Value         = CRC->DR;
+    Crc_Arch_Busy = FALSE;
+
+    return Value;
+}
+
+/**
+ * @brief   **Reverse the bit order of a value**
+ *
+ * The unit keeps the crc register in normal representation, so the initial value of a reflected
+ * crc needs to be bit reversed before loading it into the INIT register.
+ *
+ * @param   Value Value to reverse
+ * @param   Width Number of bits to reverse
+ *
+ * @retval  The reversed value
+ */
+static uint32 Crc_Arch_Reverse( uint32 Value, uint8 Width )
+{
+    uint32 Reversed = 0u;
+
+    for( uint8 bit = 0; bit < CRC_ARCH_MAX_WIDTH; bit++ )
+    {
+        Reversed = ( Reversed << 1u ) | ( ( Value >> bit ) & 1u );
+    }
+
+    return Reversed >> ( CRC_ARCH_MAX_WIDTH - Width );
+}
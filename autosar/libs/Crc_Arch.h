@@ -0,0 +1,78 @@
+/**
+ * @file    Crc_Arch.h
+ * @brief   **Crc hardware calculation unit**
+ *
+ * Low level interface to the CRC calculation unit of the STM32G0xx family, the unit has a
+ * programmable polynomial of 7, 8, 16 or 32 bits, input and output reflection and word wide
+ * feeding. The file is implemented as a means of abstraction from the hardware, this way the
+ * Crc library keeps the same API no matter if a routine is calculated in hardware or software.
+ */
+#ifndef CRC_ARCH_H__
+#define CRC_ARCH_H__
+
+#include "Std_Types.h"
+
+/**
+ * @defgroup CRC_STATIC CRC static define for testing purposes
+ *
+ * @{ */
+#ifndef UTEST
+#define CRC_STATIC static /*!< Add static when no testing */
+#else
+#define CRC_STATIC /*!< remove static for testing purposes */
+#endif
+/**
+ * @} */
+
+/**
+ * @defgroup CRC_Arch_PolySize values for the polynomial size of the CRC unit
+ *
+ * @{ */
+#define CRC_ARCH_POLYSIZE_32 0u /*!< 32 bits polynomial */
+#define CRC_ARCH_POLYSIZE_16 1u /*!< 16 bits polynomial */
+#define CRC_ARCH_POLYSIZE_8  2u /*!< 8 bits polynomial */
+/**
+ * @} */
+
+/**
+ * @defgroup CRC_Arch_Region values returned by Crc_Arch_RegionIsr
+ *
+ * @{ */
+#define CRC_ARCH_REGION_ONGOING 0u /*!< The region calculation is still in progress */
+#define CRC_ARCH_REGION_DONE    1u /*!< The region calculation has finished */
+#define CRC_ARCH_REGION_ERROR   2u /*!< The DMA reported a transfer error, calculation aborted */
+/**
+ * @} */
+
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Crc_Cfg.h */
+#if CRC_REGION_DMA_CHANNEL == 1u
+#define CRC_ARCH_REGION_IRQ DMA1_Channel1_IRQn /*!< Interrupt vector of the region DMA channel */
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Crc_Cfg.h */
+#elif CRC_REGION_DMA_CHANNEL <= 3u
+#define CRC_ARCH_REGION_IRQ DMA1_Channel2_3_IRQn /*!< Interrupt vector of the region DMA channel */
+#else
+#define CRC_ARCH_REGION_IRQ DMA1_Ch4_7_DMA2_Ch1_5_DMAMUX1_OVR_IRQn /*!< Interrupt vector of the region DMA channel */
+#endif
+
+/**
+ * @brief **CRC unit configuration for a given polynomial**
+ */
+typedef struct _Crc_Arch_ConfigType
+{
+    uint32 Polynomial; /*!< Polynomial in normal representation (not reflected) */
+    uint8 PolySize;    /*!< Polynomial size, one of the CRC_ARCH_POLYSIZE_x values */
+    uint8 Width;       /*!< Width of the crc in bits (8, 16 or 32) */
+    boolean Reflected; /*!< TRUE when input bytes and the output are bit reversed */
+} Crc_Arch_ConfigType;
+
+/**
+ * @brief **Interrupt handler installed on the vector of the region DMA channel**
+ */
+typedef void ( *Crc_Arch_IsrType )( void );
+
+Std_ReturnType Crc_Arch_Calculate( const Crc_Arch_ConfigType *Config, const uint8 *Crc_DataPtr, uint32 Crc_Length, uint32 *Crc_Value );
+Std_ReturnType Crc_Arch_StartRegion( const Crc_Arch_ConfigType *Config, const uint8 *Crc_DataPtr, uint32 Crc_Length, uint32 Crc_Value );
+uint8 Crc_Arch_RegionIsr( uint32 *Crc_Value );
+void Crc_Arch_InstallRegionIsr( Crc_Arch_IsrType Handler );
+
+#endif
@@ -0,0 +1,1113 @@
+/**
+ * @file    E2E.c
+ * @brief   **E2E library**
+ *
+ * End to end protection of safety related data according to the AUTOSAR E2E Library, profiles
+ * 1, 2, 4, 5 and 11. The protect routines write the header (counter, Data ID, length) in place
+ * and then calculate the CRC in a single pass over the data, feeding to the Crc library the data
+ * before and after the CRC field as consecutive chunks, so the data is never copied. The check
+ * routines calculate the CRC the same way over the received data and evaluate the counter.
+ */
+#include "Std_Types.h"
+#include "Crc.h"
+#include "E2E.h"
+
+/**
+ * @defgroup E2E_Values values used by the different profiles
+ *
+ * @{ */
+#define E2E_BITS_PER_BYTE        8u     /*!< Number of bits on a byte */
+#define E2E_NIBBLE_BITS          4u     /*!< Number of bits on a nibble */
+#define E2E_NIBBLE_MASK          0x0Fu  /*!< Mask of a nibble */
+#define E2E_BYTE_MASK            0xFFu  /*!< Mask of a byte */
+#define E2E_CRC8_XORVALUE        0xFFu  /*!< Final xor applied by Crc_CalculateCRC8 and Crc_CalculateCRC8H2F */
+#define E2E_CRC8_START           0x00u  /*!< Crc register start value of profiles 1 and 11 */
+#define E2E_CRC8H2F_START        0xFFu  /*!< Crc start value of profile 2 */
+#define E2E_CRC16_START          0xFFFFu     /*!< Crc start value of profile 5 */
+#define E2E_CRC32_START          0xFFFFFFFFu /*!< Crc start value of profile 4 */
+/**
+ * @} */
+
+/**
+ * @defgroup E2E_P01_Values values used by profiles 1 and 11
+ *
+ * @{ */
+#define E2E_P01_MAX_COUNTER      14u  /*!< Maximum value of the counter */
+#define E2E_P01_COUNTER_RANGE    15u  /*!< Number of counter values */
+#define E2E_P01_MAX_DATA_LENGTH  240u /*!< Maximum length of the data in bits */
+#define E2E_P01_MAX_DELTA        14u  /*!< Saturation value of the state counters */
+/**
+ * @} */
+
+/**
+ * @defgroup E2E_P02_Values values used by profile 2
+ *
+ * @{ */
+#define E2E_P02_COUNTER_RANGE    16u   /*!< Number of counter values */
+#define E2E_P02_MAX_DATA_LENGTH  2048u /*!< Maximum length of the data in bits */
+#define E2E_P02_MIN_DATA_LENGTH  16u   /*!< Minimum length of the data in bits, CRC and counter */
+#define E2E_P02_CRC_POS          0u    /*!< Position of the CRC byte */
+#define E2E_P02_COUNTER_POS      1u    /*!< Position of the counter byte */
+/**
+ * @} */
+
+/**
+ * @defgroup E2E_P04_Values values used by profile 4
+ *
+ * @{ */
+#define E2E_P04_LENGTH_POS       0u     /*!< Position of the length inside the header */
+#define E2E_P04_COUNTER_POS      2u     /*!< Position of the counter inside the header */
+#define E2E_P04_DATAID_POS       4u     /*!< Position of the Data ID inside the header */
+#define E2E_P04_CRC_POS          8u     /*!< Position of the CRC inside the header */
+#define E2E_P04_HEADER_LENGTH    12u    /*!< Length of the header in bytes */
+#define E2E_P04_COUNTER_RANGE    65536u /*!< Number of counter values */
+/**
+ * @} */
+
+/**
+ * @defgroup E2E_P05_Values values used by profile 5
+ *
+ * @{ */
+#define E2E_P05_CRC_POS          0u   /*!< Position of the CRC inside the header */
+#define E2E_P05_COUNTER_POS      2u   /*!< Position of the counter inside the header */
+#define E2E_P05_HEADER_LENGTH    3u   /*!< Length of the header in bytes */
+#define E2E_P05_COUNTER_RANGE    256u /*!< Number of counter values */
+/**
+ * @} */
+
+static uint8 E2E_UpdateCrc8( const uint8 *Data, uint32 Length, uint8 Register );
+static uint8 E2E_P01ComputeCrc( const uint8 *Data, uint16 CRCOffset, uint16 DataLength, uint16 DataID, uint8 DataIDMode, uint8 Counter );
+static uint8 E2E_ReadNibble( const uint8 *Data, uint16 BitOffset );
+static void E2E_WriteNibble( uint8 *Data, uint16 BitOffset, uint8 Value );
+static uint32 E2E_CounterDelta( uint32 Received, uint32 Last, uint32 Range );
+static uint8 E2E_CheckCounter( uint32 Delta, uint32 MaxDeltaCounter );
+static void E2E_CheckSequence( E2E_P01CheckStateType *StatePtr, uint8 ReceivedCounter, uint8 CounterRange, uint8 MaxDeltaCounterInit, uint8 MaxNoNewOrRepeatedData, uint8 SyncCounterInit );
+static uint32 E2E_P04ComputeCrc( const uint8 *Data, uint16 Offset, uint16 Length );
+static uint16 E2E_P05ComputeCrc( const uint8 *Data, uint16 Offset, uint16 Length, uint16 DataID );
+static uint32 E2E_ReadBigEndian( const uint8 *Data, uint8 Size );
+static void E2E_WriteBigEndian( uint8 *Data, uint8 Size, uint32 Value );
+
+/**
+ * @brief   **Profile 1 protection**
+ *
+ * Writes the counter (and the Data ID nibble on E2E_P01_DATAID_NIBBLE mode) into the data,
+ * calculates the CRC over the Data ID and the data excluding the CRC byte, writes it and
+ * increments the counter from 0 to 14.
+ *
+ * @param   ConfigPtr Profile configuration
+ * @param   StatePtr Protect state, holds the counter for the next call
+ * @param   DataPtr Data to protect, DataLength bits long
+ *
+ * @retval  E2E_E_OK, E2E_E_INPUTERR_NULL on null pointers or E2E_E_INPUTERR_WRONG on a wrong
+ *          configuration or counter
+ */
+Std_ReturnType E2E_P01Protect( const E2E_P01ConfigType *ConfigPtr, E2E_P01ProtectStateType *StatePtr, uint8 *DataPtr )
+{
+    Std_ReturnType Status = E2E_E_OK;
+
+    if( ( ConfigPtr == NULL_PTR ) || ( StatePtr == NULL_PTR ) || ( DataPtr == NULL_PTR ) )
+    {
+        Status = E2E_E_INPUTERR_NULL;
+    }
+    else if( ( ConfigPtr->DataLength > E2E_P01_MAX_DATA_LENGTH ) || ( ( ConfigPtr->CRCOffset % E2E_BITS_PER_BYTE ) != 0u ) ||
+             ( StatePtr->Counter > E2E_P01_MAX_COUNTER ) )
+    {
+        Status = E2E_E_INPUTERR_WRONG;
+    }
+    else
+    {
+        if( ConfigPtr->DataIDMode == E2E_P01_DATAID_NIBBLE )
+        {
+            E2E_WriteNibble( DataPtr, ConfigPtr->DataIDNibbleOffset, (uint8)( ConfigPtr->DataID >> E2E_BITS_PER_BYTE ) );
+        }
+        E2E_WriteNibble( DataPtr, ConfigPtr->CounterOffset, StatePtr->Counter );
+
+        DataPtr[ ConfigPtr->CRCOffset / E2E_BITS_PER_BYTE ] = E2E_P01ComputeCrc( DataPtr, ConfigPtr->CRCOffset, ConfigPtr->DataLength, ConfigPtr->DataID, ConfigPtr->DataIDMode, StatePtr->Counter );
+
+        StatePtr->Counter = ( StatePtr->Counter + 1u ) % E2E_P01_COUNTER_RANGE;
+    }
+
+    return Status;
+}
+
+/**
+ * @brief   **Profile 1 protect state initialization**
+ *
+ * @param   StatePtr Protect state to initialize
+ *
+ * @retval  E2E_E_OK or E2E_E_INPUTERR_NULL
+ */
+Std_ReturnType E2E_P01ProtectInit( E2E_P01ProtectStateType *StatePtr )
+{
+    Std_ReturnType Status = E2E_E_INPUTERR_NULL;
+
+    if( StatePtr != NULL_PTR )
+    {
+        StatePtr->Counter = 0u;
+        Status            = E2E_E_OK;
+    }
+
+    return Status;
+}
+
+/**
+ * @brief   **Profile 1 check**
+ *
+ * When StatePtr->NewDataAvailable is TRUE the CRC (and the Data ID nibble) of the data is
+ * verified and the counter compared with the last valid one, the result is left in
+ * StatePtr->Status.
+ *
+ * @param   ConfigPtr Profile configuration
+ * @param   StatePtr Check state
+ * @param   DataPtr Received data, DataLength bits long
+ *
+ * @retval  E2E_E_OK, E2E_E_INPUTERR_NULL on null pointers or E2E_E_INPUTERR_WRONG on a wrong
+ *          configuration
+ */
+Std_ReturnType E2E_P01Check( const E2E_P01ConfigType *ConfigPtr, E2E_P01CheckStateType *StatePtr, const uint8 *DataPtr )
+{
+    Std_ReturnType Status = E2E_E_OK;
+
+    if( ( ConfigPtr == NULL_PTR ) || ( StatePtr == NULL_PTR ) || ( DataPtr == NULL_PTR ) )
+    {
+        Status = E2E_E_INPUTERR_NULL;
+    }
+    else if( ( ConfigPtr->DataLength > E2E_P01_MAX_DATA_LENGTH ) || ( ( ConfigPtr->CRCOffset % E2E_BITS_PER_BYTE ) != 0u ) )
+    {
+        Status = E2E_E_INPUTERR_WRONG;
+    }
+    else
+    {
+        if( StatePtr->MaxDeltaCounter < E2E_P01_MAX_DELTA )
+        {
+            StatePtr->MaxDeltaCounter++;
+        }
+
+        if( StatePtr->NewDataAvailable == FALSE )
+        {
+            if( StatePtr->NoNewOrRepeatedDataCounter < E2E_P01_MAX_DELTA )
+            {
+                StatePtr->NoNewOrRepeatedDataCounter++;
+            }
+            StatePtr->Status = E2E_P01STATUS_NONEWDATA;
+        }
+        else
+        {
+            uint8 ReceivedCounter = E2E_ReadNibble( DataPtr, ConfigPtr->CounterOffset );
+            uint8 ReceivedCrc     = DataPtr[ ConfigPtr->CRCOffset / E2E_BITS_PER_BYTE ];
+            uint8 ComputedCrc     = E2E_P01ComputeCrc( DataPtr, ConfigPtr->CRCOffset, ConfigPtr->DataLength, ConfigPtr->DataID, ConfigPtr->DataIDMode, ReceivedCounter );
+            boolean NibbleOk      = TRUE;
+
+            if( ConfigPtr->DataIDMode == E2E_P01_DATAID_NIBBLE )
+            {
+                NibbleOk = ( E2E_ReadNibble( DataPtr, ConfigPtr->DataIDNibbleOffset ) == ( ( ConfigPtr->DataID >> E2E_BITS_PER_BYTE ) & E2E_NIBBLE_MASK ) ) ? TRUE : FALSE;
+            }
+
+            if( ( ReceivedCrc != ComputedCrc ) || ( NibbleOk == FALSE ) )
+            {
+                StatePtr->Status = E2E_P01STATUS_WRONGCRC;
+            }
+            else
+            {
+                E2E_CheckSequence( StatePtr, ReceivedCounter, E2E_P01_COUNTER_RANGE, ConfigPtr->MaxDeltaCounterInit, ConfigPtr->MaxNoNewOrRepeatedData, ConfigPtr->SyncCounterInit );
+            }
+        }
+    }
+
+    return Status;
+}
+
+/**
+ * @brief   **Profile 1 check state initialization**
+ *
+ * @param   StatePtr Check state to initialize
+ *
+ * @retval  E2E_E_OK or E2E_E_INPUTERR_NULL
+ */
+Std_ReturnType E2E_P01CheckInit( E2E_P01CheckStateType *StatePtr )
+{
+    Std_ReturnType Status = E2E_E_INPUTERR_NULL;
+
+    if( StatePtr != NULL_PTR )
+    {
+        StatePtr->LastValidCounter           = 0u;
+        StatePtr->MaxDeltaCounter            = 0u;
+        StatePtr->WaitForFirstData           = TRUE;
+        StatePtr->NewDataAvailable           = FALSE;
+        StatePtr->LostData                   = 0u;
+        StatePtr->Status                     = E2E_P01STATUS_NONEWDATA;
+        StatePtr->SyncCounter                = 0u;
+        StatePtr->NoNewOrRepeatedDataCounter = 0u;
+        Status                               = E2E_E_OK;
+    }
+
+    return Status;
+}
+
+/**
+ * @brief   **Profile 2 protection**
+ *
+ * Writes the counter in the low nibble of the second byte, calculates the CRC over the data
+ * after the CRC byte followed by the Data ID of the counter, writes it in the first byte and
+ * increments the counter from 0 to 15.
+ *
+ * @param   ConfigPtr Profile configuration
+ * @param   StatePtr Protect state, holds the counter for the next call
+ * @param   DataPtr Data to protect, DataLength bits long
+ *
+ * @retval  E2E_E_OK, E2E_E_INPUTERR_NULL on null pointers or E2E_E_INPUTERR_WRONG on a wrong
+ *          configuration or counter
+ */
+Std_ReturnType E2E_P02Protect( const E2E_P02ConfigType *ConfigPtr, E2E_P02ProtectStateType *StatePtr, uint8 *DataPtr )
+{
+    Std_ReturnType Status = E2E_E_OK;
+
+    if( ( ConfigPtr == NULL_PTR ) || ( StatePtr == NULL_PTR ) || ( DataPtr == NULL_PTR ) )
+    {
+        Status = E2E_E_INPUTERR_NULL;
+    }
+    else if( ( ConfigPtr->DataLength < E2E_P02_MIN_DATA_LENGTH ) || ( ConfigPtr->DataLength > E2E_P02_MAX_DATA_LENGTH ) ||
+             ( StatePtr->Counter >= E2E_P02_COUNTER_RANGE ) )
+    {
+        Status = E2E_E_INPUTERR_WRONG;
+    }
+    else
+    {
+        uint16 Length = ConfigPtr->DataLength / E2E_BITS_PER_BYTE;
+
+        DataPtr[ E2E_P02_COUNTER_POS ] = ( DataPtr[ E2E_P02_COUNTER_POS ] & (uint8)~E2E_NIBBLE_MASK ) | StatePtr->Counter;
+
+        uint8 Crc = Crc_CalculateCRC8H2F( &DataPtr[ E2E_P02_COUNTER_POS ], Length - 1u, E2E_CRC8H2F_START, TRUE );
+        Crc       = Crc_CalculateCRC8H2F( &ConfigPtr->DataIDList[ StatePtr->Counter ], 1u, Crc ^ E2E_CRC8_XORVALUE, FALSE );
+
+        DataPtr[ E2E_P02_CRC_POS ] = Crc;
+        StatePtr->Counter          = ( StatePtr->Counter + 1u ) % E2E_P02_COUNTER_RANGE;
+    }
+
+    return Status;
+}
+
+/**
+ * @brief   **Profile 2 protect state initialization**
+ *
+ * @param   StatePtr Protect state to initialize
+ *
+ * @retval  E2E_E_OK or E2E_E_INPUTERR_NULL
+ */
+Std_ReturnType E2E_P02ProtectInit( E2E_P02ProtectStateType *StatePtr )
+{
+    Std_ReturnType Status = E2E_E_INPUTERR_NULL;
+
+    if( StatePtr != NULL_PTR )
+    {
+        StatePtr->Counter = 0u;
+        Status            = E2E_E_OK;
+    }
+
+    return Status;
+}
+
+/**
+ * @brief   **Profile 2 check**
+ *
+ * Same as E2E_P01Check, the Data ID used in the CRC is selected by the received counter.
+ *
+ * @param   ConfigPtr Profile configuration
+ * @param   StatePtr Check state
+ * @param   DataPtr Received data, DataLength bits long
+ *
+ * @retval  E2E_E_OK, E2E_E_INPUTERR_NULL on null pointers or E2E_E_INPUTERR_WRONG on a wrong
+ *          configuration
+ */
+Std_ReturnType E2E_P02Check( const E2E_P02ConfigType *ConfigPtr, E2E_P02CheckStateType *StatePtr, const uint8 *DataPtr )
+{
+    Std_ReturnType Status = E2E_E_OK;
+
+    if( ( ConfigPtr == NULL_PTR ) || ( StatePtr == NULL_PTR ) || ( DataPtr == NULL_PTR ) )
+    {
+        Status = E2E_E_INPUTERR_NULL;
+    }
+    else if( ( ConfigPtr->DataLength < E2E_P02_MIN_DATA_LENGTH ) || ( ConfigPtr->DataLength > E2E_P02_MAX_DATA_LENGTH ) )
+    {
+        Status = E2E_E_INPUTERR_WRONG;
+    }
+    else
+    {
+        if( StatePtr->MaxDeltaCounter < E2E_P01_MAX_DELTA )
+        {
+            StatePtr->MaxDeltaCounter++;
+        }
+
+        if( StatePtr->NewDataAvailable == FALSE )
+        {
+            if( StatePtr->NoNewOrRepeatedDataCounter < E2E_P01_MAX_DELTA )
+            {
+                StatePtr->NoNewOrRepeatedDataCounter++;
+            }
+            StatePtr->Status = E2E_P02STATUS_NONEWDATA;
+        }
+        else
+        {
+            uint16 Length         = ConfigPtr->DataLength / E2E_BITS_PER_BYTE;
+            uint8 ReceivedCounter = DataPtr[ E2E_P02_COUNTER_POS ] & E2E_NIBBLE_MASK;
+
+            uint8 Crc = Crc_CalculateCRC8H2F( &DataPtr[ E2E_P02_COUNTER_POS ], Length - 1u, E2E_CRC8H2F_START, TRUE );
+            Crc       = Crc_CalculateCRC8H2F( &ConfigPtr->DataIDList[ ReceivedCounter ], 1u, Crc ^ E2E_CRC8_XORVALUE, FALSE );
+
+            if( DataPtr[ E2E_P02_CRC_POS ] != Crc )
+            {
+                StatePtr->Status = E2E_P02STATUS_WRONGCRC;
+            }
+            else
+            {
+                E2E_CheckSequence( StatePtr, ReceivedCounter, E2E_P02_COUNTER_RANGE, ConfigPtr->MaxDeltaCounterInit, ConfigPtr->MaxNoNewOrRepeatedData, ConfigPtr->SyncCounterInit );
+            }
+        }
+    }
+
+    return Status;
+}
+
+/**
+ * @brief   **Profile 2 check state initialization**
+ *
+ * @param   StatePtr Check state to initialize
+ *
+ * @retval  E2E_E_OK or E2E_E_INPUTERR_NULL
+ */
+Std_ReturnType E2E_P02CheckInit( E2E_P02CheckStateType *StatePtr )
+{
+    return E2E_P01CheckInit( StatePtr );
+}
+
+/**
+ * @brief   **Profile 4 protection**
+ *
+ * Writes the length, counter and Data ID of the header in big endian, calculates the CRC32P4
+ * over the data before the CRC field and continues after it, writes it and increments the
+ * counter.
+ *
+ * @param   ConfigPtr Profile configuration
+ * @param   StatePtr Protect state, holds the counter for the next call
+ * @param   DataPtr Data to protect
+ * @param   Length Length of the data in bytes, between MinDataLength and MaxDataLength
+ *
+ * @retval  E2E_E_OK, E2E_E_INPUTERR_NULL on null pointers or E2E_E_INPUTERR_WRONG on a wrong
+ *          length
+ */
+Std_ReturnType E2E_P04Protect( const E2E_P04ConfigType *ConfigPtr, E2E_P04ProtectStateType *StatePtr, uint8 *DataPtr, uint16 Length )
+{
+    Std_ReturnType Status = E2E_E_OK;
+
+    if( ( ConfigPtr == NULL_PTR ) || ( StatePtr == NULL_PTR ) || ( DataPtr == NULL_PTR ) )
+    {
+        Status = E2E_E_INPUTERR_NULL;
+    }
+    else if( ( Length < ( ConfigPtr->MinDataLength / E2E_BITS_PER_BYTE ) ) || ( Length > ( ConfigPtr->MaxDataLength / E2E_BITS_PER_BYTE ) ) ||
+             ( Length < ( ( ConfigPtr->Offset / E2E_BITS_PER_BYTE ) + E2E_P04_HEADER_LENGTH ) ) )
+    {
+        Status = E2E_E_INPUTERR_WRONG;
+    }
+    else
+    {
+        uint8 *Header = &DataPtr[ ConfigPtr->Offset / E2E_BITS_PER_BYTE ];
+
+        E2E_WriteBigEndian( &Header[ E2E_P04_LENGTH_POS ], sizeof( uint16 ), Length );
+        E2E_WriteBigEndian( &Header[ E2E_P04_COUNTER_POS ], sizeof( uint16 ), StatePtr->Counter );
+        E2E_WriteBigEndian( &Header[ E2E_P04_DATAID_POS ], sizeof( uint32 ), ConfigPtr->DataID );
+        E2E_WriteBigEndian( &Header[ E2E_P04_CRC_POS ], sizeof( uint32 ), E2E_P04ComputeCrc( DataPtr, ConfigPtr->Offset, Length ) );
+
+        StatePtr->Counter++;
+    }
+
+    return Status;
+}
+
+/**
+ * @brief   **Profile 4 protect state initialization**
+ *
+ * @param   StatePtr Protect state to initialize
+ *
+ * @retval  E2E_E_OK or E2E_E_INPUTERR_NULL
+ */
+Std_ReturnType E2E_P04ProtectInit( E2E_P04ProtectStateType *StatePtr )
+{
+    Std_ReturnType Status = E2E_E_INPUTERR_NULL;
+
+    if( StatePtr != NULL_PTR )
+    {
+        StatePtr->Counter = 0u;
+        Status            = E2E_E_OK;
+    }
+
+    return Status;
+}
+
+/**
+ * @brief   **Profile 4 check**
+ *
+ * A null DataPtr with a zero Length means no new data has been received. Otherwise the length,
+ * Data ID and CRC of the header are verified and the counter compared with the last valid one,
+ * the result is left in StatePtr->Status.
+ *
+ * @param   ConfigPtr Profile configuration
+ * @param   StatePtr Check state
+ * @param   DataPtr Received data, NULL_PTR if no new data
+ * @param   Length Length of the received data in bytes, 0 if no new data
+ *
+ * @retval  E2E_E_OK, E2E_E_INPUTERR_NULL on null pointers or E2E_E_INPUTERR_WRONG when only one
+ *          of DataPtr or Length is null
+ */
+Std_ReturnType E2E_P04Check( const E2E_P04ConfigType *ConfigPtr, E2E_P04CheckStateType *StatePtr, const uint8 *DataPtr, uint16 Length )
+{
+    Std_ReturnType Status = E2E_E_OK;
+
+    if( ( ConfigPtr == NULL_PTR ) || ( StatePtr == NULL_PTR ) )
+    {
+        Status = E2E_E_INPUTERR_NULL;
+    }
+    else if( ( DataPtr == NULL_PTR ) != ( Length == 0u ) )
+    {
+        Status = E2E_E_INPUTERR_WRONG;
+    }
+    else if( DataPtr == NULL_PTR )
+    {
+        StatePtr->Status = E2E_P04STATUS_NONEWDATA;
+    }
+    else if( ( Length < ( ConfigPtr->MinDataLength / E2E_BITS_PER_BYTE ) ) || ( Length > ( ConfigPtr->MaxDataLength / E2E_BITS_PER_BYTE ) ) ||
+             ( Length < ( ( ConfigPtr->Offset / E2E_BITS_PER_BYTE ) + E2E_P04_HEADER_LENGTH ) ) )
+    {
+        StatePtr->Status = E2E_P04STATUS_ERROR;
+    }
+    else
+    {
+        const uint8 *Header = &DataPtr[ ConfigPtr->Offset / E2E_BITS_PER_BYTE ];
+        uint16 ReceivedCounter = (uint16)E2E_ReadBigEndian( &Header[ E2E_P04_COUNTER_POS ], sizeof( uint16 ) );
+
+        if( ( E2E_ReadBigEndian( &Header[ E2E_P04_LENGTH_POS ], sizeof( uint16 ) ) != Length ) ||
+            ( E2E_ReadBigEndian( &Header[ E2E_P04_DATAID_POS ], sizeof( uint32 ) ) != ConfigPtr->DataID ) ||
+            ( E2E_ReadBigEndian( &Header[ E2E_P04_CRC_POS ], sizeof( uint32 ) ) != E2E_P04ComputeCrc( DataPtr, ConfigPtr->Offset, Length ) ) )
+        {
+            StatePtr->Status = E2E_P04STATUS_ERROR;
+        }
+        else
+        {
+            StatePtr->Status  = E2E_CheckCounter( E2E_CounterDelta( ReceivedCounter, StatePtr->Counter, E2E_P04_COUNTER_RANGE ), ConfigPtr->MaxDeltaCounter );
+            StatePtr->Counter = ReceivedCounter;
+        }
+    }
+
+    return Status;
+}
+
+/**
+ * @brief   **Profile 4 check state initialization**
+ *
+ * The counter is set to the maximum value so the first data with counter 0 is accepted as OK.
+ *
+ * @param   StatePtr Check state to initialize
+ *
+ * @retval  E2E_E_OK or E2E_E_INPUTERR_NULL
+ */
+Std_ReturnType E2E_P04CheckInit( E2E_P04CheckStateType *StatePtr )
+{
+    Std_ReturnType Status = E2E_E_INPUTERR_NULL;
+
+    if( StatePtr != NULL_PTR )
+    {
+        StatePtr->Counter = (uint16)( E2E_P04_COUNTER_RANGE - 1u );
+        StatePtr->Status  = E2E_P04STATUS_ERROR;
+        Status            = E2E_E_OK;
+    }
+
+    return Status;
+}
+
+/**
+ * @brief   **Profile 5 protection**
+ *
+ * Writes the counter of the header, calculates the CRC16 over the data before and after the CRC
+ * field followed by the Data ID in little endian, writes it in little endian and increments the
+ * counter.
+ *
+ * @param   ConfigPtr Profile configuration
+ * @param   StatePtr Protect state, holds the counter for the next call
+ * @param   DataPtr Data to protect
+ * @param   Length Length of the data in bytes, equal to DataLength
+ *
+ * @retval  E2E_E_OK, E2E_E_INPUTERR_NULL on null pointers or E2E_E_INPUTERR_WRONG on a wrong
+ *          length
+ */
+Std_ReturnType E2E_P05Protect( const E2E_P05ConfigType *ConfigPtr, E2E_P05ProtectStateType *StatePtr, uint8 *DataPtr, uint16 Length )
+{
+    Std_ReturnType Status = E2E_E_OK;
+
+    if( ( ConfigPtr == NULL_PTR ) || ( StatePtr == NULL_PTR ) || ( DataPtr == NULL_PTR ) )
+    {
+        Status = E2E_E_INPUTERR_NULL;
+    }
+    else if( ( Length != ( ConfigPtr->DataLength / E2E_BITS_PER_BYTE ) ) || ( Length < ( ( ConfigPtr->Offset / E2E_BITS_PER_BYTE ) + E2E_P05_HEADER_LENGTH ) ) )
+    {
+        Status = E2E_E_INPUTERR_WRONG;
+    }
+    else
+    {
+        uint8 *Header = &DataPtr[ ConfigPtr->Offset / E2E_BITS_PER_BYTE ];
+
+        Header[ E2E_P05_COUNTER_POS ] = StatePtr->Counter;
+
+        uint16 Crc                     = E2E_P05ComputeCrc( DataPtr, ConfigPtr->Offset, Length, ConfigPtr->DataID );
+        Header[ E2E_P05_CRC_POS ]      = (uint8)Crc;
+        Header[ E2E_P05_CRC_POS + 1u ] = (uint8)( Crc >> E2E_BITS_PER_BYTE );
+
+        StatePtr->Counter++;
+    }
+
+    return Status;
+}
+
+/**
+ * @brief   **Profile 5 protect state initialization**
+ *
+ * @param   StatePtr Protect state to initialize
+ *
+ * @retval  E2E_E_OK or E2E_E_INPUTERR_NULL
+ */
+Std_ReturnType E2E_P05ProtectInit( E2E_P05ProtectStateType *StatePtr )
+{
+    Std_ReturnType Status = E2E_E_INPUTERR_NULL;
+
+    if( StatePtr != NULL_PTR )
+    {
+        StatePtr->Counter = 0u;
+        Status            = E2E_E_OK;
+    }
+
+    return Status;
+}
+
+/**
+ * @brief   **Profile 5 check**
+ *
+ * A null DataPtr with a zero Length means no new data has been received. Otherwise the CRC of
+ * the header is verified and the counter compared with the last valid one, the result is left
+ * in StatePtr->Status.
+ *
+ * @param   ConfigPtr Profile configuration
+ * @param   StatePtr Check state
+ * @param   DataPtr Received data, NULL_PTR if no new data
+ * @param   Length Length of the received data in bytes, 0 if no new data
+ *
+ * @retval  E2E_E_OK, E2E_E_INPUTERR_NULL on null pointers or E2E_E_INPUTERR_WRONG when only one
+ *          of DataPtr or Length is null
+ */
+Std_ReturnType E2E_P05Check( const E2E_P05ConfigType *ConfigPtr, E2E_P05CheckStateType *StatePtr, const uint8 *DataPtr, uint16 Length )
+{
+    Std_ReturnType Status = E2E_E_OK;
+
+    if( ( ConfigPtr == NULL_PTR ) || ( StatePtr == NULL_PTR ) )
+    {
+        Status = E2E_E_INPUTERR_NULL;
+    }
+    else if( ( DataPtr == NULL_PTR ) != ( Length == 0u ) )
+    {
+        Status = E2E_E_INPUTERR_WRONG;
+    }
+    else if( DataPtr == NULL_PTR )
+    {
+        StatePtr->Status = E2E_P05STATUS_NONEWDATA;
+    }
+    else if( ( Length != ( ConfigPtr->DataLength / E2E_BITS_PER_BYTE ) ) || ( Length < ( ( ConfigPtr->Offset / E2E_BITS_PER_BYTE ) + E2E_P05_HEADER_LENGTH ) ) )
+    {
+        StatePtr->Status = E2E_P05STATUS_ERROR;
+    }
+    else
+    {
+        const uint8 *Header   = &DataPtr[ ConfigPtr->Offset / E2E_BITS_PER_BYTE ];
+        uint8 ReceivedCounter = Header[ E2E_P05_COUNTER_POS ];
+        uint16 ReceivedCrc    = (uint16)Header[ E2E_P05_CRC_POS ] | (uint16)( (uint16)Header[ E2E_P05_CRC_POS + 1u ] << E2E_BITS_PER_BYTE );
+
+        if( ReceivedCrc != E2E_P05ComputeCrc( DataPtr, ConfigPtr->Offset, Length, ConfigPtr->DataID ) )
+        {
+            StatePtr->Status = E2E_P05STATUS_ERROR;
+        }
+        else
+        {
+            StatePtr->Status  = E2E_CheckCounter( E2E_CounterDelta( ReceivedCounter, StatePtr->Counter, E2E_P05_COUNTER_RANGE ), ConfigPtr->MaxDeltaCounter );
+            StatePtr->Counter = ReceivedCounter;
+        }
+    }
+
+    return Status;
+}
+
+/**
+ * @brief   **Profile 5 check state initialization**
+ *
+ * The counter is set to the maximum value so the first data with counter 0 is accepted as OK.
+ *
+ * @param   StatePtr Check state to initialize
+ *
+ * @retval  E2E_E_OK or E2E_E_INPUTERR_NULL
+ */
+Std_ReturnType E2E_P05CheckInit( E2E_P05CheckStateType *StatePtr )
+{
+    Std_ReturnType Status = E2E_E_INPUTERR_NULL;
+
+    if( StatePtr != NULL_PTR )
+    {
+        StatePtr->Counter = (uint8)( E2E_P05_COUNTER_RANGE - 1u );
+        StatePtr->Status  = E2E_P05STATUS_ERROR;
+        Status            = E2E_E_OK;
+    }
+
+    return Status;
+}
+
+/**
+ * @brief   **Profile 11 protection**
+ *
+ * Same layout and CRC as profile 1 with the Data ID modes BOTH and NIBBLE, the counter goes from
+ * 0 to 14.
+ *
+ * @param   ConfigPtr Profile configuration
+ * @param   StatePtr Protect state, holds the counter for the next call
+ * @param   DataPtr Data to protect
+ * @param   Length Length of the data in bytes, equal to DataLength
+ *
+ * @retval  E2E_E_OK, E2E_E_INPUTERR_NULL on null pointers or E2E_E_INPUTERR_WRONG on a wrong
+ *          length, configuration or counter
+ */
+Std_ReturnType E2E_P11Protect( const E2E_P11ConfigType *ConfigPtr, E2E_P11ProtectStateType *StatePtr, uint8 *DataPtr, uint16 Length )
+{
+    Std_ReturnType Status = E2E_E_OK;
+
+    if( ( ConfigPtr == NULL_PTR ) || ( StatePtr == NULL_PTR ) || ( DataPtr == NULL_PTR ) )
+    {
+        Status = E2E_E_INPUTERR_NULL;
+    }
+    else if( ( Length != ( ConfigPtr->DataLength / E2E_BITS_PER_BYTE ) ) || ( ConfigPtr->DataLength > E2E_P01_MAX_DATA_LENGTH ) ||
+             ( ( ConfigPtr->CRCOffset % E2E_BITS_PER_BYTE ) != 0u ) || ( StatePtr->Counter > E2E_P01_MAX_COUNTER ) )
+    {
+        Status = E2E_E_INPUTERR_WRONG;
+    }
+    else
+    {
+        if( ConfigPtr->DataIDMode == E2E_P11_DATAID_NIBBLE )
+        {
+            E2E_WriteNibble( DataPtr, ConfigPtr->DataIDNibbleOffset, (uint8)( ConfigPtr->DataID >> E2E_BITS_PER_BYTE ) );
+        }
+        E2E_WriteNibble( DataPtr, ConfigPtr->CounterOffset, StatePtr->Counter );
+
+        DataPtr[ ConfigPtr->CRCOffset / E2E_BITS_PER_BYTE ] = E2E_P01ComputeCrc( DataPtr, ConfigPtr->CRCOffset, ConfigPtr->DataLength, ConfigPtr->DataID, ConfigPtr->DataIDMode, StatePtr->Counter );
+
+        StatePtr->Counter = ( StatePtr->Counter + 1u ) % E2E_P01_COUNTER_RANGE;
+    }
+
+    return Status;
+}
+
+/**
+ * @brief   **Profile 11 protect state initialization**
+ *
+ * @param   StatePtr Protect state to initialize
+ *
+ * @retval  E2E_E_OK or E2E_E_INPUTERR_NULL
+ */
+Std_ReturnType E2E_P11ProtectInit( E2E_P11ProtectStateType *StatePtr )
+{
+    Std_ReturnType Status = E2E_E_INPUTERR_NULL;
+
+    if( StatePtr != NULL_PTR )
+    {
+        StatePtr->Counter = 0u;
+        Status            = E2E_E_OK;
+    }
+
+    return Status;
+}
+
+/**
+ * @brief   **Profile 11 check**
+ *
+ * A null DataPtr with a zero Length means no new data has been received. Otherwise the CRC (and
+ * the Data ID nibble) is verified and the counter compared with the last valid one, the result
+ * is left in StatePtr->Status.
+ *
+ * @param   ConfigPtr Profile configuration
+ * @param   StatePtr Check state
+ * @param   DataPtr Received data, NULL_PTR if no new data
+ * @param   Length Length of the received data in bytes, 0 if no new data
+ *
+ * @retval  E2E_E_OK, E2E_E_INPUTERR_NULL on null pointers or E2E_E_INPUTERR_WRONG when only one
+ *          of DataPtr or Length is null or on a wrong configuration
+ */
+Std_ReturnType E2E_P11Check( const E2E_P11ConfigType *ConfigPtr, E2E_P11CheckStateType *StatePtr, const uint8 *DataPtr, uint16 Length )
+{
+    Std_ReturnType Status = E2E_E_OK;
+
+    if( ( ConfigPtr == NULL_PTR ) || ( StatePtr == NULL_PTR ) )
+    {
+        Status = E2E_E_INPUTERR_NULL;
+    }
+    else if( ( ( DataPtr == NULL_PTR ) != ( Length == 0u ) ) || ( ConfigPtr->DataLength > E2E_P01_MAX_DATA_LENGTH ) ||
+             ( ( ConfigPtr->CRCOffset % E2E_BITS_PER_BYTE ) != 0u ) )
+    {
+        Status = E2E_E_INPUTERR_WRONG;
+    }
+    else if( DataPtr == NULL_PTR )
+    {
+        StatePtr->Status = E2E_P11STATUS_NONEWDATA;
+    }
+    else if( Length != ( ConfigPtr->DataLength / E2E_BITS_PER_BYTE ) )
+    {
+        StatePtr->Status = E2E_P11STATUS_ERROR;
+    }
+    else
+    {
+        uint8 ReceivedCounter = E2E_ReadNibble( DataPtr, ConfigPtr->CounterOffset );
+        uint8 ReceivedCrc     = DataPtr[ ConfigPtr->CRCOffset / E2E_BITS_PER_BYTE ];
+        uint8 ComputedCrc     = E2E_P01ComputeCrc( DataPtr, ConfigPtr->CRCOffset, ConfigPtr->DataLength, ConfigPtr->DataID, ConfigPtr->DataIDMode, ReceivedCounter );
+        boolean NibbleOk      = TRUE;
+
+        if( ConfigPtr->DataIDMode == E2E_P11_DATAID_NIBBLE )
+        {
+            NibbleOk = ( E2E_ReadNibble( DataPtr, ConfigPtr->DataIDNibbleOffset ) == ( ( ConfigPtr->DataID >> E2E_BITS_PER_BYTE ) & E2E_NIBBLE_MASK ) ) ? TRUE : FALSE;
+        }
+
+        if( ( ReceivedCrc != ComputedCrc ) || ( NibbleOk == FALSE ) )
+        {
+            StatePtr->Status = E2E_P11STATUS_ERROR;
+        }
+        else
+        {
+            StatePtr->Status  = E2E_CheckCounter( E2E_CounterDelta( ReceivedCounter, StatePtr->Counter, E2E_P01_COUNTER_RANGE ), ConfigPtr->MaxDeltaCounter );
+            StatePtr->Counter = ReceivedCounter;
+        }
+    }
+
+    return Status;
+}
+
+/**
+ * @brief   **Profile 11 check state initialization**
+ *
+ * The counter is set to the maximum value so the first data with counter 0 is accepted as OK.
+ *
+ * @param   StatePtr Check state to initialize
+ *
+ * @retval  E2E_E_OK or E2E_E_INPUTERR_NULL
+ */
+Std_ReturnType E2E_P11CheckInit( E2E_P11CheckStateType *StatePtr )
+{
+    Std_ReturnType Status = E2E_E_INPUTERR_NULL;
+
+    if( StatePtr != NULL_PTR )
+    {
+        StatePtr->Counter = E2E_P01_MAX_COUNTER;
+        StatePtr->Status  = E2E_P11STATUS_ERROR;
+        Status            = E2E_E_OK;
+    }
+
+    return Status;
+}
+
+/**
+ * @brief   **Continue a CRC8 SAE J1850 calculation**
+ *
+ * Crc_CalculateCRC8 takes the crc register as start value on consecutive calls but applies the
+ * final xor to its result, the xor is removed here so the register can be carried between chunks.
+ *
+ * @param   Data Pointer to the chunk
+ * @param   Length Length of the chunk in bytes
+ * @param   Register Crc register before the chunk
+ *
+ * @retval  Crc register after the chunk, without final xor
+ */
+static uint8 E2E_UpdateCrc8( const uint8 *Data, uint32 Length, uint8 Register )
+{
+    return Crc_CalculateCRC8( Data, Length, Register, FALSE ) ^ E2E_CRC8_XORVALUE;
+}
+
+/**
+ * @brief   **CRC of profiles 1 and 11**
+ *
+ * CRC8 SAE J1850 with start value 0x00 and no final xor over the Data ID, according to the Data
+ * ID mode, followed by the data before and after the CRC byte.
+ *
+ * @param   Data Pointer to the data
+ * @param   CRCOffset Bit offset of the CRC
+ * @param   DataLength Length of the data in bits
+ * @param   DataID Data ID of the data
+ * @param   DataIDMode Inclusion mode of the Data ID
+ * @param   Counter Counter of the data, selects the Data ID byte on E2E_P01_DATAID_ALT mode
+ *
+ * @retval  The CRC of the data
+ */
+static uint8 E2E_P01ComputeCrc( const uint8 *Data, uint16 CRCOffset, uint16 DataLength, uint16 DataID, uint8 DataIDMode, uint8 Counter )
+{
+    uint8 DataIDBytes[ 2u ] = { (uint8)( DataID & E2E_BYTE_MASK ), (uint8)( DataID >> E2E_BITS_PER_BYTE ) };
+    uint16 CrcByte          = CRCOffset / E2E_BITS_PER_BYTE;
+    uint16 Length           = DataLength / E2E_BITS_PER_BYTE;
+    uint8 Crc               = E2E_CRC8_START;
+
+    if( DataIDMode == E2E_P01_DATAID_BOTH )
+    {
+        Crc = E2E_UpdateCrc8( DataIDBytes, 2u, Crc );
+    }
+    else if( DataIDMode == E2E_P01_DATAID_ALT )
+    {
+        Crc = E2E_UpdateCrc8( &DataIDBytes[ Counter % 2u ], 1u, Crc );
+    }
+    else if( DataIDMode == E2E_P01_DATAID_NIBBLE )
+    {
+        DataIDBytes[ 1u ] = 0u;
+        Crc               = E2E_UpdateCrc8( DataIDBytes, 2u, Crc );
+    }
+    else
+    {
+        Crc = E2E_UpdateCrc8( DataIDBytes, 1u, Crc );
+    }
+
+    Crc = E2E_UpdateCrc8( Data, CrcByte, Crc );
+    if( ( CrcByte + 1u ) < Length )
+    {
+        Crc = E2E_UpdateCrc8( &Data[ CrcByte + 1u ], (uint32)Length - CrcByte - 1u, Crc );
+    }
+
+    return Crc;
+}
+
+/**
+ * @brief   **Read a nibble from the data**
+ *
+ * @param   Data Pointer to the data
+ * @param   BitOffset Bit offset of the nibble, multiple of 4
+ *
+ * @retval  The nibble value
+ */
+static uint8 E2E_ReadNibble( const uint8 *Data, uint16 BitOffset )
+{
+    return ( Data[ BitOffset / E2E_BITS_PER_BYTE ] >> ( BitOffset % E2E_BITS_PER_BYTE ) ) & E2E_NIBBLE_MASK;
+}
+
+/**
+ * @brief   **Write a nibble into the data**
+ *
+ * @param   Data Pointer to the data
+ * @param   BitOffset Bit offset of the nibble, multiple of 4
+ * @param   Value Value to write, only the low nibble is used
+ */
+static void E2E_WriteNibble( uint8 *Data, uint16 BitOffset, uint8 Value )
+{
+    uint8 Shift = BitOffset % E2E_BITS_PER_BYTE;
+    uint8 Byte  = Data[ BitOffset / E2E_BITS_PER_BYTE ] & (uint8)~( E2E_NIBBLE_MASK << Shift );
+
+    Data[ BitOffset / E2E_BITS_PER_BYTE ] = Byte | (uint8)( ( Value & E2E_NIBBLE_MASK ) << Shift );
+}
+
+/**
+ * @brief   **Distance between two counter values**
+ *
+ * @param   Received Received counter
+ * @param   Last Last valid counter
+ * @param   Range Number of counter values
+ *
+ * @retval  Number of increments from Last to Received
+ */
+static uint32 E2E_CounterDelta( uint32 Received, uint32 Last, uint32 Range )
+{
+    uint32 Delta = Received - Last;
+
+    if( Received < Last )
+    {
+        Delta = ( Range + Received ) - Last;
+    }
+
+    return Delta;
+}
+
+/**
+ * @brief   **Evaluate the counter of profiles 4, 5 and 11**
+ *
+ * @param   Delta Distance from the last valid counter
+ * @param   MaxDeltaCounter Maximum allowed gap
+ *
+ * @retval  E2E_P04STATUS_REPEATED, E2E_P04STATUS_OK, E2E_P04STATUS_OKSOMELOST or
+ *          E2E_P04STATUS_WRONGSEQUENCE
+ */
+static uint8 E2E_CheckCounter( uint32 Delta, uint32 MaxDeltaCounter )
+{
+    uint8 Status = E2E_P04STATUS_WRONGSEQUENCE;
+
+    if( Delta == 0u )
+    {
+        Status = E2E_P04STATUS_REPEATED;
+    }
+    else if( Delta == 1u )
+    {
+        Status = E2E_P04STATUS_OK;
+    }
+    else if( Delta <= MaxDeltaCounter )
+    {
+        Status = E2E_P04STATUS_OKSOMELOST;
+    }
+    else
+    {
+        /* gap too big, wrong sequence */
+    }
+
+    return Status;
+}
+
+/**
+ * @brief   **Evaluate the counter of profiles 1 and 2**
+ *
+ * Updates the check state with a correctly received counter, handling the first reception, the
+ * repeated data, the lost data and the synchronization after too many cycles without new data.
+ *
+ * @param   StatePtr Check state
+ * @param   ReceivedCounter Counter of the received data
+ * @param   CounterRange Number of counter values
+ * @param   MaxDeltaCounterInit Initial maximum allowed gap
+ * @param   MaxNoNewOrRepeatedData Maximum number of cycles without new data before resync
+ * @param   SyncCounterInit Number of valid data required to leave the sync state
+ */
+static void E2E_CheckSequence( E2E_P01CheckStateType *StatePtr, uint8 ReceivedCounter, uint8 CounterRange, uint8 MaxDeltaCounterInit, uint8 MaxNoNewOrRepeatedData, uint8 SyncCounterInit )
+{
+    if( StatePtr->WaitForFirstData == TRUE )
+    {
+        StatePtr->WaitForFirstData = FALSE;
+        StatePtr->MaxDeltaCounter  = MaxDeltaCounterInit;
+        StatePtr->LastValidCounter = ReceivedCounter;
+        StatePtr->Status           = E2E_P01STATUS_INITIAL;
+    }
+    else
+    {
+        uint8 Delta = (uint8)E2E_CounterDelta( ReceivedCounter, StatePtr->LastValidCounter, CounterRange );
+
+        if( Delta == 0u )
+        {
+            if( StatePtr->NoNewOrRepeatedDataCounter < E2E_P01_MAX_DELTA )
+            {
+                StatePtr->NoNewOrRepeatedDataCounter++;
+            }
+            StatePtr->Status = E2E_P01STATUS_REPEATED;
+        }
+        else if( Delta <= StatePtr->MaxDeltaCounter )
+        {
+            StatePtr->MaxDeltaCounter  = MaxDeltaCounterInit;
+            StatePtr->LastValidCounter = ReceivedCounter;
+            StatePtr->LostData         = Delta - 1u;
+
+            if( StatePtr->NoNewOrRepeatedDataCounter > MaxNoNewOrRepeatedData )
+            {
+                StatePtr->SyncCounter = SyncCounterInit;
+            }
+            StatePtr->NoNewOrRepeatedDataCounter = 0u;
+
+            if( StatePtr->SyncCounter > 0u )
+            {
+                StatePtr->SyncCounter--;
+                StatePtr->Status = E2E_P01STATUS_SYNC;
+            }
+            else
+            {
+                StatePtr->Status = ( Delta == 1u ) ? E2E_P01STATUS_OK : E2E_P01STATUS_OKSOMELOST;
+            }
+        }
+        else
+        {
+            StatePtr->NoNewOrRepeatedDataCounter = 0u;
+            StatePtr->SyncCounter                = SyncCounterInit;
+            StatePtr->Status                     = E2E_P01STATUS_WRONGSEQUENCE;
+        }
+    }
+}
+
+/**
+ * @brief   **CRC of profile 4**
+ *
+ * CRC32P4 over the data before the CRC field, continued after it.
+ *
+ * @param   Data Pointer to the data
+ * @param   Offset Bit offset of the header
+ * @param   Length Length of the data in bytes
+ *
+ * @retval  The CRC of the data
+ */
+static uint32 E2E_P04ComputeCrc( const uint8 *Data, uint16 Offset, uint16 Length )
+{
+    uint32 CrcPos = ( (uint32)Offset / E2E_BITS_PER_BYTE ) + E2E_P04_CRC_POS;
+    uint32 Crc    = Crc_CalculateCRC32P4( Data, CrcPos, E2E_CRC32_START, TRUE );
+
+    if( ( CrcPos + sizeof( uint32 ) ) < Length )
+    {
+        Crc = Crc_CalculateCRC32P4( &Data[ CrcPos + sizeof( uint32 ) ], Length - CrcPos - sizeof( uint32 ), Crc, FALSE );
+    }
+
+    return Crc;
+}
+
+/**
+ * @brief   **CRC of profile 5**
+ *
+ * CRC16 over the data before and after the CRC field, followed by the Data ID low and high
+ * bytes.
+ *
+ * @param   Data Pointer to the data
+ * @param   Offset Bit offset of the header
+ * @param   Length Length of the data in bytes
+ * @param   DataID Data ID of the data
+ *
+ * @retval  The CRC of the data
+ */
+static uint16 E2E_P05ComputeCrc( const uint8 *Data, uint16 Offset, uint16 Length, uint16 DataID )
+{
+    uint8 DataIDBytes[ 2u ] = { (uint8)( DataID & E2E_BYTE_MASK ), (uint8)( DataID >> E2E_BITS_PER_BYTE ) };
+    uint32 CrcPos           = (uint32)Offset / E2E_BITS_PER_BYTE;
+    uint16 Crc              = Crc_CalculateCRC16( Data, CrcPos, E2E_CRC16_START, TRUE );
+
+    Crc = Crc_CalculateCRC16( &Data[ CrcPos + sizeof( uint16 ) ], Length - CrcPos - sizeof( uint16 ), Crc, FALSE );
+    Crc = Crc_CalculateCRC16( DataIDBytes, sizeof( DataIDBytes ), Crc, FALSE );
+
+    return Crc;
+}
+
+/**
+ * @brief   **Read a big endian value from the data**
+ *
+ * @param   Data Pointer to the most significant byte
+ * @param   Size Number of bytes, up to 4
+ *
+ * @retval  The value read
+ */
+static uint32 E2E_ReadBigEndian( const uint8 *Data, uint8 Size )
+{
+    uint32 Value = 0u;
+
+    for( uint8 i = 0u; i < Size; i++ )
+    {
+        Value = ( Value << E2E_BITS_PER_BYTE ) | Data[ i ];
+    }
+
+    return Value;
+}
+
+/**
+ * @brief   **Write a big endian value into the data**
+ *
+ * @param   Data Pointer to the most significant byte
+ * @param   Size Number of bytes, up to 4
+ * @param   Value Value to write
+ */
+static void E2E_WriteBigEndian( uint8 *Data, uint8 Size, uint32 Value )
+{
+    uint32 Remaining = Value;
+
+    for( uint8 i = Size; i > 0u; i-- )
+    {
+        Data[ i - 1u ] = (uint8)( Remaining & E2E_BYTE_MASK );
+        Remaining >>= E2E_BITS_PER_BYTE;
+    }
+}
@@ -0,0 +1,284 @@
+/**
+ * @file    E2E.h
+ * @brief   **E2E library header file**
+ *
+ * End to end protection of safety related data (AUTOSAR E2E Library) for profiles 1, 2, 4, 5 and
+ * 11. Each profile has its own configuration, protect state and check state types, the
+ * application keeps one set per protected data element.
+ */
+#ifndef E2E_H__
+#define E2E_H__
+
+#include "Std_Types.h"
+
+/**
+ * @defgroup E2E_Errors E2E library return values
+ *
+ * @{ */
+#define E2E_E_OK                 0x00u /*!< Function completed successfully */
+#define E2E_E_INPUTERR_NULL      0x13u /*!< At least one pointer parameter is a NULL pointer */
+#define E2E_E_INPUTERR_WRONG     0x17u /*!< At least one input parameter is erroneous */
+#define E2E_E_INTERR             0x19u /*!< An internal library error has occurred */
+#define E2E_E_WRONGSTATE         0x1Au /*!< Function executed in wrong state */
+/**
+ * @} */
+
+/**
+ * @defgroup E2E_P01_Status Status of the reception on one single Data in one cycle, profiles 1 and 2
+ *
+ * @{ */
+#define E2E_P01STATUS_OK            0x00u /*!< New data correctly received */
+#define E2E_P01STATUS_NONEWDATA     0x01u /*!< Check called without new data */
+#define E2E_P01STATUS_WRONGCRC      0x02u /*!< Data received with a wrong CRC */
+#define E2E_P01STATUS_SYNC          0x03u /*!< Data correct but the receiver is still synchronizing */
+#define E2E_P01STATUS_INITIAL       0x04u /*!< First data received, no counter to compare with */
+#define E2E_P01STATUS_REPEATED      0x08u /*!< Data received with the same counter as the last one */
+#define E2E_P01STATUS_OKSOMELOST    0x20u /*!< Data correct but some data in between has been lost */
+#define E2E_P01STATUS_WRONGSEQUENCE 0x40u /*!< Counter jump bigger than allowed */
+#define E2E_P02STATUS_OK            0x00u /*!< New data correctly received */
+#define E2E_P02STATUS_NONEWDATA     0x01u /*!< Check called without new data */
+#define E2E_P02STATUS_WRONGCRC      0x02u /*!< Data received with a wrong CRC */
+#define E2E_P02STATUS_SYNC          0x03u /*!< Data correct but the receiver is still synchronizing */
+#define E2E_P02STATUS_INITIAL       0x04u /*!< First data received, no counter to compare with */
+#define E2E_P02STATUS_REPEATED      0x08u /*!< Data received with the same counter as the last one */
+#define E2E_P02STATUS_OKSOMELOST    0x20u /*!< Data correct but some data in between has been lost */
+#define E2E_P02STATUS_WRONGSEQUENCE 0x40u /*!< Counter jump bigger than allowed */
+/**
+ * @} */
+
+/**
+ * @defgroup E2E_P04_Status Status of the reception on one single Data in one cycle, profiles 4, 5 and 11
+ *
+ * @{ */
+#define E2E_P04STATUS_OK            0x00u /*!< New data correctly received */
+#define E2E_P04STATUS_NONEWDATA     0x01u /*!< Check called without new data */
+#define E2E_P04STATUS_ERROR         0x07u /*!< Data received with a wrong CRC, length or Data ID */
+#define E2E_P04STATUS_REPEATED      0x08u /*!< Data received with the same counter as the last one */
+#define E2E_P04STATUS_OKSOMELOST    0x20u /*!< Data correct but some data in between has been lost */
+#define E2E_P04STATUS_WRONGSEQUENCE 0x40u /*!< Counter jump bigger than allowed */
+#define E2E_P05STATUS_OK            0x00u /*!< New data correctly received */
+#define E2E_P05STATUS_NONEWDATA     0x01u /*!< Check called without new data */
+#define E2E_P05STATUS_ERROR         0x07u /*!< Data received with a wrong CRC or length */
+#define E2E_P05STATUS_REPEATED      0x08u /*!< Data received with the same counter as the last one */
+#define E2E_P05STATUS_OKSOMELOST    0x20u /*!< Data correct but some data in between has been lost */
+#define E2E_P05STATUS_WRONGSEQUENCE 0x40u /*!< Counter jump bigger than allowed */
+#define E2E_P11STATUS_OK            0x00u /*!< New data correctly received */
+#define E2E_P11STATUS_NONEWDATA     0x01u /*!< Check called without new data */
+#define E2E_P11STATUS_ERROR         0x07u /*!< Data received with a wrong CRC or Data ID nibble */
+#define E2E_P11STATUS_REPEATED      0x08u /*!< Data received with the same counter as the last one */
+#define E2E_P11STATUS_OKSOMELOST    0x20u /*!< Data correct but some data in between has been lost */
+#define E2E_P11STATUS_WRONGSEQUENCE 0x40u /*!< Counter jump bigger than allowed */
+/**
+ * @} */
+
+/**
+ * @defgroup E2E_DataIDMode Inclusion mode of the Data ID in the CRC, profiles 1 and 11
+ *
+ * @{ */
+#define E2E_P01_DATAID_BOTH      0x00u /*!< Both bytes of the Data ID are included in the CRC */
+#define E2E_P01_DATAID_ALT       0x01u /*!< Low byte on even counters, high byte on odd counters */
+#define E2E_P01_DATAID_LOW       0x02u /*!< Only the low byte is included, high byte shall be 0 */
+#define E2E_P01_DATAID_NIBBLE    0x03u /*!< Low byte in the CRC, low nibble of the high byte sent */
+#define E2E_P11_DATAID_BOTH      0x00u /*!< Both bytes of the Data ID are included in the CRC */
+#define E2E_P11_DATAID_NIBBLE    0x03u /*!< Low byte in the CRC, low nibble of the high byte sent */
+/**
+ * @} */
+
+typedef uint8 E2E_P01CheckStatusType;   /*!< Values of @ref E2E_P01_Status */
+typedef uint8 E2E_P02CheckStatusType;   /*!< Values of @ref E2E_P01_Status */
+typedef uint8 E2E_P04CheckStatusType;   /*!< Values of @ref E2E_P04_Status */
+typedef uint8 E2E_P05CheckStatusType;   /*!< Values of @ref E2E_P04_Status */
+typedef uint8 E2E_P11CheckStatusType;   /*!< Values of @ref E2E_P04_Status */
+typedef uint8 E2E_P01DataIDMode;        /*!< Values of @ref E2E_DataIDMode */
+typedef uint8 E2E_P11DataIDMode;        /*!< Values of @ref E2E_DataIDMode */
+
+/**
+ * @brief **Profile 1 configuration**
+ *
+ * CRC8 SAE J1850 in one byte, 4 bits counter, offsets and lengths given in bits.
+ */
+typedef struct _E2E_P01ConfigType
+{
+    uint16 CounterOffset;          /*!< Bit offset of the counter, multiple of 4 */
+    uint16 CRCOffset;              /*!< Bit offset of the CRC, multiple of 8 */
+    uint16 DataID;                 /*!< Unique identifier of the protected data */
+    uint16 DataIDNibbleOffset;     /*!< Bit offset of the Data ID nibble, E2E_P01_DATAID_NIBBLE only */
+    E2E_P01DataIDMode DataIDMode;  /*!< Inclusion mode of the Data ID, @ref E2E_DataIDMode */
+    uint16 DataLength;             /*!< Length of the data in bits, multiple of 8 up to 240 */
+    uint8 MaxDeltaCounterInit;     /*!< Initial maximum allowed gap between two counter values */
+    uint8 MaxNoNewOrRepeatedData;  /*!< Maximum number of cycles without new or with repeated data */
+    uint8 SyncCounterInit;         /*!< Number of valid data required to leave the sync state */
+} E2E_P01ConfigType;
+
+/**
+ * @brief **Profile 1 protect state**
+ */
+typedef struct _E2E_P01ProtectStateType
+{
+    uint8 Counter; /*!< Counter to be used for protecting the next data, 0 to 14 */
+} E2E_P01ProtectStateType;
+
+/**
+ * @brief **Profile 1 check state**
+ *
+ * NewDataAvailable shall be set by the caller before each call to E2E_P01Check.
+ */
+typedef struct _E2E_P01CheckStateType
+{
+    uint8 LastValidCounter;                 /*!< Counter of the last valid received data */
+    uint8 MaxDeltaCounter;                  /*!< Maximum allowed gap to the next counter */
+    boolean WaitForFirstData;               /*!< No data has been received yet */
+    boolean NewDataAvailable;               /*!< There is new data to check */
+    uint8 LostData;                         /*!< Number of data lost since the last valid one */
+    E2E_P01CheckStatusType Status;          /*!< Result of the last check */
+    uint8 SyncCounter;                      /*!< Valid data left to leave the sync state */
+    uint8 NoNewOrRepeatedDataCounter;       /*!< Cycles without new or with repeated data */
+} E2E_P01CheckStateType;
+
+/**
+ * @brief **Profile 2 configuration**
+ *
+ * CRC8H2F in the first byte, 4 bits counter in the low nibble of the second byte and one Data ID
+ * per counter value.
+ */
+typedef struct _E2E_P02ConfigType
+{
+    uint16 DataLength;             /*!< Length of the data in bits, multiple of 8 up to 2048 */
+    uint8 DataIDList[ 16u ];       /*!< Data ID used for each counter value */
+    uint8 MaxDeltaCounterInit;     /*!< Initial maximum allowed gap between two counter values */
+    uint8 MaxNoNewOrRepeatedData;  /*!< Maximum number of cycles without new or with repeated data */
+    uint8 SyncCounterInit;         /*!< Number of valid data required to leave the sync state */
+} E2E_P02ConfigType;
+
+/**
+ * @brief **Profile 2 protect state**
+ */
+typedef struct _E2E_P02ProtectStateType
+{
+    uint8 Counter; /*!< Counter to be used for protecting the next data, 0 to 15 */
+} E2E_P02ProtectStateType;
+
+/**
+ * @brief **Profile 2 check state**, same members as profile 1
+ */
+typedef E2E_P01CheckStateType E2E_P02CheckStateType;
+
+/**
+ * @brief **Profile 4 configuration**
+ *
+ * 12 bytes header with length, 16 bits counter, 32 bits Data ID and CRC32P4, for large data
+ * (e.g. CAN FD or Ethernet). Offsets and lengths given in bits.
+ */
+typedef struct _E2E_P04ConfigType
+{
+    uint32 DataID;          /*!< Unique system wide identifier of the protected data */
+    uint16 Offset;          /*!< Bit offset of the header, multiple of 8 */
+    uint16 MinDataLength;   /*!< Minimal length of the data in bits */
+    uint16 MaxDataLength;   /*!< Maximal length of the data in bits */
+    uint16 MaxDeltaCounter; /*!< Maximum allowed gap between two counter values */
+} E2E_P04ConfigType;
+
+/**
+ * @brief **Profile 4 protect state**
+ */
+typedef struct _E2E_P04ProtectStateType
+{
+    uint16 Counter; /*!< Counter to be used for protecting the next data */
+} E2E_P04ProtectStateType;
+
+/**
+ * @brief **Profile 4 check state**
+ */
+typedef struct _E2E_P04CheckStateType
+{
+    E2E_P04CheckStatusType Status; /*!< Result of the last check */
+    uint16 Counter;                /*!< Counter of the last valid received data */
+} E2E_P04CheckStateType;
+
+/**
+ * @brief **Profile 5 configuration**
+ *
+ * 3 bytes header with CRC16 and 8 bits counter, the 16 bits Data ID is included in the CRC but
+ * not transmitted. Offsets and lengths given in bits.
+ */
+typedef struct _E2E_P05ConfigType
+{
+    uint16 Offset;         /*!< Bit offset of the header, multiple of 8 */
+    uint16 DataLength;     /*!< Length of the data in bits, multiple of 8 */
+    uint16 DataID;         /*!< Unique system wide identifier of the protected data */
+    uint8 MaxDeltaCounter; /*!< Maximum allowed gap between two counter values */
+} E2E_P05ConfigType;
+
+/**
+ * @brief **Profile 5 protect state**
+ */
+typedef struct _E2E_P05ProtectStateType
+{
+    uint8 Counter; /*!< Counter to be used for protecting the next data */
+} E2E_P05ProtectStateType;
+
+/**
+ * @brief **Profile 5 check state**
+ */
+typedef struct _E2E_P05CheckStateType
+{
+    E2E_P05CheckStatusType Status; /*!< Result of the last check */
+    uint8 Counter;                 /*!< Counter of the last valid received data */
+} E2E_P05CheckStateType;
+
+/**
+ * @brief **Profile 11 configuration**
+ *
+ * Same layout as profile 1 with the Data ID modes BOTH and NIBBLE, checked with the state of
+ * profiles 4 and 5.
+ */
+typedef struct _E2E_P11ConfigType
+{
+    uint16 CounterOffset;         /*!< Bit offset of the counter, multiple of 4 */
+    uint16 CRCOffset;             /*!< Bit offset of the CRC, multiple of 8 */
+    uint16 DataID;                /*!< Unique identifier of the protected data */
+    uint16 DataIDNibbleOffset;    /*!< Bit offset of the Data ID nibble, E2E_P11_DATAID_NIBBLE only */
+    E2E_P11DataIDMode DataIDMode; /*!< Inclusion mode of the Data ID, @ref E2E_DataIDMode */
+    uint16 DataLength;            /*!< Length of the data in bits, multiple of 8 up to 240 */
+    uint8 MaxDeltaCounter;        /*!< Maximum allowed gap between two counter values */
+} E2E_P11ConfigType;
+
+/**
+ * @brief **Profile 11 protect state**
+ */
+typedef struct _E2E_P11ProtectStateType
+{
+    uint8 Counter; /*!< Counter to be used for protecting the next data, 0 to 14 */
+} E2E_P11ProtectStateType;
+
+/**
+ * @brief **Profile 11 check state**
+ */
+typedef struct _E2E_P11CheckStateType
+{
+    E2E_P11CheckStatusType Status; /*!< Result of the last check */
+    uint8 Counter;                 /*!< Counter of the last valid received data */
+} E2E_P11CheckStateType;
+
+Std_ReturnType E2E_P01Protect( const E2E_P01ConfigType *ConfigPtr, E2E_P01ProtectStateType *StatePtr, uint8 *DataPtr );
+Std_ReturnType E2E_P01ProtectInit( E2E_P01ProtectStateType *StatePtr );
+Std_ReturnType E2E_P01Check( const E2E_P01ConfigType *ConfigPtr, E2E_P01CheckStateType *StatePtr, const uint8 *DataPtr );
+Std_ReturnType E2E_P01CheckInit( E2E_P01CheckStateType *StatePtr );
+Std_ReturnType E2E_P02Protect( const E2E_P02ConfigType *ConfigPtr, E2E_P02ProtectStateType *StatePtr, uint8 *DataPtr );
+Std_ReturnType E2E_P02ProtectInit( E2E_P02ProtectStateType *StatePtr );
+Std_ReturnType E2E_P02Check( const E2E_P02ConfigType *ConfigPtr, E2E_P02CheckStateType *StatePtr, const uint8 *DataPtr );
+Std_ReturnType E2E_P02CheckInit( E2E_P02CheckStateType *StatePtr );
+Std_ReturnType E2E_P04Protect( const E2E_P04ConfigType *ConfigPtr, E2E_P04ProtectStateType *StatePtr, uint8 *DataPtr, uint16 Length );
+Std_ReturnType E2E_P04ProtectInit( E2E_P04ProtectStateType *StatePtr );
+Std_ReturnType E2E_P04Check( const E2E_P04ConfigType *ConfigPtr, E2E_P04CheckStateType *StatePtr, const uint8 *DataPtr, uint16 Length );
+Std_ReturnType E2E_P04CheckInit( E2E_P04CheckStateType *StatePtr );
+Std_ReturnType E2E_P05Protect( const E2E_P05ConfigType *ConfigPtr, E2E_P05ProtectStateType *StatePtr, uint8 *DataPtr, uint16 Length );
+Std_ReturnType E2E_P05ProtectInit( E2E_P05ProtectStateType *StatePtr );
+Std_ReturnType E2E_P05Check( const E2E_P05ConfigType *ConfigPtr, E2E_P05CheckStateType *StatePtr, const uint8 *DataPtr, uint16 Length );
+Std_ReturnType E2E_P05CheckInit( E2E_P05CheckStateType *StatePtr );
+Std_ReturnType E2E_P11Protect( const E2E_P11ConfigType *ConfigPtr, E2E_P11ProtectStateType *StatePtr, uint8 *DataPtr, uint16 Length );
+Std_ReturnType E2E_P11ProtectInit( E2E_P11ProtectStateType *StatePtr );
+Std_ReturnType E2E_P11Check( const E2E_P11ConfigType *ConfigPtr, E2E_P11CheckStateType *StatePtr, const uint8 *DataPtr, uint16 Length );
+Std_ReturnType E2E_P11CheckInit( E2E_P11CheckStateType *StatePtr );
+
+#endif
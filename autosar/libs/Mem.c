@@ -0,0 +1,379 @@
+/**
+ * @file    Mem.c
+ * @brief   **Memory copy, fill, compare and scan routines**
+ *
+ * All the routines follow the same scheme: a byte wise head until the pointers are word aligned,
+ * a body that moves four words per iteration (MEM_UNROLL_SIZE bytes), a word wise loop for the
+ * remaining words and a byte wise tail. Buffers shorter than MEM_MIN_WORD_LENGTH skip the head
+ * and body since the alignment overhead is not worth it. The word accesses go through
+ * Mem_WordType, which may alias any other type, so the routines are safe with strict aliasing
+ * at any optimization level.
+ */
+#include "Std_Types.h"
+#include "Mem.h"
+
+/**
+ * @defgroup Mem_Values values used by the routines
+ *
+ * @{ */
+#define MEM_WORD_SIZE        4u          /*!< Number of bytes on a word */
+#define MEM_WORD_ALIGN_MASK  3u          /*!< Address bits that shall be zero on a word aligned pointer */
+#define MEM_UNROLL_SIZE      16u         /*!< Bytes processed on each iteration of the unrolled loops */
+#define MEM_MIN_WORD_LENGTH  8u          /*!< Buffers shorter than this are processed byte wise */
+#define MEM_BYTE_REPLICATE   0x01010101u /*!< Multiplier to replicate a byte on the four bytes of a word */
+#define MEM_BYTES_HIGH_BITS  0x80808080u /*!< Most significant bit of each byte of a word */
+#define MEM_BITS_PER_BYTE    8u          /*!< Number of bits on a byte */
+/**
+ * @} */
+
+/**
+ * @brief  Word type used to access byte buffers without breaking the strict aliasing rules
+ */
+typedef uint32 MAY_ALIAS Mem_WordType;
+
+/**
+ * @brief   **Copy a memory block**
+ *
+ * Copies Length bytes from Src to Dst, the blocks shall not overlap. When both pointers have the
+ * same alignment the copy is done four words per iteration, otherwise byte by byte.
+ *
+ * @param   Dst Destination block
+ * @param   Src Source block
+ * @param   Length Number of bytes to copy
+ */
+void Mem_Copy( void *Dst, const void *Src, uint32 Length )
+{
+    uint8 *DstPtr       = (uint8 *)Dst;
+    const uint8 *SrcPtr = (const uint8 *)Src;
+    uint32 Remaining    = Length;
+
+    /* cppcheck-suppress misra-c2012-11.4 ; the address is needed to know its alignment */
+    if( ( Remaining >= MEM_MIN_WORD_LENGTH ) && ( ( ( (uint32_least)DstPtr ^ (uint32_least)SrcPtr ) & MEM_WORD_ALIGN_MASK ) == 0u ) )
+    {
+        /* cppcheck-suppress misra-c2012-11.4 ; the address is needed to know its alignment */
+        while( ( (uint32_least)DstPtr & MEM_WORD_ALIGN_MASK ) != 0u )
+        {
+            *DstPtr = *SrcPtr;
+            DstPtr++;
+            SrcPtr++;
+            Remaining--;
+        }
+
+        /* cppcheck-suppress misra-c2012-11.3 ; both pointers are word aligned at this point */
+        Mem_WordType *DstWord = (Mem_WordType *)DstPtr;
+        /* cppcheck-suppress misra-c2012-11.3 ; both pointers are word aligned at this point */
+        const Mem_WordType *SrcWord = (const Mem_WordType *)SrcPtr;
+
+        while( Remaining >= MEM_UNROLL_SIZE )
+        {
+            DstWord[ 0 ] = SrcWord[ 0 ];
+            DstWord[ 1 ] = SrcWord[ 1 ];
+            DstWord[ 2 ] = SrcWord[ 2 ];
+            DstWord[ 3 ] = SrcWord[ 3 ];
+            DstWord += 4;
+            SrcWord += 4;
+            Remaining -= MEM_UNROLL_SIZE;
+        }
+
+        while( Remaining >= MEM_WORD_SIZE )
+        {
+            *DstWord = *SrcWord;
+            DstWord++;
+            SrcWord++;
+            Remaining -= MEM_WORD_SIZE;
+        }
+
+        /* cppcheck-suppress misra-c2012-11.3 ; go back to byte access for the remaining bytes */
+        DstPtr = (uint8 *)DstWord;
+        /* cppcheck-suppress misra-c2012-11.3 ; go back to byte access for the remaining bytes */
+        SrcPtr = (const uint8 *)SrcWord;
+    }
+
+    for( uint32 Byte = 0u; Byte < Remaining; Byte++ )
+    {
+        DstPtr[ Byte ] = SrcPtr[ Byte ];
+    }
+}
+
+/**
+ * @brief   **Fill a memory block**
+ *
+ * Sets Length bytes from Dst to Value, the value is replicated on the four bytes of a word to
+ * fill the aligned part of the block four words per iteration.
+ *
+ * @param   Dst Destination block
+ * @param   Value Value to write on each byte
+ * @param   Length Number of bytes to fill
+ */
+void Mem_Set( void *Dst, uint8 Value, uint32 Length )
+{
+    uint8 *DstPtr    = (uint8 *)Dst;
+    uint32 Remaining = Length;
+
+    if( Remaining >= MEM_MIN_WORD_LENGTH )
+    {
+        uint32 Pattern = (uint32)Value * MEM_BYTE_REPLICATE;
+
+        /* cppcheck-suppress misra-c2012-11.4 ; the address is needed to know its alignment */
+        while( ( (uint32_least)DstPtr & MEM_WORD_ALIGN_MASK ) != 0u )
+        {
+            *DstPtr = Value;
+            DstPtr++;
+            Remaining--;
+        }
+
+        /* cppcheck-suppress misra-c2012-11.3 ; the pointer is word aligned at this point */
+        Mem_WordType *DstWord = (Mem_WordType *)DstPtr;
+
+        while( Remaining >= MEM_UNROLL_SIZE )
+        {
+            DstWord[ 0 ] = Pattern;
+            DstWord[ 1 ] = Pattern;
+            DstWord[ 2 ] = Pattern;
+            DstWord[ 3 ] = Pattern;
+            DstWord += 4;
+            Remaining -= MEM_UNROLL_SIZE;
+        }
+
+        while( Remaining >= MEM_WORD_SIZE )
+        {
+            *DstWord = Pattern;
+            DstWord++;
+            Remaining -= MEM_WORD_SIZE;
+        }
+
+        /* cppcheck-suppress misra-c2012-11.3 ; go back to byte access for the remaining bytes */
+        DstPtr = (uint8 *)DstWord;
+    }
+
+    for( uint32 Byte = 0u; Byte < Remaining; Byte++ )
+    {
+        DstPtr[ Byte ] = Value;
+    }
+}
+
+/**
+ * @brief   **Compare two memory blocks**
+ *
+ * Compares Length bytes of both blocks, when both pointers have the same alignment the equal
+ * words are skipped one at a time and only the first different word is compared byte wise.
+ *
+ * @param   Ptr1 First block
+ * @param   Ptr2 Second block
+ * @param   Length Number of bytes to compare
+ *
+ * @retval  Zero when both blocks are equal, otherwise the difference between the first different
+ *          bytes taken as unsigned, negative when the byte of Ptr1 is lower
+ */
+sint32 Mem_Compare( const void *Ptr1, const void *Ptr2, uint32 Length )
+{
+    const uint8 *Ptr1Byte = (const uint8 *)Ptr1;
+    const uint8 *Ptr2Byte = (const uint8 *)Ptr2;
+    uint32 Remaining      = Length;
+    sint32 Result         = 0;
+
+    /* cppcheck-suppress misra-c2012-11.4 ; the address is needed to know its alignment */
+    if( ( Remaining >= MEM_MIN_WORD_LENGTH ) && ( ( ( (uint32_least)Ptr1Byte ^ (uint32_least)Ptr2Byte ) & MEM_WORD_ALIGN_MASK ) == 0u ) )
+    {
+        /* cppcheck-suppress misra-c2012-11.4 ; the address is needed to know its alignment */
+        while( ( ( (uint32_least)Ptr1Byte & MEM_WORD_ALIGN_MASK ) != 0u ) && ( *Ptr1Byte == *Ptr2Byte ) )
+        {
+            Ptr1Byte++;
+            Ptr2Byte++;
+            Remaining--;
+        }
+
+        /* cppcheck-suppress misra-c2012-11.4 ; the address is needed to know its alignment */
+        if( ( (uint32_least)Ptr1Byte & MEM_WORD_ALIGN_MASK ) == 0u )
+        {
+            /* cppcheck-suppress misra-c2012-11.3 ; both pointers are word aligned at this point */
+            const Mem_WordType *Ptr1Word = (const Mem_WordType *)Ptr1Byte;
+            /* cppcheck-suppress misra-c2012-11.3 ; both pointers are word aligned at this point */
+            const Mem_WordType *Ptr2Word = (const Mem_WordType *)Ptr2Byte;
+
+            while( ( Remaining >= MEM_WORD_SIZE ) && ( *Ptr1Word == *Ptr2Word ) )
+            {
+                Ptr1Word++;
+                Ptr2Word++;
+                Remaining -= MEM_WORD_SIZE;
+            }
+
+            /* cppcheck-suppress misra-c2012-11.3 ; go back to byte access for the remaining bytes */
+            Ptr1Byte = (const uint8 *)Ptr1Word;
+            /* cppcheck-suppress misra-c2012-11.3 ; go back to byte access for the remaining bytes */
+            Ptr2Byte = (const uint8 *)Ptr2Word;
+        }
+    }
+
+    for( uint32 Byte = 0u; ( Byte < Remaining ) && ( Result == 0 ); Byte++ )
+    {
+        Result = (sint32)Ptr1Byte[ Byte ] - (sint32)Ptr2Byte[ Byte ];
+    }
+
+    return Result;
+}
+
+/**
+ * @brief   **Look for a byte in a memory block**
+ *
+ * Scans the block for the first byte equal to Value, the aligned part is scanned a word at a
+ * time, a word contains the value when any of its bytes xored with the value is zero, which is
+ * detected without a loop with ( x - 0x01010101 ) & ~x & 0x80808080.
+ *
+ * @param   Ptr Block to scan
+ * @param   Value Byte to look for
+ * @param   Length Number of bytes to scan
+ *
+ * @retval  Pointer to the first byte equal to Value, or NULL_PTR if there is none
+ */
+const uint8 *Mem_Find( const void *Ptr, uint8 Value, uint32 Length )
+{
+    const uint8 *BytePtr = (const uint8 *)Ptr;
+    const uint8 *Found   = NULL_PTR;
+    uint32 Remaining     = Length;
+
+    if( Remaining >= MEM_MIN_WORD_LENGTH )
+    {
+        uint32 Pattern = (uint32)Value * MEM_BYTE_REPLICATE;
+
+        /* cppcheck-suppress misra-c2012-11.4 ; the address is needed to know its alignment */
+        while( ( ( (uint32_least)BytePtr & MEM_WORD_ALIGN_MASK ) != 0u ) && ( *BytePtr != Value ) )
+        {
+            BytePtr++;
+            Remaining--;
+        }
+
+        /* cppcheck-suppress misra-c2012-11.4 ; the address is needed to know its alignment */
+        if( ( (uint32_least)BytePtr & MEM_WORD_ALIGN_MASK ) == 0u )
+        {
+            /* cppcheck-suppress misra-c2012-11.3 ; the pointer is word aligned at this point */
+            const Mem_WordType *WordPtr = (const Mem_WordType *)BytePtr;
+
+            while( Remaining >= MEM_WORD_SIZE )
+            {
+                uint32 Word = *WordPtr ^ Pattern;
+
+                if( ( ( Word - MEM_BYTE_REPLICATE ) & ~Word & MEM_BYTES_HIGH_BITS ) != 0u )
+                {
+                    break;
+                }
+                WordPtr++;
+                Remaining -= MEM_WORD_SIZE;
+            }
+
+            /* cppcheck-suppress misra-c2012-11.3 ; go back to byte access for the remaining bytes */
+            BytePtr = (const uint8 *)WordPtr;
+        }
+    }
+
+    for( uint32 Byte = 0u; ( Byte < Remaining ) && ( Found == NULL_PTR ); Byte++ )
+    {
+        if( BytePtr[ Byte ] == Value )
+        {
+            Found = &BytePtr[ Byte ];
+        }
+    }
+
+    return Found;
+}
+
+/**
+ * @brief   **Copy a memory block to a word only memory**
+ *
+ * Copies Length bytes from Src to a memory that only accepts 32 bits accesses, like the FDCAN
+ * message RAM, Dst is always written word by word and the last word is completed with zeros when
+ * Length is not a multiple of four. A word aligned source is read four words per iteration and
+ * then word by word, an unaligned one is read byte wise and packed into words (little endian).
+ *
+ * @param   Dst Destination words
+ * @param   Src Source block
+ * @param   Length Number of bytes to copy
+ */
+void Mem_CopyToVolatile32( volatile uint32 *Dst, const void *Src, uint32 Length )
+{
+    volatile uint32 *DstWord = Dst;
+    const uint8 *SrcPtr      = (const uint8 *)Src;
+    uint32 Remaining         = Length;
+
+    /* cppcheck-suppress misra-c2012-11.4 ; the address is needed to know its alignment */
+    if( ( (uint32_least)SrcPtr & MEM_WORD_ALIGN_MASK ) == 0u )
+    {
+        /* cppcheck-suppress misra-c2012-11.3 ; the pointer is word aligned at this point */
+        const Mem_WordType *SrcWord = (const Mem_WordType *)SrcPtr;
+
+        while( Remaining >= MEM_UNROLL_SIZE )
+        {
+            DstWord[ 0 ] = SrcWord[ 0 ];
+            DstWord[ 1 ] = SrcWord[ 1 ];
+            DstWord[ 2 ] = SrcWord[ 2 ];
+            DstWord[ 3 ] = SrcWord[ 3 ];
+            DstWord += 4;
+            SrcWord += 4;
+            Remaining -= MEM_UNROLL_SIZE;
+        }
+
+        while( Remaining >= MEM_WORD_SIZE )
+        {
+            *DstWord = *SrcWord;
+            DstWord++;
+            SrcWord++;
+            Remaining -= MEM_WORD_SIZE;
+        }
+
+        /* cppcheck-suppress misra-c2012-11.3 ; go back to byte access for the remaining bytes */
+        SrcPtr = (const uint8 *)SrcWord;
+    }
+
+    while( Remaining >= MEM_WORD_SIZE )
+    {
+        *DstWord = (uint32)SrcPtr[ 0 ] | ( (uint32)SrcPtr[ 1 ] << 8u ) | ( (uint32)SrcPtr[ 2 ] << 16u ) |
+                   ( (uint32)SrcPtr[ 3 ] << 24u );
+        DstWord++;
+        SrcPtr += MEM_WORD_SIZE;
+        Remaining -= MEM_WORD_SIZE;
+    }
+
+    if( Remaining > 0u )
+    {
+        uint32 Word = 0u;
+
+        for( uint32 Byte = 0u; Byte < Remaining; Byte++ )
+        {
+            Word |= (uint32)SrcPtr[ Byte ] << ( Byte * MEM_BITS_PER_BYTE );
+        }
+        *DstWord = Word;
+    }
+}
+
+/**
+ * @brief   **Fill a word only memory**
+ *
+ * Writes Value on Words consecutive words of a memory that only accepts 32 bits accesses, four
+ * words per iteration.
+ *
+ * @param   Dst Destination words
+ * @param   Value Value to write on each word
+ * @param   Words Number of words to fill
+ */
+void Mem_SetVolatile32( volatile uint32 *Dst, uint32 Value, uint32 Words )
+{
+    volatile uint32 *DstWord = Dst;
+    uint32 Remaining         = Words;
+
+    while( Remaining >= 4u )
+    {
+        DstWord[ 0 ] = Value;
+        DstWord[ 1 ] = Value;
+        DstWord[ 2 ] = Value;
+        DstWord[ 3 ] = Value;
+        DstWord += 4;
+        Remaining -= 4u;
+    }
+
+    while( Remaining > 0u )
+    {
+        *DstWord = Value;
+        DstWord++;
+        Remaining--;
+    }
+}
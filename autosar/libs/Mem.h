@@ -0,0 +1,26 @@
+/**
+ * @file    Mem.h
+ * @brief   **Memory copy, fill, compare and scan routines**
+ *
+ * The project is built with -fno-builtin, so the compiler never replaces a loop with a call to
+ * memcpy or memset and there is no C library to call either. These routines take the place of
+ * the byte by byte loops, the Cortex-M0+ does not support unaligned word accesses, so each routine
+ * goes byte wise until the pointers are word aligned and then moves four words per iteration,
+ * when the pointers can not be aligned at the same time the whole buffer is processed byte wise.
+ *
+ * The Volatile32 routines are meant for peripheral memories that only accept 32 bits accesses,
+ * like the FDCAN message RAM, the destination is always written word by word.
+ */
+#ifndef MEM_H__
+#define MEM_H__
+
+#include "Std_Types.h"
+
+void Mem_Copy( void *Dst, const void *Src, uint32 Length );
+void Mem_Set( void *Dst, uint8 Value, uint32 Length );
+sint32 Mem_Compare( const void *Ptr1, const void *Ptr2, uint32 Length );
+const uint8 *Mem_Find( const void *Ptr, uint8 Value, uint32 Length );
+void Mem_CopyToVolatile32( volatile uint32 *Dst, const void *Src, uint32 Length );
+void Mem_SetVolatile32( volatile uint32 *Dst, uint32 Value, uint32 Words );
+
+#endif /* MEM_H__ */
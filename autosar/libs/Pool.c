@@ -0,0 +1,271 @@
+/**
+ * @file    Pool.c
+ * @brief   **Fixed block memory pools**
+ *
+ * Each class keeps its free blocks as a stack of block indexes, so allocating is popping an index
+ * and freeing is pushing it back, nothing is written inside the free blocks and a buffer overrun
+ * by the user can not break the allocator. The block index of a pointer is found with a range
+ * check and a shift, since the block sizes are powers of two. The interrupts are masked with
+ * PRIMASK during the few instructions that update the stack and the counters, the Cortex-M0+ has
+ * no exclusive load/store instructions to do it lock free.
+ */
+#include "Std_Types.h"
+#include "Pool.h"
+#include "Pool_Cfg.h"
+#include "Bfx_32bits.h"
+
+/**
+ * @defgroup Pool_Values values used by the allocator
+ *
+ * @{ */
+#define POOL_SHIFT_8    3u      /*!< Bits to shift a block index to get the offset of a 8 bytes block */
+#define POOL_SHIFT_64   6u      /*!< Bits to shift a block index to get the offset of a 64 bytes block */
+#define POOL_SHIFT_256  8u      /*!< Bits to shift a block index to get the offset of a 256 bytes block */
+#define POOL_MAX_REFS   0xFFu   /*!< Largest number of owners of a block */
+#define POOL_MAX_FAILED 0xFFFFu /*!< Value where the failed requests counter stops */
+/**
+ * @} */
+
+/**
+ * @brief   **Size class control structure**
+ */
+typedef struct _Pool_ClassType
+{
+    uint8 *Storage;    /*!< Memory of the blocks */
+    uint8 *References; /*!< Number of owners of each block, zero when the block is free */
+    uint16 *FreeStack; /*!< Indexes of the free blocks, the last one is the next to allocate */
+    uint16 Blocks;     /*!< Number of blocks of the class */
+    uint8 SizeShift;   /*!< Block size as a power of two */
+    uint16 Free;       /*!< Number of indexes on the free stack */
+    uint16 HighWater;  /*!< Largest number of blocks allocated at the same time */
+    uint16 Failed;     /*!< Requests that found no free block */
+} Pool_ClassType;
+
+static uint32 Pool_Storage8[ ( POOL_BLOCKS_8 << POOL_SHIFT_8 ) / sizeof( uint32 ) ];
+static uint32 Pool_Storage64[ ( POOL_BLOCKS_64 << POOL_SHIFT_64 ) / sizeof( uint32 ) ];
+static uint32 Pool_Storage256[ ( POOL_BLOCKS_256 << POOL_SHIFT_256 ) / sizeof( uint32 ) ];
+
+static uint8 Pool_References8[ POOL_BLOCKS_8 ];
+static uint8 Pool_References64[ POOL_BLOCKS_64 ];
+static uint8 Pool_References256[ POOL_BLOCKS_256 ];
+
+static uint16 Pool_FreeStack8[ POOL_BLOCKS_8 ];
+static uint16 Pool_FreeStack64[ POOL_BLOCKS_64 ];
+static uint16 Pool_FreeStack256[ POOL_BLOCKS_256 ];
+
+/**
+ * @brief  Size classes from the smallest to the largest block
+ */
+static Pool_ClassType Pool_Classes[ POOL_CLASSES ] = {
+    { (uint8 *)Pool_Storage8, Pool_References8, Pool_FreeStack8, POOL_BLOCKS_8, POOL_SHIFT_8, 0u, 0u, 0u },
+    { (uint8 *)Pool_Storage64, Pool_References64, Pool_FreeStack64, POOL_BLOCKS_64, POOL_SHIFT_64, 0u, 0u, 0u },
+    { (uint8 *)Pool_Storage256, Pool_References256, Pool_FreeStack256, POOL_BLOCKS_256, POOL_SHIFT_256, 0u, 0u, 0u } };
+
+/**
+ * @brief   **Find the class and index of a block**
+ *
+ * The pointer shall be the start of a block of any class, a pointer to the middle of a block or
+ * outside the pools is rejected.
+ *
+ * @param   Block Pointer returned by Pool_Alloc
+ * @param   Index Returns the index of the block in its class
+ *
+ * @retval  Class of the block, NULL_PTR when the pointer is not a block
+ */
+static Pool_ClassType *Pool_Locate( const void *Block, uint16 *Index )
+{
+    Pool_ClassType *Class = NULL_PTR;
+
+    for( uint8 i = 0u; ( i < POOL_CLASSES ) && ( Class == NULL_PTR ); i++ )
+    {
+        /* cppcheck-suppress misra-c2012-11.4 ; the address is needed to compare with the pool range */
+        uint32_least Offset = (uint32_least)Block - (uint32_least)Pool_Classes[ i ].Storage;
+
+        /*a pointer below the storage wraps around to a large offset*/
+        if( ( Offset < ( (uint32_least)Pool_Classes[ i ].Blocks << Pool_Classes[ i ].SizeShift ) ) &&
+            ( ( Offset & ( ( (uint32_least)1u << Pool_Classes[ i ].SizeShift ) - 1u ) ) == 0u ) )
+        {
+            *Index = (uint16)( Offset >> Pool_Classes[ i ].SizeShift );
+            Class  = &Pool_Classes[ i ];
+        }
+    }
+
+    return Class;
+}
+
+/**
+ * @brief   **Initialize the pools**
+ *
+ * Sets every block as free and clears the statistics, shall be called before any other function
+ * of the library and with no block in use.
+ */
+void Pool_Init( void )
+{
+    for( uint8 i = 0u; i < POOL_CLASSES; i++ )
+    {
+        Pool_ClassType *Class = &Pool_Classes[ i ];
+
+        /*the lowest block is on top of the stack so it is the first one given*/
+        for( uint16 Block = 0u; Block < Class->Blocks; Block++ )
+        {
+            Class->FreeStack[ Block ]  = (uint16)( Class->Blocks - 1u - Block );
+            Class->References[ Block ] = 0u;
+        }
+        Class->Free      = Class->Blocks;
+        Class->HighWater = 0u;
+        Class->Failed    = 0u;
+    }
+}
+
+/**
+ * @brief   **Allocate a block**
+ *
+ * Takes a block from the smallest class that fits the requested size, when that class has no free
+ * blocks the next larger classes are tried. The block starts with a single owner and its content
+ * is not initialized. Can be called from interrupts.
+ *
+ * @param   Size Number of bytes needed, from 1 up to 256
+ *
+ * @retval  Pointer to the block, word aligned, NULL_PTR when the size is not valid or there is no
+ *          free block large enough
+ */
+void *Pool_Alloc( uint32 Size )
+{
+    void *Block = NULL_PTR;
+    uint8 First = POOL_CLASSES;
+
+    for( uint8 i = 0u; ( i < POOL_CLASSES ) && ( First == POOL_CLASSES ); i++ )
+    {
+        if( Size <= ( 1u << Pool_Classes[ i ].SizeShift ) )
+        {
+            First = i;
+        }
+    }
+
+    if( Size > 0u )
+    {
+        uint32 PriMask = Bfx_EnterAtomic_u32( );
+
+        for( uint8 i = First; ( i < POOL_CLASSES ) && ( Block == NULL_PTR ); i++ )
+        {
+            Pool_ClassType *Class = &Pool_Classes[ i ];
+
+            if( Class->Free > 0u )
+            {
+                uint16 Index = Class->FreeStack[ Class->Free - 1u ];
+                uint16 Used  = (uint16)( Class->Blocks - Class->Free ) + 1u;
+
+                Class->Free--;
+                Class->References[ Index ] = 1u;
+                Class->HighWater           = ( Used > Class->HighWater ) ? Used : Class->HighWater;
+                Block                      = &Class->Storage[ (uint32)Index << Class->SizeShift ];
+            }
+        }
+
+        if( ( Block == NULL_PTR ) && ( First < POOL_CLASSES ) && ( Pool_Classes[ First ].Failed < POOL_MAX_FAILED ) )
+        {
+            Pool_Classes[ First ].Failed++;
+        }
+        Bfx_ExitAtomic_u32( PriMask );
+    }
+
+    return Block;
+}
+
+/**
+ * @brief   **Add an owner to a block**
+ *
+ * Shall be called by each module that keeps a reference to a block it did not allocate, the block
+ * is not released until every owner calls Pool_Free. Can be called from interrupts.
+ *
+ * @param   Block Pointer returned by Pool_Alloc
+ *
+ * @retval  E_OK: owner added, E_NOT_OK: the pointer is not an allocated block or the block already
+ *          has 255 owners
+ */
+Std_ReturnType Pool_Retain( const void *Block )
+{
+    Std_ReturnType RetVal = E_NOT_OK;
+    uint16 Index          = 0u;
+    Pool_ClassType *Class = Pool_Locate( Block, &Index );
+
+    if( Class != NULL_PTR )
+    {
+        uint32 PriMask = Bfx_EnterAtomic_u32( );
+
+        if( ( Class->References[ Index ] != 0u ) && ( Class->References[ Index ] < POOL_MAX_REFS ) )
+        {
+            Class->References[ Index ]++;
+            RetVal = E_OK;
+        }
+        Bfx_ExitAtomic_u32( PriMask );
+    }
+
+    return RetVal;
+}
+
+/**
+ * @brief   **Remove an owner from a block**
+ *
+ * The block goes back to its pool when the last owner frees it. Can be called from interrupts.
+ *
+ * @param   Block Pointer returned by Pool_Alloc
+ *
+ * @retval  E_OK: owner removed, E_NOT_OK: the pointer is not an allocated block, a double free is
+ *          also rejected this way
+ */
+Std_ReturnType Pool_Free( const void *Block )
+{
+    Std_ReturnType RetVal = E_NOT_OK;
+    uint16 Index          = 0u;
+    Pool_ClassType *Class = Pool_Locate( Block, &Index );
+
+    if( Class != NULL_PTR )
+    {
+        uint32 PriMask = Bfx_EnterAtomic_u32( );
+
+        if( Class->References[ Index ] != 0u )
+        {
+            Class->References[ Index ]--;
+            if( Class->References[ Index ] == 0u )
+            {
+                Class->FreeStack[ Class->Free ] = Index;
+                Class->Free++;
+            }
+            RetVal = E_OK;
+        }
+        Bfx_ExitAtomic_u32( PriMask );
+    }
+
+    return RetVal;
+}
+
+/**
+ * @brief   **Usage statistics of a size class**
+ *
+ * Use the high water mark of each class to tune the number of blocks in Pool_Cfg.h.
+ *
+ * @param   Class Size class, one of the POOL_CLASS_x values
+ * @param   Stats Returns the statistics of the class
+ *
+ * @retval  E_OK: statistics returned, E_NOT_OK: invalid class or null pointer
+ */
+Std_ReturnType Pool_GetStats( uint8 Class, Pool_StatsType *Stats )
+{
+    Std_ReturnType RetVal = E_NOT_OK;
+
+    if( ( Class < POOL_CLASSES ) && ( Stats != NULL_PTR ) )
+    {
+        uint32 PriMask = Bfx_EnterAtomic_u32( );
+
+        Stats->BlockSize = 1u << Pool_Classes[ Class ].SizeShift;
+        Stats->Blocks    = Pool_Classes[ Class ].Blocks;
+        Stats->Used      = (uint16)( Pool_Classes[ Class ].Blocks - Pool_Classes[ Class ].Free );
+        Stats->HighWater = Pool_Classes[ Class ].HighWater;
+        Stats->Failed    = Pool_Classes[ Class ].Failed;
+        Bfx_ExitAtomic_u32( PriMask );
+        RetVal = E_OK;
+    }
+
+    return RetVal;
+}
@@ -0,0 +1,53 @@
+/**
+ * @file    Pool.h
+ * @brief   **Fixed block memory pools**
+ *
+ * Allocator for the buffers of the upper layers, the memory is split in three classes of fixed
+ * size blocks (8, 64 and 256 bytes) and the number of blocks of each class is set in Pool_Cfg.h.
+ * A request is served from the smallest class that fits and has a free block, allocation and
+ * release take constant time and are safe to call from interrupts, each one masks the interrupts
+ * for a few instructions.
+ *
+ * Each block has a reference counter, so a buffer can be passed by reference from one module to
+ * another (e.g. from CanIf to Spi) instead of copying it, each module that keeps the buffer calls
+ * Pool_Retain and every owner calls Pool_Free when done, the block goes back to its pool when the
+ * last owner frees it.
+ *
+ * No module uses the pools yet, so Pool.c is not part of the default SRCS of the makefile and its
+ * storage takes no RAM, add it to SRCS along with the first consumer.
+ */
+#ifndef POOL_H__
+#define POOL_H__
+
+#include "Std_Types.h"
+
+/**
+ * @defgroup Pool_Classes size classes
+ *
+ * @{ */
+#define POOL_CLASS_8   0u /*!< Class of 8 bytes blocks */
+#define POOL_CLASS_64  1u /*!< Class of 64 bytes blocks */
+#define POOL_CLASS_256 2u /*!< Class of 256 bytes blocks */
+#define POOL_CLASSES   3u /*!< Number of size classes */
+/**
+ * @} */
+
+/**
+ * @brief   **Usage statistics of a size class**
+ */
+typedef struct _Pool_StatsType
+{
+    uint32 BlockSize; /*!< Size of each block in bytes */
+    uint16 Blocks;    /*!< Number of blocks on the class */
+    uint16 Used;      /*!< Blocks allocated at this moment */
+    uint16 HighWater; /*!< Largest number of blocks allocated at the same time since init */
+    uint16 Failed;    /*!< Requests that fit this class but found no free block on it or above */
+} Pool_StatsType;
+
+void Pool_Init( void );
+void *Pool_Alloc( uint32 Size );
+Std_ReturnType Pool_Retain( const void *Block );
+Std_ReturnType Pool_Free( const void *Block );
+Std_ReturnType Pool_GetStats( uint8 Class, Pool_StatsType *Stats );
+
+#endif /* POOL_H__ */
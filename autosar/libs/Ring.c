@@ -0,0 +1,274 @@
+/**
+ * @file    Ring.c
+ * @brief   **Single producer single consumer ring buffer**
+ *
+ * Each side reads its own index with a plain access, since nobody else writes it, and the index of
+ * the other side with an acquire load. The index it owns is only updated once per call, after the
+ * elements have been copied, with a release store. The elements are copied with Mem_Copy and a
+ * batch is moved with at most two copies, one up to the end of the storage and another from the
+ * beginning when the ring wraps around.
+ */
+#include "Std_Types.h"
+#include "Ring.h"
+#include "Mem.h"
+
+/**
+ * @defgroup Ring_Ordering index accesses between the producer and the consumer
+ *
+ * On the Cortex-M0+ the acquire load is a LDR followed by a DMB and the release store a DMB
+ * followed by a STR, on a single core the DMB only costs a few cycles but it is also what keeps
+ * the compiler from reordering the element accesses with the index access.
+ *
+ * @{ */
+#define RING_LOAD_ACQUIRE( Index )         __atomic_load_n( &( Index ), __ATOMIC_ACQUIRE )           /*!< Read the index written by the other side */
+#define RING_STORE_RELEASE( Index, Value ) __atomic_store_n( &( Index ), ( Value ), __ATOMIC_RELEASE ) /*!< Publish the index owned by this side */
+/**
+ * @} */
+
+#define RING_MAX_ELEMENTS 0x80000000u /*!< Largest number of elements, so Head - Tail never overflows */
+
+/**
+ * @brief   **Number of consecutive slots from an index**
+ *
+ * Limits the number of slots available from the given free running index to the ones left before
+ * the end of the storage.
+ *
+ * @param   Ring Ring buffer
+ * @param   Index Free running index of the first slot
+ * @param   Available Number of slots available from the index
+ *
+ * @retval  Number of slots that can be accessed without wrapping around
+ */
+static uint32 Ring_Contiguous( const Ring_BufferType *Ring, uint32 Index, uint32 Available )
+{
+    uint32 ToEnd = ( Ring->Mask + 1u ) - ( Index & Ring->Mask );
+
+    return ( Available < ToEnd ) ? Available : ToEnd;
+}
+
+/**
+ * @brief   **Initialize a ring buffer**
+ *
+ * Sets the ring as empty over the given storage, shall be called before the producer and the
+ * consumer start to use it.
+ *
+ * @param   Ring Ring buffer to initialize
+ * @param   Storage Memory for the elements, with room for Elements * ElementSize bytes
+ * @param   Elements Number of elements, shall be a power of two
+ * @param   ElementSize Size of each element in bytes
+ *
+ * @retval  E_OK: Ring initialized, E_NOT_OK: a null pointer, a size of zero or a number of elements
+ *          that is not a power of two
+ */
+Std_ReturnType Ring_Init( Ring_BufferType *Ring, void *Storage, uint32 Elements, uint32 ElementSize )
+{
+    Std_ReturnType RetVal = E_NOT_OK;
+
+    if( ( Ring != NULL_PTR ) && ( Storage != NULL_PTR ) && ( ElementSize != 0u ) &&
+        ( Elements != 0u ) && ( Elements <= RING_MAX_ELEMENTS ) && ( ( Elements & ( Elements - 1u ) ) == 0u ) )
+    {
+        Ring->Storage     = (uint8 *)Storage;
+        Ring->Mask        = Elements - 1u;
+        Ring->ElementSize = ElementSize;
+        Ring->Head        = 0u;
+        Ring->Tail        = 0u;
+        RetVal            = E_OK;
+    }
+
+    return RetVal;
+}
+
+/**
+ * @brief   **Number of elements stored**
+ *
+ * Can be called from either side, the value may be already outdated when the other side is
+ * running, it is only a lower bound for the consumer and an upper bound for the producer.
+ *
+ * @param   Ring Ring buffer
+ *
+ * @retval  Number of elements that can be popped
+ */
+uint32 Ring_GetCount( const Ring_BufferType *Ring )
+{
+    uint32 Tail = RING_LOAD_ACQUIRE( Ring->Tail );
+
+    return RING_LOAD_ACQUIRE( Ring->Head ) - Tail;
+}
+
+/**
+ * @brief   **Number of free slots**
+ *
+ * Can be called from either side, same as Ring_GetCount the value may be already outdated.
+ *
+ * @param   Ring Ring buffer
+ *
+ * @retval  Number of elements that can be pushed
+ */
+uint32 Ring_GetFree( const Ring_BufferType *Ring )
+{
+    return ( Ring->Mask + 1u ) - Ring_GetCount( Ring );
+}
+
+/**
+ * @brief   **Push one element**
+ *
+ * Producer side only.
+ *
+ * @param   Ring Ring buffer
+ * @param   Element Element to copy into the ring
+ *
+ * @retval  TRUE: element pushed, FALSE: the ring is full
+ */
+boolean Ring_Push( Ring_BufferType *Ring, const void *Element )
+{
+    return ( Ring_PushBatch( Ring, Element, 1u ) == 1u ) ? TRUE : FALSE;
+}
+
+/**
+ * @brief   **Pop one element**
+ *
+ * Consumer side only.
+ *
+ * @param   Ring Ring buffer
+ * @param   Element Where to copy the oldest element
+ *
+ * @retval  TRUE: element popped, FALSE: the ring is empty
+ */
+boolean Ring_Pop( Ring_BufferType *Ring, void *Element )
+{
+    return ( Ring_PopBatch( Ring, Element, 1u ) == 1u ) ? TRUE : FALSE;
+}
+
+/**
+ * @brief   **Push several elements**
+ *
+ * Producer side only. Copies as many elements as fit and makes all of them visible to the consumer
+ * at once, with a single update of the index.
+ *
+ * @param   Ring Ring buffer
+ * @param   Elements Array of elements to copy into the ring
+ * @param   Count Number of elements on the array
+ *
+ * @retval  Number of elements pushed, from zero up to Count
+ */
+uint32 Ring_PushBatch( Ring_BufferType *Ring, const void *Elements, uint32 Count )
+{
+    uint32 Head  = Ring->Head;
+    uint32 Free  = ( Ring->Mask + 1u ) - ( Head - RING_LOAD_ACQUIRE( Ring->Tail ) );
+    uint32 Total = ( Count < Free ) ? Count : Free;
+    uint32 First = Ring_Contiguous( Ring, Head, Total );
+
+    Mem_Copy( &Ring->Storage[ ( Head & Ring->Mask ) * Ring->ElementSize ], Elements, First * Ring->ElementSize );
+    Mem_Copy( Ring->Storage, &( (const uint8 *)Elements )[ First * Ring->ElementSize ], ( Total - First ) * Ring->ElementSize );
+    RING_STORE_RELEASE( Ring->Head, Head + Total );
+
+    return Total;
+}
+
+/**
+ * @brief   **Pop several elements**
+ *
+ * Consumer side only. Copies as many elements as available and frees all their slots at once, with
+ * a single update of the index.
+ *
+ * @param   Ring Ring buffer
+ * @param   Elements Array where to copy the elements, oldest first
+ * @param   Count Number of elements the array can take
+ *
+ * @retval  Number of elements popped, from zero up to Count
+ */
+uint32 Ring_PopBatch( Ring_BufferType *Ring, void *Elements, uint32 Count )
+{
+    uint32 Tail  = Ring->Tail;
+    uint32 Used  = RING_LOAD_ACQUIRE( Ring->Head ) - Tail;
+    uint32 Total = ( Count < Used ) ? Count : Used;
+    uint32 First = Ring_Contiguous( Ring, Tail, Total );
+
+    Mem_Copy( Elements, &Ring->Storage[ ( Tail & Ring->Mask ) * Ring->ElementSize ], First * Ring->ElementSize );
+    Mem_Copy( &( (uint8 *)Elements )[ First * Ring->ElementSize ], Ring->Storage, ( Total - First ) * Ring->ElementSize );
+    RING_STORE_RELEASE( Ring->Tail, Tail + Total );
+
+    return Total;
+}
+
+/**
+ * @brief   **Reserve free slots to write in place**
+ *
+ * Producer side only. Gives access to the free slots after the last element pushed, up to the end
+ * of the storage, the slots are not visible to the consumer until Ring_Commit is called. When more
+ * slots are needed after a wrap around, commit the first ones and reserve again.
+ *
+ * @param   Ring Ring buffer
+ * @param   Count Returns the number of consecutive slots available
+ *
+ * @retval  Pointer to the first free slot, NULL_PTR when the ring is full
+ */
+void *Ring_Reserve( Ring_BufferType *Ring, uint32 *Count )
+{
+    uint32 Head  = Ring->Head;
+    uint32 Free  = ( Ring->Mask + 1u ) - ( Head - RING_LOAD_ACQUIRE( Ring->Tail ) );
+    void *Slots  = NULL_PTR;
+
+    *Count = Ring_Contiguous( Ring, Head, Free );
+    if( *Count > 0u )
+    {
+        Slots = &Ring->Storage[ ( Head & Ring->Mask ) * Ring->ElementSize ];
+    }
+
+    return Slots;
+}
+
+/**
+ * @brief   **Push the slots written in place**
+ *
+ * Producer side only. Makes visible to the consumer the first Count slots given by the last call
+ * to Ring_Reserve.
+ *
+ * @param   Ring Ring buffer
+ * @param   Count Number of slots written, shall not be larger than the number reserved
+ */
+void Ring_Commit( Ring_BufferType *Ring, uint32 Count )
+{
+    RING_STORE_RELEASE( Ring->Head, Ring->Head + Count );
+}
+
+/**
+ * @brief   **Access the stored elements in place**
+ *
+ * Consumer side only. Gives access to the oldest elements, up to the end of the storage, the slots
+ * are not given back to the producer until Ring_Release is called. When more elements are needed
+ * after a wrap around, release the first ones and peek again.
+ *
+ * @param   Ring Ring buffer
+ * @param   Count Returns the number of consecutive elements available
+ *
+ * @retval  Pointer to the oldest element, NULL_PTR when the ring is empty
+ */
+const void *Ring_Peek( Ring_BufferType *Ring, uint32 *Count )
+{
+    uint32 Tail       = Ring->Tail;
+    uint32 Used       = RING_LOAD_ACQUIRE( Ring->Head ) - Tail;
+    const void *Slots = NULL_PTR;
+
+    *Count = Ring_Contiguous( Ring, Tail, Used );
+    if( *Count > 0u )
+    {
+        Slots = &Ring->Storage[ ( Tail & Ring->Mask ) * Ring->ElementSize ];
+    }
+
+    return Slots;
+}
+
+/**
+ * @brief   **Pop the elements accessed in place**
+ *
+ * Consumer side only. Gives back to the producer the first Count slots given by the last call to
+ * Ring_Peek.
+ *
+ * @param   Ring Ring buffer
+ * @param   Count Number of elements consumed, shall not be larger than the number peeked
+ */
+void Ring_Release( Ring_BufferType *Ring, uint32 Count )
+{
+    RING_STORE_RELEASE( Ring->Tail, Ring->Tail + Count );
+}
@@ -0,0 +1,54 @@
+/**
+ * @file    Ring.h
+ * @brief   **Single producer single consumer ring buffer**
+ *
+ * Lock free queue of fixed size elements to move data from one context to another, typically
+ * from an interrupt to a task or the other way around, without masking the interrupts. Only one
+ * context can push and only one context can pop on the same ring, the producer only writes Head
+ * and the consumer only writes Tail, both are free running counters, so the number of elements
+ * stored is always Head - Tail and no slot is wasted to tell a full ring from an empty one.
+ *
+ * Memory ordering: the producer writes the elements and then publishes the new Head with release
+ * semantics, the consumer reads Head with acquire semantics before reading the elements, and the
+ * same the other way around with Tail when the consumer frees the slots. On the Cortex-M0+ the
+ * loads and stores of an aligned word are atomic and the release/acquire operations are a DMB
+ * next to them, which also keeps the compiler from moving the element accesses across the index
+ * update.
+ *
+ * Besides the single element and batch functions, Ring_Reserve/Ring_Commit and
+ * Ring_Peek/Ring_Release give direct access to the slots to avoid a copy, they return the number
+ * of consecutive slots available before the end of the storage, so a caller may need to call
+ * them twice when the ring wraps around.
+ */
+#ifndef RING_H__
+#define RING_H__
+
+#include "Std_Types.h"
+
+/**
+ * @brief   **Ring buffer control structure**
+ *
+ * Set by Ring_Init, the storage shall have room for Elements * ElementSize bytes.
+ */
+typedef struct _Ring_BufferType
+{
+    uint8 *Storage;     /*!< Memory to store the elements */
+    uint32 Mask;        /*!< Number of elements minus one, the number of elements is a power of two */
+    uint32 ElementSize; /*!< Size of each element in bytes */
+    uint32 Head;        /*!< Elements pushed since init, only written by the producer */
+    uint32 Tail;        /*!< Elements popped since init, only written by the consumer */
+} Ring_BufferType;
+
+Std_ReturnType Ring_Init( Ring_BufferType *Ring, void *Storage, uint32 Elements, uint32 ElementSize );
+uint32 Ring_GetCount( const Ring_BufferType *Ring );
+uint32 Ring_GetFree( const Ring_BufferType *Ring );
+boolean Ring_Push( Ring_BufferType *Ring, const void *Element );
+boolean Ring_Pop( Ring_BufferType *Ring, void *Element );
+uint32 Ring_PushBatch( Ring_BufferType *Ring, const void *Elements, uint32 Count );
+uint32 Ring_PopBatch( Ring_BufferType *Ring, void *Elements, uint32 Count );
+void *Ring_Reserve( Ring_BufferType *Ring, uint32 *Count );
+void Ring_Commit( Ring_BufferType *Ring, uint32 Count );
+const void *Ring_Peek( Ring_BufferType *Ring, uint32 *Count );
+void Ring_Release( Ring_BufferType *Ring, uint32 Count );
+
+#endif /* RING_H__ */
@@ -50,6 +50,26 @@ CAN_STATIC Can_HwUnit HwUnit =
 };
 /* clang-format on */
 
+/**
+ * @brief    **Check the length of a message to send**
+ *
+ * The length shall not be more than 64 bytes, and not more than 8 bytes unless the controller is
+ * in CAN FD mode and the CAN FD flag is set in the message id.
+ *
+ * @param    Hth Hardware transmit handle of the message
+ * @param    PduInfo Message to check
+ *
+ * @retval  TRUE: valid length, FALSE: invalid length
+ */
+static boolean Can_IsValidDataLength( Can_HwHandleType Hth, const Can_PduType *PduInfo )
+{
+    uint8 FdFlag  = Bfx_GetBit_u32u8_u8( PduInfo->id, 30u );
+    uint32 FdMode = HwUnit.Config->Hohs[ Hth ].ControllerRef->FrameFormat;
+
+    return ( ( PduInfo->length > 64u ) || ( ( PduInfo->length > 8u ) && ( FdMode == CAN_FRAME_CLASSIC ) ) ||
+             ( ( PduInfo->length > 8u ) && ( FdMode != CAN_FRAME_CLASSIC ) && ( FdFlag == STD_OFF ) ) ) ? FALSE : TRUE;
+}
+
 /**
  * @brief    **Can Initialization**
  *
@@ -77,6 +97,8 @@ void Can_Init( const Can_ConfigType *Config )
             Can_Arch_Init( &HwUnit, Config, Controller );
             /*set configured state*/
             HwUnit.ControllerState[ Controller ] = CAN_CS_STOPPED;
+            /*the initial state is not indicated to the upper layer*/
+            HwUnit.ModeIndicated[ Controller ] = CAN_CS_STOPPED;
         }
 
         /*update Hardware init state*/
@@ -752,32 +774,198 @@ Std_ReturnType Can_Write( Can_HwHandleType Hth, const Can_PduType *PduInfo )
         Can_Write() shall raise CAN_E_PARAM_POINTER if the parameter PduInfo is a null pointer */
         Det_ReportError( CAN_MODULE_ID, CAN_INSTANCE_ID, CAN_ID_WRITE, CAN_E_PARAM_POINTER );
     }
+    else if( Can_IsValidDataLength( Hth, PduInfo ) == FALSE )
+    {
+        /* The function Can_Write if development error detection for the CAN module is enabled shall
+        raise the error CAN_E_PARAM_DATA_LENGTH:
+         - If the length is more than 64 byte.
+         - If the length is more than 8 byte and the CAN controller is not in CAN FD mode (no
+           CanControllerFdBaudrateConfig).
+         - If the length is more than 8 byte and the CAN controller is in CAN FD mode (valid
+           CanControllerFdBaudrateConfig), but the CAN FD flag in Can_PduType->id is not set (refer
+           CAN_MODULE_ID Type) */
+        Det_ReportError( CAN_MODULE_ID, CAN_INSTANCE_ID, CAN_ID_WRITE, CAN_E_PARAM_DATA_LENGTH );
+    }
+    else
+    {
+        /* Enable the slected interrupts to their corresponding interrupt lines */
+        ReturnValue = Can_Arch_Write( &HwUnit, Hth, PduInfo );
+    }
+
+    return ReturnValue;
+}
+
+/**
+ * @brief    **Can Write Batch**
+ *
+ * This function passes several CAN messages to CanDrv for transmission in the same call, the
+ * messages are written to as many free hardware transmit buffers as there are and their
+ * transmission is requested at once, so the controller sends the burst back to back. The messages
+ * are taken in order, the ones not accepted can be passed again later. This is not an AUTOSAR
+ * service, each message is checked like on Can_Write and the first one with an invalid length
+ * stops the batch.
+ *
+ * @param    Hth information which HW-transmit handle shall be used for transmit. Implicitly this
+ *                  is also the information about the controller to use because the Hth numbers
+ *                  are unique inside one hardware unit.
+ * @param    PduInfo Array of messages with their SDU user memory, Data Length and Identifier
+ * @param    Count Number of messages on the array
+ *
+ * @retval  Number of messages accepted from the beginning of the array, zero when a development
+ *          error occurred or no TX hardware buffer is available
+ */
+uint8 Can_WriteBatch( Can_HwHandleType Hth, const Can_PduType *PduInfo, uint8 Count )
+{
+    uint8 Accepted = 0u;
+
+    if( HwUnit.HwUnitState == CAN_CS_UNINIT )
+    {
+        /* If development error detection for the Can module is enabled:
+        The function Can_WriteBatch shall raise the error CAN_E_UNINIT if the driver is not yet
+        initialized */
+        Det_ReportError( CAN_MODULE_ID, CAN_INSTANCE_ID, CAN_ID_WRITE_BATCH, CAN_E_UNINIT );
+    }
+    else if( HwUnit.Config->Hohs[ Hth ].ObjectType != CAN_HOH_TYPE_TRANSMIT )
+    {
+        /* If development error detection for the Can module is enabled:
+        The function Can_WriteBatch shall raise the error CAN_E_PARAM_HANDLE if the parameter Hth is
+        not a configured Hardware Transmit Handle */
+        Det_ReportError( CAN_MODULE_ID, CAN_INSTANCE_ID, CAN_ID_WRITE_BATCH, CAN_E_PARAM_HANDLE );
+    }
+    else if( PduInfo == NULL_PTR )
+    {
+        /* If development error detection for CanDrv is enabled:
+        Can_WriteBatch() shall raise CAN_E_PARAM_POINTER if the parameter PduInfo is a null pointer */
+        Det_ReportError( CAN_MODULE_ID, CAN_INSTANCE_ID, CAN_ID_WRITE_BATCH, CAN_E_PARAM_POINTER );
+    }
     else
     {
-        uint8 FdFlag  = Bfx_GetBit_u32u8_u8( PduInfo->id, 30u );
-        uint32 FdMode = HwUnit.Config->Hohs[ Hth ].ControllerRef->FrameFormat;
+        uint8 Valid = 0u;
 
-        if( ( PduInfo->length > 64u ) || ( ( PduInfo->length > 8u ) && ( FdMode == CAN_FRAME_CLASSIC ) ) ||
-            ( ( PduInfo->length > 8u ) && ( FdMode != CAN_FRAME_CLASSIC ) && ( FdFlag == STD_OFF ) ) )
+        /* Only the messages before the first one with an invalid length are passed */
+        while( ( Valid < Count ) && ( Can_IsValidDataLength( Hth, &PduInfo[ Valid ] ) == TRUE ) )
         {
-            /* The function Can_Write if development error detection for the CAN module is enabled shall
-            raise the error CAN_E_PARAM_DATA_LENGTH:
-             - If the length is more than 64 byte.
-             - If the length is more than 8 byte and the CAN controller is not in CAN FD mode (no
-               CanControllerFdBaudrateConfig).
-             - If the length is more than 8 byte and the CAN controller is in CAN FD mode (valid
-               CanControllerFdBaudrateConfig), but the CAN FD flag in Can_PduType->id is not set (refer
-               CAN_MODULE_ID Type) */
-            Det_ReportError( CAN_MODULE_ID, CAN_INSTANCE_ID, CAN_ID_WRITE, CAN_E_PARAM_DATA_LENGTH );
+            Valid++;
         }
-        else
+
+        if( Valid < Count )
+        {
+            /* If development error detection for CanDrv is enabled:
+            Can_WriteBatch() shall raise CAN_E_PARAM_DATA_LENGTH for the same lengths as Can_Write */
+            Det_ReportError( CAN_MODULE_ID, CAN_INSTANCE_ID, CAN_ID_WRITE_BATCH, CAN_E_PARAM_DATA_LENGTH );
+        }
+
+        if( Valid > 0u )
         {
-            /* Enable the slected interrupts to their corresponding interrupt lines */
-            ReturnValue = Can_Arch_Write( &HwUnit, Hth, PduInfo );
+            Accepted = Can_Arch_WriteBatch( &HwUnit, Hth, PduInfo, Valid );
         }
     }
 
-    return ReturnValue;
+    return Accepted;
+}
+
+/**
+ * @brief    **Can Main Function Write**
+ *
+ * This function performs the polling of the transmit confirmations of the controllers configured
+ * with polled transmission, a bounded number of confirmations are given on each call.
+ *
+ * @reqs    SWS_Can_00225, SWS_Can_00031, SWS_Can_00179
+ */
+void Can_MainFunction_Write( void )
+{
+    if( HwUnit.HwUnitState == CAN_CS_UNINIT )
+    {
+        /* If development error detection for the module Can is enabled:
+        The function Can_MainFunction_Write shall raise the error CAN_E_UNINIT if the driver is not
+        yet initialized */
+        Det_ReportError( CAN_MODULE_ID, CAN_INSTANCE_ID, CAN_ID_MF_WRITE, CAN_E_UNINIT );
+    }
+    else
+    {
+        for( uint8 Controller = 0; Controller < CAN_NUMBER_OF_CONTROLLERS; Controller++ )
+        {
+            Can_Arch_MainFunction_Write( &HwUnit, Controller );
+        }
+    }
+}
+
+/**
+ * @brief    **Can Main Function Read**
+ *
+ * This function performs the polling of the received messages of the controllers configured with
+ * polled reception, a bounded number of messages are read on each call.
+ *
+ * @reqs    SWS_Can_00226, SWS_Can_00108, SWS_Can_00181
+ */
+void Can_MainFunction_Read( void )
+{
+    if( HwUnit.HwUnitState == CAN_CS_UNINIT )
+    {
+        /* If development error detection for the module Can is enabled:
+        The function Can_MainFunction_Read shall raise the error CAN_E_UNINIT if the driver is not
+        yet initialized */
+        Det_ReportError( CAN_MODULE_ID, CAN_INSTANCE_ID, CAN_ID_MF_READ, CAN_E_UNINIT );
+    }
+    else
+    {
+        for( uint8 Controller = 0; Controller < CAN_NUMBER_OF_CONTROLLERS; Controller++ )
+        {
+            Can_Arch_MainFunction_Read( &HwUnit, Controller );
+        }
+    }
+}
+
+/**
+ * @brief    **Can Main Function Bus Off**
+ *
+ * This function performs the polling of the bus off events of the controllers configured with
+ * polled bus off processing.
+ *
+ * @reqs    SWS_Can_00227, SWS_Can_00109, SWS_Can_00184
+ */
+void Can_MainFunction_BusOff( void )
+{
+    if( HwUnit.HwUnitState == CAN_CS_UNINIT )
+    {
+        /* If development error detection for the module Can is enabled:
+        The function Can_MainFunction_BusOff shall raise the error CAN_E_UNINIT if the driver is not
+        yet initialized */
+        Det_ReportError( CAN_MODULE_ID, CAN_INSTANCE_ID, CAN_ID_MF_BUSOFF, CAN_E_UNINIT );
+    }
+    else
+    {
+        for( uint8 Controller = 0; Controller < CAN_NUMBER_OF_CONTROLLERS; Controller++ )
+        {
+            Can_Arch_MainFunction_BusOff( &HwUnit, Controller );
+        }
+    }
+}
+
+/**
+ * @brief    **Can Main Function Mode**
+ *
+ * This function performs the polling of the controller mode transitions and indicates them to the
+ * upper layer.
+ *
+ * @reqs    SWS_Can_00368, SWS_Can_00369, SWS_Can_00379
+ */
+void Can_MainFunction_Mode( void )
+{
+    if( HwUnit.HwUnitState == CAN_CS_UNINIT )
+    {
+        /* If development error detection for the module Can is enabled:
+        The function Can_MainFunction_Mode shall raise the error CAN_E_UNINIT if the driver is not
+        yet initialized */
+        Det_ReportError( CAN_MODULE_ID, CAN_INSTANCE_ID, CAN_ID_MF_MODE, CAN_E_UNINIT );
+    }
+    else
+    {
+        for( uint8 Controller = 0; Controller < CAN_NUMBER_OF_CONTROLLERS; Controller++ )
+        {
+            Can_Arch_MainFunction_Mode( &HwUnit, Controller );
+        }
+    }
 }
 
 #if CAN_VERSION_INFO_API == STD_ON /* cppcheck-suppress misra-c2012-20.9 ; it is necesary to use a define for this function */
@@ -29,6 +29,11 @@ Std_ReturnType Can_GetControllerMode( uint8 Controller, Can_ControllerStateType
 Std_ReturnType Can_GetControllerRxErrorCounter( uint8 ControllerId, uint8 *RxErrorCounterPtr );
 Std_ReturnType Can_GetControllerTxErrorCounter( uint8 ControllerId, uint8 *TxErrorCounterPtr );
 Std_ReturnType Can_Write( Can_HwHandleType Hth, const Can_PduType *PduInfo );
+uint8 Can_WriteBatch( Can_HwHandleType Hth, const Can_PduType *PduInfo, uint8 Count );
+void Can_MainFunction_Write( void );
+void Can_MainFunction_Read( void );
+void Can_MainFunction_BusOff( void );
+void Can_MainFunction_Mode( void );
 #if CAN_VERSION_INFO_API == STD_ON /* cppcheck-suppress misra-c2012-20.9 ; it is necesary to use a define for this function */
 void Can_GetVersionInfo( Std_VersionInfoType *versioninfo );
 #endif
@@ -13,8 +13,18 @@
 #include "Can_Cfg.h"
 #include "Can_Arch.h"
 #include "Bfx.h"
+#include "Mem.h"
+#include "Nvic.h"
+#include "SchM.h"
 #include "CanIf_Can.h"
 
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Can_Cfg.h */
+#if CAN_RAM_FUNCTIONS == STD_ON
+#define CAN_RAMFUNC RAMFUNC /*!< Hot functions executed from RAM */
+#else
+#define CAN_RAMFUNC /*!< Hot functions executed from flash */
+#endif
+
 /* cppcheck-suppress misra-c2012-20.9 ; this is declared at Can_Cfg.h */
 #if CAN_DEV_ERROR_DETECT == STD_OFF
 /**
@@ -150,6 +160,7 @@
  * @{ */
 #define TXFQS_TFQF_BIT       20u /*!< Tx FIFO/Queue Full */
 #define TXFQS_TFQPI_BIT      16u /*!< Tx FIFO/Queue Put Index */
+#define TXFQS_TFFL_BIT       0u  /*!< Tx FIFO Free Level */
 /**
  * @} */
 
@@ -158,6 +169,7 @@
  *
  * @{ */
 #define TXFQS_TFQPI_SIZE     2u /*!< Tx FIFO/Queue Put Index bitfiled size*/
+#define TXFQS_TFFL_SIZE      3u /*!< Tx FIFO Free Level bitfiled size*/
 /**
  * @} */
 
@@ -197,6 +209,42 @@
 /**
  * @} */
 
+/**
+ * @brief  Number of elements on each Rx FIFO in the message RAM
+ */
+#define RX_FIFO_ELEMENTS     3u
+
+/**
+ * @brief  Number of Tx buffers of the Tx FIFO/Queue in the message RAM
+ */
+#define TX_FIFO_ELEMENTS     3u
+
+/**
+ * @defgroup Isr_handlers interrupt flags with a service routine
+ *
+ * @{ */
+#define CAN_ISR_HANDLERS      23u         /*!< Flags from bit 0 to bit 22 of the IR register */
+#define CAN_ISR_HANDLERS_MASK 0x007FFFFFu /*!< IR flags served by the interrupt handler */
+#define IR_RF0N_BIT           0u          /*!< Rx FIFO 0 new message flag */
+#define IR_RF1N_BIT           3u          /*!< Rx FIFO 1 new message flag */
+#define CAN_ISR_LINE0         0u          /*!< Interrupt line 0, vector shared with TIM16 */
+#define CAN_ISR_LINE1         1u          /*!< Interrupt line 1, vector shared with TIM17 */
+#define CAN_ISR_LINES         2u          /*!< Number of interrupt lines */
+#define CAN_ISR_GROUPS        7u          /*!< Interrupt groups routed by the ILS register */
+#define CAN_ISR_GROUPS_MASK   0x0000007Fu /*!< ILS bits with an interrupt group */
+/**
+ * @} */
+
+/**
+ * @defgroup Polled_interrupts interrupts left disabled when its events are polled
+ *
+ * @{ */
+#define CAN_IT_POLLED_RX     ( CAN_IT_RX_FIFO0_FULL | CAN_IT_RX_FIFO0_NEW_MESSAGE | CAN_IT_RX_FIFO1_FULL | CAN_IT_RX_FIFO1_NEW_MESSAGE ) /*!< Reception */
+#define CAN_IT_POLLED_TX     ( CAN_IT_TX_COMPLETE | CAN_IT_TX_FIFO_EMPTY | CAN_IT_TX_EVT_FIFO_NEW_DATA | CAN_IT_TX_EVT_FIFO_FULL )            /*!< Tx confirmation */
+#define CAN_IT_POLLED_BUSOFF ( CAN_IT_BUS_OFF )                                                                                             /*!< Bus off */
+/**
+ * @} */
+
 /**
  * @defgroup PSRs_bits PSR register bits
  *
@@ -247,6 +295,15 @@
 /**
  * @} */
 
+/**
+ * @defgroup TX_Buffer_payload TX Buffer payload sizes
+ *
+ * @{ */
+#define TX_PAYLOAD_WORD_SIZE 4u /*!< Bytes on each word of the payload */
+#define TX_PAYLOAD_CLASSIC   8u /*!< Largest payload written without the Mem routines */
+/**
+ * @} */
+
 /**
  * @defgroup RX_Buffer_bits RX Buffer header register bits
  *
@@ -322,18 +379,29 @@
  */
 typedef struct _HwObjectHandler
 {
-    uint32 ObjHeader1;       /*!< Tx Buffer Standard Address Header 1 */
-    uint32 ObjHeader2;       /*!< Tx Buffer Standard Address Header 2 */
-    uint32 ObjPayload[ 16 ]; /*!< Tx Buffer Standard Address Payload */
+    volatile uint32 ObjHeader1;       /*!< Tx Buffer Standard Address Header 1 */
+    volatile uint32 ObjHeader2;       /*!< Tx Buffer Standard Address Header 2 */
+    volatile uint32 ObjPayload[ 16 ]; /*!< Tx Buffer Standard Address Payload */
 } HwObjectHandler;
 
+/**
+ * @brief  Tx element built before writing it to the message RAM.
+ */
+typedef struct _HwTxHeader
+{
+    uint32 Header1;     /*!< Tx Buffer Header 1, identifier */
+    uint32 Header2;     /*!< Tx Buffer Header 2, message marker, frame format and data length */
+    uint8 Bytes;        /*!< Bytes of the data length, payload plus padding */
+    uint8 PaddingValue; /*!< Value for the bytes after the payload */
+} HwTxHeader;
+
 /**
  * @brief  Extended Filter descriptor.
  */
 typedef struct _HwExtFilter
 {
-    uint32 ExtFilterHeader1; /*!< Extended Filter Standard Address Header 1 */
-    uint32 ExtFilterHeader2; /*!< Extended Filter Standard Address Header 2 */
+    volatile uint32 ExtFilterHeader1; /*!< Extended Filter Standard Address Header 1 */
+    volatile uint32 ExtFilterHeader2; /*!< Extended Filter Standard Address Header 2 */
 } HwExtFilter;
 
 /**
@@ -366,6 +434,19 @@ static SramCan_RegisterType *SramCanPeripherals[] = { SRAMCAN1, SRAMCAN2 };
  */
 static const uint8 DlcToBytes[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 12, 16, 20, 24, 32, 48, 64 };
 
+/**
+ * @brief  Closest FD data length code of a payload, indexed by its length in words rounded up.
+ */
+/* clang-format off */
+static const uint8 WordsToDlc[] =
+{
+    CAN_OBJECT_PL_8,  CAN_OBJECT_PL_8,  CAN_OBJECT_PL_8,  CAN_OBJECT_PL_12, CAN_OBJECT_PL_16,
+    CAN_OBJECT_PL_20, CAN_OBJECT_PL_24, CAN_OBJECT_PL_32, CAN_OBJECT_PL_32, CAN_OBJECT_PL_48,
+    CAN_OBJECT_PL_48, CAN_OBJECT_PL_48, CAN_OBJECT_PL_48, CAN_OBJECT_PL_64, CAN_OBJECT_PL_64,
+    CAN_OBJECT_PL_64, CAN_OBJECT_PL_64
+};
+/* clang-format on */
+
 /**
  * @brief  Fifo 0 to controller id decoder.
  */
@@ -376,12 +457,34 @@ static const uint8 Fifo0ToCtrlIds[] = { CAN_OBJ_HRH_RX00, CAN_OBJ_HRH_RX10 };
  */
 static const uint8 Fifo1ToCtrlIds[] = { CAN_OBJ_HRH_RX01, CAN_OBJ_HRH_RX11 };
 
+/**
+ * @brief  Hardware unit served by the interrupt lines, set at initialization.
+ */
+CAN_STATIC Can_HwUnit *CanIsrHwUnit = NULL_PTR;
+
+/**
+ * @brief  Handlers found on the interrupt lines before the driver installed its own, the vectors
+ *         are shared with TIM16 and TIM17 so they are still called after the Can flags.
+ */
+CAN_STATIC Nvic_HandlerType CanIsrChained[ CAN_ISR_LINES ] = { NULL_PTR, NULL_PTR };
+
 CAN_STATIC void Can_SetupConfiguredInterrupts( const Can_Controller *Controller, Can_RegisterType *Can );
 CAN_STATIC void Can_SetupConfiguredFilters( const Can_ConfigType *Config, uint8 Controller );
 CAN_STATIC void Can_SetupBaudrateConfig( const Can_ControllerBaudrateConfig *Baudrate, Can_RegisterType *Can );
-CAN_STATIC uint8 Can_GetClosestDlcWithPadding( uint8 Dlc, uint32 *RamBuffer, uint8 PaddingValue );
+CAN_STATIC uint8 Can_GetClosestDlc( uint8 Length );
+CAN_STATIC void Can_BuildTxHeader( const Can_HwUnit *HwUnit, Can_HwHandleType Hth, const Can_PduType *PduInfo, HwTxHeader *TxHeader );
+CAN_STATIC void Can_WriteTxElement( HwObjectHandler *Element, const HwTxHeader *TxHeader, const Can_PduType *PduInfo );
+CAN_STATIC void Can_WriteTxPayload( volatile uint32 *Payload, const uint8 *Sdu, uint8 Length, uint8 Bytes, uint8 PaddingValue );
+CAN_STATIC uint32 Can_MergeTxBytes( const uint8 *Sdu, uint8 Count, uint32 Padding );
 CAN_STATIC uint8 Can_GetTxPduId( const Can_Controller *Controller, PduIdType *CanPduId );
 CAN_STATIC void Can_GetMessage( volatile uint32 *Fifo, PduInfoType *PduInfo, uint32 *CanId );
+CAN_STATIC uint8 Can_ReadRxFifo( HwObjectHandler *HrhObject, volatile uint32 *Status, volatile uint32 *Acknowledge, Can_HwType *Mailbox, uint8 Budget );
+CAN_STATIC void Can_PendRxFifoLeft( const Can_RegisterType *Can, const volatile uint32 *Status, uint8 Group );
+CAN_STATIC uint32 Can_GetLineFlags( uint32 Routing, uint8 Line );
+CAN_STATIC void Can_Isr_Lines( uint8 Line );
+CAN_STATIC void Can_Isr_Line0( void );
+CAN_STATIC void Can_Isr_Line1( void );
+CAN_STATIC void Can_InstallLineHandler( Nvic_IrqType Irq, Nvic_HandlerType Handler, uint8 Line );
 
 CAN_STATIC void Can_Isr_RxFifo0NewMessage( Can_HwUnit *HwUnit, uint8 Controller );
 CAN_STATIC void Can_Isr_RxFifo0Full( Can_HwUnit *HwUnit, uint8 Controller );
@@ -407,6 +510,54 @@ CAN_STATIC void Can_Isr_WatchdogInterrupt( Can_HwUnit *HwUnit, uint8 Controller
 CAN_STATIC void Can_Isr_ProtocolErrorInArbitrationPhase( Can_HwUnit *HwUnit, uint8 Controller );
 CAN_STATIC void Can_Isr_ProtocolErrorInDataPhase( Can_HwUnit *HwUnit, uint8 Controller );
 
+/**
+ * @brief  Interrupt service routines, each one at the position of its flag on the IR register.
+ */
+/* clang-format off */
+static void ( *const CanIsrHandlers[ CAN_ISR_HANDLERS ] )( Can_HwUnit *HwUnit, uint8 Controller ) =
+{
+    Can_Isr_RxFifo0NewMessage,
+    Can_Isr_RxFifo0Full,
+    Can_Isr_RxFifo0MessageLost,
+    Can_Isr_RxFifo1NewMessage,
+    Can_Isr_RxFifo1Full,
+    Can_Isr_RxFifo1MessageLost,
+    Can_Isr_HighPriorityMessageRx,
+    Can_Isr_TransmissionCompleted,
+    Can_Isr_TransmissionCancellationFinished,
+    Can_Isr_TxEventFifoElementLost,
+    Can_Isr_TxEventFifoFull,
+    Can_Isr_TxEventFifoNewEntry,
+    Can_Isr_TxFifoEmpty,
+    Can_Isr_TimestampWraparound,
+    Can_Isr_MessageRamAccessFailure,
+    Can_Isr_TimeoutOccurred,
+    Can_Isr_ErrorLoggingOverflow,
+    Can_Isr_ErrorPassive,
+    Can_Isr_WarningStatus,
+    Can_Isr_BusOffStatus,
+    Can_Isr_WatchdogInterrupt,
+    Can_Isr_ProtocolErrorInArbitrationPhase,
+    Can_Isr_ProtocolErrorInDataPhase
+};
+/* clang-format on */
+
+/**
+ * @brief  IR flags of each interrupt group, at the position of its group bit on the ILS register.
+ */
+/* clang-format off */
+static const uint32 CanIsrGroupFlags[ CAN_ISR_GROUPS ] =
+{
+    CAN_IT_LIST_RX_FIFO0,
+    CAN_IT_LIST_RX_FIFO1,
+    CAN_IT_LIST_SMSG,
+    CAN_IT_LIST_TX_FIFO_ERROR,
+    CAN_IT_LIST_MISC,
+    CAN_IT_LIST_BIT_LINE_ERROR,
+    CAN_IT_LIST_PROTOCOL_ERROR
+};
+/* clang-format on */
+
 /**
  * @brief    **Can low level Initialization**
  *
@@ -434,14 +585,10 @@ void Can_Arch_Init( Can_HwUnit *HwUnit, const Can_ConfigType *Config, uint8 Cont
     Can->CKDIV = ControllerConfig->ClockDivider;
 
     /* Flush the allocated Message RAM area */
-    for( uint8 i = 0u; i < ( sizeof( SramCan_RegisterType ) / sizeof( uint32 ) ); i++ )
-    {
-        /* Flush the allocated Message RAM area */
-        ( (uint32 *)SramCanPeripherals[ ControllerConfig->CanReference ] )[ i ] = 0x00000000u;
-    }
+    Mem_SetVolatile32( (volatile uint32 *)SramCanPeripherals[ ControllerConfig->CanReference ], 0x00000000u, ( sizeof( SramCan_RegisterType ) / sizeof( uint32 ) ) );
 
     /* Exit from Sleep mode */
-    Bfx_ClrBit_u32u8( (uint32 *)&Can->CCCR, CCCR_CSR_BIT );
+    Bfx_ClrBit_vu32u8( &Can->CCCR, CCCR_CSR_BIT );
 
     /* Wait until the CSA bit into CCCR register is set */
     while( Bfx_GetBit_u32u8_u8( Can->CCCR, CCCR_CSA_BIT ) == STD_ON )
@@ -452,7 +599,7 @@ void Can_Arch_Init( Can_HwUnit *HwUnit, const Can_ConfigType *Config, uint8 Cont
     }
 
     /* Request initialisation */
-    Bfx_SetBit_u32u8( (uint32 *)&Can->CCCR, CCCR_INIT_BIT );
+    Bfx_SetBit_vu32u8( &Can->CCCR, CCCR_INIT_BIT );
 
     /* Wait until the INIT bit into CCCR register is set */
     while( Bfx_GetBit_u32u8_u8( Can->CCCR, CCCR_INIT_BIT ) == STD_OFF )
@@ -463,23 +610,23 @@ void Can_Arch_Init( Can_HwUnit *HwUnit, const Can_ConfigType *Config, uint8 Cont
     }
 
     /* Enable configuration change */
-    Bfx_SetBit_u32u8( (uint32 *)&Can->CCCR, CCCR_CCE_BIT );
+    Bfx_SetBit_vu32u8( &Can->CCCR, CCCR_CCE_BIT );
 
     /* Set the automatic retransmission */
-    Bfx_PutBit_u32u8u8( (uint32 *)&Can->CCCR, CCCR_DAR_BIT, !ControllerConfig->AutoRetransmission );
+    Bfx_PutBit_vu32u8u8( &Can->CCCR, CCCR_DAR_BIT, !ControllerConfig->AutoRetransmission );
 
     /* Set the transmit pause feature */
-    Bfx_PutBit_u32u8u8( (uint32 *)&Can->CCCR, CCCR_TXP_BIT, ControllerConfig->TransmitPause );
+    Bfx_PutBit_vu32u8u8( &Can->CCCR, CCCR_TXP_BIT, ControllerConfig->TransmitPause );
 
     /* Set the Protocol Exception Handling */
-    Bfx_PutBit_u32u8u8( (uint32 *)&Can->CCCR, CCCR_PXHD_BIT, !ControllerConfig->ProtocolException );
+    Bfx_PutBit_vu32u8u8( &Can->CCCR, CCCR_PXHD_BIT, !ControllerConfig->ProtocolException );
 
     /* Set CAN Frame Format */
-    Bfx_PutBit_u32u8u8( (uint32 *)&Can->CCCR, CCCR_FDOE_BIT, ControllerConfig->FrameFormat );
+    Bfx_PutBit_vu32u8u8( &Can->CCCR, CCCR_FDOE_BIT, ControllerConfig->FrameFormat );
 
     /* Reset FDCAN Operation Mode */
-    Bfx_ClrBitMask_u32u32( (uint32 *)&Can->CCCR, ( ( 1u << CCCR_TEST_BIT ) | ( 1u << CCCR_MON_BIT ) | ( 1u << CCCR_ASM_BIT ) ) );
-    Bfx_ClrBit_u32u8( (uint32 *)&Can->TEST, TEST_LBCK_BIT );
+    Bfx_ClrBitMask_vu32u32( &Can->CCCR, ( ( 1u << CCCR_TEST_BIT ) | ( 1u << CCCR_MON_BIT ) | ( 1u << CCCR_ASM_BIT ) ) );
+    Bfx_ClrBit_vu32u8( &Can->TEST, TEST_LBCK_BIT );
 
     /* Set FDCAN Operating Mode:
                  | Normal | Restricted |    Bus     | Internal | External
@@ -492,27 +639,27 @@ void Can_Arch_Init( Can_HwUnit *HwUnit, const Can_ConfigType *Config, uint8 Cont
     if( ControllerConfig->Mode == CAN_MODE_RESTRICTED_OPERATION )
     {
         /* Enable Restricted Operation mode */
-        Bfx_SetBit_u32u8( (uint32 *)&Can->CCCR, CCCR_ASM_BIT );
+        Bfx_SetBit_vu32u8( &Can->CCCR, CCCR_ASM_BIT );
     }
     else if( ControllerConfig->Mode != CAN_MODE_NORMAL )
     {
         if( ControllerConfig->Mode != CAN_MODE_BUS_MONITORING )
         {
             /* Enable write access to TEST register */
-            Bfx_SetBit_u32u8( (uint32 *)&Can->CCCR, CCCR_TEST_BIT );
+            Bfx_SetBit_vu32u8( &Can->CCCR, CCCR_TEST_BIT );
             /* Enable LoopBack mode */
-            Bfx_SetBit_u32u8( (uint32 *)&Can->TEST, TEST_LBCK_BIT );
+            Bfx_SetBit_vu32u8( &Can->TEST, TEST_LBCK_BIT );
 
             if( ControllerConfig->Mode == CAN_MODE_INTERNAL_LOOPBACK )
             {
                 /* Enable Internal LoopBack mode */
-                Bfx_SetBit_u32u8( (uint32 *)&Can->CCCR, CCCR_MON_BIT );
+                Bfx_SetBit_vu32u8( &Can->CCCR, CCCR_MON_BIT );
             }
         }
         else
         {
             /* Enable bus monitoring mode */
-            Bfx_SetBit_u32u8( (uint32 *)&Can->CCCR, CCCR_MON_BIT );
+            Bfx_SetBit_vu32u8( &Can->CCCR, CCCR_MON_BIT );
         }
     }
     else
@@ -524,26 +671,28 @@ void Can_Arch_Init( Can_HwUnit *HwUnit, const Can_ConfigType *Config, uint8 Cont
     Can_SetupBaudrateConfig( ControllerConfig->DefaultBaudrate, Can );
 
     /* Select between Tx FIFO and Tx Queue operation modes */
-    Bfx_PutBit_u32u8u8( (uint32 *)&Can->TXBC, TXBC_TFQM_BIT, ControllerConfig->TxFifoQueueMode );
+    Bfx_PutBit_vu32u8u8( &Can->TXBC, TXBC_TFQM_BIT, ControllerConfig->TxFifoQueueMode );
 
     /* Setup filter for Fifo 0 and Fifo 1*/
     Can_SetupConfiguredFilters( Config, Controller );
 
     /* As per autosar reject all Std remote frames*/
-    Bfx_SetBit_u32u8( (uint32 *)&Can->RXGFC, RXGFC_RRFS_BIT );
+    Bfx_SetBit_vu32u8( &Can->RXGFC, RXGFC_RRFS_BIT );
     /* As per autosar reject all Ext remote frames*/
-    Bfx_SetBit_u32u8( (uint32 *)&Can->RXGFC, RXGFC_RRFE_BIT );
+    Bfx_SetBit_vu32u8( &Can->RXGFC, RXGFC_RRFE_BIT );
 
     /* As per autosar reject all Std remote frames*/
-    Bfx_SetBit_u32u8( (uint32 *)&Can->RXGFC, RXGFC_RRFS_BIT );
+    Bfx_SetBit_vu32u8( &Can->RXGFC, RXGFC_RRFS_BIT );
     /* As per autosar reject all Ext remote frames*/
-    Bfx_SetBit_u32u8( (uint32 *)&Can->RXGFC, RXGFC_RRFE_BIT );
+    Bfx_SetBit_vu32u8( &Can->RXGFC, RXGFC_RRFE_BIT );
 
     /* Setup the interrupt to line 0 or 1*/
     Can_SetupConfiguredInterrupts( &Config->Controllers[ Controller ], Can );
 
-    /*paramter not in use, placed to keep standard and for potential future use*/
-    (void)HwUnit;
+    /* Install the driver handler on both interrupt lines, chained to the handler already there */
+    CanIsrHwUnit = HwUnit;
+    Can_InstallLineHandler( TIM16_FDCAN_IT0_IRQn, Can_Isr_Line0, CAN_ISR_LINE0 );
+    Can_InstallLineHandler( TIM17_FDCAN_IT1_IRQn, Can_Isr_Line1, CAN_ISR_LINE1 );
 }
 
 /**
@@ -565,7 +714,7 @@ void Can_Arch_DeInit( Can_HwUnit *HwUnit, uint8 Controller )
     Can_RegisterType *Can = CanPeripherals[ ControllerConfig->CanReference ];
 
     /* Request initialisation */
-    Bfx_SetBit_u32u8( (uint32 *)&Can->CCCR, CCCR_INIT_BIT );
+    Bfx_SetBit_vu32u8( &Can->CCCR, CCCR_INIT_BIT );
 
     /* Wait until the INIT bit into CCCR register is set */
     while( Bfx_GetBit_u32u8_u8( Can->CCCR, CCCR_INIT_BIT ) == FALSE )
@@ -576,7 +725,7 @@ void Can_Arch_DeInit( Can_HwUnit *HwUnit, uint8 Controller )
     }
 
     /* Exit from Sleep mode */
-    Bfx_ClrBit_u32u8( (uint32 *)&Can->CCCR, CCCR_CSR_BIT );
+    Bfx_ClrBit_vu32u8( &Can->CCCR, CCCR_CSR_BIT );
 
     /* Wait until FDCAN exits sleep mode */
     while( Bfx_GetBit_u32u8_u8( Can->CCCR, CCCR_CSA_BIT ) == FALSE )
@@ -587,11 +736,11 @@ void Can_Arch_DeInit( Can_HwUnit *HwUnit, uint8 Controller )
     }
 
     /* Enable configuration change */
-    Bfx_SetBit_u32u8( (uint32 *)&Can->CCCR, CCCR_CCE_BIT );
+    Bfx_SetBit_vu32u8( &Can->CCCR, CCCR_CCE_BIT );
 
     /* Disable interrupt lines */
-    Bfx_ClrBit_u32u8( (uint32 *)&Can->ILE, CAN_INTERRUPT_LINE0 );
-    Bfx_ClrBit_u32u8( (uint32 *)&Can->ILE, CAN_INTERRUPT_LINE1 );
+    Bfx_ClrBit_vu32u8( &Can->ILE, CAN_INTERRUPT_LINE0 );
+    Bfx_ClrBit_vu32u8( &Can->ILE, CAN_INTERRUPT_LINE1 );
 }
 
 /**
@@ -653,28 +802,34 @@ Std_ReturnType Can_Arch_SetBaudrate( Can_HwUnit *HwUnit, uint8 Controller, uint1
 Std_ReturnType Can_Arch_SetControllerMode( Can_HwUnit *HwUnit, uint8 Controller, Can_ControllerStateType Transition )
 {
     Std_ReturnType RetVal = E_NOT_OK;
+    boolean Requested     = FALSE;
     /* get controller configuration */
     const Can_Controller *ControllerConfig = &HwUnit->Config->Controllers[ Controller ];
     /*Get the Can controller register structure*/
     Can_RegisterType *Can = CanPeripherals[ ControllerConfig->CanReference ];
 
+    /* The state is checked and the transition requested with the bus off interrupt masked, the
+    waits for the peripheral are done after the exclusive area so they do not add interrupt latency */
     switch( Transition )
     {
         case CAN_CS_STARTED:
+            SchM_Enter_Can_CAN_EXCLUSIVE_AREA_1( );
             /*Transition shall be carried out from STOPPED to STARTED*/
             if( HwUnit->ControllerState[ Controller ] == CAN_CS_STOPPED )
             {
                 /* Request leave initialisation */
-                Bfx_ClrBit_u32u8( (uint32 *)&Can->CCCR, CCCR_INIT_BIT );
+                Bfx_ClrBit_vu32u8( &Can->CCCR, CCCR_INIT_BIT );
 
                 /* Change CAN peripheral state */
                 HwUnit->ControllerState[ Controller ] = CAN_CS_STARTED;
 
                 RetVal = E_OK;
             }
+            SchM_Exit_Can_CAN_EXCLUSIVE_AREA_1( );
             break;
 
         case CAN_CS_STOPPED:
+            SchM_Enter_Can_CAN_EXCLUSIVE_AREA_1( );
             /*Transition shall be carried out from STARTED to STOPPED*/
             if( HwUnit->ControllerState[ Controller ] == CAN_CS_STARTED )
             {
@@ -682,8 +837,14 @@ Std_ReturnType Can_Arch_SetControllerMode( Can_HwUnit *HwUnit, uint8 Controller,
                 Can->TXBCR = 0x03u;
 
                 /* Request initialisation */
-                Bfx_SetBit_u32u8( (uint32 *)&Can->CCCR, CCCR_INIT_BIT );
+                Bfx_SetBit_vu32u8( &Can->CCCR, CCCR_INIT_BIT );
 
+                RetVal = E_OK;
+            }
+            SchM_Exit_Can_CAN_EXCLUSIVE_AREA_1( );
+
+            if( RetVal == E_OK )
+            {
                 /* Wait until the INIT bit into CCCR register is set */
                 while( Bfx_GetBit_u32u8_u8( Can->CCCR, CCCR_INIT_BIT ) == FALSE )
                 {
@@ -693,7 +854,7 @@ Std_ReturnType Can_Arch_SetControllerMode( Can_HwUnit *HwUnit, uint8 Controller,
                 }
 
                 /* Exit from Sleep mode */
-                Bfx_ClrBit_u32u8( (uint32 *)&Can->CCCR, CCCR_CSR_BIT );
+                Bfx_ClrBit_vu32u8( &Can->CCCR, CCCR_CSR_BIT );
 
                 /* Wait until FDCAN exits sleep mode */
                 while( Bfx_GetBit_u32u8_u8( Can->CCCR, CCCR_CSA_BIT ) == TRUE )
@@ -704,22 +865,27 @@ Std_ReturnType Can_Arch_SetControllerMode( Can_HwUnit *HwUnit, uint8 Controller,
                 }
 
                 /* Enable configuration change */
-                Bfx_SetBit_u32u8( (uint32 *)&Can->CCCR, CCCR_CCE_BIT );
+                Bfx_SetBit_vu32u8( &Can->CCCR, CCCR_CCE_BIT );
 
                 /* Change CAN peripheral state */
                 HwUnit->ControllerState[ Controller ] = CAN_CS_STOPPED;
-
-                RetVal = E_OK;
             }
             break;
 
         case CAN_CS_SLEEP:
+            SchM_Enter_Can_CAN_EXCLUSIVE_AREA_1( );
             /*Transition shall be carried out from STOPPED to SLEEP*/
             if( HwUnit->ControllerState[ Controller ] == CAN_CS_STOPPED )
             {
                 /* Request clock stop */
-                Bfx_SetBit_u32u8( (uint32 *)&Can->CCCR, CCCR_CSR_BIT );
+                Bfx_SetBit_vu32u8( &Can->CCCR, CCCR_CSR_BIT );
+
+                Requested = TRUE;
+            }
+            SchM_Exit_Can_CAN_EXCLUSIVE_AREA_1( );
 
+            if( Requested == TRUE )
+            {
                 /* Wait until CAN is ready for power down */
                 while( Bfx_GetBit_u32u8_u8( Can->CCCR, CCCR_CSA_BIT ) == FALSE )
                 {
@@ -760,19 +926,25 @@ void Can_Arch_EnableControllerInterrupts( Can_HwUnit *HwUnit, uint8 Controller )
     /*Get the Can controller register structure*/
     Can_RegisterType *Can = CanPeripherals[ ControllerConfig->CanReference ];
 
+    /*the counter and ILE are also updated from the upper layer callbacks running in the
+    interrupts*/
+    SchM_Enter_Can_CAN_EXCLUSIVE_AREA_1( );
+
     /*enable interrupts only if this function is called the same number of times than
     disable interrupts*/
     if( HwUnit->DisableIntsLvl[ Controller ] == 0u )
     {
         /* Enable Interrupt line 0 */
-        Bfx_SetBit_u32u8( (uint32 *)&Can->ILE, CAN_INTERRUPT_LINE0 );
+        Bfx_SetBit_vu32u8( &Can->ILE, CAN_INTERRUPT_LINE0 );
         /* Enable Interrupt line 1 */
-        Bfx_SetBit_u32u8( (uint32 *)&Can->ILE, CAN_INTERRUPT_LINE1 );
+        Bfx_SetBit_vu32u8( &Can->ILE, CAN_INTERRUPT_LINE1 );
     }
     else
     {
         HwUnit->DisableIntsLvl[ Controller ]--;
     }
+
+    SchM_Exit_Can_CAN_EXCLUSIVE_AREA_1( );
 }
 
 /**
@@ -794,16 +966,20 @@ void Can_Arch_DisableControllerInterrupts( Can_HwUnit *HwUnit, uint8 Controller
     /*Get the Can controller register structure*/
     Can_RegisterType *Can = CanPeripherals[ ControllerConfig->CanReference ];
 
+    SchM_Enter_Can_CAN_EXCLUSIVE_AREA_1( );
+
     /* Disable interrupt line 0 */
-    Bfx_ClrBit_u32u8( (uint32 *)&Can->ILE, CAN_INTERRUPT_LINE0 );
+    Bfx_ClrBit_vu32u8( &Can->ILE, CAN_INTERRUPT_LINE0 );
     /* Disable interrupt line 1 */
-    Bfx_ClrBit_u32u8( (uint32 *)&Can->ILE, CAN_INTERRUPT_LINE1 );
+    Bfx_ClrBit_vu32u8( &Can->ILE, CAN_INTERRUPT_LINE1 );
 
     /*increase the number of disable int but keeping at maximum of 255*/
     if( HwUnit->DisableIntsLvl[ Controller ] < 255u )
     {
         HwUnit->DisableIntsLvl[ Controller ]++;
     }
+
+    SchM_Exit_Can_CAN_EXCLUSIVE_AREA_1( );
 }
 
 /**
@@ -915,7 +1091,7 @@ Std_ReturnType Can_Arch_GetControllerRxErrorCounter( Can_HwUnit *HwUnit, uint8 C
 
     /* Read the error counters register */
     *RxErrorCounterPtr = Bfx_GetBits_u32u8u8_u32( Can->ECR, ECR_REC_BIT, ECR_REC_SIZE );
-    Bfx_PutBit_u32u8u8( (uint32 *)RxErrorCounterPtr, 7u, Bfx_GetBit_u32u8_u8( Can->ECR, ECR_RP_BIT ) );
+    Bfx_PutBit_u8u8u8( RxErrorCounterPtr, 7u, Bfx_GetBit_u32u8_u8( Can->ECR, ECR_RP_BIT ) );
 
     return E_NOT_OK;
 }
@@ -1053,11 +1229,10 @@ Std_ReturnType Can_Arch_GetIngressTimeStamp( Can_HwUnit *HwUnit, Can_HwHandleTyp
  * @reqs    SWS_Can_00213, SWS_Can_00214, SWS_Can_00275, SWS_Can_00277, SWS_Can_00401, SWS_Can_00402
  *          SWS_Can_00403, SWS_Can_00011, SWS_Can_00486, SWS_Can_00502, SWS_Can_00276
  */
-Std_ReturnType Can_Arch_Write( Can_HwUnit *HwUnit, Can_HwHandleType Hth, const Can_PduType *PduInfo )
+CAN_RAMFUNC Std_ReturnType Can_Arch_Write( Can_HwUnit *HwUnit, Can_HwHandleType Hth, const Can_PduType *PduInfo )
 {
     Std_ReturnType RetVal = E_NOT_OK;
-    uint8 DataLenght;
-    uint32 RamBuffer[ 16u ];
+    HwTxHeader TxHeader;
 
     /* get controller configuration */
     const Can_Controller *ControllerConfig = HwUnit->Config->Hohs[ Hth ].ControllerRef;
@@ -1067,152 +1242,390 @@ Std_ReturnType Can_Arch_Write( Can_HwUnit *HwUnit, Can_HwHandleType Hth, const C
     /* Check that the Tx FIFO/Queue is not full*/
     if( ( Bfx_GetBit_u32u8_u8( Can->TXFQS, TXFQS_TFQF_BIT ) == FALSE ) )
     {
-        /* Retrieve the Tx FIFO PutIndex */
-        uint32 PutIndex = Bfx_GetBits_u32u8u8_u32( Can->TXFQS, TXFQS_TFQPI_BIT, TXFQS_TFQPI_SIZE );
-
         /*Get the buffer to write as per autosar will be the transmit hardware objet from Sram*/
         HwObjectHandler *HthObject = (HwObjectHandler *)SramCanPeripherals[ ControllerConfig->CanReference ]->TBSA;
 
-        /*get the message ID type*/
-        uint8 IdType = Bfx_GetBit_u32u8_u8( PduInfo->id, MSG_ID_BIT );
+        Can_BuildTxHeader( HwUnit, Hth, PduInfo, &TxHeader );
 
-        /* Set the message ID, standard (11 bits) or extended (29 bits) */
-        if( IdType == CAN_ID_STANDARD )
-        {
-            Bfx_PutBits_u32u8u8u32( &HthObject[ PutIndex ].ObjHeader1, TX_BUFFER_ID_11_BITS, TX_BUFFER_ID_11_SIZE, PduInfo->id );
-            /* Write the ID type bit */
-            Bfx_ClrBit_u32u8( &HthObject[ PutIndex ].ObjHeader1, TX_BUFFER_XTD_BIT );
-        }
-        else
+        /* The element is built above, only the put index read, the element write and the
+        transmission request are done with the interrupts masked, a Can_Write from a Tx confirmation
+        can not take the same put index in the meantime, so the queue is checked again inside */
+        SchM_Enter_Can_CAN_EXCLUSIVE_AREA_0( );
+
+        if( ( Bfx_GetBit_u32u8_u8( Can->TXFQS, TXFQS_TFQF_BIT ) == FALSE ) )
         {
-            Bfx_PutBits_u32u8u8u32( &HthObject[ PutIndex ].ObjHeader1, TX_BUFFER_ID_29_BITS, TX_BUFFER_ID_29_SIZE, PduInfo->id );
-            /* Write the ID type bit */
-            Bfx_SetBit_u32u8( &HthObject[ PutIndex ].ObjHeader1, TX_BUFFER_XTD_BIT );
-        }
+            /* Retrieve the Tx FIFO PutIndex */
+            uint32 PutIndex = Bfx_GetBits_u32u8u8_u32( Can->TXFQS, TXFQS_TFQPI_BIT, TXFQS_TFQPI_SIZE );
 
-        /* Store the PduId into FIFO events  */
-        Bfx_PutBits_u32u8u8u32( &HthObject[ PutIndex ].ObjHeader2, TX_BUFFER_MM_BIT, TX_BUFFER_MM_SIZE, PduInfo->swPduHandle );
+            Can_WriteTxElement( &HthObject[ PutIndex ], &TxHeader, PduInfo );
 
-        /* Get the type of frame to send */
-        uint8 FrameType = Bfx_GetBit_u32u8_u8( PduInfo->id, MSG_FORMAT_BIT );
+            /* Activate the corresponding transmission request */
+            Bfx_SetBit_vu32u8( &Can->TXBAR, PutIndex );
 
-        /* Set the frame */
-        if( FrameType == CAN_FRAME_CLASSIC )
-        {
-            /*Frame format*/
-            Bfx_ClrBit_u32u8( &HthObject[ PutIndex ].ObjHeader2, TX_BUFFER_FDF_BIT );
-            /* Set the actual data lenght (DLC) */
-            DataLenght = PduInfo->length;
+            RetVal = E_OK;
         }
         else
         {
-            /*Frame format*/
-            Bfx_SetBit_u32u8( &HthObject[ PutIndex ].ObjHeader2, TX_BUFFER_FDF_BIT );
-            /* Get the actual data lenght (DLC) */
-            DataLenght = Can_GetClosestDlcWithPadding( PduInfo->length, RamBuffer, HwUnit->Config->Hohs[ Hth ].FdPaddingValue );
-            /* Bit rate switch */
-            if( Bfx_GetBit_u32u8_u8( Can->CCCR, CCCR_BRSE_BIT ) == STD_ON )
-            {
-                Bfx_SetBit_u32u8( &HthObject[ PutIndex ].ObjHeader2, TX_BUFFER_BRS_BIT );
-            }
+            RetVal = CAN_BUSY;
         }
 
-        /*Store Tx Events*/
-        Bfx_SetBit_u32u8( &HthObject[ PutIndex ].ObjHeader2, TX_BUFFER_EFC_BIT );
+        SchM_Exit_Can_CAN_EXCLUSIVE_AREA_0( );
+    }
+    else
+    {
+        RetVal = CAN_BUSY;
+    }
 
-        /* copy message into a 32bit wide buffer*/
-        for( uint8 Byte = 0; Byte < PduInfo->length; Byte++ )
-        {
-            ( (uint8 *)RamBuffer )[ Byte ] = PduInfo->sdu[ Byte ];
-        }
+    return RetVal;
+}
 
-        /* Write message data lenght */
-        Bfx_PutBits_u32u8u8u32( &HthObject[ PutIndex ].ObjHeader2, TX_BUFFER_DLC_BIT, TX_BUFFER_DLC_SIZE, DataLenght );
+/**
+ * @brief    **Can low level Write of several messages**
+ *
+ * Writes the messages in order to as many free elements of the Tx FIFO/Queue as there are, up to
+ * the three Tx buffers, and requests the transmission of all of them with a single write to TXBAR
+ * so the controller sends the whole burst back to back. On FIFO operation the elements are taken
+ * from the put index, on queue operation the buffers without a pending request are taken. The
+ * messages not accepted shall be written again later.
+ *
+ * @param    HwUnit Pointer to the hardware unit configuration
+ * @param    Hth Information which HW-transmit handle shall be used for transmit.
+ * @param    PduInfo Array of messages with their SDU, Data Length and Identifier
+ * @param    Count Number of messages on the array
+ *
+ * @retval  Number of messages accepted from the beginning of the array
+ */
+CAN_RAMFUNC uint8 Can_Arch_WriteBatch( Can_HwUnit *HwUnit, Can_HwHandleType Hth, const Can_PduType *PduInfo, uint8 Count )
+{
+    HwTxHeader TxHeaders[ TX_FIFO_ELEMENTS ];
+    uint32 Requests = 0u;
+    uint8 Accepted  = 0u;
+    uint8 Build     = ( Count < TX_FIFO_ELEMENTS ) ? Count : TX_FIFO_ELEMENTS;
 
-        /* Write Tx payload with padding value to the message RAM */
-        for( uint8 Word = 0; Word < ( DlcToBytes[ DataLenght ] / sizeof( uint32 ) ); Word++ )
+    /* get controller configuration */
+    const Can_Controller *ControllerConfig = HwUnit->Config->Hohs[ Hth ].ControllerRef;
+    /*Get the Can controller register structure*/
+    Can_RegisterType *Can = CanPeripherals[ ControllerConfig->CanReference ];
+    /*Get the buffer to write as per autosar will be the transmit hardware objet from Sram*/
+    HwObjectHandler *HthObject = (HwObjectHandler *)SramCanPeripherals[ ControllerConfig->CanReference ]->TBSA;
+
+    /* The elements that may fit are built before masking the interrupts */
+    for( uint8 Message = 0u; Message < Build; Message++ )
+    {
+        Can_BuildTxHeader( HwUnit, Hth, &PduInfo[ Message ], &TxHeaders[ Message ] );
+    }
+
+    SchM_Enter_Can_CAN_EXCLUSIVE_AREA_0( );
+
+    if( ControllerConfig->TxFifoQueueMode == CAN_TX_FIFO_OPERATION )
+    {
+        /* Consecutive free elements starting at the put index */
+        uint8 FreeLevel = Bfx_GetBits_u32u8u8_u32( Can->TXFQS, TXFQS_TFFL_BIT, TXFQS_TFFL_SIZE );
+        uint8 PutIndex  = Bfx_GetBits_u32u8u8_u32( Can->TXFQS, TXFQS_TFQPI_BIT, TXFQS_TFQPI_SIZE );
+
+        while( ( Accepted < Build ) && ( Accepted < FreeLevel ) )
         {
-            HthObject[ PutIndex ].ObjPayload[ Word ] = RamBuffer[ Word ];
+            Can_WriteTxElement( &HthObject[ PutIndex ], &TxHeaders[ Accepted ], &PduInfo[ Accepted ] );
+            Requests |= ( 1UL << PutIndex );
+            Accepted++;
+            PutIndex = ( PutIndex < ( TX_FIFO_ELEMENTS - 1u ) ) ? ( PutIndex + 1u ) : 0u;
         }
+    }
+    else
+    {
+        /* Buffers without a pending transmission request */
+        uint32 Free = ~Can->TXBRP & ( ( 1UL << TX_FIFO_ELEMENTS ) - 1u );
 
-        /* Activate the corresponding transmission request */
-        Bfx_SetBit_u32u8( (uint32 *)&Can->TXBAR, PutIndex );
+        while( ( Accepted < Build ) && ( Free != 0u ) )
+        {
+            uint8 Buffer = Bfx_CountTrailingZeros_u32( Free );
 
-        RetVal = E_OK;
+            Can_WriteTxElement( &HthObject[ Buffer ], &TxHeaders[ Accepted ], &PduInfo[ Accepted ] );
+            Requests |= ( 1UL << Buffer );
+            Accepted++;
+            Free &= Free - 1u;
+        }
     }
-    else
+
+    /* Request all of them at once, the register only adds the requests of the bits written with one */
+    if( Requests != 0u )
     {
-        RetVal = CAN_BUSY;
+        Can->TXBAR = Requests;
     }
 
-    return RetVal;
+    SchM_Exit_Can_CAN_EXCLUSIVE_AREA_0( );
+
+    return Accepted;
 }
 
 /**
  * @brief    **Can Interrupt Handler**
  *
  * This function is the interrupt handler for the Can controller, it will check the interrupt flags
- * and call the corresponding callback functions.
+ * and call the corresponding callback functions. The flags pending and enabled are taken at once
+ * and cleared with a single write before their routines run, the routines are found on a const
+ * table by the position of each flag. The flags of disabled interrupts are left untouched, as
+ * well as the flags of the groups the ILS register routes to the other interrupt line.
  *
  * @param    HwUnit Pointer to the hardware unit configuration
  * @param    Controller CAN controller for which the status shall be changed.
+ * @param    Line Interrupt line being served, CAN_INTERRUPT_LINE0 or CAN_INTERRUPT_LINE1
  *
  * @reqs    SWS_Can_00420, SWS_Can_00033
  */
-void Can_Arch_IsrMainHandler( Can_HwUnit *HwUnit, uint8 Controller )
+CAN_RAMFUNC void Can_Arch_IsrMainHandler( Can_HwUnit *HwUnit, uint8 Controller, uint8 Line )
 {
     /* get controller configuration */
     const Can_Controller *ControllerConfig = &HwUnit->Config->Controllers[ Controller ];
     /*Get the Can controller register structure*/
     Can_RegisterType *Can = CanPeripherals[ ControllerConfig->CanReference ];
 
-    /* clang-format off */
-    void (*IsrPointer[])(Can_HwUnit*, uint8) = 
+    /*Only the enabled flags of this line with a service routine are served, read the registers once*/
+    uint32 Enabled = Can->IE & Can_GetLineFlags( Can->ILS, Line );
+    uint32 Pending = Can->IR & Enabled & CAN_ISR_HANDLERS_MASK;
+
+    /*Clear all of them with a single write, the register is write 1 to clear so the flags set
+    meanwhile are kept and an event arriving during its service routine raises the line again*/
+    Can->IR = Pending;
+
+    /*The messages left on a Rx FIFO by CAN_RX_FIFO_ISR_BUDGET have their flag already cleared,
+    serve them as new messages while the FIFO is not empty*/
+    if( Bfx_GetBits_u32u8u8_u32( Can->RXF0S, RXF0S_F0FL_BIT, RXF0S_F0FL_SIZE ) != 0u )
     {
-        Can_Isr_RxFifo0NewMessage,
-        Can_Isr_RxFifo0Full,
-        Can_Isr_RxFifo0MessageLost,
-        Can_Isr_RxFifo1NewMessage,
-        Can_Isr_RxFifo1Full,
-        Can_Isr_RxFifo1MessageLost,
-        Can_Isr_HighPriorityMessageRx,
-        Can_Isr_TransmissionCompleted,
-        Can_Isr_TransmissionCancellationFinished,
-        Can_Isr_TxEventFifoElementLost,
-        Can_Isr_TxEventFifoFull,
-        Can_Isr_TxEventFifoNewEntry,
-        Can_Isr_TxFifoEmpty,
-        Can_Isr_TimestampWraparound,
-        Can_Isr_MessageRamAccessFailure,
-        Can_Isr_TimeoutOccurred,
-        Can_Isr_ErrorLoggingOverflow,
-        Can_Isr_ErrorPassive,
-        Can_Isr_WarningStatus,
-        Can_Isr_BusOffStatus,
-        Can_Isr_WatchdogInterrupt,
-        Can_Isr_ProtocolErrorInArbitrationPhase,
-        Can_Isr_ProtocolErrorInDataPhase
-    };
-    /* clang-format on */
+        Pending |= Enabled & ( 1UL << IR_RF0N_BIT );
+    }
+    if( Bfx_GetBits_u32u8u8_u32( Can->RXF1S, RXF0S_F0FL_BIT, RXF0S_F0FL_SIZE ) != 0u )
+    {
+        Pending |= Enabled & ( 1UL << IR_RF1N_BIT );
+    }
+
+    /*Go only through the pending flags, lowest first*/
+    while( Pending != 0u )
+    {
+        uint8 Interrupt = Bfx_CountTrailingZeros_u32( Pending );
+        /* Call its interrupt service rutine */
+        CanIsrHandlers[ Interrupt ]( HwUnit, Controller );
+        Pending &= Pending - 1u;
+    }
+}
+
+/**
+ * @brief    **Get the interrupt flags of a line**
+ *
+ * Builds the IR flags routed to the given interrupt line out of the ILS register, each group bit
+ * set routes its whole group of flags to line 1 while the groups left clear go to line 0.
+ *
+ * @param    Routing Value of the ILS register
+ * @param    Line Interrupt line, CAN_INTERRUPT_LINE0 or CAN_INTERRUPT_LINE1
+ *
+ * @retval  IR flags routed to the line
+ */
+CAN_RAMFUNC CAN_STATIC uint32 Can_GetLineFlags( uint32 Routing, uint8 Line )
+{
+    uint32 Groups = Routing & CAN_ISR_GROUPS_MASK;
+    uint32 Line1  = 0u;
+
+    /*Go only through the groups routed to line 1, usually none or just a few*/
+    while( Groups != 0u )
+    {
+        Line1 |= CanIsrGroupFlags[ Bfx_CountTrailingZeros_u32( Groups ) ];
+        Groups &= Groups - 1u;
+    }
+
+    return ( Line == CAN_INTERRUPT_LINE1 ) ? Line1 : ~Line1;
+}
+
+/**
+ * @brief    **Can interrupt lines handler**
+ *
+ * Serves one of the interrupt lines 0 and 1, both lines are shared by FDCAN1 and FDCAN2 so every
+ * configured controller is served, the controllers without pending flags on the line return right
+ * away.
+ *
+ * @param    Line Interrupt line, CAN_INTERRUPT_LINE0 or CAN_INTERRUPT_LINE1
+ */
+CAN_RAMFUNC CAN_STATIC void Can_Isr_Lines( uint8 Line )
+{
+    for( uint8 Controller = 0u; Controller < CanIsrHwUnit->Config->ControllersCount; Controller++ )
+    {
+        Can_Arch_IsrMainHandler( CanIsrHwUnit, Controller, Line );
+    }
+}
+
+/**
+ * @brief    **Can interrupt line 0 handler**
+ *
+ * Installed on the TIM16_FDCAN_IT0 vector, serves the line 0 flags of the controllers and then
+ * calls the handler found on the vector at initialization, if any.
+ */
+CAN_RAMFUNC CAN_STATIC void Can_Isr_Line0( void )
+{
+    Can_Isr_Lines( CAN_INTERRUPT_LINE0 );
+
+    if( CanIsrChained[ CAN_ISR_LINE0 ] != NULL_PTR )
+    {
+        CanIsrChained[ CAN_ISR_LINE0 ]( );
+    }
+}
+
+/**
+ * @brief    **Can interrupt line 1 handler**
+ *
+ * Installed on the TIM17_FDCAN_IT1 vector, serves the line 1 flags of the controllers and then
+ * calls the handler found on the vector at initialization, if any.
+ */
+CAN_RAMFUNC CAN_STATIC void Can_Isr_Line1( void )
+{
+    Can_Isr_Lines( CAN_INTERRUPT_LINE1 );
+
+    if( CanIsrChained[ CAN_ISR_LINE1 ] != NULL_PTR )
+    {
+        CanIsrChained[ CAN_ISR_LINE1 ]( );
+    }
+}
+
+/**
+ * @brief    **Install the handler of an interrupt line**
+ *
+ * The handler already on the vector is kept to be chained, unless it is the driver handler
+ * installed by a previous initialization.
+ *
+ * @param    Irq Vector of the interrupt line
+ * @param    Handler Driver handler of the line
+ * @param    Line Interrupt line, CAN_ISR_LINE0 or CAN_ISR_LINE1
+ */
+CAN_STATIC void Can_InstallLineHandler( Nvic_IrqType Irq, Nvic_HandlerType Handler, uint8 Line )
+{
+    Nvic_HandlerType Previous = CDD_Nvic_GetHandler( Irq );
 
-    /*Go throu all interrupts potentianly enable*/
-    for( uint8 Interrupt = 0u; Interrupt < sizeof( IsrPointer ) / sizeof( IsrPointer[ 0 ] ); Interrupt++ )
+    if( Previous != Handler )
     {
-        /* If interrupt in turn is active */
-        if( Bfx_GetBit_u32u8_u8( Can->IR, Interrupt ) == STD_ON )
+        CanIsrChained[ Line ] = Previous;
+        CDD_Nvic_SetHandler( Irq, Handler );
+    }
+}
+
+/**
+ * @brief    **Can low level polling of transmit confirmations**
+ *
+ * Reads up to CAN_MAIN_FUNCTION_WRITE_BATCH elements of the Tx event FIFO and confirms each sent
+ * message to the upper layer, the rest are confirmed on the next call. Nothing is done when the
+ * controller confirms its messages on interrupts.
+ *
+ * @param    HwUnit Pointer to the hardware unit configuration
+ * @param    Controller CAN controller to poll
+ *
+ * @reqs    SWS_Can_00031, SWS_Can_00178
+ */
+void Can_Arch_MainFunction_Write( Can_HwUnit *HwUnit, uint8 Controller )
+{
+    /* get controller configuration */
+    const Can_Controller *ControllerConfig = &HwUnit->Config->Controllers[ Controller ];
+    /*Get the Can controller register structure*/
+    Can_RegisterType *Can = CanPeripherals[ ControllerConfig->CanReference ];
+
+    PduIdType CanPduId;
+
+    if( ControllerConfig->TxProcessing == CAN_PROCESSING_POLLING )
+    {
+        uint8 Pending = Bfx_GetBits_u32u8u8_u32( Can->TXEFS, TXEFS_EFFL_BIT, TXEFS_EFFL_SIZE );
+
+        for( uint8 Confirmed = 0u; ( Confirmed < CAN_MAIN_FUNCTION_WRITE_BATCH ) && ( Pending > 0u ); Confirmed++ )
         {
-            /*Double check if the interrupt is enable*/
-            if( Bfx_GetBit_u32u8_u8( Can->IE, Interrupt ) == STD_ON )
-            {
-                /* Call its interrupt service rutine */
-                IsrPointer[ Interrupt ]( HwUnit, Controller );
-            }
-            /* Clear the interrupt flag */
-            Bfx_SetBit_u32u8( (uint32 *)&Can->IR, Interrupt );
+            /*Get the PduId store in the MMS field*/
+            Pending = Can_GetTxPduId( ControllerConfig, &CanPduId );
+
+            /*Pass the PduId od the senede message to upper layer*/
+            CanIf_TxConfirmation( CanPduId );
         }
     }
 }
 
+/**
+ * @brief    **Can low level polling of received messages**
+ *
+ * Reads up to CAN_MAIN_FUNCTION_READ_BATCH messages from the Rx FIFO 0 and then from the Rx FIFO 1
+ * with what is left of the batch, the rest are read on the next call. Nothing is done when the
+ * controller reads its messages on interrupts.
+ *
+ * @param    HwUnit Pointer to the hardware unit configuration
+ * @param    Controller CAN controller to poll
+ *
+ * @reqs    SWS_Can_00108, SWS_Can_00180
+ */
+void Can_Arch_MainFunction_Read( Can_HwUnit *HwUnit, uint8 Controller )
+{
+    /* get controller configuration */
+    const Can_Controller *ControllerConfig = &HwUnit->Config->Controllers[ Controller ];
+    /*Get the Can controller register structure*/
+    Can_RegisterType *Can = CanPeripherals[ ControllerConfig->CanReference ];
+    /*Get the Sram Can controller register structure*/
+    SramCan_RegisterType *SramCan = SramCanPeripherals[ ControllerConfig->CanReference ];
+
+    Can_HwType Mailbox;
+
+    if( ControllerConfig->RxProcessing == CAN_PROCESSING_POLLING )
+    {
+        Mailbox.ControllerId = Controller;
+
+        /* Rx FIFO 0 takes the batch first */
+        Mailbox.Hoh = Fifo0ToCtrlIds[ Controller ];
+        uint8 Read  = Can_ReadRxFifo( (HwObjectHandler *)SramCan->F0SA, &Can->RXF0S, &Can->RXF0A, &Mailbox, CAN_MAIN_FUNCTION_READ_BATCH );
+
+        /* Rx FIFO 1 takes what is left */
+        Mailbox.Hoh = Fifo1ToCtrlIds[ Controller ];
+        (void)Can_ReadRxFifo( (HwObjectHandler *)SramCan->F1SA, &Can->RXF1S, &Can->RXF1A, &Mailbox, CAN_MAIN_FUNCTION_READ_BATCH - Read );
+    }
+}
+
+/**
+ * @brief    **Can low level polling of bus off**
+ *
+ * Checks if a started controller went to bus off and handles it the same way as its interrupt.
+ * Nothing is done when the controller handles the bus off on its interrupt.
+ *
+ * @param    HwUnit Pointer to the hardware unit configuration
+ * @param    Controller CAN controller to poll
+ *
+ * @reqs    SWS_Can_00109, SWS_Can_00183
+ */
+void Can_Arch_MainFunction_BusOff( Can_HwUnit *HwUnit, uint8 Controller )
+{
+    /* get controller configuration */
+    const Can_Controller *ControllerConfig = &HwUnit->Config->Controllers[ Controller ];
+
+    /* the flag stays set until the controller is started again, only the first poll reports it */
+    if( ( ControllerConfig->BusoffProcessing == CAN_PROCESSING_POLLING ) && ( HwUnit->ControllerState[ Controller ] == CAN_CS_STARTED ) )
+    {
+        Can_Isr_BusOffStatus( HwUnit, Controller );
+    }
+}
+
+/**
+ * @brief    **Can low level polling of controller mode changes**
+ *
+ * Indicates to the upper layer the controller state reached since the previous call, either by
+ * Can_SetControllerMode or by a bus off.
+ *
+ * @param    HwUnit Pointer to the hardware unit configuration
+ * @param    Controller CAN controller to poll
+ *
+ * @reqs    SWS_Can_00369, SWS_Can_00370, SWS_Can_00373
+ */
+void Can_Arch_MainFunction_Mode( Can_HwUnit *HwUnit, uint8 Controller )
+{
+    /* get controller configuration */
+    const Can_Controller *ControllerConfig = &HwUnit->Config->Controllers[ Controller ];
+
+    Can_ControllerStateType State = HwUnit->ControllerState[ Controller ];
+
+    if( State != HwUnit->ModeIndicated[ Controller ] )
+    {
+        HwUnit->ModeIndicated[ Controller ] = State;
+        CanIf_ControllerModeIndication( ControllerConfig->ControllerId, State );
+    }
+}
+
 /**
  * @brief    **Setup reception Filters**
  *
@@ -1249,13 +1662,21 @@ CAN_STATIC void Can_SetupConfiguredFilters( const Can_ConfigType *Config, uint8
                         /* Set the filter ID, standard (11 bits) or extended (29 bits) */
                         if( ( Config->Hohs[ Hoh ].IdType == CAN_ID_STANDARD ) || ( ( Config->Hohs[ Hoh ].IdType == CAN_ID_MIXED ) && ( Config->Hohs[ Hoh ].HwFilter->HwFilterIdType == CAN_ID_STANDARD ) ) )
                         {
-                            uint32 *StdFilter            = (uint32 *)&SramCanPeripherals[ ControllerConfig->CanReference ]->FLSSA[ StdFilterIndex ];
+                            volatile uint32 *StdFilter   = &SramCanPeripherals[ ControllerConfig->CanReference ]->FLSSA[ StdFilterIndex ];
                             const Can_HwFilter *HwFilter = &Config->Hohs[ Hoh ].HwFilter[ Filter ];
 
-                            Bfx_PutBits_u32u8u8u32( StdFilter, FLSSA_SFID1_BIT, RX_BUFFER_ID_11_SIZE, HwFilter->HwFilterCode );
-                            Bfx_PutBits_u32u8u8u32( StdFilter, FLSSA_SFID2_BIT, RX_BUFFER_ID_11_SIZE, HwFilter->HwFilterMask );
-                            Bfx_PutBits_u32u8u8u32( StdFilter, FLSSA_SFEC_BIT, FLSSA_SFEC_SIZE, Config->Hohs[ Hoh ].RxFifo );
-                            Bfx_PutBits_u32u8u8u32( StdFilter, FLSSA_SFT_BIT, FLSSA_SFT_SIZE, HwFilter->HwFilterType );
+                            /* clang-format off */
+                            const Bfx_FieldType StdFields[ ] =
+                            {
+                                { FLSSA_SFID1_BIT, RX_BUFFER_ID_11_SIZE, HwFilter->HwFilterCode },
+                                { FLSSA_SFID2_BIT, RX_BUFFER_ID_11_SIZE, HwFilter->HwFilterMask },
+                                { FLSSA_SFEC_BIT,  FLSSA_SFEC_SIZE,      Config->Hohs[ Hoh ].RxFifo },
+                                { FLSSA_SFT_BIT,   FLSSA_SFT_SIZE,       HwFilter->HwFilterType }
+                            };
+                            /* clang-format on */
+
+                            /*the element is completely described by its fields, write it at once*/
+                            Bfx_WriteFields_vu32( StdFilter, StdFields, 4u );
                             StdFilterIndex++;
                         }
                         else if( ( Config->Hohs[ Hoh ].IdType == CAN_ID_EXTENDED ) || ( ( Config->Hohs[ Hoh ].IdType == CAN_ID_MIXED ) && ( Config->Hohs[ Hoh ].HwFilter->HwFilterIdType == CAN_ID_EXTENDED ) ) )
@@ -1263,10 +1684,22 @@ CAN_STATIC void Can_SetupConfiguredFilters( const Can_ConfigType *Config, uint8
                             HwExtFilter *ExtFilter       = (HwExtFilter *)&SramCanPeripherals[ ControllerConfig->CanReference ]->FLESA[ ExtFilterIndex ];
                             const Can_HwFilter *HwFilter = &Config->Hohs[ Hoh ].HwFilter[ Filter ];
 
-                            Bfx_PutBits_u32u8u8u32( &ExtFilter->ExtFilterHeader1, FLESA_EFID_BIT, RX_BUFFER_ID_29_SIZE, HwFilter->HwFilterCode );
-                            Bfx_PutBits_u32u8u8u32( &ExtFilter->ExtFilterHeader2, FLESA_EFID_BIT, RX_BUFFER_ID_29_SIZE, HwFilter->HwFilterMask );
-                            Bfx_PutBits_u32u8u8u32( &ExtFilter->ExtFilterHeader2, FLESA_EFT_BIT, FLESA_EFT_SIZE, HwFilter->HwFilterType );
-                            Bfx_PutBits_u32u8u8u32( &ExtFilter->ExtFilterHeader1, FLESA_EFEC_BIT, FLESA_EFEC_SIZE, Config->Hohs[ Hoh ].RxFifo );
+                            /* clang-format off */
+                            const Bfx_FieldType ExtFields1[ ] =
+                            {
+                                { FLESA_EFID_BIT, RX_BUFFER_ID_29_SIZE, HwFilter->HwFilterCode },
+                                { FLESA_EFEC_BIT, FLESA_EFEC_SIZE,      Config->Hohs[ Hoh ].RxFifo }
+                            };
+                            const Bfx_FieldType ExtFields2[ ] =
+                            {
+                                { FLESA_EFID_BIT, RX_BUFFER_ID_29_SIZE, HwFilter->HwFilterMask },
+                                { FLESA_EFT_BIT,  FLESA_EFT_SIZE,       HwFilter->HwFilterType }
+                            };
+                            /* clang-format on */
+
+                            /*both words of the element are completely described by its fields*/
+                            Bfx_WriteFields_vu32( &ExtFilter->ExtFilterHeader1, ExtFields1, 2u );
+                            Bfx_WriteFields_vu32( &ExtFilter->ExtFilterHeader2, ExtFields2, 2u );
                             ExtFilterIndex++;
                         }
                         else
@@ -1281,18 +1714,16 @@ CAN_STATIC void Can_SetupConfiguredFilters( const Can_ConfigType *Config, uint8
 
     if( StdFilterIndex != 0u )
     {
-        /* Standard filter elements number */
-        Bfx_PutBits_u32u8u8u32( (uint32 *)&Can->RXGFC, RXGFC_LSS_BIT, RXGFC_LSS_SIZE, StdFilterIndex );
-        /*Reject all messages that do not match with filters*/
-        Bfx_PutBits_u32u8u8u32( (uint32 *)&Can->RXGFC, RXGFC_ANFS_BIT, RXGFC_ANFS_SIZE, 3u );
+        /* Standard filter elements number and reject all messages that do not match with filters */
+        const Bfx_FieldType StdGlobalFields[ ] = { { RXGFC_LSS_BIT, RXGFC_LSS_SIZE, StdFilterIndex }, { RXGFC_ANFS_BIT, RXGFC_ANFS_SIZE, 3u } };
+        Bfx_PutFields_vu32( &Can->RXGFC, StdGlobalFields, 2u );
     }
 
     if( ExtFilterIndex != 0u )
     {
-        /* Extended filter elements number */
-        Bfx_PutBits_u32u8u8u32( (uint32 *)&Can->RXGFC, RXGFC_LSE_BIT, RXGFC_LSE_SIZE, ExtFilterIndex );
-        /*Reject all messages that do not match with filters*/
-        Bfx_PutBits_u32u8u8u32( (uint32 *)&Can->RXGFC, RXGFC_ANFE_BIT, RXGFC_ANFE_SIZE, 3u );
+        /* Extended filter elements number and reject all messages that do not match with filters */
+        const Bfx_FieldType ExtGlobalFields[ ] = { { RXGFC_LSE_BIT, RXGFC_LSE_SIZE, ExtFilterIndex }, { RXGFC_ANFE_BIT, RXGFC_ANFE_SIZE, 3u } };
+        Bfx_PutFields_vu32( &Can->RXGFC, ExtGlobalFields, 2u );
     }
 }
 
@@ -1308,23 +1739,38 @@ CAN_STATIC void Can_SetupConfiguredFilters( const Can_ConfigType *Config, uint8
  */
 CAN_STATIC void Can_SetupBaudrateConfig( const Can_ControllerBaudrateConfig *Baudrate, Can_RegisterType *Can )
 {
-    /* Set the default nominal bit timing register */
-    Bfx_PutBits_u32u8u8u32( (uint32 *)&Can->NBTP, NBTP_NSJW_BIT, NBTP_NSJW_SIZE, ( Baudrate->SyncJumpWidth - 1u ) );
-    Bfx_PutBits_u32u8u8u32( (uint32 *)&Can->NBTP, NBTP_NTSEG1_BIT, NBTP_NTSEG1_SIZE, ( Baudrate->Seg1 - 1u ) );
-    Bfx_PutBits_u32u8u8u32( (uint32 *)&Can->NBTP, NBTP_NTSEG2_BIT, NBTP_NTSEG2_SIZE, ( Baudrate->Seg2 - 1u ) );
-    Bfx_PutBits_u32u8u8u32( (uint32 *)&Can->NBTP, NBTP_NBRP_BIT, NBTP_NBRP_SIZE, ( Baudrate->Prescaler - 1u ) );
+    /* clang-format off */
+    const Bfx_FieldType NominalFields[ ] =
+    {
+        { NBTP_NSJW_BIT,   NBTP_NSJW_SIZE,   ( Baudrate->SyncJumpWidth - 1u ) },
+        { NBTP_NTSEG1_BIT, NBTP_NTSEG1_SIZE, ( Baudrate->Seg1 - 1u ) },
+        { NBTP_NTSEG2_BIT, NBTP_NTSEG2_SIZE, ( Baudrate->Seg2 - 1u ) },
+        { NBTP_NBRP_BIT,   NBTP_NBRP_SIZE,   ( Baudrate->Prescaler - 1u ) }
+    };
+    /* clang-format on */
+
+    /* Set the default nominal bit timing register, all its fields are written */
+    Bfx_WriteFields_vu32( &Can->NBTP, NominalFields, 4u );
 
     /*set default data bit timing register if FD is active*/
     if( Baudrate->FdTxBitRateSwitch == STD_ON )
     {
-        Bfx_PutBits_u32u8u8u32( (uint32 *)&Can->DBTP, DBTP_DSJW_BIT, DBTP_DSJW_SIZE, ( Baudrate->FdSyncJumpWidth - 1u ) );
-        Bfx_PutBits_u32u8u8u32( (uint32 *)&Can->DBTP, DBTP_DTSEG1_BIT, DBTP_DTSEG1_SIZE, ( Baudrate->FdSeg1 - 1u ) );
-        Bfx_PutBits_u32u8u8u32( (uint32 *)&Can->DBTP, DBTP_DTSEG2_BIT, DBTP_DTSEG2_SIZE, ( Baudrate->FdSeg2 - 1u ) );
-        Bfx_PutBits_u32u8u8u32( (uint32 *)&Can->DBTP, DBTP_DBRP_BIT, DBTP_DBRP_SIZE, ( Baudrate->FdPrescaler - 1u ) );
+        /* clang-format off */
+        const Bfx_FieldType DataFields[ ] =
+        {
+            { DBTP_DSJW_BIT,   DBTP_DSJW_SIZE,   ( Baudrate->FdSyncJumpWidth - 1u ) },
+            { DBTP_DTSEG1_BIT, DBTP_DTSEG1_SIZE, ( Baudrate->FdSeg1 - 1u ) },
+            { DBTP_DTSEG2_BIT, DBTP_DTSEG2_SIZE, ( Baudrate->FdSeg2 - 1u ) },
+            { DBTP_DBRP_BIT,   DBTP_DBRP_SIZE,   ( Baudrate->FdPrescaler - 1u ) }
+        };
+        /* clang-format on */
+
+        /*the transceiver delay compensation bit is kept*/
+        Bfx_PutFields_vu32( &Can->DBTP, DataFields, 4u );
     }
 
     /* set data bit rate switch */
-    Bfx_PutBit_u32u8u8( (uint32 *)&Can->CCCR, CCCR_BRSE_BIT, Baudrate->FdTxBitRateSwitch );
+    Bfx_PutBit_vu32u8u8( &Can->CCCR, CCCR_BRSE_BIT, Baudrate->FdTxBitRateSwitch );
 }
 
 /**
@@ -1338,8 +1784,23 @@ CAN_STATIC void Can_SetupBaudrateConfig( const Can_ControllerBaudrateConfig *Bau
  */
 CAN_STATIC void Can_SetupConfiguredInterrupts( const Can_Controller *Controller, Can_RegisterType *Can )
 {
-    uint32 Line1ITs = 0u;
-    uint32 Line0ITs = 0u;
+    uint32 Line1ITs  = 0u;
+    uint32 Line0ITs  = 0u;
+    uint32 ActiveITs = Controller->ActiveITs;
+
+    /* The events processed by the main functions do not interrupt */
+    if( Controller->RxProcessing == CAN_PROCESSING_POLLING )
+    {
+        ActiveITs &= ~CAN_IT_POLLED_RX;
+    }
+    if( Controller->TxProcessing == CAN_PROCESSING_POLLING )
+    {
+        ActiveITs &= ~CAN_IT_POLLED_TX;
+    }
+    if( Controller->BusoffProcessing == CAN_PROCESSING_POLLING )
+    {
+        ActiveITs &= ~CAN_IT_POLLED_BUSOFF;
+    }
 
     /* cppcheck-suppress misra-c2012-20.9 ; it is necesary to use a define for this function */
 #if CAN_ENABLE_SECURITY_EVENT_REPORTING == STD_ON
@@ -1352,27 +1813,27 @@ CAN_STATIC void Can_SetupConfiguredInterrupts( const Can_Controller *Controller,
     Can->ILS = 0x00u;
 
     /*Enable interrupts*/
-    Bfx_SetBitMask_u32u32( (uint32 *)&Can->IE, Controller->ActiveITs | Line0ITs | Line1ITs );
+    Bfx_SetBitMask_vu32u32( &Can->IE, ActiveITs | Line0ITs | Line1ITs );
 
     /* Assign group of interrupts Tx Event Fifo to line 1*/
-    Bfx_PutBit_u32u8u8( (uint32 *)&Can->ILS, CAN_IT_GROUP_MISC, (uint8)( ( Line1ITs & CAN_IT_LIST_MISC ) != 0 ) );
+    Bfx_PutBit_vu32u8u8( &Can->ILS, CAN_IT_GROUP_MISC, (uint8)( ( Line1ITs & CAN_IT_LIST_MISC ) != 0 ) );
     /* Assign group of interrupts Bit line errors to line 1*/
-    Bfx_PutBit_u32u8u8( (uint32 *)&Can->ILS, CAN_IT_GROUP_BIT_LINE_ERROR, (uint8)( ( Line1ITs & CAN_IT_LIST_BIT_LINE_ERROR ) != 0 ) );
+    Bfx_PutBit_vu32u8u8( &Can->ILS, CAN_IT_GROUP_BIT_LINE_ERROR, (uint8)( ( Line1ITs & CAN_IT_LIST_BIT_LINE_ERROR ) != 0 ) );
 
     /* Assign group of interrupts Protocol errors to line 1*/
-    Bfx_PutBit_u32u8u8( (uint32 *)&Can->ILS, CAN_IT_GROUP_PROTOCOL_ERROR, (uint8)( ( Line1ITs & CAN_IT_LIST_PROTOCOL_ERROR ) != 0 ) );
+    Bfx_PutBit_vu32u8u8( &Can->ILS, CAN_IT_GROUP_PROTOCOL_ERROR, (uint8)( ( Line1ITs & CAN_IT_LIST_PROTOCOL_ERROR ) != 0 ) );
 
 
     /* Enable Tx Buffer Transmission Interrupt to set TC flag in IR register,
          but interrupt will only occur if TC is enabled in IE register */
-    if( ( Controller->ActiveITs & CAN_IT_TX_COMPLETE ) != 0u )
+    if( ( ActiveITs & CAN_IT_TX_COMPLETE ) != 0u )
     {
         Can->TXBTIE = CAN_TX_BUFFER0 | CAN_TX_BUFFER1 | CAN_TX_BUFFER2;
     }
 
     /* Enable Tx Buffer Cancellation Finished Interrupt to set TCF flag in IR register,
          but interrupt will only occur if TCF is enabled in IE register */
-    if( ( Controller->ActiveITs & CAN_IT_TX_ABORT_COMPLETE ) != 0u )
+    if( ( ActiveITs & CAN_IT_TX_ABORT_COMPLETE ) != 0u )
     {
         Can->TXBCIE = CAN_TX_BUFFER0 | CAN_TX_BUFFER1 | CAN_TX_BUFFER2;
     }
@@ -1383,67 +1844,208 @@ CAN_STATIC void Can_SetupConfiguredInterrupts( const Can_Controller *Controller,
  *
  * This function determines the data lenght to send according to the CAN FD specification, in case
  * the actual data lenght do not match with any of the available data lenghts, the function will
- * return the closest data lenght with padding.
+ * return the closest data lenght, the bytes left are filled with padding when the payload is
+ * written. The data lenght is taken from a table by the number of words of the payload.
  *
- * @param    Dlc: Data lenght to send
- * @param    RamBuffer: Pointer to the buffer where the data will be stored
- * @param    PaddingValue: Value to use for padding
+ * @param    Length: Data lenght to send
  *
  * @retval  DataLenght: Define with for data lenght to send
  */
-CAN_STATIC uint8 Can_GetClosestDlcWithPadding( uint8 Dlc, uint32 *RamBuffer, uint8 PaddingValue )
+CAN_RAMFUNC CAN_STATIC uint8 Can_GetClosestDlc( uint8 Length )
 {
-    uint8 DataLenght = 0u;
-    uint8 Counter;
+    uint8 DataLenght = CAN_OBJECT_PL_8;
 
-    if( ( Dlc > 8u ) && ( Dlc <= 12u ) )
-    {
-        DataLenght = CAN_OBJECT_PL_12;
-        Counter    = 12;
-    }
-    else if( ( Dlc > 12u ) && ( Dlc <= 16u ) )
+    if( Length <= 64u )
     {
-        DataLenght = CAN_OBJECT_PL_16;
-        Counter    = 16;
+        DataLenght = WordsToDlc[ ( Length + 3u ) >> 2u ];
     }
-    else if( ( Dlc > 16u ) && ( Dlc <= 20u ) )
-    {
-        DataLenght = CAN_OBJECT_PL_20;
-        Counter    = 20;
-    }
-    else if( ( Dlc > 20u ) && ( Dlc <= 24u ) )
+
+    return DataLenght;
+}
+
+/**
+ * @brief    **Build a Tx element**
+ *
+ * Composes both header words of the Tx element and the data lenght to write for a message, the
+ * message RAM is not touched so it can be done before masking the interrupts.
+ *
+ * @param    HwUnit: Pointer to the hardware unit configuration
+ * @param    Hth: Hardware transmit handle of the message
+ * @param    PduInfo: Message to send
+ * @param    TxHeader: Element built
+ */
+CAN_RAMFUNC CAN_STATIC void Can_BuildTxHeader( const Can_HwUnit *HwUnit, Can_HwHandleType Hth, const Can_PduType *PduInfo, HwTxHeader *TxHeader )
+{
+    uint8 DataLenght;
+    /*Get the Can controller register structure*/
+    const Can_RegisterType *Can = CanPeripherals[ HwUnit->Config->Hohs[ Hth ].ControllerRef->CanReference ];
+
+    /*get the message ID type*/
+    uint32 IdType = Bfx_GetBit_u32u8_u8( PduInfo->id, MSG_ID_BIT );
+    /* Get the type of frame to send */
+    uint32 FrameType = Bfx_GetBit_u32u8_u8( PduInfo->id, MSG_FORMAT_BIT );
+    /* Bit rate switch is only used on FD frames */
+    uint32 BitRateSwitch = STD_OFF;
+
+    /* Classic frames not multiple of four bytes are completed with zeros */
+    TxHeader->PaddingValue = 0u;
+    /* message ID field, extended (29 bits) or standard (11 bits) */
+    TxHeader->Header1 = ( IdType << TX_BUFFER_XTD_BIT ) | ( PduInfo->id & ( ( 1UL << TX_BUFFER_ID_29_SIZE ) - 1u ) );
+
+    if( IdType == CAN_ID_STANDARD )
     {
-        DataLenght = CAN_OBJECT_PL_24;
-        Counter    = 24;
+        TxHeader->Header1 = ( PduInfo->id & ( ( 1UL << TX_BUFFER_ID_11_SIZE ) - 1u ) ) << TX_BUFFER_ID_11_BITS;
     }
-    else if( ( Dlc > 24u ) && ( Dlc <= 32u ) )
+
+    /* Set the frame */
+    if( FrameType == CAN_FRAME_CLASSIC )
     {
-        DataLenght = CAN_OBJECT_PL_32;
-        Counter    = 32;
+        /* Set the actual data lenght (DLC) */
+        DataLenght = PduInfo->length;
     }
-    else if( ( Dlc > 32u ) && ( Dlc <= 48u ) )
+    else
     {
-        DataLenght = CAN_OBJECT_PL_48;
-        Counter    = 48;
+        /* Get the actual data lenght (DLC) */
+        DataLenght             = Can_GetClosestDlc( PduInfo->length );
+        TxHeader->PaddingValue = HwUnit->Config->Hohs[ Hth ].FdPaddingValue;
+        BitRateSwitch          = Bfx_GetBit_u32u8_u8( Can->CCCR, CCCR_BRSE_BIT );
     }
-    else if( ( Dlc > 48u ) && ( Dlc <= 64u ) )
+
+    /* PduId into the message marker to get it back from the Tx event FIFO, store Tx events,
+    frame format, bit rate switch and message data lenght */
+    TxHeader->Header2 = ( (uint32)PduInfo->swPduHandle << TX_BUFFER_MM_BIT ) | ( 1UL << TX_BUFFER_EFC_BIT ) |
+                        ( FrameType << TX_BUFFER_FDF_BIT ) | ( BitRateSwitch << TX_BUFFER_BRS_BIT ) |
+                        ( (uint32)DataLenght << TX_BUFFER_DLC_BIT );
+    TxHeader->Bytes = DlcToBytes[ DataLenght ];
+}
+
+/**
+ * @brief    **Write a Tx element to the message RAM**
+ *
+ * Both header words are completely built, each one is written at once without leaving bits from
+ * the previous message sent with the same element, then the payload with its padding.
+ *
+ * @param    Element: Tx element of the message RAM
+ * @param    TxHeader: Element built with Can_BuildTxHeader
+ * @param    PduInfo: Message to send
+ */
+CAN_RAMFUNC CAN_STATIC void Can_WriteTxElement( HwObjectHandler *Element, const HwTxHeader *TxHeader, const Can_PduType *PduInfo )
+{
+    Element->ObjHeader1 = TxHeader->Header1;
+    Element->ObjHeader2 = TxHeader->Header2;
+    Can_WriteTxPayload( Element->ObjPayload, PduInfo->sdu, PduInfo->length, TxHeader->Bytes, TxHeader->PaddingValue );
+}
+
+/**
+ * @brief    **Write a Tx payload to the message RAM**
+ *
+ * The message RAM only accepts word accesses, each word is written once and no intermediate
+ * buffer is used. Payloads up to 8 bytes (every classic frame) are built in two words packed
+ * byte by byte, so any alignment of the message costs the same and no function in flash is
+ * called. Bigger FD payloads copy the whole words of the message with Mem_CopyToVolatile32, the
+ * word shared by the last bytes and the padding is built here and the words of padding only up
+ * to the data lenght to send are written with Mem_SetVolatile32.
+ *
+ * @param    Payload: Payload of the Tx element in the message RAM
+ * @param    Sdu: Message to send
+ * @param    Length: Number of bytes of the message
+ * @param    Bytes: Number of bytes of the data lenght to send, not less than Length
+ * @param    PaddingValue: Value to use for padding
+ */
+CAN_RAMFUNC CAN_STATIC void Can_WriteTxPayload( volatile uint32 *Payload, const uint8 *Sdu, uint8 Length, uint8 Bytes, uint8 PaddingValue )
+{
+    uint32 Padding = (uint32)PaddingValue * 0x01010101u;
+
+    if( Bytes <= TX_PAYLOAD_CLASSIC )
     {
-        DataLenght = CAN_OBJECT_PL_64;
-        Counter    = 64;
+        uint32 Word0 = Padding;
+        uint32 Word1 = Padding;
+
+        if( Length >= TX_PAYLOAD_WORD_SIZE )
+        {
+            Word0 = (uint32)Sdu[ 0 ] | ( (uint32)Sdu[ 1 ] << 8u ) | ( (uint32)Sdu[ 2 ] << 16u ) | ( (uint32)Sdu[ 3 ] << 24u );
+
+            if( Length == TX_PAYLOAD_CLASSIC )
+            {
+                Word1 = (uint32)Sdu[ 4 ] | ( (uint32)Sdu[ 5 ] << 8u ) | ( (uint32)Sdu[ 6 ] << 16u ) | ( (uint32)Sdu[ 7 ] << 24u );
+            }
+            else if( Length > TX_PAYLOAD_WORD_SIZE )
+            {
+                Word1 = Can_MergeTxBytes( &Sdu[ TX_PAYLOAD_WORD_SIZE ], Length - TX_PAYLOAD_WORD_SIZE, Padding );
+            }
+            else
+            {
+                /* second word is padding only */
+            }
+        }
+        else if( Length > 0u )
+        {
+            Word0 = Can_MergeTxBytes( Sdu, Length, Padding );
+        }
+        else
+        {
+            /* both words are padding only */
+        }
+
+        if( Bytes > 0u )
+        {
+            Payload[ 0 ] = Word0;
+        }
+        if( Bytes > TX_PAYLOAD_WORD_SIZE )
+        {
+            Payload[ 1 ] = Word1;
+        }
     }
     else
     {
-        DataLenght = CAN_OBJECT_PL_8;
-        Counter    = 8;
+        uint8 Byte  = (uint8)( Length & 0xFCu );
+        uint8 Word  = (uint8)( Byte >> 2u );
+        uint8 Words = (uint8)( ( Bytes + 3u ) >> 2u );
+
+        /*whole words of the message*/
+        Mem_CopyToVolatile32( Payload, Sdu, Byte );
+
+        /*last bytes of the message completed with padding*/
+        if( Byte < Length )
+        {
+            Payload[ Word ] = Can_MergeTxBytes( &Sdu[ Byte ], Length - Byte, Padding );
+            Word++;
+        }
+
+        /*words of padding only*/
+        if( Word < Words )
+        {
+            Mem_SetVolatile32( &Payload[ Word ], Padding, (uint32)Words - Word );
+        }
     }
+}
 
-    /*set padding value*/
-    for( uint8 Byte = 0u; Byte < Counter; Byte++ )
+/**
+ * @brief    **Build a payload word with the last bytes of a message**
+ *
+ * The bytes are packed in the lower positions of the word (little endian) and the rest of the
+ * word keeps the padding value.
+ *
+ * @param    Sdu: First byte to pack
+ * @param    Count: Number of bytes to pack, from 1 to 3
+ * @param    Padding: Padding value repeated on the four bytes
+ *
+ * @retval  The payload word
+ */
+CAN_RAMFUNC CAN_STATIC uint32 Can_MergeTxBytes( const uint8 *Sdu, uint8 Count, uint32 Padding )
+{
+    uint32 Data = Sdu[ 0 ];
+
+    if( Count > 1u )
     {
-        ( (uint8 *)RamBuffer )[ Byte ] = PaddingValue;
+        Data |= (uint32)Sdu[ 1 ] << 8u;
+    }
+    if( Count > 2u )
+    {
+        Data |= (uint32)Sdu[ 2 ] << 16u;
     }
 
-    return DataLenght;
+    return ( Padding & ( 0xFFFFFFFFUL << ( (uint32)Count << 3u ) ) ) | Data;
 }
 
 /**
@@ -1488,7 +2090,7 @@ CAN_STATIC uint8 Can_GetTxPduId( const Can_Controller *Controller, PduIdType *Ca
  * @param    PduInfo Pointer to the variable where the message will be stored.
  * @param    CanId Pointer to the variable where the message ID will be stored.
  */
-CAN_STATIC void Can_GetMessage( volatile uint32 *Fifo, PduInfoType *PduInfo, uint32 *CanId )
+CAN_RAMFUNC CAN_STATIC void Can_GetMessage( volatile uint32 *Fifo, PduInfoType *PduInfo, uint32 *CanId )
 {
     /*Get the buffer to write as per autosar will be the transmit hardware objet from Sram*/
     HwObjectHandler *HrhObject = (HwObjectHandler *)Fifo;
@@ -1496,7 +2098,7 @@ CAN_STATIC void Can_GetMessage( volatile uint32 *Fifo, PduInfoType *PduInfo, uin
     /* Retrieve DataLength */
     PduInfo->SduLength = Bfx_GetBits_u32u8u8_u32( HrhObject->ObjHeader2, RX_BUFFER_DLC_BIT, RX_BUFFER_DLC_SIZE );
     PduInfo->SduLength = DlcToBytes[ PduInfo->SduLength ];
-    /* Retrieve Rx payload */
+    /* Retrieve Rx payload, the upper layer copies it out before the element is acknowledged */
     PduInfo->SduDataPtr = (uint8 *)&HrhObject->ObjPayload;
 
     /*Retrieve message ID Type*/
@@ -1520,19 +2122,97 @@ CAN_STATIC void Can_GetMessage( volatile uint32 *Fifo, PduInfoType *PduInfo, uin
     Bfx_PutBit_u32u8u8( CanId, MSG_FORMAT_BIT, Format );
 }
 
+/**
+ * @brief    **Read the messages pending on one of the Rx FIFOs**
+ *
+ * The fill level and get index are read once, then every pending element up to Budget is passed
+ * to the upper layer in order and only the last one is acknowledged, which releases all the
+ * elements read at once.
+ *
+ * @param    HrhObject Pointer to the first element of the Rx FIFO in the message RAM
+ * @param    Status Pointer to the Rx FIFO status register, RXF0S or RXF1S
+ * @param    Acknowledge Pointer to the Rx FIFO acknowledge register, RXF0A or RXF1A
+ * @param    Mailbox Hoh and controller of the Rx FIFO, the message ID is set for each message
+ * @param    Budget Maximum number of messages to read
+ *
+ * @retval  Number of messages read
+ *
+ * @reqs    SWS_Can_00489, SWS_Can_00501, SWS_Can_00423, SWS_Can_00279
+ */
+CAN_RAMFUNC CAN_STATIC uint8 Can_ReadRxFifo( HwObjectHandler *HrhObject, volatile uint32 *Status, volatile uint32 *Acknowledge, Can_HwType *Mailbox, uint8 Budget )
+{
+    PduInfoType PduInfo;
+    uint32 FifoStatus = *Status;
+    uint8 Index       = Bfx_GetBits_u32u8u8_u32( FifoStatus, RXF0S_F0GI_BIT, RXF0S_F0GI_SIZE );
+    uint8 Pending     = Bfx_GetBits_u32u8u8_u32( FifoStatus, RXF0S_F0FL_BIT, RXF0S_F0FL_SIZE );
+    uint8 Last        = Index;
+
+    if( Pending > Budget )
+    {
+        Pending = Budget;
+    }
+
+    for( uint8 Element = 0u; Element < Pending; Element++ )
+    {
+        /* Read the oldest message arrived */
+        Can_GetMessage( (volatile uint32 *)&HrhObject[ Index ], &PduInfo, &Mailbox->CanId );
+        /* Pass the messages to upper layer */
+        CanIf_RxIndication( Mailbox, &PduInfo );
+
+        Last  = Index;
+        Index = ( ( Index + 1u ) < RX_FIFO_ELEMENTS ) ? ( Index + 1u ) : 0u;
+    }
+
+    if( Pending > 0u )
+    {
+        /* Acknowledge the last element read so that the GetIndex moves past all of them */
+        *Acknowledge = Last;
+    }
+
+    return Pending;
+}
+
+
+/**
+ * @brief    **Pend the interrupt line of a Rx FIFO with messages left**
+ *
+ * The new message and full flags are cleared before their routine runs, when the budget leaves
+ * messages on the FIFO no flag is raised again until another frame arrives. The status is read
+ * again after the acknowledge and, if the FIFO is not empty, the interrupt line of its group is
+ * set pending so the handler comes back right after returning.
+ *
+ * @param    Can Can controller register structure
+ * @param    Status Pointer to the Rx FIFO status register, RXF0S or RXF1S
+ * @param    Group Interrupt group of the Rx FIFO, CAN_IT_GROUP_RX_FIFO0 or CAN_IT_GROUP_RX_FIFO1
+ */
+CAN_RAMFUNC CAN_STATIC void Can_PendRxFifoLeft( const Can_RegisterType *Can, const volatile uint32 *Status, uint8 Group )
+{
+    if( Bfx_GetBits_u32u8u8_u32( *Status, RXF0S_F0FL_BIT, RXF0S_F0FL_SIZE ) != 0u )
+    {
+        if( Bfx_GetBit_u32u8_u8( Can->ILS, Group ) == STD_ON )
+        {
+            CDD_Nvic_SetPendingIrq( TIM17_FDCAN_IT1_IRQn );
+        }
+        else
+        {
+            CDD_Nvic_SetPendingIrq( TIM16_FDCAN_IT0_IRQn );
+        }
+    }
+}
 
 /**
  * @brief    **Can Rx Fifo 0 New Message Callback**
  *
- * This function is the callback for the Rx Fifo 0 New Message interrupt, it will read the oldest
- * message arrived and pass it to the upper layer.
+ * This function is the callback for the Rx Fifo 0 New Message interrupt, it will read all the
+ * messages pending on the FIFO and pass them to the upper layer, so a burst of frames takes a
+ * single interrupt.
  *
  * @param    HwUnit: Pointer to the hardware unit configuration
  * @param    Controller: CAN controller for which the status shall be changed.
  *
  * @reqs    SWS_Can_00489, SWS_Can_00501, SWS_Can_00423, SWS_Can_00279
  */
-CAN_STATIC void Can_Isr_RxFifo0NewMessage( Can_HwUnit *HwUnit, uint8 Controller )
+CAN_RAMFUNC CAN_STATIC void Can_Isr_RxFifo0NewMessage( Can_HwUnit *HwUnit, uint8 Controller )
 {
     /* get controller configuration */
     const Can_Controller *ControllerConfig = &HwUnit->Config->Controllers[ Controller ];
@@ -1541,23 +2221,16 @@ CAN_STATIC void Can_Isr_RxFifo0NewMessage( Can_HwUnit *HwUnit, uint8 Controller
     /*Get the buffer to write as per autosar will be the transmit hardware objet from Sram*/
     HwObjectHandler *HrhObject = (HwObjectHandler *)SramCanPeripherals[ ControllerConfig->CanReference ]->F0SA;
 
-    PduInfoType PduInfo;
     Can_HwType Mailbox;
 
-    /* Set Hoh and controller Ids */
+    /* Set Hoh and controller Ids, same for all messages */
     Mailbox.Hoh          = Fifo0ToCtrlIds[ Controller ];
     Mailbox.ControllerId = Controller;
 
-    /* Get Rx FIFO Get index */
-    uint8 Index = Bfx_GetBits_u32u8u8_u32( Can->RXF0S, RXF0S_F0GI_BIT, RXF0S_F0GI_SIZE );
-
-    /* Read the oldest message arrived */
-    Can_GetMessage( (uint32 *)&HrhObject[ Index ], &PduInfo, &Mailbox.CanId );
-    /* Pass the messages to upper layer */
-    CanIf_RxIndication( &Mailbox, &PduInfo );
-
-    /* Acknowledge the Rx FIFO 0 that the oldest element is read so that it increments the GetIndex */
-    Can->RXF0A = Index;
+    /* Read every message pending, not only the one that triggered the interrupt */
+    (void)Can_ReadRxFifo( HrhObject, &Can->RXF0S, &Can->RXF0A, &Mailbox, CAN_RX_FIFO_ISR_BUDGET );
+    /* The messages left by the budget are read on the next interrupt */
+    Can_PendRxFifoLeft( Can, &Can->RXF0S, CAN_IT_GROUP_RX_FIFO0 );
 }
 
 /**
@@ -1580,25 +2253,16 @@ CAN_STATIC void Can_Isr_RxFifo0Full( Can_HwUnit *HwUnit, uint8 Controller )
     /*Get the buffer to write as per autosar will be the transmit hardware objet from Sram*/
     HwObjectHandler *HrhObject = (HwObjectHandler *)SramCanPeripherals[ ControllerConfig->CanReference ]->F0SA;
 
-    PduInfoType PduInfo;
     Can_HwType Mailbox;
-    uint8 Index;
 
     /* Set Hoh and controller Ids, same for all messages */
     Mailbox.Hoh          = Fifo0ToCtrlIds[ Controller ];
     Mailbox.ControllerId = Controller;
 
-    while( Bfx_GetBits_u32u8u8_u32( Can->RXF0S, RXF0S_F0FL_BIT, RXF0S_F0FL_SIZE ) > 0u )
-    {
-        /* Get Rx FIFO Get index */
-        Index = Bfx_GetBits_u32u8u8_u32( Can->RXF0S, RXF0S_F0GI_BIT, RXF0S_F0GI_SIZE );
-        /* Read the oldest message arrived */
-        Can_GetMessage( (uint32 *)&HrhObject[ Index ], &PduInfo, &Mailbox.CanId );
-        /* Pass the messages to upper layer */
-        CanIf_RxIndication( &Mailbox, &PduInfo );
-        /* Acknowledge the Rx FIFO 0 that the oldest element is read so that it increments the GetIndex */
-        Can->RXF0A = Index;
-    }
+    /* Read all the messages arrived */
+    (void)Can_ReadRxFifo( HrhObject, &Can->RXF0S, &Can->RXF0A, &Mailbox, CAN_RX_FIFO_ISR_BUDGET );
+    /* The messages left by the budget are read on the next interrupt */
+    Can_PendRxFifoLeft( Can, &Can->RXF0S, CAN_IT_GROUP_RX_FIFO0 );
 }
 
 /**
@@ -1632,15 +2296,16 @@ CAN_STATIC void Can_Isr_RxFifo0MessageLost( Can_HwUnit *HwUnit, uint8 Controller
 /**
  * @brief    **Can Rx Fifo 1 New Message Callback**
  *
- * This function is the callback for the Rx Fifo 1 New Message interrupt, it will read the oldest
- * message arrived and pass it to the upper layer.
+ * This function is the callback for the Rx Fifo 1 New Message interrupt, it will read all the
+ * messages pending on the FIFO and pass them to the upper layer, so a burst of frames takes a
+ * single interrupt.
  *
  * @param    HwUnit: Pointer to the hardware unit configuration
  * @param    Controller: CAN controller for which the status shall be changed.
  *
  * @reqs    SWS_Can_00489, SWS_Can_00501, SWS_Can_00423, SWS_Can_00279
  */
-CAN_STATIC void Can_Isr_RxFifo1NewMessage( Can_HwUnit *HwUnit, uint8 Controller )
+CAN_RAMFUNC CAN_STATIC void Can_Isr_RxFifo1NewMessage( Can_HwUnit *HwUnit, uint8 Controller )
 {
     /* get controller configuration */
     const Can_Controller *ControllerConfig = &HwUnit->Config->Controllers[ Controller ];
@@ -1649,23 +2314,16 @@ CAN_STATIC void Can_Isr_RxFifo1NewMessage( Can_HwUnit *HwUnit, uint8 Controller
     /*Get the buffer to write as per autosar will be the transmit hardware objet from Sram*/
     HwObjectHandler *HrhObject = (HwObjectHandler *)SramCanPeripherals[ ControllerConfig->CanReference ]->F1SA;
 
-    PduInfoType PduInfo;
     Can_HwType Mailbox;
 
-    /* Set Hoh and controller Ids */
+    /* Set Hoh and controller Ids, same for all messages */
     Mailbox.Hoh          = Fifo1ToCtrlIds[ Controller ];
     Mailbox.ControllerId = Controller;
 
-    /* Get Rx FIFO Get index */
-    uint8 Index = Bfx_GetBits_u32u8u8_u32( Can->RXF1S, RXF0S_F0GI_BIT, RXF0S_F0GI_SIZE );
-
-    /* Read the oldest message arrived */
-    Can_GetMessage( (uint32 *)&HrhObject[ Index ], &PduInfo, &Mailbox.CanId );
-    /* Pass the messages to upper layer */
-    CanIf_RxIndication( &Mailbox, &PduInfo );
-
-    /* Acknowledge the Rx FIFO 0 that the oldest element is read so that it increments the GetIndex */
-    Can->RXF1A = Index;
+    /* Read every message pending, not only the one that triggered the interrupt */
+    (void)Can_ReadRxFifo( HrhObject, &Can->RXF1S, &Can->RXF1A, &Mailbox, CAN_RX_FIFO_ISR_BUDGET );
+    /* The messages left by the budget are read on the next interrupt */
+    Can_PendRxFifoLeft( Can, &Can->RXF1S, CAN_IT_GROUP_RX_FIFO1 );
 }
 
 /**
@@ -1688,25 +2346,16 @@ CAN_STATIC void Can_Isr_RxFifo1Full( Can_HwUnit *HwUnit, uint8 Controller )
     /*Get the buffer to write as per autosar will be the transmit hardware objet from Sram*/
     HwObjectHandler *HrhObject = (HwObjectHandler *)SramCanPeripherals[ ControllerConfig->CanReference ]->F1SA;
 
-    PduInfoType PduInfo;
     Can_HwType Mailbox;
-    uint8 Index;
 
     /* Set Hoh and controller Ids, same for all messages */
     Mailbox.Hoh          = Fifo1ToCtrlIds[ Controller ];
     Mailbox.ControllerId = Controller;
 
-    while( Bfx_GetBits_u32u8u8_u32( Can->RXF1S, RXF0S_F0FL_BIT, RXF0S_F0FL_SIZE ) > 0u )
-    {
-        /* Get Rx FIFO Get index */
-        Index = Bfx_GetBits_u32u8u8_u32( Can->RXF1S, RXF0S_F0GI_BIT, RXF0S_F0GI_SIZE );
-        /* Read the oldest message arrived */
-        Can_GetMessage( (uint32 *)&HrhObject[ Index ], &PduInfo, &Mailbox.CanId );
-        /* Pass the messages to upper layer */
-        CanIf_RxIndication( &Mailbox, &PduInfo );
-        /* Acknowledge the Rx FIFO 1 that the oldest element is read so that it increments the GetIndex */
-        Can->RXF1A = Index;
-    }
+    /* Read all the messages arrived */
+    (void)Can_ReadRxFifo( HrhObject, &Can->RXF1S, &Can->RXF1A, &Mailbox, CAN_RX_FIFO_ISR_BUDGET );
+    /* The messages left by the budget are read on the next interrupt */
+    Can_PendRxFifoLeft( Can, &Can->RXF1S, CAN_IT_GROUP_RX_FIFO1 );
 }
 
 /**
@@ -1743,7 +2392,7 @@ CAN_STATIC void Can_Isr_RxFifo1MessageLost( Can_HwUnit *HwUnit, uint8 Controller
  * @param    HwUnit: Pointer to the hardware unit configuration
  * @param    Controller: CAN controller for which the status shall be changed.
  */
-CAN_STATIC void Can_Isr_HighPriorityMessageRx( Can_HwUnit *HwUnit, uint8 Controller )
+CAN_RAMFUNC CAN_STATIC void Can_Isr_HighPriorityMessageRx( Can_HwUnit *HwUnit, uint8 Controller )
 {
     (void)HwUnit;
     (void)Controller;
@@ -1763,7 +2412,7 @@ CAN_STATIC void Can_Isr_HighPriorityMessageRx( Can_HwUnit *HwUnit, uint8 Control
  *
  * @reqs    SWS_Can_00016
  */
-CAN_STATIC void Can_Isr_TransmissionCompleted( Can_HwUnit *HwUnit, uint8 Controller )
+CAN_RAMFUNC CAN_STATIC void Can_Isr_TransmissionCompleted( Can_HwUnit *HwUnit, uint8 Controller )
 {
     /* get controller configuration */
     const Can_Controller *ControllerConfig = &HwUnit->Config->Controllers[ Controller ];
@@ -1860,7 +2509,7 @@ CAN_STATIC void Can_Isr_TxEventFifoFull( Can_HwUnit *HwUnit, uint8 Controller )
  *
  * @reqs    SWS_Can_00016
  */
-CAN_STATIC void Can_Isr_TxEventFifoNewEntry( Can_HwUnit *HwUnit, uint8 Controller )
+CAN_RAMFUNC CAN_STATIC void Can_Isr_TxEventFifoNewEntry( Can_HwUnit *HwUnit, uint8 Controller )
 {
     /* get controller configuration */
     const Can_Controller *ControllerConfig = &HwUnit->Config->Controllers[ Controller ];
@@ -1888,7 +2537,7 @@ CAN_STATIC void Can_Isr_TxEventFifoNewEntry( Can_HwUnit *HwUnit, uint8 Controlle
  *
  * @reqs    SWS_Can_00016
  */
-CAN_STATIC void Can_Isr_TxFifoEmpty( Can_HwUnit *HwUnit, uint8 Controller )
+CAN_RAMFUNC CAN_STATIC void Can_Isr_TxFifoEmpty( Can_HwUnit *HwUnit, uint8 Controller )
 {
     /* get controller configuration */
     const Can_Controller *ControllerConfig = &HwUnit->Config->Controllers[ Controller ];
@@ -2033,7 +2682,7 @@ CAN_STATIC void Can_Isr_BusOffStatus( Can_HwUnit *HwUnit, uint8 Controller )
         }
 
         /* Enable configuration change */
-        Bfx_SetBit_u32u8( (uint32 *)&Can->CCCR, CCCR_CCE_BIT );
+        Bfx_SetBit_vu32u8( &Can->CCCR, CCCR_CCE_BIT );
 
         /* Change CAN peripheral state */
         HwUnit->ControllerState[ Controller ] = CAN_CS_STOPPED;
@@ -84,6 +84,15 @@
 /**
  * @} */
 
+/**
+ * @defgroup CAN_Processing CAN Event Processing
+ *
+ * @{ */
+#define CAN_PROCESSING_INTERRUPT       0u /*!< Events handled on the controller interrupts */
+#define CAN_PROCESSING_POLLING         1u /*!< Events handled by the Can main functions    */
+/**
+ * @} */
+
 /**
  * @defgroup CAN_TxBuffer CAN Trnasmit Buffers
  *
@@ -309,10 +318,15 @@ Std_ReturnType Can_Arch_GetControllerMode( Can_HwUnit *HwUnit, uint8 Controller,
 Std_ReturnType Can_Arch_GetControllerRxErrorCounter( Can_HwUnit *HwUnit, uint8 ControllerId, uint8 *RxErrorCounterPtr );
 Std_ReturnType Can_Arch_GetControllerTxErrorCounter( Can_HwUnit *HwUnit, uint8 ControllerId, uint8 *TxErrorCounterPtr );
 Std_ReturnType Can_Arch_Write( Can_HwUnit *HwUnit, Can_HwHandleType Hth, const Can_PduType *PduInfo );
+uint8 Can_Arch_WriteBatch( Can_HwUnit *HwUnit, Can_HwHandleType Hth, const Can_PduType *PduInfo, uint8 Count );
 Std_ReturnType Can_Arch_GetCurrentTime( Can_HwUnit *HwUnit, uint8 ControllerId, Can_TimeStampType *timeStampPtr );
 void Can_Arch_EnableEgressTimeStamp( Can_HwUnit *HwUnit, Can_HwHandleType Hth );
 Std_ReturnType Can_Arch_GetEgressTimeStamp( Can_HwUnit *HwUnit, PduIdType TxPduId, Can_HwHandleType Hth, Can_TimeStampType *timeStampPtr );
 Std_ReturnType Can_Arch_GetIngressTimeStamp( Can_HwUnit *HwUnit, Can_HwHandleType Hrh, Can_TimeStampType *timeStampPtr );
-void Can_Arch_IsrMainHandler( Can_HwUnit *HwUnit, uint8 Controller );
+void Can_Arch_IsrMainHandler( Can_HwUnit *HwUnit, uint8 Controller, uint8 Line );
+void Can_Arch_MainFunction_Write( Can_HwUnit *HwUnit, uint8 Controller );
+void Can_Arch_MainFunction_Read( Can_HwUnit *HwUnit, uint8 Controller );
+void Can_Arch_MainFunction_BusOff( Can_HwUnit *HwUnit, uint8 Controller );
+void Can_Arch_MainFunction_Mode( Can_HwUnit *HwUnit, uint8 Controller );
 
 #endif /* CAN_ARCH_H__ */
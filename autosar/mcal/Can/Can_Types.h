@@ -41,6 +41,7 @@
 #define CAN_ID_GET_CTRL_RX_ERR_CNT 0x30u /*!< Can_GetControllerRxErrorCounter() api service id */
 #define CAN_ID_GET_CTRL_TX_ERR_CNT 0x31u /*!< Can_GetControllerTxErrorCounter() api service id */
 #define CAN_ID_WRITE               0x06u /*!< Can_Write() api service id */
+#define CAN_ID_WRITE_BATCH         0x40u /*!< Can_WriteBatch() api service id, vendor specific */
 #define CAN_ID_MF_WRITE            0x01u /*!< Can_MainFunction_Write() api service id */
 #define CAN_ID_MF_READ             0x08u /*!< Can_MainFunction_Read() api service id */
 #define CAN_ID_MF_BUSOFF           0x09u /*!< Can_MainFunction_BusOff() api service id */
@@ -157,6 +158,15 @@ typedef struct _Can_Controller
     uint32 ActiveITs; /*!< Specifies the interrupts to be enabled on Line0.
                                This parameter can be a value of CAN_IT_<interrupt> */
 
+    uint8 RxProcessing; /*!< Reception handled on its interrupts or by Can_MainFunction_Read
+                             This parameter can be a value of @ref CAN_Processing */
+
+    uint8 TxProcessing; /*!< Transmit confirmation handled on its interrupts or by Can_MainFunction_Write
+                             This parameter can be a value of @ref CAN_Processing */
+
+    uint8 BusoffProcessing; /*!< Bus off handled on its interrupt or by Can_MainFunction_BusOff
+                                 This parameter can be a value of @ref CAN_Processing */
+
     uint8 CanReference; /*!< Base address of the Mcu CAN controller
                                   this paramter must be CAN_FDCAN1 or CAN_FDCAN2 */
 
@@ -249,10 +259,11 @@ typedef struct _Can_ConfigType
  */
 typedef struct _Can_HwUnit
 {
-    uint8 HwUnitState;                        /*!< CAN hardware unit state */
-    const Can_ConfigType *Config;             /*!< Pointer to the configuration structure */
-    Can_ControllerStateType *ControllerState; /*!< CAN controller states */
-    uint8 DisableIntsLvl[ 2u ];               /*!< Disable interrupts counter */
+    uint8 HwUnitState;                           /*!< CAN hardware unit state */
+    const Can_ConfigType *Config;                /*!< Pointer to the configuration structure */
+    Can_ControllerStateType *ControllerState;    /*!< CAN controller states */
+    uint8 DisableIntsLvl[ 2u ];                  /*!< Disable interrupts counter */
+    Can_ControllerStateType ModeIndicated[ 2u ]; /*!< Last controller state indicated to the upper layer */
 } Can_HwUnit;
 
 #endif /* CAN_TYPES_H__ */
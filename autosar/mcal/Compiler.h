@@ -0,0 +1,61 @@
+/**
+ * @file    Compiler.h
+ * @brief   **Specification of Compiler Abstraction**
+ *
+ * This file contains the compiler specific keywords used by the drivers, so the source code does not
+ * need to change when moving from one compiler to another. Only GCC is supported by now.
+ *
+ * RAM execution: the functions marked with RAMFUNC are linked into the .ramfunc section, which
+ * lives inside .data, so the startup code copies them from flash along with the initialized
+ * variables before main is called. The code runs from SRAM at zero wait states while the flash
+ * needs two wait states at 64MHz. Each driver enables or disables the placement of its hot
+ * functions with its own switch in the configuration header, every switch is STD_OFF by default
+ * since the SRAM taken is only worth it once the gain is measured on the target for the code
+ * actually called from the interrupts. These are the functions each switch places in RAM:
+ *
+ * | Switch              | Functions                                                          |
+ * |---------------------|--------------------------------------------------------------------|
+ * | CAN_RAM_FUNCTIONS   | Can_Isr_Lines, Can_Isr_Line0, Can_Isr_Line1,                       |
+ * |                     | Can_Arch_IsrMainHandler, Can_Arch_Write,                           |
+ * |                     | Can_GetMessage, Can_ReadRxFifo, Can_Isr_RxFifo0NewMessage,         |
+ * |                     | Can_Isr_RxFifo1NewMessage, Can_GetClosestDlc, Can_WriteTxPayload,  |
+ * |                     | Can_Arch_WriteBatch, Can_BuildTxHeader, Can_WriteTxElement,        |
+ * |                     | Can_PendRxFifoLeft, Can_GetLineFlags,                              |
+ * |                     | Can_Isr_HighPriorityMessageRx, Can_Isr_TransmissionCompleted,      |
+ * |                     | Can_Isr_TxEventFifoNewEntry, Can_Isr_TxFifoEmpty, Can_MergeTxBytes |
+ * | DIO_RAM_FUNCTIONS   | Dio_Arch_ReadChannel, Dio_Arch_WriteChannel, Dio_Arch_FlipChannel, |
+ * |                     | Dio_Arch_ReadPort, Dio_Arch_WritePort, Dio_Arch_ReadChannelGroup,  |
+ * |                     | Dio_Arch_WriteChannelGroup, Dio_Arch_MaskedWritePort               |
+ * | GPT_RAM_FUNCTIONS   | Gpt_Arch_Notification_Channel0, Gpt_Arch_Notification_Channel1     |
+ * | CRC_RAM_FUNCTIONS   | Crc_CalculateCRC8, Crc_CalculateCRC8H2F, Crc_CalculateCRC16,       |
+ * |                     | Crc_CalculateCRC16ARC, Crc_CalculateCRC32, Crc_CalculateCRC32P4,   |
+ * |                     | Crc_CalculateCRC64, Crc_Slice4Reflected32, Crc_Slice4Reflected64,  |
+ * |                     | Crc_WordReflected32                                                |
+ *
+ * The rest of the code stays in flash, the linker inserts long branch veneers on the calls between
+ * both memories. Bfx static inline functions are only inlined into the RAM functions when the
+ * code is built with optimizations, at -O0 they are called from flash through veneers, so the
+ * switches are meant for optimized builds. The Can functions still call Mem_CopyToVolatile32 and
+ * Mem_SetVolatile32 in flash for the FD payloads over 8 bytes. The CRC lookup tables stay in
+ * flash, so the table driven CRC kernels still pay the wait states on each table read.
+ */
+#ifndef COMPILER_H
+#define COMPILER_H
+
+#ifndef UTEST
+/**
+ * @brief Place a function in the .ramfunc section, noinline avoids the function being copied
+ * back into a flash caller
+ */
+#define RAMFUNC __attribute__( ( section( ".ramfunc" ), noinline ) )
+#else
+#define RAMFUNC /*!< Functions stay in place when running the unit tests on the host */
+#endif
+
+/**
+ * @brief Type attribute to access any object through a pointer to the type without breaking the
+ * strict aliasing rules, used by the word wise memory routines
+ */
+#define MAY_ALIAS __attribute__( ( may_alias ) )
+
+#endif /* COMPILER_H */
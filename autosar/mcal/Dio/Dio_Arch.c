@@ -11,8 +11,16 @@
 #include "Std_Types.h"
 #include "Registers.h"
 #include "Bfx.h"
+#include "Dio_Cfg.h"
 #include "Dio_Arch.h"
 
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Dio_Cfg.h */
+#if DIO_RAM_FUNCTIONS == STD_ON
+#define DIO_RAMFUNC RAMFUNC /*!< Hot functions executed from RAM */
+#else
+#define DIO_RAMFUNC /*!< Hot functions executed from flash */
+#endif
+
 #define GPIOx_BSRR_OFFSET 8u /*!< Offset to set the bit in BSRR register */
 
 /**
@@ -33,7 +41,7 @@ static Dio_RegisterType *DiosPeripherals[] = { DIOA, DIOB, DIOC, DIOD, DIOE, DIO
  *
  * @reqs  SWS_Dio_00027, SWS_Dio_00074
  */
-Dio_LevelType Dio_Arch_ReadChannel( Dio_PortType Port, uint8 Pin )
+DIO_RAMFUNC Dio_LevelType Dio_Arch_ReadChannel( Dio_PortType Port, uint8 Pin )
 {
     return Bfx_GetBit_u32u8_u8( DiosPeripherals[ Port ]->IDR, Pin );
 }
@@ -50,9 +58,9 @@ Dio_LevelType Dio_Arch_ReadChannel( Dio_PortType Port, uint8 Pin )
  *
  * @reqs  SWS_Dio_00028, SWS_Dio_00029, SWS_Dio_00079
  */
-void Dio_Arch_WriteChannel( Dio_PortType Port, uint8 Pin, Dio_LevelType Level )
+DIO_RAMFUNC void Dio_Arch_WriteChannel( Dio_PortType Port, uint8 Pin, Dio_LevelType Level )
 {
-    Bfx_PutBit_u32u8u8( (uint32 *)&DiosPeripherals[ Port ]->ODR, Pin, Level );
+    Bfx_PutBitAtomic_vu32u8u8( &DiosPeripherals[ Port ]->ODR, Pin, Level );
 }
 
 /**
@@ -70,12 +78,12 @@ void Dio_Arch_WriteChannel( Dio_PortType Port, uint8 Pin, Dio_LevelType Level )
  *
  * @reqs  SWS_Dio_00191, SWS_Dio_00192, SWS_Dio_00193
  */
-Dio_LevelType Dio_Arch_FlipChannel( Dio_PortType Port, uint8 Pin )
+DIO_RAMFUNC Dio_LevelType Dio_Arch_FlipChannel( Dio_PortType Port, uint8 Pin )
 {
     /*read the actual bit status*/
     uint8 Bit = Bfx_GetBit_u32u8_u8( DiosPeripherals[ Port ]->IDR, Pin );
     /*flip its value*/
-    Bfx_SetBit_u32u8( (uint32 *)&DiosPeripherals[ Port ]->BSRR, ( Pin + ( GPIOx_BSRR_OFFSET * Bit ) ) );
+    Bfx_SetBit_vu32u8( &DiosPeripherals[ Port ]->BSRR, ( Pin + ( GPIOx_BSRR_OFFSET * Bit ) ) );
 
     return Bfx_GetBit_u32u8_u8( DiosPeripherals[ Port ]->IDR, Pin );
 }
@@ -92,7 +100,7 @@ Dio_LevelType Dio_Arch_FlipChannel( Dio_PortType Port, uint8 Pin )
  *
  * @reqs  SWS_Dio_00031, SWS_Dio_00104, SWS_Dio_00075
  */
-Dio_PortLevelType Dio_Arch_ReadPort( Dio_PortType Port )
+DIO_RAMFUNC Dio_PortLevelType Dio_Arch_ReadPort( Dio_PortType Port )
 {
     return DiosPeripherals[ Port ]->IDR;
 }
@@ -108,7 +116,7 @@ Dio_PortLevelType Dio_Arch_ReadPort( Dio_PortType Port )
  *
  * @reqs  SWS_Dio_00034, SWS_Dio_00035, SWS_Dio_00105, SWS_Dio_00108
  */
-void Dio_Arch_WritePort( Dio_PortType Port, Dio_PortLevelType Level )
+DIO_RAMFUNC void Dio_Arch_WritePort( Dio_PortType Port, Dio_PortLevelType Level )
 {
     DiosPeripherals[ Port ]->ODR = Level;
 }
@@ -125,14 +133,14 @@ void Dio_Arch_WritePort( Dio_PortType Port, Dio_PortLevelType Level )
  *
  * @reqs  SWS_Dio_00037, SWS_Dio_00092, SWS_Dio_00093, SWS_Dio_00114
  */
-Dio_PortLevelType Dio_Arch_ReadChannelGroup( const Dio_ChannelGroupType *ChannelGroupIdPtr )
+DIO_RAMFUNC Dio_PortLevelType Dio_Arch_ReadChannelGroup( const Dio_ChannelGroupType *ChannelGroupIdPtr )
 {
     Dio_PortLevelType GroupLevel = DiosPeripherals[ ChannelGroupIdPtr->port ]->IDR;
 
     /*clear the values outside the mask*/
-    Bfx_ClrBitMask_u32u32( (uint32 *)&GroupLevel, ~ChannelGroupIdPtr->mask );
+    Bfx_ClrBitMask_u32u32( &GroupLevel, ~ChannelGroupIdPtr->mask );
     /*rotate offset to extract the actual value marked by the mask */
-    Bfx_ShiftBitRt_u32u8( (uint32 *)&GroupLevel, ChannelGroupIdPtr->offset );
+    Bfx_ShiftBitRt_u32u8( &GroupLevel, ChannelGroupIdPtr->offset );
 
     return GroupLevel;
 }
@@ -149,11 +157,11 @@ Dio_PortLevelType Dio_Arch_ReadChannelGroup( const Dio_ChannelGroupType *Channel
  *
  * @reqs  SWS_Dio_00039, SWS_Dio_00040, SWS_Dio_00090, SWS_Dio_00091
  */
-void Dio_Arch_WriteChannelGroup( const Dio_ChannelGroupType *ChannelGroupIdPtr, Dio_PortLevelType Level )
+DIO_RAMFUNC void Dio_Arch_WriteChannelGroup( const Dio_ChannelGroupType *ChannelGroupIdPtr, Dio_PortLevelType Level )
 {
     Dio_RegisterType *Port = DiosPeripherals[ ChannelGroupIdPtr->port ];
 
-    Bfx_PutBits_u32u8u8u32( (uint32 *)&Port->ODR, ChannelGroupIdPtr->offset, ChannelGroupIdPtr->mask, Level );
+    Bfx_PutBitsAtomic_vu32u8u8u32( &Port->ODR, ChannelGroupIdPtr->offset, ChannelGroupIdPtr->mask, Level );
 }
 
 /**
@@ -168,7 +176,7 @@ void Dio_Arch_WriteChannelGroup( const Dio_ChannelGroupType *ChannelGroupIdPtr,
  *
  * @reqs  SWS_Dio_00202, SWS_Dio_00203, SWS_Dio_00204
  */
-void Dio_Arch_MaskedWritePort( Dio_PortType Port, Dio_PortLevelType Level, Dio_PortLevelType Mask )
+DIO_RAMFUNC void Dio_Arch_MaskedWritePort( Dio_PortType Port, Dio_PortLevelType Level, Dio_PortLevelType Mask )
 {
-    Bfx_PutBitsMask_u32u32u32( (uint32 *)&DiosPeripherals[ Port ]->ODR, Mask, Level );
+    Bfx_PutBitsMaskAtomic_vu32u32u32( &DiosPeripherals[ Port ]->ODR, Mask, Level );
 }
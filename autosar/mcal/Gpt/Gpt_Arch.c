@@ -14,6 +14,13 @@
 #include "Gpt.h"
 #include "Gpt_Arch.h"
 
+/* cppcheck-suppress misra-c2012-20.9 ; this is declared at Gpt_Cfg.h */
+#if GPT_RAM_FUNCTIONS == STD_ON
+#define GPT_RAMFUNC RAMFUNC /*!< Hot functions executed from RAM */
+#else
+#define GPT_RAMFUNC /*!< Hot functions executed from flash */
+#endif
+
 /**
  * @brief Global GPT register array.
  */
@@ -38,13 +45,13 @@ void Gpt_Arch_Init( const Gpt_ConfigType *ConfigPtr, uint32 ChannelsToInit )
 
     channel = GptPeripherals[ ConfigPtr->Channels[ ChannelsToInit ].GptReference ];
     /*Clearing the value of the prescaler on TIMx_PSC*/
-    Bfx_SetBits_u32u8u8u8( (uint32 *)&channel->PSC, GPT_PRESCALER_LSB, GPT_PRESCALER_MSB, STD_OFF );
+    Bfx_SetBits_vu32u8u8u8( &channel->PSC, GPT_PRESCALER_LSB, GPT_PRESCALER_MSB, STD_OFF );
     /*Writing the value of the prescaler on TIMx_PSC*/
-    Bfx_SetBitMask_u32u32( (uint32 *)&channel->PSC, (uint32)ConfigPtr->Channels[ ChannelsToInit ].GptChannelPrescaler );
+    Bfx_SetBitMask_vu32u32( &channel->PSC, (uint32)ConfigPtr->Channels[ ChannelsToInit ].GptChannelPrescaler );
     /*Writing the OPM: bit of TIMx_CR1 for continuous or one-pulse mode*/
-    Bfx_PutBit_u32u8u8( (uint32 *)&channel->CR1, GPT_ONE_PULSE_MODE_BIT, (uint32)ConfigPtr->Channels[ ChannelsToInit ].GptChannelMode );
+    Bfx_PutBit_vu32u8u8( &channel->CR1, GPT_ONE_PULSE_MODE_BIT, (uint32)ConfigPtr->Channels[ ChannelsToInit ].GptChannelMode );
     /*Clearing the update interrupt flag of TIMx_SR*/
-    Bfx_ClrBit_u32u8( (uint32 *)&channel->SR, GPT_INTERRUPT_FLAG_BIT );
+    Bfx_ClrBit_vu32u8( &channel->SR, GPT_INTERRUPT_FLAG_BIT );
 }
 
 /**
@@ -63,13 +70,13 @@ void Gpt_Arch_DeInit( const Gpt_ConfigType *ConfigPtr, uint32 ChannelsToDeinit )
 
     channel = GptPeripherals[ ConfigPtr->Channels[ ChannelsToDeinit ].GptReference ];
     /*Clearing the value of the prescaler on TIMx_PSC*/
-    Bfx_SetBits_u32u8u8u8( (uint32 *)&channel->PSC, GPT_PRESCALER_LSB, GPT_PRESCALER_MSB, STD_OFF );
+    Bfx_SetBits_vu32u8u8u8( &channel->PSC, GPT_PRESCALER_LSB, GPT_PRESCALER_MSB, STD_OFF );
     /*Clearing the OPM: bit of TIMx_CR1*/
-    Bfx_ClrBit_u32u8( (uint32 *)&channel->CR1, GPT_ONE_PULSE_MODE_BIT );
+    Bfx_ClrBit_vu32u8( &channel->CR1, GPT_ONE_PULSE_MODE_BIT );
     /*Clearing the update interrupt flag of TIMx_SR*/
-    Bfx_ClrBit_u32u8( (uint32 *)&channel->SR, GPT_INTERRUPT_FLAG_BIT );
+    Bfx_ClrBit_vu32u8( &channel->SR, GPT_INTERRUPT_FLAG_BIT );
     /*Setting back the reset value of TIMx_ARR*/
-    Bfx_SetBits_u32u8u8u8( (uint32 *)&channel->ARR, GPT_AUTO_RELOAD_LSB, GPT_AUTO_RELOAD_MSB, STD_ON );
+    Bfx_SetBits_vu32u8u8u8( &channel->ARR, GPT_AUTO_RELOAD_LSB, GPT_AUTO_RELOAD_MSB, STD_ON );
 }
 
 /**
@@ -134,11 +141,11 @@ void Gpt_Arch_StartTimer( const Gpt_ConfigType *ConfigPtr, Gpt_ChannelType Chann
 
     channel = GptPeripherals[ ConfigPtr->Channels[ Channel ].GptReference ];
     /*Clearing the reset value of TIMx_ARR*/
-    Bfx_SetBits_u32u8u8u8( (uint32 *)&channel->ARR, GPT_AUTO_RELOAD_LSB, GPT_AUTO_RELOAD_MSB, STD_OFF );
+    Bfx_SetBits_vu32u8u8u8( &channel->ARR, GPT_AUTO_RELOAD_LSB, GPT_AUTO_RELOAD_MSB, STD_OFF );
     /*Writing the value of Period on TIMx_ARR*/
-    Bfx_SetBitMask_u32u32( (uint32 *)&channel->ARR, Value );
+    Bfx_SetBitMask_vu32u32( &channel->ARR, Value );
     /*Setting the CEN: bit of TIMx_CR1*/
-    Bfx_SetBit_u32u8( (uint32 *)&channel->CR1, GPT_COUNTER_ENABLE_BIT );
+    Bfx_SetBit_vu32u8( &channel->CR1, GPT_COUNTER_ENABLE_BIT );
 }
 
 /**
@@ -156,7 +163,7 @@ void Gpt_Arch_StopTimer( const Gpt_ConfigType *ConfigPtr, Gpt_ChannelType Channe
     Gpt_RegisterType *channel;
 
     channel = GptPeripherals[ ConfigPtr->Channels[ Channel ].GptReference ];
-    Bfx_ClrBit_u32u8( (uint32 *)&channel->CR1, GPT_COUNTER_ENABLE_BIT ); /*Clearing the CEN: bit of TIMx_CR1*/
+    Bfx_ClrBit_vu32u8( &channel->CR1, GPT_COUNTER_ENABLE_BIT ); /*Clearing the CEN: bit of TIMx_CR1*/
 }
 
 /**
@@ -175,7 +182,7 @@ void Gpt_Arch_EnableNotification( const Gpt_ConfigType *ConfigPtr, Gpt_ChannelTy
     Gpt_RegisterType *channel;
 
     channel = GptPeripherals[ ConfigPtr->Channels[ Channel ].GptReference ];
-    Bfx_ClrBit_u32u8( (uint32 *)&channel->CR1, GPT_UPDATE_DISABLE_BIT ); /*Clearing the UDIS: bit of TIMx_CR1*/
+    Bfx_ClrBit_vu32u8( &channel->CR1, GPT_UPDATE_DISABLE_BIT ); /*Clearing the UDIS: bit of TIMx_CR1*/
 }
 
 /**
@@ -194,7 +201,7 @@ void Gpt_Arch_DisableNotification( const Gpt_ConfigType *ConfigPtr, Gpt_ChannelT
     Gpt_RegisterType *channel;
 
     channel = GptPeripherals[ ConfigPtr->Channels[ Channel ].GptReference ];
-    Bfx_SetBit_u32u8( (uint32 *)&channel->CR1, GPT_UPDATE_DISABLE_BIT ); /*Setting the UDIS: bit of TIMx_CR1*/
+    Bfx_SetBit_vu32u8( &channel->CR1, GPT_UPDATE_DISABLE_BIT ); /*Setting the UDIS: bit of TIMx_CR1*/
 }
 
 /**
@@ -209,7 +216,7 @@ void Gpt_Arch_DisableNotification( const Gpt_ConfigType *ConfigPtr, Gpt_ChannelT
  *
  * @reqs   SWS_Gpt_00292, SWS_Gpt_00086, SWS_Gpt_00209, SWS_Gpt_00093, SWS_Gpt_00233, SWS_Gpt_00206
  */
-void Gpt_Arch_Notification_Channel0( const Gpt_ConfigType *ConfigPtr )
+GPT_RAMFUNC void Gpt_Arch_Notification_Channel0( const Gpt_ConfigType *ConfigPtr )
 {
     Gpt_RegisterType *channel;
     channel = GptPeripherals[ GPT_CHANNEL_0 ];
@@ -221,7 +228,7 @@ void Gpt_Arch_Notification_Channel0( const Gpt_ConfigType *ConfigPtr )
             ConfigPtr->Channels[ GPT_CHANNEL_0 ].GptNotification( );
         }
 
-        Bfx_ClrBit_u32u8( (uint32 *)channel->SR, GPT_INTERRUPT_FLAG_BIT ); /*Clearing the update interrupt flag of TIMx_SR*/
+        Bfx_ClrBit_vu32u8( &channel->SR, GPT_INTERRUPT_FLAG_BIT ); /*Clearing the update interrupt flag of TIMx_SR*/
     }
 }
 
@@ -237,7 +244,7 @@ void Gpt_Arch_Notification_Channel0( const Gpt_ConfigType *ConfigPtr )
  *
  * @reqs   SWS_Gpt_00292, SWS_Gpt_00086, SWS_Gpt_00209, SWS_Gpt_00093, SWS_Gpt_00233, SWS_Gpt_00206
  */
-void Gpt_Arch_Notification_Channel1( const Gpt_ConfigType *ConfigPtr )
+GPT_RAMFUNC void Gpt_Arch_Notification_Channel1( const Gpt_ConfigType *ConfigPtr )
 {
     Gpt_RegisterType *channel;
     channel = GptPeripherals[ GPT_CHANNEL_1 ];
@@ -249,6 +256,6 @@ void Gpt_Arch_Notification_Channel1( const Gpt_ConfigType *ConfigPtr )
             ConfigPtr->Channels[ GPT_CHANNEL_1 ].GptNotification( );
         }
 
-        Bfx_ClrBit_u32u8( (uint32 *)channel->SR, GPT_INTERRUPT_FLAG_BIT ); /*Clearing the update interrupt flag of TIMx_SR*/
+        Bfx_ClrBit_vu32u8( &channel->SR, GPT_INTERRUPT_FLAG_BIT ); /*Clearing the update interrupt flag of TIMx_SR*/
     }
 }
@@ -33,8 +33,10 @@
 /* cppcheck-suppress misra-c2012-8.4 ; qualifier is declared at Mcu.h */
 MCU_STATIC Mcu_HwUnit HwUnit_Mcu =
 {
-    .HwUnitState = MCU_STATE_UNINIT,
-    .Config      = NULL_PTR
+    .HwUnitState   = MCU_STATE_UNINIT,
+    .Config        = NULL_PTR,
+    .ResetRawValue = 0u,
+    .RamState      = MCU_RAMSTATE_INVALID
 };
 /* clang-format on */
 
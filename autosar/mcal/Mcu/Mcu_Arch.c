@@ -11,6 +11,67 @@
 #include "Std_Types.h"
 #include "Mcu_Cfg.h"
 #include "Mcu_Arch.h"
+#include "Crc.h"
+
+#ifndef UTEST
+/**
+ * @brief Complete all the outstanding memory accesses before the next instruction
+ */
+#define MCU_DSB( )        __asm volatile( "dsb" : : : "memory" )
+/**
+ * @brief Nothing else to run once the reset has been requested, wait here until it takes place
+ */
+#define MCU_WAIT_RESET( ) for( ;; )
+#else
+#define MCU_DSB( )        (void)0 /*!< No barriers needed when running the unit tests on the host */
+#define MCU_WAIT_RESET( ) (void)0 /*!< Return to the test once the reset is requested */
+#endif
+
+/**
+ * @defgroup RCC_CSR_Bits RCC control/status register reset flags
+ *
+ * @{ */
+#define RCC_CSR_RMVF          0x00800000u /*!< Remove reset flags */
+#define RCC_CSR_PWRRSTF       0x08000000u /*!< BOR or POR/PDR reset flag */
+#define RCC_CSR_SFTRSTF       0x10000000u /*!< Software reset flag */
+#define RCC_CSR_IWDGRSTF      0x20000000u /*!< Independent watchdog reset flag */
+#define RCC_CSR_WWDGRSTF      0x40000000u /*!< Window watchdog reset flag */
+#define RCC_CSR_RESET_FLAGS   0xFE000000u /*!< All the reset flags */
+/**
+ * @} */
+
+/**
+ * @defgroup MCU_Arch_Values values used by the no-init RAM validation
+ *
+ * @{ */
+#define SCB_AIRCR_VECTKEY     0x05FA0000u /*!< Key required to write the AIRCR register */
+#define SCB_AIRCR_SYSRESETREQ 0x00000004u /*!< System reset request */
+#define SCB_AIRCR_PRIGROUP    0x00000700u /*!< Priority grouping, kept as it is on the reset request */
+#define MCU_NOINIT_MARKER     0x4E4F494Eu /*!< "NOIN", stamp holds a valid CRC */
+#define MCU_NOINIT_CRC_START  0xFFFFFFFFu /*!< CRC32 start value */
+/**
+ * @} */
+
+/*external reference variables from linker script, no-init RAM limits*/
+extern uint32 _snoinit; /*no-init RAM start address*/
+extern uint32 _enoinit; /*no-init RAM end address*/
+
+/**
+ * @brief  No-init RAM stamp, it is placed in front of the no-init RAM and it is neither
+ *         initialized by the startup nor part of the CRC.
+ */
+/* cppcheck-suppress misra-c2012-8.4 ; only referenced externally by the unit tests */
+__attribute__( ( section( ".noinit_stamp" ) ) ) MCU_STATIC Mcu_NoInitStampType Mcu_NoInitStamp;
+
+/**
+ * @brief  No-init RAM limits, taken from the linker script symbols.
+ */
+/* cppcheck-suppress misra-c2012-11.3 ; the RAM is read as a stream of bytes */
+MCU_STATIC const uint8 *Mcu_NoInitStart = (const uint8 *)&_snoinit;
+/* cppcheck-suppress misra-c2012-11.3 ; the RAM is read as a stream of bytes */
+MCU_STATIC const uint8 *Mcu_NoInitEnd = (const uint8 *)&_enoinit;
+
+static uint32 Mcu_Arch_NoInitCrc( void );
 
 /**
  * @brief    **MCU Low Level Initialization**
@@ -24,8 +85,23 @@
  */
 void Mcu_Arch_Init( Mcu_HwUnit *HwUnit, const Mcu_ConfigType *ConfigPtr )
 {
-    (void)HwUnit;
     (void)ConfigPtr;
+
+    /*latch and clear the reset flags, the next reset shall only report its own cause*/
+    HwUnit->ResetRawValue = RCC->CSR & RCC_CSR_RESET_FLAGS;
+    RCC->CSR |= RCC_CSR_RMVF;
+
+    /*the no-init RAM is valid only after a reset that does not cut the supply, with the stamp
+    written by Mcu_PerformReset and no change on the content since then*/
+    HwUnit->RamState = MCU_RAMSTATE_INVALID;
+    if( ( ( HwUnit->ResetRawValue & RCC_CSR_PWRRSTF ) == 0u ) && ( Mcu_NoInitStamp.Marker == MCU_NOINIT_MARKER ) &&
+        ( Mcu_NoInitStamp.Crc == Mcu_Arch_NoInitCrc( ) ) )
+    {
+        HwUnit->RamState = MCU_RAMSTATE_VALID;
+    }
+
+    /*the stamp is consumed, it validates the content for a single reset*/
+    Mcu_NoInitStamp.Marker = 0u;
 }
 
 /**
@@ -118,8 +194,26 @@ Mcu_PllStatusType Mcu_Arch_GetPllStatus( Mcu_HwUnit *HwUnit )
  */
 Mcu_ResetType Mcu_Arch_GetResetReason( Mcu_HwUnit *HwUnit )
 {
-    (void)HwUnit;
-    return E_NOT_OK;
+    Mcu_ResetType Reason = MCU_RESET_UNDEFINED;
+
+    if( ( HwUnit->ResetRawValue & RCC_CSR_PWRRSTF ) != 0u )
+    {
+        Reason = MCU_POWER_ON_RESET;
+    }
+    else if( ( HwUnit->ResetRawValue & ( RCC_CSR_IWDGRSTF | RCC_CSR_WWDGRSTF ) ) != 0u )
+    {
+        Reason = MCU_WATCHDOG_RESET;
+    }
+    else if( ( HwUnit->ResetRawValue & RCC_CSR_SFTRSTF ) != 0u )
+    {
+        Reason = MCU_SW_RESET;
+    }
+    else
+    {
+        /* pin, option byte or low power reset */
+    }
+
+    return Reason;
 }
 
 /**
@@ -135,14 +229,16 @@ Mcu_ResetType Mcu_Arch_GetResetReason( Mcu_HwUnit *HwUnit )
  */
 Mcu_RawResetType Mcu_Arch_GetResetRawValue( Mcu_HwUnit *HwUnit )
 {
-    (void)HwUnit;
-    return E_NOT_OK;
+    return HwUnit->ResetRawValue;
 }
 
 /**
  * @brief    **Reset the MCU Low Level**
  *
- * Service to perform a microcontroller reset
+ * Service to perform a microcontroller reset. Right before the reset the CRC of the no-init RAM
+ * is stamped, so after the reset Mcu_GetRamState reports whether the content can be reused.
+ * The request follows the CMSIS NVIC_SystemReset sequence, the stamp is completed before the
+ * AIRCR write and the function never returns, it waits until the reset takes place.
  *
  * @param   HwUnit Pointer to the hardware unit configuration
  *
@@ -151,6 +247,15 @@ Mcu_RawResetType Mcu_Arch_GetResetRawValue( Mcu_HwUnit *HwUnit )
 void Mcu_Arch_PerformReset( Mcu_HwUnit *HwUnit )
 {
     (void)HwUnit;
+
+    Mcu_NoInitStamp.Crc    = Mcu_Arch_NoInitCrc( );
+    Mcu_NoInitStamp.Marker = MCU_NOINIT_MARKER;
+
+    MCU_DSB( );
+    SCB->AIRCR = SCB_AIRCR_VECTKEY | ( SCB->AIRCR & SCB_AIRCR_PRIGROUP ) | SCB_AIRCR_SYSRESETREQ;
+    MCU_DSB( );
+
+    MCU_WAIT_RESET( );
 }
 
 /**
@@ -172,7 +277,8 @@ void Mcu_Arch_SetMode( Mcu_HwUnit *HwUnit, Mcu_ModeType McuMode )
 /**
  * @brief    **Get status of MCU RAM Low Level **
  *
- * Service which provides the actual status of the microcontroller RAM. (if supported)
+ * Service which provides the actual status of the microcontroller RAM. (if supported). The state
+ * refers to the no-init RAM and it is evaluated once at Mcu_Init.
  *
  * @param   HwUnit Pointer to the hardware unit configuration
  *
@@ -182,6 +288,16 @@ void Mcu_Arch_SetMode( Mcu_HwUnit *HwUnit, Mcu_ModeType McuMode )
  */
 Mcu_RamStateType Mcu_Arch_GetRamState( Mcu_HwUnit *HwUnit )
 {
-    (void)HwUnit;
-    return E_NOT_OK;
+    return HwUnit->RamState;
+}
+
+/**
+ * @brief    **CRC of the no-init RAM**
+ *
+ * @retval  CRC32 of the no-init RAM content
+ */
+static uint32 Mcu_Arch_NoInitCrc( void )
+{
+    /* cppcheck-suppress misra-c2012-18.4 ; both pointers are on the same section */
+    return Crc_CalculateCRC32( Mcu_NoInitStart, (uint32)( Mcu_NoInitEnd - Mcu_NoInitStart ), MCU_NOINIT_CRC_START, TRUE );
 }
@@ -162,8 +162,23 @@ typedef struct _Mcu_ConfigType
  */
 typedef struct _Mcu_HwUnit
 {
-    const Mcu_ConfigType *Config; /*!< Pointer to the configuration structure */
-    Mcu_StatusType HwUnitState;   /*!< MCU hardware unit state                */
+    const Mcu_ConfigType *Config;   /*!< Pointer to the configuration structure      */
+    Mcu_StatusType HwUnitState;     /*!< MCU hardware unit state                     */
+    Mcu_RawResetType ResetRawValue; /*!< Reset flags latched at initialization       */
+    Mcu_RamStateType RamState;      /*!< State of the no-init RAM after the reset    */
 } Mcu_HwUnit;
 
+/**
+ * @brief **No-init RAM stamp**
+ *
+ * Written by Mcu_PerformReset right before the software reset and verified by Mcu_Init, it lives
+ * in the .noinit_stamp section just in front of the no-init RAM so it survives the reset but it
+ * is not part of the CRC.
+ */
+typedef struct _Mcu_NoInitStampType
+{
+    uint32 Marker; /*!< MCU_NOINIT_MARKER when the Crc field is valid */
+    uint32 Crc;    /*!< CRC32 of the no-init RAM                      */
+} Mcu_NoInitStampType;
+
 #endif
\ No newline at end of file
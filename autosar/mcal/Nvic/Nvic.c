@@ -60,6 +60,21 @@
 
 #define FIRST_INDEX       0U /*!< Starting index for NVIC register */
 
+/**
+  * @defgroup VectorValues representing the vector table layout
+  @{ */
+#define NVIC_EXCEPTIONS   16  /*!< Core exceptions in front of the first peripheral interrupt */
+#define NVIC_VECTORS      47u /*!< Entries in the vector table, stack pointer included */
+/**
+  @} */
+
+/**
+ * @brief Vector table in RAM, the startup code copies the flash table here and points VTOR to
+ * it, so the drivers can install their own handlers at runtime. The linker places it at the start
+ * of the RAM to get the alignment required by VTOR.
+ */
+__attribute__( ( section( ".ram_vectors" ) ) ) NVIC_STATIC Nvic_HandlerType Nvic_RamVectors[ NVIC_VECTORS ];
+
 /**
  * @brief Sets the priority for a specific peripheral interrupt in the NVIC.
  *
@@ -88,8 +103,7 @@ void CDD_Nvic_SetPriority( Nvic_IrqType Irq, uint32 Priority )
     }
     else
     {
-        Bfx_ClrBitMask_u32u32( (uint32 *)&NVIC->IP[ IP_IDX( Irq ) ], ( 0xFFUL << BIT_SHIFT( Irq ) ) );
-        Bfx_SetBitMask_u32u32( (uint32 *)&NVIC->IP[ IP_IDX( Irq ) ], ( ( ( Priority << ( 8U - 2U ) ) & (uint32)0xFFUL ) << BIT_SHIFT( Irq ) ) );
+        Bfx_PutBitsMask_vu32u32u32( &NVIC->IP[ IP_IDX( Irq ) ], ( ( ( Priority << ( 8U - 2U ) ) & (uint32)0xFFUL ) << BIT_SHIFT( Irq ) ), ( 0xFFUL << BIT_SHIFT( Irq ) ) );
     }
 }
 
@@ -146,7 +160,7 @@ void CDD_Nvic_EnableIrq( Nvic_IrqType Irq )
     }
     else
     {
-        Bfx_SetBit_u32u8( (uint32 *)&NVIC->ISER[ FIRST_INDEX ], ( (uint32)Irq ) & IRQ_MASK );
+        Bfx_SetBit_vu32u8( &NVIC->ISER[ FIRST_INDEX ], ( (uint32)Irq ) & IRQ_MASK );
     }
 }
 
@@ -170,7 +184,7 @@ void CDD_Nvic_DisableIrq( Nvic_IrqType Irq )
     }
     else
     {
-        Bfx_PutBit_u32u8u8( (uint32 *)&NVIC->ICER[ FIRST_INDEX ], ( (uint32)Irq ) & IRQ_MASK, FALSE );
+        Bfx_PutBit_vu32u8u8( &NVIC->ICER[ FIRST_INDEX ], ( (uint32)Irq ) & IRQ_MASK, FALSE );
     }
 }
 
@@ -224,7 +238,7 @@ void CDD_Nvic_SetPendingIrq( Nvic_IrqType Irq )
     }
     else
     {
-        Bfx_SetBit_u32u8( (uint32 *)&NVIC->ISPR[ FIRST_INDEX ], ( (uint32)Irq ) & IRQ_MASK );
+        Bfx_SetBit_vu32u8( &NVIC->ISPR[ FIRST_INDEX ], ( (uint32)Irq ) & IRQ_MASK );
     }
 }
 
@@ -248,6 +262,67 @@ void CDD_Nvic_ClearPendingIrq( Nvic_IrqType Irq )
     }
     else
     {
-        Bfx_PutBit_u32u8u8( (uint32 *)&NVIC->ICPR[ FIRST_INDEX ], ( (uint32)Irq ) & IRQ_MASK, TRUE );
+        Bfx_PutBit_vu32u8u8( &NVIC->ICPR[ FIRST_INDEX ], ( (uint32)Irq ) & IRQ_MASK, TRUE );
+    }
+}
+
+/**
+ * @brief Installs an interrupt service routine in the RAM vector table.
+ *
+ * The function checks if the interrupt number is a valid exception or peripheral interrupt and
+ * the handler is not NULL, then writes the handler in its entry. The CPU fetches the new address
+ * the next time the interrupt is taken, no wrapper in between.
+ *
+ * @param Irq       Interrupt number to set.
+ * @param Handler   Function to be called on the interrupt.
+ */
+void CDD_Nvic_SetHandler( Nvic_IrqType Irq, Nvic_HandlerType Handler )
+{
+    if( ( Irq < NonMaskableInt_IRQn ) || ( Irq > CEC_IRQn ) )
+    {
+        /* If development error detection for the Nvic module is enabled:
+        the function CDD_Nvic_SetHandler shall raise the error NVIC_E_PARAM_IRQ if the parameter
+        irq is out of range. */
+        Det_ReportError( NVIC_MODULE_ID, NVIC_INSTANCE_ID, NVIC_ID_SET_HANDLER, NVIC_E_PARAM_IRQ );
     }
+    else if( Handler == NULL_PTR )
+    {
+        /* If development error detection for the Nvic module is enabled:
+        the function CDD_Nvic_SetHandler shall raise the error NVIC_E_PARAM_POINTER if the parameter
+        handler is a NULL pointer. */
+        Det_ReportError( NVIC_MODULE_ID, NVIC_INSTANCE_ID, NVIC_ID_SET_HANDLER, NVIC_E_PARAM_POINTER );
+    }
+    else
+    {
+        Nvic_RamVectors[ (uint32)( (sint32)Irq + NVIC_EXCEPTIONS ) ] = Handler;
+    }
+}
+
+/**
+ * @brief Gets the interrupt service routine installed in the RAM vector table.
+ *
+ * The function checks if the interrupt number is a valid exception or peripheral interrupt. If
+ * valid, it returns the handler from its entry, otherwise NULL.
+ *
+ * @param Irq Interrupt number whose handler is to be retrieved.
+ *
+ * @retval Handler installed for the interrupt.
+ */
+Nvic_HandlerType CDD_Nvic_GetHandler( Nvic_IrqType Irq )
+{
+    Nvic_HandlerType Handler = NULL_PTR;
+
+    if( ( Irq < NonMaskableInt_IRQn ) || ( Irq > CEC_IRQn ) )
+    {
+        /* If development error detection for the Nvic module is enabled:
+        the function CDD_Nvic_GetHandler shall raise the error NVIC_E_PARAM_IRQ if the parameter
+        irq is out of range. */
+        Det_ReportError( NVIC_MODULE_ID, NVIC_INSTANCE_ID, NVIC_ID_GET_HANDLER, NVIC_E_PARAM_IRQ );
+    }
+    else
+    {
+        Handler = Nvic_RamVectors[ (uint32)( (sint32)Irq + NVIC_EXCEPTIONS ) ];
+    }
+
+    return Handler;
 }
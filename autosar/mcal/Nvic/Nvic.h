@@ -17,5 +17,7 @@ void CDD_Nvic_DisableIrq( Nvic_IrqType irq );
 uint32 CDD_Nvic_GetPendingIrq( Nvic_IrqType irq );
 void CDD_Nvic_SetPendingIrq( Nvic_IrqType irq );
 void CDD_Nvic_ClearPendingIrq( Nvic_IrqType irq );
+void CDD_Nvic_SetHandler( Nvic_IrqType irq, Nvic_HandlerType handler );
+Nvic_HandlerType CDD_Nvic_GetHandler( Nvic_IrqType irq );
 
 #endif
@@ -23,6 +23,8 @@
 #define NVIC_ID_CLEAR_PENDING_IRQ 0x06u /*!< CDD_Nvic_ClearPendingIrq() api service id */
 #define NVIC_ID_NMI_HANDLER       0x07u /*!< NMI_Handler api service id */
 #define NVIC_ID_HARDFAULT_HANDLER 0x08u /*!< HardFault_Handler api service id */
+#define NVIC_ID_SET_HANDLER       0x09u /*!< CDD_Nvic_SetHandler() api service id */
+#define NVIC_ID_GET_HANDLER       0x0Au /*!< CDD_Nvic_GetHandler() api service id */
 /**
  * @} */
 
@@ -34,7 +36,27 @@
 #define NVIC_E_PARAM_PRIORITY     0x02u /*!< API Service called with wrong parameter */
 #define NVIC_E_NMI_ENTRY          0x03u /*!< NMI vector called unnecesary */
 #define NVIC_E_HARDFAULT_ENTRY    0x04u /*!< HardFault vector called unnecesary */
+#define NVIC_E_PARAM_POINTER      0x05u /*!< API Service called with a NULL pointer */
 /**
  * @} */
 
+/**
+ * @defgroup NVIC_STATIC NVIC static define for testing purposes
+ *
+ * @{ */
+#ifndef UTEST
+#define NVIC_STATIC static /*!< Add static when no testing */
+#else
+#define NVIC_STATIC /*!< remove static for testing purposes */
+#endif
+/**
+ * @} */
+
+/**
+ * @brief   **Interrupt service routine type**
+ *
+ * Handlers installed in the RAM vector table with CDD_Nvic_SetHandler
+ */
+typedef void ( *Nvic_HandlerType )( void );
+
 #endif /* NVIC_TYPES_H__ */
@@ -53,23 +53,23 @@ void Port_Arch_Init( const Port_PinConfigType *PortConfigPtr )
     Port_RegisterType *PortReg = PortPeripherals[ PortConfigPtr->Port ];
 
     /*change values on PUPDR*/
-    Bfx_PutBits_u32u8u8u32( (uint32 *)&PortReg->PUPDR, ( PortConfigPtr->Pin << MUL_BY_TWO ), TWO_BITS, PortConfigPtr->Pull );
+    Bfx_PutBits_vu32u8u8u32( &PortReg->PUPDR, ( PortConfigPtr->Pin << MUL_BY_TWO ), TWO_BITS, PortConfigPtr->Pull );
     /*change values on OTYPER*/
-    Bfx_PutBits_u32u8u8u32( (uint32 *)&PortReg->OTYPER, PortConfigPtr->Pin, 1u, PortConfigPtr->OutputDrive );
+    Bfx_PutBits_vu32u8u8u32( &PortReg->OTYPER, PortConfigPtr->Pin, 1u, PortConfigPtr->OutputDrive );
     /*change values on OSPEEDR*/
-    Bfx_PutBits_u32u8u8u32( (uint32 *)&PortReg->OSPEEDR, ( PortConfigPtr->Pin << MUL_BY_TWO ), TWO_BITS, PortConfigPtr->Speed );
+    Bfx_PutBits_vu32u8u8u32( &PortReg->OSPEEDR, ( PortConfigPtr->Pin << MUL_BY_TWO ), TWO_BITS, PortConfigPtr->Speed );
     /*change values on MODER*/
-    Bfx_PutBits_u32u8u8u32( (uint32 *)&PortReg->MODER, ( PortConfigPtr->Pin << MUL_BY_TWO ), TWO_BITS, GET_HIGH_NIBBLE( PortConfigPtr->Mode ) );
+    Bfx_PutBits_vu32u8u8u32( &PortReg->MODER, ( PortConfigPtr->Pin << MUL_BY_TWO ), TWO_BITS, GET_HIGH_NIBBLE( PortConfigPtr->Mode ) );
 
     if( PortConfigPtr->Pin < PIN_08_VAL )
     {
         /*change values on Altern*/
-        Bfx_PutBits_u32u8u8u32( (uint32 *)&PortReg->AFRL, ( PortConfigPtr->Pin << MUL_BY_FOUR ), FOUR_BITS, GET_LOW_NIBBLE( PortConfigPtr->Mode ) );
+        Bfx_PutBits_vu32u8u8u32( &PortReg->AFRL, ( PortConfigPtr->Pin << MUL_BY_FOUR ), FOUR_BITS, GET_LOW_NIBBLE( PortConfigPtr->Mode ) );
     }
     else
     {
         /*change values on Altern*/
-        Bfx_PutBits_u32u8u8u32( (uint32 *)&PortReg->AFRH, ( ( PortConfigPtr->Pin - PIN_08_VAL ) << MUL_BY_FOUR ), FOUR_BITS, GET_LOW_NIBBLE( PortConfigPtr->Mode ) );
+        Bfx_PutBits_vu32u8u8u32( &PortReg->AFRH, ( ( PortConfigPtr->Pin - PIN_08_VAL ) << MUL_BY_FOUR ), FOUR_BITS, GET_LOW_NIBBLE( PortConfigPtr->Mode ) );
     }
 }
 
@@ -87,7 +87,7 @@ void Port_Arch_SetPinDirection( const Port_PinConfigType *PortConfigPtr, Port_Pi
 {
     Port_RegisterType *PortReg = PortPeripherals[ PortConfigPtr->Port ];
 
-    Bfx_PutBits_u32u8u8u32( (uint32 *)&PortReg->MODER, ( PortConfigPtr->Pin << MUL_BY_TWO ), TWO_BITS, Direction );
+    Bfx_PutBits_vu32u8u8u32( &PortReg->MODER, ( PortConfigPtr->Pin << MUL_BY_TWO ), TWO_BITS, Direction );
 }
 
 /**
@@ -106,17 +106,17 @@ void Port_Arch_SetPinMode( const Port_PinConfigType *PortConfigPtr, uint8 PinMod
     Port_RegisterType *PortReg = PortPeripherals[ PortConfigPtr->Port ];
 
     /*Set mode*/
-    Bfx_PutBits_u32u8u8u32( (uint32 *)&PortReg->MODER, ( PortConfigPtr->Pin << MUL_BY_TWO ), TWO_BITS, PinMode );
+    Bfx_PutBits_vu32u8u8u32( &PortReg->MODER, ( PortConfigPtr->Pin << MUL_BY_TWO ), TWO_BITS, PinMode );
 
     if( PortConfigPtr->Pin < PIN_08_VAL )
     {
         /*change values on Altern*/
-        Bfx_PutBits_u32u8u8u32( (uint32 *)&PortReg->AFRL, ( PortConfigPtr->Pin << MUL_BY_FOUR ), FOUR_BITS, AltMode );
+        Bfx_PutBits_vu32u8u8u32( &PortReg->AFRL, ( PortConfigPtr->Pin << MUL_BY_FOUR ), FOUR_BITS, AltMode );
     }
     else
     {
         /*change values on Altern*/
-        Bfx_PutBits_u32u8u8u32( (uint32 *)&PortReg->AFRH, ( ( PortConfigPtr->Pin - PIN_08_VAL ) << MUL_BY_FOUR ), FOUR_BITS, AltMode );
+        Bfx_PutBits_vu32u8u8u32( &PortReg->AFRH, ( ( PortConfigPtr->Pin - PIN_08_VAL ) << MUL_BY_FOUR ), FOUR_BITS, AltMode );
     }
 }
 
@@ -136,6 +136,6 @@ void Port_Arch_RefreshPortDirection( const Port_PinConfigType *PortConfigPtr )
 
     if( ( PortConfigPtr->DirChange == FALSE ) && ( ( PortConfigPtr->Mode == PORT_MODE_INPUT ) || ( PortConfigPtr->Mode == PORT_MODE_OUTPUT ) ) )
     {
-        Bfx_PutBits_u32u8u8u32( (uint32 *)&PortReg->MODER, ( PortConfigPtr->Pin << MUL_BY_TWO ), TWO_BITS, GET_HIGH_NIBBLE( PortConfigPtr->Mode ) );
+        Bfx_PutBits_vu32u8u8u32( &PortReg->MODER, ( PortConfigPtr->Pin << MUL_BY_TWO ), TWO_BITS, GET_HIGH_NIBBLE( PortConfigPtr->Mode ) );
     }
 }
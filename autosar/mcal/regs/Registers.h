@@ -91,6 +91,49 @@ typedef struct
 /**
  * @} */
 
+/**
+ * @brief System Control Block (SCB) structure.
+ */
+typedef struct
+{
+    volatile uint32 CPUID;      /*!< Offset: 0x000 (R/ )  CPUID Base Register */
+    volatile uint32 ICSR;       /*!< Offset: 0x004 (R/W)  Interrupt Control and State Register */
+    volatile uint32 VTOR;       /*!< Offset: 0x008 (R/W)  Vector Table Offset Register */
+    volatile uint32 AIRCR;      /*!< Offset: 0x00C (R/W)  Application Interrupt and Reset Control Register */
+    volatile uint32 SCR;        /*!< Offset: 0x010 (R/W)  System Control Register */
+    volatile uint32 CCR;        /*!< Offset: 0x014 (R/ )  Configuration Control Register */
+    volatile uint32 RESERVED0;  /*!< Reserved memory. */
+    volatile uint32 SHPR[ 2U ]; /*!< Offset: 0x01C (R/W)  System Handlers Priority Registers 2 and 3 */
+    volatile uint32 SHCSR;      /*!< Offset: 0x024 (R/W)  System Handler Control and State Register */
+} Scb_RegisterType;
+
+/**
+ * @defgroup Scb_Base_address SCB Base Address
+ * @{ */
+#define SCB_BASE ( SCS_BASE + 0x0D00UL )           /*!< SCB Base Address */
+#define SCB      ( (Scb_RegisterType *)SCB_BASE ) /*!< SCB configuration pointer */
+/**
+ * @} */
+
+/**
+ * @brief System Timer (SysTick) structure.
+ */
+typedef struct
+{
+    volatile uint32 CTRL;  /*!< Offset: 0x000 (R/W)  SysTick Control and Status Register */
+    volatile uint32 LOAD;  /*!< Offset: 0x004 (R/W)  SysTick Reload Value Register */
+    volatile uint32 VAL;   /*!< Offset: 0x008 (R/W)  SysTick Current Value Register */
+    volatile uint32 CALIB; /*!< Offset: 0x00C (R/ )  SysTick Calibration Register */
+} SysTick_RegisterType;
+
+/**
+ * @defgroup SysTick_Base_address SysTick Base Address
+ * @{ */
+#define SYSTICK_BASE ( SCS_BASE + 0x0010UL )                  /*!< SysTick Base Address */
+#define SYSTICK      ( (SysTick_RegisterType *)SYSTICK_BASE ) /*!< SysTick configuration pointer */
+/**
+ * @} */
+
 /**
  * @brief RCC registers struct.
  */
@@ -131,6 +174,57 @@ typedef struct
 /**
  * @} */
 
+/**
+ * @brief CRC calculation unit registers struct.
+ */
+typedef struct
+{
+    volatile uint32 DR;   /*!< CRC Data register,                Address offset: 0x00 */
+    volatile uint32 IDR;  /*!< CRC Independent data register,    Address offset: 0x04 */
+    volatile uint32 CR;   /*!< CRC Control register,             Address offset: 0x08 */
+    uint32 RESERVED;      /*!< Reserved,                                         0x0C */
+    volatile uint32 INIT; /*!< CRC Initial value register,       Address offset: 0x10 */
+    volatile uint32 POL;  /*!< CRC Polynomial register,          Address offset: 0x14 */
+} Crc_RegisterType;
+
+/**
+ * @defgroup  Crc_Base_address CRC Base Address
+  @{ */
+#define CRC_BASE ( AHBPERIPH_BASE + 0x00003000UL ) /*!< CRC Base Address */
+#define CRC      ( (Crc_RegisterType *)CRC_BASE )  /*!< Access to CRC registers*/
+/**
+ * @} */
+
+/**
+ * @brief DMA channel registers struct.
+ */
+typedef struct
+{
+    volatile uint32 CCR;   /*!< DMA channel x configuration register,         Address offset: 0x08 + 0x14 * (x - 1) */
+    volatile uint32 CNDTR; /*!< DMA channel x number of data to transfer,     Address offset: 0x0C + 0x14 * (x - 1) */
+    volatile uint32 CPAR;  /*!< DMA channel x peripheral address register,    Address offset: 0x10 + 0x14 * (x - 1) */
+    volatile uint32 CMAR;  /*!< DMA channel x memory address register,        Address offset: 0x14 + 0x14 * (x - 1) */
+    uint32 RESERVED;       /*!< Reserved,                                                     0x18 + 0x14 * (x - 1) */
+} Dma_ChannelType;
+
+/**
+ * @brief DMA controller registers struct.
+ */
+typedef struct
+{
+    volatile uint32 ISR;      /*!< DMA interrupt status register,      Address offset: 0x00 */
+    volatile uint32 IFCR;     /*!< DMA interrupt flag clear register,  Address offset: 0x04 */
+    Dma_ChannelType CH[ 7u ]; /*!< DMA channels 1 to 7,                Address offset: 0x08 */
+} Dma_RegisterType;
+
+/**
+ * @defgroup  Dma_Base_address DMA Base Address
+  @{ */
+#define DMA1_BASE ( AHBPERIPH_BASE + 0x00000000UL ) /*!< DMA1 Base Address */
+#define DMA1      ( (Dma_RegisterType *)DMA1_BASE ) /*!< Access to DMA1 registers*/
+/**
+ * @} */
+
 /**
  * @brief GPIOS registers struct.
  */
@@ -7,6 +7,11 @@
  * and shall be generated by a configuration tool. for the moment the files shall be written manually
  * by the user according its application. Also the user is responsible for setting the paramter in
  * the right way.
+ *
+ * Can_Init installs the driver handlers on the TIM16_FDCAN_IT0 and TIM17_FDCAN_IT1 vectors of the
+ * RAM vector table. Both vectors are shared with the TIM16 and TIM17 timers, the handler found on
+ * each vector at that moment is called after the Can flags are served, so a timer handler shall be
+ * installed before Can_Init and not replace the Can one afterwards.
  */
 #ifndef CAN_CFG_H__
 #define CAN_CFG_H__
@@ -115,6 +120,35 @@
  */
 #define CAN_VERSION_INFO_API                STD_ON
 
+/**
+ * @brief Places the interrupt handlers and Can_Arch_Write in RAM, see Compiler.h, off until
+ * measured on the target
+ * @typedef EcucBooleanParamDef
+ */
+#define CAN_RAM_FUNCTIONS                   STD_OFF
+
+/**
+ * @brief Maximum number of elements read from a Rx FIFO on each interrupt, from 1 up to the three
+ * elements of the FIFO, when messages are left the interrupt line is set pending again so they
+ * are read right after the handler returns
+ * @typedef EcucIntegerParamDef
+ */
+#define CAN_RX_FIFO_ISR_BUDGET              3u
+
+/**
+ * @brief Maximum number of messages read on each Can_MainFunction_Read call by the controllers with
+ * polled reception, the ones left are read on the next call
+ * @typedef EcucIntegerParamDef
+ */
+#define CAN_MAIN_FUNCTION_READ_BATCH        4u
+
+/**
+ * @brief Maximum number of transmissions confirmed on each Can_MainFunction_Write call by the
+ * controllers with polled transmission, the ones left are confirmed on the next call
+ * @typedef EcucIntegerParamDef
+ */
+#define CAN_MAIN_FUNCTION_WRITE_BATCH       4u
+
 extern const Can_ConfigType CanConfig;
 
 #endif /* CAN_CFG_H__ */
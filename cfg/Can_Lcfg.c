@@ -100,6 +100,9 @@ const Can_Controller Controllers[ CAN_NUMBER_OF_CONTROLLERS ] =
         .AutoRetransmission = STD_ON,
         .TxFifoQueueMode = CAN_TX_FIFO_OPERATION,
         .ActiveITs = CAN_IT_RX_FIFO0_NEW_MESSAGE | CAN_IT_RX_FIFO1_NEW_MESSAGE | CAN_IT_TX_COMPLETE,
+        .RxProcessing = CAN_PROCESSING_INTERRUPT,
+        .TxProcessing = CAN_PROCESSING_INTERRUPT,
+        .BusoffProcessing = CAN_PROCESSING_INTERRUPT,
         .DefaultBaudrate = &BaudratesCtrl0[ CAN_BAUDRATE_CTRL0_100K ],
         .BaudrateConfigs = BaudratesCtrl0,
         .BaudrateConfigsCount = CAN_NUMBER_OF_BAUDRATES_CTRL0,
@@ -115,6 +118,9 @@ const Can_Controller Controllers[ CAN_NUMBER_OF_CONTROLLERS ] =
         .AutoRetransmission = STD_ON,
         .TxFifoQueueMode = CAN_TX_FIFO_OPERATION,
         .ActiveITs = CAN_IT_RX_FIFO0_NEW_MESSAGE | CAN_IT_RX_FIFO1_NEW_MESSAGE | CAN_IT_TX_COMPLETE,
+        .RxProcessing = CAN_PROCESSING_INTERRUPT,
+        .TxProcessing = CAN_PROCESSING_INTERRUPT,
+        .BusoffProcessing = CAN_PROCESSING_INTERRUPT,
         .DefaultBaudrate = &BaudratesCtrl1[ CAN_BAUDRATE_CTRL1_500K ],
         .BaudrateConfigs = BaudratesCtrl1,
         .BaudrateConfigsCount = CAN_NUMBER_OF_BAUDRATES_CTRL1,
@@ -0,0 +1,90 @@
+/**
+ * @file    Crc_Cfg.h
+ * @brief   **Crc Library Configuration Header**
+ *
+ * Configuration for the CRC library. This file, as per AUTOSAR guidelines, is not
+ * application-dependent and should be generated by a configuration tool. For the moment,
+ * the files shall be written manually by the user according to their application. Each
+ * polynomial can be calculated at runtime (bit by bit, no ROM table), using a 16 entries nibble
+ * lookup table (around 4 times faster than runtime for a few bytes of ROM) or using a 256 entries
+ * lookup table (faster execution but bigger code size), in this way the hot polynomials can use
+ * the big tables while the rest keeps a small footprint. CRC8, CRC8H2F, CRC16 and CRC32 can also
+ * be calculated by the crc hardware unit (CRC_HARDWARE), in this case the application shall enable
+ * the unit clock before and the routine falls back to the bit by bit calculation when the unit is
+ * already in use.
+ */
+#ifndef CRC_CFG_H__
+#define CRC_CFG_H__
+
+/**
+ * @brief Selects the calculation method for the CRC8 SAEJ1850 routine
+ * @typedef EcucEnumerationParamDef (CRC_RUNTIME, CRC_TABLE, CRC_NIBBLE, CRC_HARDWARE)
+ */
+#define CRC_8_MODE     CRC_TABLE
+
+/**
+ * @brief Selects the calculation method for the CRC8H2F routine
+ * @typedef EcucEnumerationParamDef (CRC_RUNTIME, CRC_TABLE, CRC_NIBBLE, CRC_HARDWARE)
+ */
+#define CRC_8H2F_MODE  CRC_TABLE
+
+/**
+ * @brief Selects the calculation method for the CRC16 routine
+ * @typedef EcucEnumerationParamDef (CRC_RUNTIME, CRC_TABLE, CRC_NIBBLE, CRC_HARDWARE)
+ */
+#define CRC_16_MODE    CRC_TABLE
+
+/**
+ * @brief Selects the calculation method for the CRC16ARC routine
+ * @typedef EcucEnumerationParamDef (CRC_RUNTIME, CRC_TABLE, CRC_NIBBLE)
+ */
+#define CRC_16ARC_MODE CRC_TABLE
+
+/**
+ * @brief Selects the calculation method for the CRC32 routine
+ * @typedef EcucEnumerationParamDef (CRC_RUNTIME, CRC_TABLE, CRC_SLICE4, CRC_NIBBLE, CRC_HARDWARE)
+ */
+#define CRC_32_MODE    CRC_SLICE4
+
+/**
+ * @brief Selects the calculation method for the CRC32P4 routine
+ * @typedef EcucEnumerationParamDef (CRC_RUNTIME, CRC_TABLE, CRC_SLICE4, CRC_NIBBLE)
+ */
+#define CRC_32P4_MODE  CRC_TABLE
+
+/**
+ * @brief Selects the calculation method for the CRC64 routine
+ * @typedef EcucEnumerationParamDef (CRC_RUNTIME, CRC_TABLE, CRC_SLICE4, CRC_NIBBLE)
+ */
+#define CRC_64_MODE    CRC_TABLE
+
+/**
+ * @brief Enable / disable the services Crc_StartRegionCRC32() and Crc_GetRegionResult() from the
+ * code, the crc of the region is calculated by the crc unit fed by a DMA channel.
+ * @typedef EcucBooleanParamDef
+ */
+#define CRC_REGION_API         STD_ON
+
+/**
+ * @brief DMA1 channel (1 to 7) used to feed the crc unit, Crc_StartRegionCRC32() installs
+ * Crc_RegionIsr() on the interrupt vector of this channel and enables it, channels 2 to 7 share
+ * their vector with other channels, the handler found on the vector is called from Crc_RegionIsr().
+ * Drivers of those channels shall install their handler before the first region calculation.
+ * @typedef EcucIntegerParamDef
+ */
+#define CRC_REGION_DMA_CHANNEL 1u
+
+/**
+ * @brief Maximum number of words transferred on each DMA chunk (up to 65535)
+ * @typedef EcucIntegerParamDef
+ */
+#define CRC_REGION_CHUNK_WORDS 4096u
+
+/**
+ * @brief Places the software crc routines in RAM, see Compiler.h, off until
+ * measured on the target
+ * @typedef EcucBooleanParamDef
+ */
+#define CRC_RAM_FUNCTIONS      STD_OFF
+
+#endif
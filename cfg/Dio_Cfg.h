@@ -82,6 +82,13 @@
  */
 #define DIO_GET_VERSION_INFO_API  STD_ON
 
+/**
+ * @brief Places the Dio_Arch read and write functions in RAM, see Compiler.h, off until
+ * measured on the target
+ * @typedef EcucBooleanParamDef
+ */
+#define DIO_RAM_FUNCTIONS         STD_OFF
+
 extern const Dio_ConfigType DioConfig;
 
 #endif /* DIO_CFG_H_ */
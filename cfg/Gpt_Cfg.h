@@ -47,6 +47,13 @@
  */
 #define GPT_DEV_ERROR_DETECT                STD_ON
 
+/**
+ * @brief Places the timer notification handlers in RAM, see Compiler.h, off until
+ * measured on the target
+ * @typedef EcucBooleanParamDef
+ */
+#define GPT_RAM_FUNCTIONS                   STD_OFF
+
 /**
  * @defgroup GPT_SWC_Ids GPT software version and Ids
  *
@@ -0,0 +1,49 @@
+/**
+ * @file    SchM_Cfg.h
+ * @brief   **SchM Configuration Header**
+ *
+ * Configuration of the exclusive areas used by the drivers. This file, as per AUTOSAR guidelines,
+ * is not application-dependent and should be generated by a configuration tool. For the moment,
+ * the files shall be written manually by the user according to their application. The interrupts
+ * masked by each area are set in SchM_Lcfg.c, every interrupt that touches the data protected by
+ * an area shall be on its mask, or the mask shall be zero to mask all of them.
+ */
+#ifndef SCHM_CFG_H__
+#define SCHM_CFG_H__
+
+/**
+ * @defgroup SchM_Areas exclusive area ids
+ *
+ * @{ */
+#define SCHM_CAN_EXCLUSIVE_AREA_0 0u /*!< Can Tx FIFO put index, from the free slot check to the transmission request */
+#define SCHM_CAN_EXCLUSIVE_AREA_1 1u /*!< Can controller state transitions and interrupt disable counter */
+#define SCHM_SPI_EXCLUSIVE_AREA_0 2u /*!< Spi job and sequence queue */
+#define SCHM_FLS_EXCLUSIVE_AREA_0 3u /*!< Fls job state */
+#define SCHM_NUMBER_OF_AREAS      4u /*!< Number of exclusive areas */
+/**
+ * @} */
+
+/**
+ * @defgroup SchM_AreaApis exclusive areas with the AUTOSAR service names
+ *
+ * @{ */
+#define SchM_Enter_Can_CAN_EXCLUSIVE_AREA_0( ) SchM_Enter( SCHM_CAN_EXCLUSIVE_AREA_0 ) /*!< Enter Can area 0 */
+#define SchM_Exit_Can_CAN_EXCLUSIVE_AREA_0( )  SchM_Exit( SCHM_CAN_EXCLUSIVE_AREA_0 )  /*!< Exit Can area 0 */
+#define SchM_Enter_Can_CAN_EXCLUSIVE_AREA_1( ) SchM_Enter( SCHM_CAN_EXCLUSIVE_AREA_1 ) /*!< Enter Can area 1 */
+#define SchM_Exit_Can_CAN_EXCLUSIVE_AREA_1( )  SchM_Exit( SCHM_CAN_EXCLUSIVE_AREA_1 )  /*!< Exit Can area 1 */
+#define SchM_Enter_Spi_SPI_EXCLUSIVE_AREA_0( ) SchM_Enter( SCHM_SPI_EXCLUSIVE_AREA_0 ) /*!< Enter Spi area 0 */
+#define SchM_Exit_Spi_SPI_EXCLUSIVE_AREA_0( )  SchM_Exit( SCHM_SPI_EXCLUSIVE_AREA_0 )  /*!< Exit Spi area 0 */
+#define SchM_Enter_Fls_FLS_EXCLUSIVE_AREA_0( ) SchM_Enter( SCHM_FLS_EXCLUSIVE_AREA_0 ) /*!< Enter Fls area 0 */
+#define SchM_Exit_Fls_FLS_EXCLUSIVE_AREA_0( )  SchM_Exit( SCHM_FLS_EXCLUSIVE_AREA_0 )  /*!< Exit Fls area 0 */
+/**
+ * @} */
+
+/**
+ * @brief Measures with SysTick how long each area keeps the interrupts masked, SysTick shall be
+ * started by the application (the startup leaves it stopped) and its period shall be longer than
+ * the longest section, nothing is measured while SysTick LOAD is zero
+ * @typedef EcucBooleanParamDef
+ */
+#define SCHM_MEASURE_HOLD_TIME    STD_OFF
+
+#endif /* SCHM_CFG_H__ */
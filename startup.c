@@ -1,12 +1,78 @@
 #include "Std_Types.h"
+#include "Registers.h"
+#include "Stack.h"
 
-/*external reference varibales form linker scripts*/
-extern uint8 _estack; /*stack init address*/
-extern uint8 _sbss;   /*bss section start address*/
-extern uint8 _ebss;   /*bss section end address*/
-extern uint8 _sidata; /*data section start address in FLASH*/
-extern uint8 _sdata;  /*data section start address in RAM*/
-extern uint8 _edata;  /*data section end address in RAM*/
+/**
+ * @defgroup Startup_Options startup code options, can be overridden from the compiler command line
+ *
+ * @{ */
+#ifndef STARTUP_BOOT_TIME
+#define STARTUP_BOOT_TIME STD_ON /*!< Measure with SysTick the ticks from reset to main */
+#endif
+#ifndef STARTUP_STACK_PAINT
+#define STARTUP_STACK_PAINT STD_ON /*!< Paint the free stack to measure its high water mark with Stack.h */
+#endif
+#ifndef STARTUP_DMA_INIT
+#define STARTUP_DMA_INIT STD_OFF /*!< Use the DMA to init the sections bigger than STARTUP_DMA_MIN_WORDS */
+#endif
+#ifndef STARTUP_DMA_MIN_WORDS
+#define STARTUP_DMA_MIN_WORDS 256u /*!< Minimum section size in words to be initialized by the DMA */
+#endif
+#ifndef STARTUP_DMA_CHANNEL
+#define STARTUP_DMA_CHANNEL 1u /*!< DMA1 channel used to init the sections, 1 to 7 */
+#endif
+/**
+ * @} */
+
+/**
+ * @defgroup Startup_Values values used by the startup code
+ *
+ * @{ */
+#define STARTUP_UNROLL         4u          /*!< Words moved on each iteration of the init loops */
+#define SYSTICK_MAX_LOAD       0x00FFFFFFu /*!< SysTick is a 24 bits down counter */
+#define SYSTICK_CTRL_ENABLE    0x01u       /*!< SysTick counter enable */
+#define SYSTICK_CTRL_CLKSOURCE 0x04u       /*!< SysTick clocked by the processor clock */
+#define RCC_AHBENR_DMA1EN      0x01u       /*!< DMA1 clock enable */
+#define DMA_CCR_EN             0x0001u     /*!< Channel enable */
+#define DMA_CCR_PINC           0x0040u     /*!< Peripheral (source) increment mode */
+#define DMA_CCR_MINC           0x0080u     /*!< Memory (destination) increment mode */
+#define DMA_CCR_PSIZE_32BITS   0x0200u     /*!< 32 bits source transfers */
+#define DMA_CCR_MSIZE_32BITS   0x0800u     /*!< 32 bits destination transfers */
+#define DMA_CCR_MEM2MEM        0x4000u     /*!< Memory to memory mode */
+#define DMA_ISR_TCIF_BIT       1u          /*!< Transfer complete flag of the channel */
+#define DMA_ISR_GIF_BIT        0u          /*!< Global interrupt flag of the channel */
+#define DMA_ISR_CHANNEL_SIZE   4u          /*!< Number of flags for each channel */
+#define DMA_MAX_TRANSFER       0xFFFFu     /*!< Maximum number of words on a single transfer */
+/**
+ * @} */
+
+/*external reference varibales form linker scripts, all of them are 4 bytes aligned*/
+extern uint32 _estack;       /*stack init address*/
+extern uint32 _sstack;       /*stack reservation lowest address*/
+extern uint32 _sbss;         /*bss section start address*/
+extern uint32 _ebss;         /*bss section end address*/
+extern uint32 _sidata;       /*data section start address in FLASH*/
+extern uint32 _sdata;        /*data section start address in RAM*/
+extern uint32 _edata;        /*data section end address in RAM*/
+extern uint32 _sram_vectors; /*RAM vector table start address*/
+extern uint32 _eram_vectors; /*RAM vector table end address*/
+
+#if STARTUP_BOOT_TIME == STD_ON
+/**
+ * @brief   SysTick ticks (processor clock cycles) spent from reset to the call of main, it
+ *          wraps after 2^24 ticks. It is written once .bss and .data are already initialized.
+ */
+uint32 Startup_BootTicks;
+#endif
+
+static void Startup_FillWords( uint32 *Start, const uint32 *End );
+static void Startup_CopyWords( uint32 *Start, const uint32 *End, const uint32 *Source );
+#if STARTUP_STACK_PAINT == STD_ON
+static void Startup_PaintStack( void );
+#endif
+#if STARTUP_DMA_INIT == STD_ON
+static void Startup_DmaWords( uint32 *Destination, const uint32 *Source, uint32 Words, uint32 SourceIncrement );
+#endif
 
 /*since we reference symbol main before the function declaration
 we need to declare its prototype before array vectors*/
@@ -116,33 +182,218 @@ void Common_Handler( void )
  * @brief  **Reset vector handler**
  *
  * This function is called on startup and it is responsible for initializing the .bss and .data sections
- * and then calling the main function.
+ * and then calling the main function. Both sections are initialized one word at the time, with four
+ * words on each loop iteration, since the linker script guarantees their limits are word aligned.
+ * Optionally the sections are moved by the DMA, which is worth it only for big sections since the
+ * channel has to be set up, and the ticks elapsed until main are measured with the SysTick.
+ * The .ramfunc functions are linked at the end of .data, so they are copied from flash along with it.
+ * When the Nvic driver provides a RAM vector table the flash table is copied there and VTOR is
+ * pointed to it, from there on the drivers install their handlers with CDD_Nvic_SetHandler.
  */
 void Reset_Handler( void )
 {
-    uint32 size;
-    uint8 *location;
-    uint8 *source;
-
-    /*init bss section goes here*/
-    location = &_sbss;          /*init pointer to set a zero on each .bss location*/
-    size     = &_ebss - &_sbss; /* cppcheck-suppress misra-c2012-18.4 ; fuck you MISRA */
-    for( uint32 i = 0; i < size; i++ )
+#if STARTUP_BOOT_TIME == STD_ON
+    SYSTICK->LOAD = SYSTICK_MAX_LOAD;
+    SYSTICK->VAL  = 0u;
+    SYSTICK->CTRL = SYSTICK_CTRL_CLKSOURCE | SYSTICK_CTRL_ENABLE;
+#endif
+
+#if STARTUP_DMA_INIT == STD_ON
+    const uint32 Zero = 0u;
+    /* cppcheck-suppress misra-c2012-18.4 ; both pointers are on the same section */
+    uint32 BssWords = (uint32)( &_ebss - &_sbss );
+    /* cppcheck-suppress misra-c2012-18.4 ; both pointers are on the same section */
+    uint32 DataWords = (uint32)( &_edata - &_sdata );
+
+    if( BssWords >= STARTUP_DMA_MIN_WORDS )
+    {
+        Startup_DmaWords( &_sbss, &Zero, BssWords, 0u );
+    }
+    else
+    {
+        Startup_FillWords( &_sbss, &_ebss );
+    }
+
+    if( DataWords >= STARTUP_DMA_MIN_WORDS )
     {
-        *location = 0u; /*fill it with zeros*/
-        location++;
+        Startup_DmaWords( &_sdata, &_sidata, DataWords, DMA_CCR_PINC );
     }
+    else
+    {
+        Startup_CopyWords( &_sdata, &_edata, &_sidata );
+    }
+#else
+    Startup_FillWords( &_sbss, &_ebss );
+    Startup_CopyWords( &_sdata, &_edata, &_sidata );
+#endif
 
-    /*init data section goes here*/
-    source   = &_sidata;          /*get the LMA .data starting address*/
-    location = &_sdata;           /*get the VMA .data starting address*/
-    size     = &_edata - &_sdata; /* cppcheck-suppress misra-c2012-18.4 */
-    for( uint32 i = 0; i < size; i++ )
+    /* cppcheck-suppress misra-c2012-18.4 ; both pointers are on the same section */
+    if( ( &_eram_vectors - &_sram_vectors ) != 0 )
     {
-        *location = *source; /*copy from flash to ram one bit at the time*/
-        location++;
-        source++;
+        Startup_CopyWords( &_sram_vectors, &_eram_vectors, vectors );
+        /* cppcheck-suppress misra-c2012-11.4 ; VTOR holds the table address */
+        SCB->VTOR = (uint32)&_sram_vectors;
     }
 
+#if STARTUP_STACK_PAINT == STD_ON
+    Startup_PaintStack( );
+#endif
+
+#if STARTUP_BOOT_TIME == STD_ON
+    Startup_BootTicks = SYSTICK_MAX_LOAD - SYSTICK->VAL;
+    /*leave the SysTick on its reset state for the application*/
+    SYSTICK->CTRL = 0u;
+    SYSTICK->LOAD = 0u;
+    SYSTICK->VAL  = 0u;
+#endif
+
     (void)main( );
 }
+
+/**
+ * @brief  **Fill a word aligned section with zeros**
+ *
+ * Four words are written per iteration so the compiler can keep them in registers and use
+ * multiple store instructions, the remaining words are written one by one.
+ *
+ * @param  Start First word of the section
+ * @param  End Word after the last one of the section
+ */
+static void Startup_FillWords( uint32 *Start, const uint32 *End )
+{
+    uint32 *Location = Start;
+
+    /* cppcheck-suppress misra-c2012-18.4 ; both pointers are on the same section */
+    while( ( End - Location ) >= (sint32)STARTUP_UNROLL )
+    {
+        Location[ 0u ] = 0u;
+        Location[ 1u ] = 0u;
+        Location[ 2u ] = 0u;
+        Location[ 3u ] = 0u;
+        Location += STARTUP_UNROLL; /* cppcheck-suppress misra-c2012-18.4 */
+    }
+
+    while( Location < End )
+    {
+        *Location = 0u;
+        Location++;
+    }
+}
+
+/**
+ * @brief  **Copy a word aligned section from flash to ram**
+ *
+ * Four words are read and then written per iteration so the compiler can use multiple load and
+ * store instructions, the remaining words are copied one by one.
+ *
+ * @param  Start First word of the section in ram
+ * @param  End Word after the last one of the section in ram
+ * @param  Source First word of the section in flash
+ */
+static void Startup_CopyWords( uint32 *Start, const uint32 *End, const uint32 *Source )
+{
+    uint32 *Location   = Start;
+    const uint32 *From = Source;
+
+    /* cppcheck-suppress misra-c2012-18.4 ; both pointers are on the same section */
+    while( ( End - Location ) >= (sint32)STARTUP_UNROLL )
+    {
+        uint32 Word0 = From[ 0u ];
+        uint32 Word1 = From[ 1u ];
+        uint32 Word2 = From[ 2u ];
+        uint32 Word3 = From[ 3u ];
+
+        Location[ 0u ] = Word0;
+        Location[ 1u ] = Word1;
+        Location[ 2u ] = Word2;
+        Location[ 3u ] = Word3;
+        Location += STARTUP_UNROLL; /* cppcheck-suppress misra-c2012-18.4 */
+        From += STARTUP_UNROLL;     /* cppcheck-suppress misra-c2012-18.4 */
+    }
+
+    while( Location < End )
+    {
+        *Location = *From;
+        Location++;
+        From++;
+    }
+}
+
+#if STARTUP_STACK_PAINT == STD_ON
+/**
+ * @brief  **Paint the free stack**
+ *
+ * Fill the stack reservation with STACK_PAINT_PATTERN from its lowest address up to the current
+ * stack pointer, the words above it hold the frames in use. PRIMASK is clear out of reset, but no
+ * peripheral interrupt is enabled on the NVIC yet and the SysTick and the DMA run with their
+ * interrupts off, so only NMI or HardFault could push a frame, below the stack pointer and popped
+ * before the painting goes on.
+ */
+static void Startup_PaintStack( void )
+{
+    uint32 *Location = &_sstack;
+    uint32 *StackPointer;
+
+    __asm volatile( "mov %0, sp" : "=r"( StackPointer ) );
+
+    /* cppcheck-suppress misra-c2012-18.3 ; both pointers are on the stack */
+    while( Location < StackPointer )
+    {
+        *Location = STACK_PAINT_PATTERN;
+        Location++;
+    }
+}
+#endif
+
+#if STARTUP_DMA_INIT == STD_ON
+/**
+ * @brief  **Move words with the DMA in memory to memory mode**
+ *
+ * The transfer is split in blocks of up to 65535 words and the function polls the transfer
+ * complete flag of each block. The DMA clock is enabled only for the transfer and the channel is
+ * left disabled.
+ *
+ * @param  Destination First word to write
+ * @param  Source First word to read
+ * @param  Words Number of words to move
+ * @param  SourceIncrement DMA_CCR_PINC to copy a section, 0 to fill it with the source word
+ */
+static void Startup_DmaWords( uint32 *Destination, const uint32 *Source, uint32 Words, uint32 SourceIncrement )
+{
+    Dma_ChannelType *Channel = &DMA1->CH[ STARTUP_DMA_CHANNEL - 1u ];
+    uint32 FlagsOffset       = ( STARTUP_DMA_CHANNEL - 1u ) * DMA_ISR_CHANNEL_SIZE;
+    uint32 Remaining         = Words;
+    /* cppcheck-suppress misra-c2012-11.4 ; the DMA needs the address of the destination */
+    uint32 To = (uint32)Destination;
+    /* cppcheck-suppress misra-c2012-11.4 ; the DMA needs the address of the source */
+    uint32 From = (uint32)Source;
+
+    RCC->AHBENR |= RCC_AHBENR_DMA1EN;
+
+    while( Remaining > 0u )
+    {
+        uint32 Block = ( Remaining > DMA_MAX_TRANSFER ) ? DMA_MAX_TRANSFER : Remaining;
+
+        Channel->CPAR  = From;
+        Channel->CMAR  = To;
+        Channel->CNDTR = Block;
+        Channel->CCR   = DMA_CCR_MEM2MEM | DMA_CCR_MSIZE_32BITS | DMA_CCR_PSIZE_32BITS | DMA_CCR_MINC | SourceIncrement | DMA_CCR_EN;
+
+        while( ( DMA1->ISR & ( (uint32)1u << ( FlagsOffset + DMA_ISR_TCIF_BIT ) ) ) == 0u )
+        {
+        }
+
+        Channel->CCR = 0u;
+        DMA1->IFCR   = (uint32)1u << ( FlagsOffset + DMA_ISR_GIF_BIT );
+
+        To += Block * sizeof( uint32 );
+        if( SourceIncrement != 0u )
+        {
+            From += Block * sizeof( uint32 );
+        }
+        Remaining -= Block;
+    }
+
+    RCC->AHBENR &= ~RCC_AHBENR_DMA1EN;
+}
+#endif
@@ -0,0 +1,124 @@
+/**
+ * @file    bench_Mem.c
+ * @brief   **Host benchmark of the memory routines against plain byte loops**
+ *
+ * Runs each routine of Mem.c and its byte loop counterpart over aligned and unaligned buffers of
+ * several sizes and prints the time per call in nanoseconds. The program is built with
+ * -fno-builtin like the firmware, so the compiler does not turn the byte loops into library
+ * calls, use "make bench" to build and run it. The numbers only show the relative gain on the
+ * host, the cycles on the Cortex-M0+ have to be measured on target (e.g. with SysTick).
+ */
+#include <stdio.h>
+#include <time.h>
+#include "Std_Types.h"
+#include "Mem.h"
+
+#define BENCH_MAX_SIZE 1024u    /*!< Largest buffer measured */
+#define BENCH_BYTES    20000000u /*!< Bytes processed per measure, sets the number of calls */
+
+static uint32 SrcBuffer[ ( BENCH_MAX_SIZE / 4u ) + 1u ];
+static uint32 DstBuffer[ ( BENCH_MAX_SIZE / 4u ) + 1u ];
+static volatile sint32 Sink;
+
+static void Naive_Copy( void *Dst, const void *Src, uint32 Length )
+{
+    for( uint32 i = 0u; i < Length; i++ )
+    {
+        ( (uint8 *)Dst )[ i ] = ( (const uint8 *)Src )[ i ];
+    }
+}
+
+static void Naive_Set( void *Dst, uint8 Value, uint32 Length )
+{
+    for( uint32 i = 0u; i < Length; i++ )
+    {
+        ( (uint8 *)Dst )[ i ] = Value;
+    }
+}
+
+static sint32 Naive_Compare( const void *Ptr1, const void *Ptr2, uint32 Length )
+{
+    sint32 Result = 0;
+
+    for( uint32 i = 0u; ( i < Length ) && ( Result == 0 ); i++ )
+    {
+        Result = (sint32)( (const uint8 *)Ptr1 )[ i ] - (sint32)( (const uint8 *)Ptr2 )[ i ];
+    }
+    return Result;
+}
+
+static const uint8 *Naive_Find( const void *Ptr, uint8 Value, uint32 Length )
+{
+    const uint8 *Found = NULL_PTR;
+
+    for( uint32 i = 0u; ( i < Length ) && ( Found == NULL_PTR ); i++ )
+    {
+        if( ( (const uint8 *)Ptr )[ i ] == Value )
+        {
+            Found = &( (const uint8 *)Ptr )[ i ];
+        }
+    }
+    return Found;
+}
+
+/*run the selected routine Calls times and return the nanoseconds per call*/
+static double Bench_Run( uint8 Routine, boolean Optimized, uint32 Offset, uint32 Length, uint32 Calls )
+{
+    uint8 *Src      = (uint8 *)SrcBuffer + Offset;
+    uint8 *Dst      = (uint8 *)DstBuffer;
+    clock_t Start   = clock( );
+
+    for( uint32 Call = 0u; Call < Calls; Call++ )
+    {
+        switch( Routine )
+        {
+            case 0u:
+                ( Optimized == TRUE ) ? Mem_Copy( Dst, Src, Length ) : Naive_Copy( Dst, Src, Length );
+                break;
+            case 1u:
+                ( Optimized == TRUE ) ? Mem_Set( Src, (uint8)Call, Length ) : Naive_Set( Src, (uint8)Call, Length );
+                break;
+            case 2u:
+                Sink = ( Optimized == TRUE ) ? Mem_Compare( Dst, Src, Length ) : Naive_Compare( Dst, Src, Length );
+                break;
+            default:
+                Sink = ( ( ( Optimized == TRUE ) ? Mem_Find( Src, 0xFFu, Length ) : Naive_Find( Src, 0xFFu, Length ) ) != NULL_PTR );
+                break;
+        }
+    }
+
+    return ( (double)( clock( ) - Start ) * 1e9 ) / ( (double)CLOCKS_PER_SEC * (double)Calls );
+}
+
+int main( void )
+{
+    static const char *Names[ ] = { "Copy", "Set", "Compare", "Find" };
+    static const uint32 Sizes[ ] = { 8u, 64u, 1024u };
+
+    printf( "%-8s %6s %7s %12s %12s %8s\n", "Routine", "Size", "Offset", "Naive ns", "Mem ns", "Speedup" );
+    for( uint8 Routine = 0u; Routine < 4u; Routine++ )
+    {
+        for( uint8 Size = 0u; Size < ( sizeof( Sizes ) / sizeof( Sizes[ 0 ] ) ); Size++ )
+        {
+            for( uint32 Offset = 0u; Offset < 2u; Offset++ )
+            {
+                uint32 Calls = BENCH_BYTES / Sizes[ Size ];
+
+                /*equal buffers without the value to look for, so every routine goes through the whole length*/
+                Naive_Set( SrcBuffer, 0x5Au, sizeof( SrcBuffer ) );
+                Naive_Set( DstBuffer, 0x5Au, sizeof( DstBuffer ) );
+
+                double Naive = Bench_Run( Routine, FALSE, Offset, Sizes[ Size ], Calls );
+                if( Routine == 1u )
+                {
+                    Naive_Set( SrcBuffer, 0x5Au, sizeof( SrcBuffer ) );
+                }
+                double Optimized = Bench_Run( Routine, TRUE, Offset, Sizes[ Size ], Calls );
+
+                printf( "%-8s %6u %7u %12.1f %12.1f %7.1fx\n", Names[ Routine ], Sizes[ Size ], Offset, Naive, Optimized, Naive / Optimized );
+            }
+        }
+    }
+
+    return 0;
+}
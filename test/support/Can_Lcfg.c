@@ -199,6 +199,9 @@ const Can_Controller ArchControllers[ CANARCH_NUMBER_OF_CONTROLLERS ] =
         .TransmitPause        = STD_ON,
         .ProtocolException    = STD_OFF,
         .TxFifoQueueMode      = CAN_TX_FIFO_OPERATION,
+        .RxProcessing         = CAN_PROCESSING_POLLING,
+        .TxProcessing         = CAN_PROCESSING_POLLING,
+        .BusoffProcessing     = CAN_PROCESSING_POLLING,
         .BaudrateConfigsCount = CAN_NUMBER_OF_BAUDRATES_CTRL0,
         .CanReference         = CAN_FDCAN2,
         .BaudrateConfigs      = ArchBaudrates,
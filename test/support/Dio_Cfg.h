@@ -83,6 +83,12 @@
  */
 #define DIO_GET_VERSION_INFO_API  STD_ON
 
+/**
+ * @brief Places the Dio_Arch read and write functions in RAM, see Compiler.h
+ * @typedef EcucBooleanParamDef
+ */
+#define DIO_RAM_FUNCTIONS         STD_ON
+
 extern const Dio_ConfigType DioConfig;
 
 #endif /* DIO_CFG_H_ */
@@ -0,0 +1,32 @@
+/**
+ * @file    Pool_Cfg.h
+ * @brief   **Pool Library Configuration Header**
+ *
+ * Configuration for the fixed block memory pools. This file, as per AUTOSAR guidelines, is not
+ * application-dependent and should be generated by a configuration tool. For the moment, the files
+ * shall be written manually by the user according to their application. Each size class needs at
+ * least one block, the RAM taken by a class is its number of blocks times the block size plus
+ * three bytes of bookkeeping per block.
+ */
+#ifndef POOL_CFG_H__
+#define POOL_CFG_H__
+
+/**
+ * @brief Number of 8 bytes blocks, up to 65535
+ * @typedef EcucIntegerParamDef
+ */
+#define POOL_BLOCKS_8   4u
+
+/**
+ * @brief Number of 64 bytes blocks, up to 65535, enough for a CAN FD frame
+ * @typedef EcucIntegerParamDef
+ */
+#define POOL_BLOCKS_64  2u
+
+/**
+ * @brief Number of 256 bytes blocks, up to 65535
+ * @typedef EcucIntegerParamDef
+ */
+#define POOL_BLOCKS_256 1u
+
+#endif
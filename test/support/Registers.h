@@ -146,6 +146,120 @@ extern Nvic_RegisterType NVIC_BASE; /* NVIC ADDRESS */
 
 #define NVIC ( (Nvic_RegisterType *)&NVIC_BASE ) /*!< Access to NVIC registers*/
 
+/**
+ * @brief System Timer (SysTick) structure.
+ */
+typedef struct
+{
+    volatile uint32 CTRL;  /*!< Offset: 0x000 (R/W)  SysTick Control and Status Register */
+    volatile uint32 LOAD;  /*!< Offset: 0x004 (R/W)  SysTick Reload Value Register */
+    volatile uint32 VAL;   /*!< Offset: 0x008 (R/W)  SysTick Current Value Register */
+    volatile uint32 CALIB; /*!< Offset: 0x00C (R/ )  SysTick Calibration Register */
+} SysTick_RegisterType;
+
+extern SysTick_RegisterType SYSTICK_BASE; /* SYSTICK ADDRESS */
+
+#define SYSTICK ( (SysTick_RegisterType *)&SYSTICK_BASE ) /*!< Access to SysTick registers*/
+
+/**
+ * @brief System Control Block (SCB) structure.
+ */
+typedef struct
+{
+    volatile uint32 CPUID;      /*!< Offset: 0x000 (R/ )  CPUID Base Register */
+    volatile uint32 ICSR;       /*!< Offset: 0x004 (R/W)  Interrupt Control and State Register */
+    volatile uint32 VTOR;       /*!< Offset: 0x008 (R/W)  Vector Table Offset Register */
+    volatile uint32 AIRCR;      /*!< Offset: 0x00C (R/W)  Application Interrupt and Reset Control Register */
+    volatile uint32 SCR;        /*!< Offset: 0x010 (R/W)  System Control Register */
+    volatile uint32 CCR;        /*!< Offset: 0x014 (R/ )  Configuration Control Register */
+    volatile uint32 RESERVED0;  /*!< Reserved memory. */
+    volatile uint32 SHPR[ 2U ]; /*!< Offset: 0x01C (R/W)  System Handlers Priority Registers 2 and 3 */
+    volatile uint32 SHCSR;      /*!< Offset: 0x024 (R/W)  System Handler Control and State Register */
+} Scb_RegisterType;
+
+extern Scb_RegisterType SCB_BASE; /* SCB ADDRESS */
+
+#define SCB ( (Scb_RegisterType *)&SCB_BASE ) /*!< Access to SCB registers*/
+
+/**
+ * @brief RCC registers struct.
+ */
+typedef struct
+{
+    volatile uint32 CR;        /*!< RCC clock control register*/
+    volatile uint32 ICSCR;     /*!< RCC internal clock sources calibration register*/
+    volatile uint32 CFGR;      /*!< Clock configuration register*/
+    volatile uint32 PLLCFGR;   /*!< PLL configuration register*/
+    volatile uint32 Reserv;    /*!< Reserv memory space*/
+    volatile uint32 CRRCR;     /*!< clock recovery RC register*/
+    volatile uint32 CIER;      /*!< Clock interrupt enable register*/
+    volatile uint32 CIFR;      /*!< Clock interrupt flag register*/
+    volatile uint32 CICR;      /*!< Clock interrupt clear register*/
+    volatile uint32 IOPRSTR;   /*!< I/O port reset register*/
+    volatile uint32 AHBRSTR;   /*!< AHB peripheral reset register*/
+    volatile uint32 APBRSTR1;  /*!< APB1 peripheral reset register*/
+    volatile uint32 APBRSTR2;  /*!< APB2 peripheral reset register*/
+    volatile uint32 IOPENR;    /*!< I/O port clock enable register*/
+    volatile uint32 AHBENR;    /*!< AHB peripheral clock enable register*/
+    volatile uint32 APBENR1;   /*!< APB1 peripheral clock enable register */
+    volatile uint32 APBENR2;   /*!< APB2 peripheral clock enable register */
+    volatile uint32 IOPSMENR;  /*!< I/O port in Sleep mode clock enable register*/
+    volatile uint32 AHBSMENR;  /*!< AHB peripheral clock enable in sleep/stop mode register*/
+    volatile uint32 APBSMENR1; /*!< APB1 peripheral clock enable in Sleep/stop mode register */
+    volatile uint32 APBSMENR2; /*!< APB2 peripheral clock enable in Sleep/stop mode register*/
+    volatile uint32 CCIPR;     /*!< Peripherals independent clock configuration register*/
+    volatile uint32 CCIPR2;    /*!< Peripherals independent clock configuration register 2*/
+    volatile uint32 BDCR;      /*!< RTC domain control register*/
+    volatile uint32 CSR;       /*!< control/status register*/
+} Rcc_RegisterType;
+
+extern Rcc_RegisterType RCC_BASE; /*!< RCC Base Address */
+
+#define RCC ( (Rcc_RegisterType *)&RCC_BASE ) /*!< Access to RCC registers*/
+
+/**
+ * @brief CRC calculation unit registers struct.
+ */
+typedef struct
+{
+    volatile uint32 DR;   /*!< CRC Data register,                Address offset: 0x00 */
+    volatile uint32 IDR;  /*!< CRC Independent data register,    Address offset: 0x04 */
+    volatile uint32 CR;   /*!< CRC Control register,             Address offset: 0x08 */
+    uint32 RESERVED;      /*!< Reserved,                                         0x0C */
+    volatile uint32 INIT; /*!< CRC Initial value register,       Address offset: 0x10 */
+    volatile uint32 POL;  /*!< CRC Polynomial register,          Address offset: 0x14 */
+} Crc_RegisterType;
+
+extern Crc_RegisterType CRC_BASE; /*!< CRC Base Address */
+
+#define CRC ( (Crc_RegisterType *)&CRC_BASE ) /*!< Access to CRC registers*/
+
+/**
+ * @brief DMA channel registers struct.
+ */
+typedef struct
+{
+    volatile uint32 CCR;   /*!< DMA channel x configuration register,         Address offset: 0x08 + 0x14 * (x - 1) */
+    volatile uint32 CNDTR; /*!< DMA channel x number of data to transfer,     Address offset: 0x0C + 0x14 * (x - 1) */
+    volatile uint32 CPAR;  /*!< DMA channel x peripheral address register,    Address offset: 0x10 + 0x14 * (x - 1) */
+    volatile uint32 CMAR;  /*!< DMA channel x memory address register,        Address offset: 0x14 + 0x14 * (x - 1) */
+    uint32 RESERVED;       /*!< Reserved,                                                     0x18 + 0x14 * (x - 1) */
+} Dma_ChannelType;
+
+/**
+ * @brief DMA controller registers struct.
+ */
+typedef struct
+{
+    volatile uint32 ISR;      /*!< DMA interrupt status register,      Address offset: 0x00 */
+    volatile uint32 IFCR;     /*!< DMA interrupt flag clear register,  Address offset: 0x04 */
+    Dma_ChannelType CH[ 7u ]; /*!< DMA channels 1 to 7,                Address offset: 0x08 */
+} Dma_RegisterType;
+
+extern Dma_RegisterType DMA1_BASE; /*!< DMA1 Base Address */
+
+#define DMA1 ( (Dma_RegisterType *)&DMA1_BASE ) /*!< Access to DMA1 registers*/
+
 /**
  * @brief CAN Controller Area Network
  */
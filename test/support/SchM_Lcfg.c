@@ -0,0 +1,26 @@
+/**
+ * @file    SchM_Lcfg.c
+ * @brief   **SchM Configuration**
+ *
+ * This file contains the interrupts masked by each exclusive area. As per AUTOSAR guidelines, this
+ * file is not application-dependent and should be generated by a configuration tool. For the
+ * moment, the files shall be written manually by the user according to their application. Each
+ * entry has one bit per NVIC line (the same layout as ISER), a value of zero masks every interrupt
+ * with PRIMASK.
+ */
+#include "Std_Types.h"
+#include "Registers.h"
+#include "SchM_Cfg.h"
+
+/**
+ * @brief Interrupt lines masked by each exclusive area
+ */
+/* clang-format off */
+const uint32 SchM_AreaMasks[ SCHM_NUMBER_OF_AREAS ] =
+{
+    [SCHM_CAN_EXCLUSIVE_AREA_0] = ( 1UL << TIM16_FDCAN_IT0_IRQn ) | ( 1UL << TIM17_FDCAN_IT1_IRQn ),
+    [SCHM_CAN_EXCLUSIVE_AREA_1] = ( 1UL << TIM16_FDCAN_IT0_IRQn ) | ( 1UL << TIM17_FDCAN_IT1_IRQn ),
+    [SCHM_SPI_EXCLUSIVE_AREA_0] = ( 1UL << SPI1_IRQn ) | ( 1UL << SPI2_3_IRQn ),
+    [SCHM_FLS_EXCLUSIVE_AREA_0] = ( 1UL << FLASH_IRQn ),
+};
+/* clang-format on */
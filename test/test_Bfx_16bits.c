@@ -0,0 +1,132 @@
+/**
+ * @file    test_Bfx_16bits.c
+ * @brief   **This file contains the unit testing for the count functions in the library Bfx_16bits.**
+ *
+ * The count leading and trailing functions are constant time, they are compared against a bit by
+ * bit reference for all the 65536 possible values.
+ */
+#include "unity.h"
+#include "Bfx_16bits.h"
+
+/**
+ * @brief   **setUp**
+ *
+ * This function is required by Ceedling to run any code before the test cases.
+ */
+void setUp( void )
+{
+}
+
+/**
+ * @brief   **tearDown**
+ *
+ * This function is required by Ceedling to run any code before the test cases.
+ */
+void tearDown( void )
+{
+}
+
+/*bit by bit reference of the count functions to compare with*/
+static uint8 Reference_CountLeadingZeros( uint16 Data )
+{
+    uint8 Counter = 0u;
+
+    while( ( Counter < 16u ) && ( ( Data & ( (uint16)1u << ( 15u - Counter ) ) ) == 0u ) )
+    {
+        Counter++;
+    }
+    return Counter;
+}
+
+static uint8 Reference_CountTrailingZeros( uint16 Data )
+{
+    uint8 Counter = 0u;
+
+    while( ( Counter < 16u ) && ( ( Data & ( (uint16)1u << Counter ) ) == 0u ) )
+    {
+        Counter++;
+    }
+    return Counter;
+}
+
+static uint8 Reference_CountOnes( uint16 Data )
+{
+    uint8 Counter = 0u;
+
+    for( uint8 i = 0u; i < 16u; i++ )
+    {
+        Counter += ( Data >> i ) & 1u;
+    }
+    return Counter;
+}
+
+/**
+ * @brief   **Test Count Leading Zeros for every value**
+ *
+ * The test validates the constant time count against the bit by bit reference for all the 65536
+ * possible values
+ */
+void test__Bfx_CountLeadingZeros_u16__all_values( void )
+{
+    for( uint32 i = 0u; i < 65536u; i++ )
+    {
+        TEST_ASSERT_EQUAL_UINT8( Reference_CountLeadingZeros( (uint16)i ), Bfx_CountLeadingZeros_u16( (uint16)i ) );
+    }
+}
+
+/**
+ * @brief   **Test Count Leading Ones for every value**
+ *
+ * The test validates the leading ones are the leading zeros of the inverted value for all the
+ * 65536 possible values
+ */
+void test__Bfx_CountLeadingOnes_u16__all_values( void )
+{
+    for( uint32 i = 0u; i < 65536u; i++ )
+    {
+        TEST_ASSERT_EQUAL_UINT8( Reference_CountLeadingZeros( (uint16)~i ), Bfx_CountLeadingOnes_u16( (uint16)i ) );
+    }
+}
+
+/**
+ * @brief   **Test Count Leading Signs for every value**
+ *
+ * The test validates the redundant sign bits for all the 65536 possible values, zero and minus one
+ * have 15 redundant sign bits
+ */
+void test__Bfx_CountLeadingSigns_s16__all_values( void )
+{
+    for( uint32 i = 0u; i < 65536u; i++ )
+    {
+        uint16 Value = ( i >> 15u ) != 0u ? (uint16)~i : (uint16)i;
+        TEST_ASSERT_EQUAL_UINT8( Reference_CountLeadingZeros( Value ) - 1u, Bfx_CountLeadingSigns_s16( (sint16)i ) );
+    }
+}
+
+/**
+ * @brief   **Test Count Trailing Zeros for every value**
+ *
+ * The test validates the count against the bit by bit reference for all the 65536 possible
+ * values, zero has 16 trailing zeros
+ */
+void test__Bfx_CountTrailingZeros_u16__all_values( void )
+{
+    for( uint32 i = 0u; i < 65536u; i++ )
+    {
+        TEST_ASSERT_EQUAL_UINT8( Reference_CountTrailingZeros( (uint16)i ), Bfx_CountTrailingZeros_u16( (uint16)i ) );
+    }
+}
+
+/**
+ * @brief   **Test Count Ones for every value**
+ *
+ * The test validates the population count against the bit by bit reference for all the 65536
+ * possible values
+ */
+void test__Bfx_CountOnes_u16__all_values( void )
+{
+    for( uint32 i = 0u; i < 65536u; i++ )
+    {
+        TEST_ASSERT_EQUAL_UINT8( Reference_CountOnes( (uint16)i ), Bfx_CountOnes_u16( (uint16)i ) );
+    }
+}
@@ -516,6 +516,102 @@ void test__Bfx_PutBitsMask_u32u32u32__specsinv( void )
     TEST_ASSERT_EQUAL_HEX8_MESSAGE( Data, 0x2D2D2D2D, "The mask or pattern are incorrect" );
 }
 
+/**
+ * @brief   **Test building a value from a list of fields**
+ *
+ * The test validates the fields are placed in its positions, the patterns are cut to the field
+ * length and the mask covers only the bits of the fields
+ */
+void test__Bfx_BuildFields_u32__specs( void )
+{
+    const Bfx_FieldType Fields[ ] = { { 0, 4, 0x1F }, { 8, 8, 0xA5 }, { 30, 2, 0x02 } };
+    uint32 Mask;
+
+    uint32 Value = Bfx_BuildFields_u32( Fields, 3, &Mask );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x8000A50F, Value, "The fields are not in place" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0xC000FF0F, Mask, "The mask is incorrect" );
+}
+
+/**
+ * @brief   **Test building a value from a single field of 32 bits**
+ *
+ * The test validates a field covering the whole word and an empty list of fields
+ */
+void test__Bfx_BuildFields_u32__specsinv( void )
+{
+    const Bfx_FieldType Fields[ ] = { { 0, 32, 0x12345678 } };
+    uint32 Mask;
+
+    uint32 Value = Bfx_BuildFields_u32( Fields, 1, &Mask );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x12345678, Value, "The field is not in place" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0xFFFFFFFF, Mask, "The mask is incorrect" );
+
+    Value = Bfx_BuildFields_u32( Fields, 0, &Mask );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000000, Value, "The value is not empty" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000000, Mask, "The mask is not empty" );
+}
+
+/**
+ * @brief   **Test putting a list of fields keeping the rest of the bits**
+ *
+ * The test validates the result is the same as calling Bfx_PutBits_u32u8u8u32 once per field
+ */
+void test__Bfx_PutFields_u32__specs( void )
+{
+    const Bfx_FieldType Fields[ ] = { { 17, 3, 0x03 }, { 0, 4, 0x05 }, { 28, 4, 0x00 } };
+    uint32 Data      = 0xF0F0F0F0;
+    uint32 Reference = 0xF0F0F0F0;
+
+    Bfx_PutBits_u32u8u8u32( &Reference, 17, 3, 0x03 );
+    Bfx_PutBits_u32u8u8u32( &Reference, 0, 4, 0x05 );
+    Bfx_PutBits_u32u8u8u32( &Reference, 28, 4, 0x00 );
+
+    Bfx_PutFields_u32( &Data, Fields, 3 );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( Reference, Data, "The fields are incorrect" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00F6F0F5, Data, "The fields are incorrect" );
+}
+
+/**
+ * @brief   **Test putting a list of fields with patterns longer than the fields**
+ *
+ * The test validates the bits of the pattern out of the field length are discarded
+ */
+void test__Bfx_PutFields_u32__specsinv( void )
+{
+    const Bfx_FieldType Fields[ ] = { { 4, 4, 0xFFFFFFFF }, { 12, 1, 0xFE } };
+    uint32 Data = 0x00000000;
+
+    Bfx_PutFields_u32( &Data, Fields, 2 );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x000000F0, Data, "The fields are incorrect" );
+}
+
+/**
+ * @brief   **Test writing a list of fields replacing the whole word**
+ *
+ * The test validates the bits not covered by the fields are cleared
+ */
+void test__Bfx_WriteFields_u32__specs( void )
+{
+    const Bfx_FieldType Fields[ ] = { { 16, 11, 0x127 }, { 0, 11, 0x7FF }, { 27, 3, 0x01 }, { 30, 2, 0x02 } };
+    uint32 Data = 0xFFFFFFFF;
+
+    Bfx_WriteFields_u32( &Data, Fields, 4 );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x892707FF, Data, "The fields are incorrect" );
+}
+
+/**
+ * @brief   **Test writing an empty list of fields**
+ *
+ * The test validates the whole word is cleared when there is no field to write
+ */
+void test__Bfx_WriteFields_u32__specsinv( void )
+{
+    uint32 Data = 0xA5A5A5A5;
+
+    Bfx_WriteFields_u32( &Data, NULL_PTR, 0 );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000000, Data, "The word is not cleared" );
+}
+
 /**
  * @brief   **Test putting a bit to zero on the 17 position**
  *
@@ -701,4 +797,441 @@ void test__Bfx_ShiftBitSat_u32s8_u32__shiftNeg( void )
     sint32 Data   = 0x2A2A2A2A;
     sint32 Result = Bfx_ShiftBitSat_u32s8_u32( -2, Data );
     TEST_ASSERT_EQUAL_HEX8_MESSAGE( Result, 0x0A8A8A8A, "The left shift wasn't performed correctly" );
-}
\ No newline at end of file
+}
+
+/*bit by bit reference of the count functions to compare with*/
+static uint8 Reference_CountLeadingZeros( uint32 Data )
+{
+    uint8 Counter = 0u;
+
+    while( ( Counter < 32u ) && ( ( Data & ( (uint32)1u << ( 31u - Counter ) ) ) == 0u ) )
+    {
+        Counter++;
+    }
+    return Counter;
+}
+
+static uint8 Reference_CountTrailingZeros( uint32 Data )
+{
+    uint8 Counter = 0u;
+
+    while( ( Counter < 32u ) && ( ( Data & ( (uint32)1u << Counter ) ) == 0u ) )
+    {
+        Counter++;
+    }
+    return Counter;
+}
+
+static uint8 Reference_CountOnes( uint32 Data )
+{
+    uint8 Counter = 0u;
+
+    for( uint8 i = 0u; i < 32u; i++ )
+    {
+        Counter += ( Data >> i ) & 1u;
+    }
+    return Counter;
+}
+
+/*values with the most significant one at every position: alone, with all the bits below set and
+with pseudo random bits below, then each one reversed for the trailing zeros*/
+#define TEST_VALUES_PER_BIT 1024u
+
+static uint32 Test_Value( uint8 Msb, uint32 Index )
+{
+    uint32 Below  = ( ( 1uL << Msb ) - 1u );
+    uint32 Random = ( Index * 2654435761u ) ^ ( Index << 13u );
+
+    return ( 1uL << Msb ) | ( ( Index == 0u ) ? 0u : ( ( Index == 1u ) ? Below : ( Random & Below ) ) );
+}
+
+/**
+ * @brief   **Test Count Leading Zeros for every position of the most significant one**
+ *
+ * The test validates the constant time count against the bit by bit reference for zero and for
+ * TEST_VALUES_PER_BIT values with the most significant one at each of the 32 positions
+ */
+void test__Bfx_CountLeadingZeros_u32__all_positions( void )
+{
+    TEST_ASSERT_EQUAL_UINT8( 32u, Bfx_CountLeadingZeros_u32( 0u ) );
+
+    for( uint8 Msb = 0u; Msb < 32u; Msb++ )
+    {
+        for( uint32 i = 0u; i < TEST_VALUES_PER_BIT; i++ )
+        {
+            uint32 Value = Test_Value( Msb, i );
+            TEST_ASSERT_EQUAL_UINT8( Reference_CountLeadingZeros( Value ), Bfx_CountLeadingZeros_u32( Value ) );
+        }
+    }
+}
+
+/**
+ * @brief   **Test Count Leading Ones for every position of the most significant zero**
+ *
+ * The test validates the leading ones against the bit by bit reference for all ones and for
+ * TEST_VALUES_PER_BIT values with the most significant zero at each of the 32 positions
+ */
+void test__Bfx_CountLeadingOnes_u32__all_positions( void )
+{
+    TEST_ASSERT_EQUAL_UINT8( 32u, Bfx_CountLeadingOnes_u32( 0xFFFFFFFFu ) );
+
+    for( uint8 Msb = 0u; Msb < 32u; Msb++ )
+    {
+        for( uint32 i = 0u; i < TEST_VALUES_PER_BIT; i++ )
+        {
+            uint32 Value = Test_Value( Msb, i );
+            TEST_ASSERT_EQUAL_UINT8( Reference_CountLeadingZeros( Value ), Bfx_CountLeadingOnes_u32( ~Value ) );
+        }
+    }
+}
+
+/**
+ * @brief   **Test Count Leading Signs for every position of the first bit different to the sign**
+ *
+ * The test validates the redundant sign bits for zero, minus one and TEST_VALUES_PER_BIT positive
+ * and negative values with the first bit different to the sign at each of the 31 positions
+ */
+void test__Bfx_CountLeadingSigns_s32__all_positions( void )
+{
+    TEST_ASSERT_EQUAL_UINT8( 31u, Bfx_CountLeadingSigns_s32( 0 ) );
+    TEST_ASSERT_EQUAL_UINT8( 31u, Bfx_CountLeadingSigns_s32( -1 ) );
+
+    for( uint8 Msb = 0u; Msb < 31u; Msb++ )
+    {
+        for( uint32 i = 0u; i < TEST_VALUES_PER_BIT; i++ )
+        {
+            uint32 Value = Test_Value( Msb, i );
+            TEST_ASSERT_EQUAL_UINT8( Reference_CountLeadingZeros( Value ) - 1u, Bfx_CountLeadingSigns_s32( (sint32)Value ) );
+            TEST_ASSERT_EQUAL_UINT8( Reference_CountLeadingZeros( Value ) - 1u, Bfx_CountLeadingSigns_s32( (sint32)~Value ) );
+        }
+    }
+}
+
+/**
+ * @brief   **Test Count Trailing Zeros for every position of the least significant one**
+ *
+ * The test validates the count against the bit by bit reference for zero and for
+ * TEST_VALUES_PER_BIT values with the least significant one at each of the 32 positions
+ */
+void test__Bfx_CountTrailingZeros_u32__all_positions( void )
+{
+    TEST_ASSERT_EQUAL_UINT8( 32u, Bfx_CountTrailingZeros_u32( 0u ) );
+
+    for( uint8 Lsb = 0u; Lsb < 32u; Lsb++ )
+    {
+        for( uint32 i = 0u; i < TEST_VALUES_PER_BIT; i++ )
+        {
+            uint32 Value = ~( ( 1uL << Lsb ) - 1u ) & ( Test_Value( 31u, i ) << Lsb );
+            Value |= 1uL << Lsb;
+            TEST_ASSERT_EQUAL_UINT8( Reference_CountTrailingZeros( Value ), Bfx_CountTrailingZeros_u32( Value ) );
+        }
+    }
+}
+
+/**
+ * @brief   **Test Count Ones for every number of bits set**
+ *
+ * The test validates the population count against the bit by bit reference for values with
+ * growing number of bits set and pseudo random values
+ */
+void test__Bfx_CountOnes_u32__all_counts( void )
+{
+    TEST_ASSERT_EQUAL_UINT8( 0u, Bfx_CountOnes_u32( 0u ) );
+
+    for( uint8 Msb = 0u; Msb < 32u; Msb++ )
+    {
+        for( uint32 i = 0u; i < TEST_VALUES_PER_BIT; i++ )
+        {
+            uint32 Value = Test_Value( Msb, i );
+            TEST_ASSERT_EQUAL_UINT8( Reference_CountOnes( Value ), Bfx_CountOnes_u32( Value ) );
+        }
+    }
+}
+
+/**
+ * @brief   **Test the register variant to set a single bit**
+ *
+ * The test validates the volatile register gets the same value as the non volatile function
+ */
+void test__Bfx_SetBit_vu32u8__same_as_u32u8( void )
+{
+    volatile uint32 Reg = 0xF0F0F0F0;
+    uint32 Reference    = 0xF0F0F0F0;
+
+    Bfx_SetBit_u32u8( &Reference, 17 );
+    Bfx_SetBit_vu32u8( &Reg, 17 );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( Reference, Reg, "The register value is incorrect" );
+}
+
+/**
+ * @brief   **Test the atomic register variant to set a single bit**
+ *
+ * The test validates the volatile register gets the same value as the non volatile function
+ */
+void test__Bfx_SetBitAtomic_vu32u8__same_as_u32u8( void )
+{
+    volatile uint32 Reg = 0xF0F0F0F0;
+    uint32 Reference    = 0xF0F0F0F0;
+
+    Bfx_SetBit_u32u8( &Reference, 17 );
+    Bfx_SetBitAtomic_vu32u8( &Reg, 17 );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( Reference, Reg, "The register value is incorrect" );
+}
+
+/**
+ * @brief   **Test the register variant to clear a single bit**
+ *
+ * The test validates the volatile register gets the same value as the non volatile function
+ */
+void test__Bfx_ClrBit_vu32u8__same_as_u32u8( void )
+{
+    volatile uint32 Reg = 0xF0F0F0F0;
+    uint32 Reference    = 0xF0F0F0F0;
+
+    Bfx_ClrBit_u32u8( &Reference, 5 );
+    Bfx_ClrBit_vu32u8( &Reg, 5 );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( Reference, Reg, "The register value is incorrect" );
+}
+
+/**
+ * @brief   **Test the atomic register variant to clear a single bit**
+ *
+ * The test validates the volatile register gets the same value as the non volatile function
+ */
+void test__Bfx_ClrBitAtomic_vu32u8__same_as_u32u8( void )
+{
+    volatile uint32 Reg = 0xF0F0F0F0;
+    uint32 Reference    = 0xF0F0F0F0;
+
+    Bfx_ClrBit_u32u8( &Reference, 5 );
+    Bfx_ClrBitAtomic_vu32u8( &Reg, 5 );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( Reference, Reg, "The register value is incorrect" );
+}
+
+/**
+ * @brief   **Test the register variant to put a single bit**
+ *
+ * The test validates the volatile register gets the same value as the non volatile function
+ */
+void test__Bfx_PutBit_vu32u8u8__same_as_u32u8u8( void )
+{
+    volatile uint32 Reg = 0xF0F0F0F0;
+    uint32 Reference    = 0xF0F0F0F0;
+
+    Bfx_PutBit_u32u8u8( &Reference, 12, FALSE );
+    Bfx_PutBit_vu32u8u8( &Reg, 12, FALSE );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( Reference, Reg, "The register value is incorrect" );
+}
+
+/**
+ * @brief   **Test the atomic register variant to put a single bit**
+ *
+ * The test validates the volatile register gets the same value as the non volatile function
+ */
+void test__Bfx_PutBitAtomic_vu32u8u8__same_as_u32u8u8( void )
+{
+    volatile uint32 Reg = 0xF0F0F0F0;
+    uint32 Reference    = 0xF0F0F0F0;
+
+    Bfx_PutBit_u32u8u8( &Reference, 12, FALSE );
+    Bfx_PutBitAtomic_vu32u8u8( &Reg, 12, FALSE );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( Reference, Reg, "The register value is incorrect" );
+}
+
+/**
+ * @brief   **Test the register variant to set consecutive bits**
+ *
+ * The test validates the volatile register gets the same value as the non volatile function
+ */
+void test__Bfx_SetBits_vu32u8u8u8__same_as_u32u8u8u8( void )
+{
+    volatile uint32 Reg = 0xF0F0F0F0;
+    uint32 Reference    = 0xF0F0F0F0;
+
+    Bfx_SetBits_u32u8u8u8( &Reference, 8, 4, 1 );
+    Bfx_SetBits_vu32u8u8u8( &Reg, 8, 4, 1 );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( Reference, Reg, "The register value is incorrect" );
+}
+
+/**
+ * @brief   **Test the register variant to set bits with a mask**
+ *
+ * The test validates the volatile register gets the same value as the non volatile function
+ */
+void test__Bfx_SetBitMask_vu32u32__same_as_u32u32( void )
+{
+    volatile uint32 Reg = 0xF0F0F0F0;
+    uint32 Reference    = 0xF0F0F0F0;
+
+    Bfx_SetBitMask_u32u32( &Reference, 0x0000FF00 );
+    Bfx_SetBitMask_vu32u32( &Reg, 0x0000FF00 );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( Reference, Reg, "The register value is incorrect" );
+}
+
+/**
+ * @brief   **Test the atomic register variant to set bits with a mask**
+ *
+ * The test validates the volatile register gets the same value as the non volatile function
+ */
+void test__Bfx_SetBitMaskAtomic_vu32u32__same_as_u32u32( void )
+{
+    volatile uint32 Reg = 0xF0F0F0F0;
+    uint32 Reference    = 0xF0F0F0F0;
+
+    Bfx_SetBitMask_u32u32( &Reference, 0x0000FF00 );
+    Bfx_SetBitMaskAtomic_vu32u32( &Reg, 0x0000FF00 );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( Reference, Reg, "The register value is incorrect" );
+}
+
+/**
+ * @brief   **Test the register variant to clear bits with a mask**
+ *
+ * The test validates the volatile register gets the same value as the non volatile function
+ */
+void test__Bfx_ClrBitMask_vu32u32__same_as_u32u32( void )
+{
+    volatile uint32 Reg = 0xF0F0F0F0;
+    uint32 Reference    = 0xF0F0F0F0;
+
+    Bfx_ClrBitMask_u32u32( &Reference, 0xFF000000 );
+    Bfx_ClrBitMask_vu32u32( &Reg, 0xFF000000 );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( Reference, Reg, "The register value is incorrect" );
+}
+
+/**
+ * @brief   **Test the atomic register variant to clear bits with a mask**
+ *
+ * The test validates the volatile register gets the same value as the non volatile function
+ */
+void test__Bfx_ClrBitMaskAtomic_vu32u32__same_as_u32u32( void )
+{
+    volatile uint32 Reg = 0xF0F0F0F0;
+    uint32 Reference    = 0xF0F0F0F0;
+
+    Bfx_ClrBitMask_u32u32( &Reference, 0xFF000000 );
+    Bfx_ClrBitMaskAtomic_vu32u32( &Reg, 0xFF000000 );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( Reference, Reg, "The register value is incorrect" );
+}
+
+/**
+ * @brief   **Test the register variant to put a pattern**
+ *
+ * The test validates the volatile register gets the same value as the non volatile function
+ */
+void test__Bfx_PutBits_vu32u8u8u32__same_as_u32u8u8u32( void )
+{
+    volatile uint32 Reg = 0xF0F0F0F0;
+    uint32 Reference    = 0xF0F0F0F0;
+
+    Bfx_PutBits_u32u8u8u32( &Reference, 17, 3, 0x03 );
+    Bfx_PutBits_vu32u8u8u32( &Reg, 17, 3, 0x03 );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( Reference, Reg, "The register value is incorrect" );
+}
+
+/**
+ * @brief   **Test the atomic register variant to put a pattern**
+ *
+ * The test validates the volatile register gets the same value as the non volatile function
+ */
+void test__Bfx_PutBitsAtomic_vu32u8u8u32__same_as_u32u8u8u32( void )
+{
+    volatile uint32 Reg = 0xF0F0F0F0;
+    uint32 Reference    = 0xF0F0F0F0;
+
+    Bfx_PutBits_u32u8u8u32( &Reference, 17, 3, 0x03 );
+    Bfx_PutBitsAtomic_vu32u8u8u32( &Reg, 17, 3, 0x03 );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( Reference, Reg, "The register value is incorrect" );
+}
+
+/**
+ * @brief   **Test the register variant to put a pattern with a mask**
+ *
+ * The test validates the volatile register gets the same value as the non volatile function
+ */
+void test__Bfx_PutBitsMask_vu32u32u32__same_as_u32u32u32( void )
+{
+    volatile uint32 Reg = 0xF0F0F0F0;
+    uint32 Reference    = 0xF0F0F0F0;
+
+    Bfx_PutBitsMask_u32u32u32( &Reference, 0xCDCDCDCD, 0x0F0F0F0F );
+    Bfx_PutBitsMask_vu32u32u32( &Reg, 0xCDCDCDCD, 0x0F0F0F0F );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( Reference, Reg, "The register value is incorrect" );
+}
+
+/**
+ * @brief   **Test the atomic register variant to put a pattern with a mask**
+ *
+ * The test validates the volatile register gets the same value as the non volatile function
+ */
+void test__Bfx_PutBitsMaskAtomic_vu32u32u32__same_as_u32u32u32( void )
+{
+    volatile uint32 Reg = 0xF0F0F0F0;
+    uint32 Reference    = 0xF0F0F0F0;
+
+    Bfx_PutBitsMask_u32u32u32( &Reference, 0xCDCDCDCD, 0x0F0F0F0F );
+    Bfx_PutBitsMaskAtomic_vu32u32u32( &Reg, 0xCDCDCDCD, 0x0F0F0F0F );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( Reference, Reg, "The register value is incorrect" );
+}
+
+/**
+ * @brief   **Test the register variant to put a list of fields**
+ *
+ * The test validates the volatile register gets the same value as the non volatile function
+ */
+void test__Bfx_PutFields_vu32__same_as_u32( void )
+{
+    const Bfx_FieldType Fields[ ] = { { 4, 4, 0x09 }, { 24, 8, 0x3C } };
+
+    volatile uint32 Reg = 0xF0F0F0F0;
+    uint32 Reference    = 0xF0F0F0F0;
+
+    Bfx_PutFields_u32( &Reference, Fields, 2 );
+    Bfx_PutFields_vu32( &Reg, Fields, 2 );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( Reference, Reg, "The register value is incorrect" );
+}
+
+/**
+ * @brief   **Test the atomic register variant to put a list of fields**
+ *
+ * The test validates the volatile register gets the same value as the non volatile function
+ */
+void test__Bfx_PutFieldsAtomic_vu32__same_as_u32( void )
+{
+    const Bfx_FieldType Fields[ ] = { { 4, 4, 0x09 }, { 24, 8, 0x3C } };
+
+    volatile uint32 Reg = 0xF0F0F0F0;
+    uint32 Reference    = 0xF0F0F0F0;
+
+    Bfx_PutFields_u32( &Reference, Fields, 2 );
+    Bfx_PutFieldsAtomic_vu32( &Reg, Fields, 2 );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( Reference, Reg, "The register value is incorrect" );
+}
+
+/**
+ * @brief   **Test the register variant to write a list of fields**
+ *
+ * The test validates the bits not covered by the fields are cleared on the register
+ */
+void test__Bfx_WriteFields_vu32__clear_the_rest( void )
+{
+    const Bfx_FieldType Fields[ ] = { { 4, 4, 0x09 }, { 24, 8, 0x3C } };
+
+    volatile uint32 Reg = 0xF0F0F0F0;
+
+    Bfx_WriteFields_vu32( &Reg, Fields, 2 );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x3C000090, Reg, "The register value is incorrect" );
+}
+
+/**
+ * @brief   **Test the register variants to get bits**
+ *
+ * The test validates the single bit and consecutive bits read from a volatile register
+ */
+void test__Bfx_GetBit_vu32u8_u8__and_GetBits_vu32u8u8_u32( void )
+{
+    volatile uint32 Reg = 0xF0F6F0F0;
+
+    TEST_ASSERT_EQUAL_MESSAGE( TRUE, Bfx_GetBit_vu32u8_u8( &Reg, 17 ), "The bit value is incorrect" );
+    TEST_ASSERT_EQUAL_MESSAGE( FALSE, Bfx_GetBit_vu32u8_u8( &Reg, 16 ), "The bit value is incorrect" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x03, Bfx_GetBits_vu32u8u8_u32( &Reg, 17, 3 ), "The bits value is incorrect" );
+}
@@ -705,4 +705,109 @@ void test__Bfx_ShiftBitSat_u8s8_u8__shiftright( void )
     sint8 Data   = (sint8)0x55; // 0101 0101
     sint8 Result = Bfx_ShiftBitSat_u8s8_u8( -3, Data );
     TEST_ASSERT_EQUAL_HEX8_MESSAGE( Result, 0x0A, "The shift right wasn't performed correctly" );
-}
\ No newline at end of file
+}
+
+/*bit by bit reference of the count functions to compare with*/
+static uint8 Reference_CountLeadingZeros( uint8 Data )
+{
+    uint8 Counter = 0u;
+
+    while( ( Counter < 8u ) && ( ( Data & ( (uint8)1u << ( 7u - Counter ) ) ) == 0u ) )
+    {
+        Counter++;
+    }
+    return Counter;
+}
+
+static uint8 Reference_CountTrailingZeros( uint8 Data )
+{
+    uint8 Counter = 0u;
+
+    while( ( Counter < 8u ) && ( ( Data & ( (uint8)1u << Counter ) ) == 0u ) )
+    {
+        Counter++;
+    }
+    return Counter;
+}
+
+static uint8 Reference_CountOnes( uint8 Data )
+{
+    uint8 Counter = 0u;
+
+    for( uint8 i = 0u; i < 8u; i++ )
+    {
+        Counter += ( Data >> i ) & 1u;
+    }
+    return Counter;
+}
+
+/**
+ * @brief   **Test Count Leading Zeros for every value**
+ *
+ * The test validates the constant time count against the bit by bit reference for all the 256
+ * possible values
+ */
+void test__Bfx_CountLeadingZeros_u8__all_values( void )
+{
+    for( uint32 i = 0u; i < 256u; i++ )
+    {
+        TEST_ASSERT_EQUAL_UINT8( Reference_CountLeadingZeros( (uint8)i ), Bfx_CountLeadingZeros_u8( (uint8)i ) );
+    }
+}
+
+/**
+ * @brief   **Test Count Leading Ones for every value**
+ *
+ * The test validates the leading ones are the leading zeros of the inverted value for all the
+ * 256 possible values
+ */
+void test__Bfx_CountLeadingOnes_u8__all_values( void )
+{
+    for( uint32 i = 0u; i < 256u; i++ )
+    {
+        TEST_ASSERT_EQUAL_UINT8( Reference_CountLeadingZeros( (uint8)~i ), Bfx_CountLeadingOnes_u8( (uint8)i ) );
+    }
+}
+
+/**
+ * @brief   **Test Count Leading Signs for every value**
+ *
+ * The test validates the redundant sign bits for all the 256 possible values, zero and minus one
+ * have 7 redundant sign bits
+ */
+void test__Bfx_CountLeadingSigns_s8__all_values( void )
+{
+    for( uint32 i = 0u; i < 256u; i++ )
+    {
+        uint8 Value = ( i >> 7u ) != 0u ? (uint8)~i : (uint8)i;
+        TEST_ASSERT_EQUAL_UINT8( Reference_CountLeadingZeros( Value ) - 1u, Bfx_CountLeadingSigns_s8( (sint8)i ) );
+    }
+}
+
+/**
+ * @brief   **Test Count Trailing Zeros for every value**
+ *
+ * The test validates the count against the bit by bit reference for all the 256 possible
+ * values, zero has 8 trailing zeros
+ */
+void test__Bfx_CountTrailingZeros_u8__all_values( void )
+{
+    for( uint32 i = 0u; i < 256u; i++ )
+    {
+        TEST_ASSERT_EQUAL_UINT8( Reference_CountTrailingZeros( (uint8)i ), Bfx_CountTrailingZeros_u8( (uint8)i ) );
+    }
+}
+
+/**
+ * @brief   **Test Count Ones for every value**
+ *
+ * The test validates the population count against the bit by bit reference for all the 256
+ * possible values
+ */
+void test__Bfx_CountOnes_u8__all_values( void )
+{
+    for( uint32 i = 0u; i < 256u; i++ )
+    {
+        TEST_ASSERT_EQUAL_UINT8( Reference_CountOnes( (uint8)i ), Bfx_CountOnes_u8( (uint8)i ) );
+    }
+}
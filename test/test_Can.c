@@ -1160,6 +1160,219 @@ void test__Can_Write__when_all_paramters_are_right_and_CAN_mode_is_FD( void )
     TEST_ASSERT_EQUAL_MESSAGE( Return, E_OK, "Return value should be E_OK" );
 }
 
+/**
+ * @brief   **Test Can_WriteBatch when driver is not initialized**
+ *
+ * The test checks that the function does not call the Can_Arch_WriteBatch function when the driver
+ * is not initialized.
+ */
+void test__Can_WriteBatch__when_not_ready_value_in_HwUnitState( void )
+{
+    Can_PduType PduInfo[ 2 ];
+    HwUnit.HwUnitState = CAN_CS_UNINIT;
+
+    Det_ReportError_IgnoreAndReturn( E_OK );
+
+    uint8 Accepted = Can_WriteBatch( CAN_HTH_0_CTRL_0, PduInfo, 2 );
+
+    TEST_ASSERT_EQUAL_MESSAGE( 0, Accepted, "No message should be accepted" );
+}
+
+/**
+ * @brief   **Test Can_WriteBatch when Hth is not for transmit**
+ *
+ * The test checks that the function does not call the Can_Arch_WriteBatch function when the Hth
+ * is not for transmit.
+ */
+void test__Can_WriteBatch__when_Hth_is_unkown( void )
+{
+    Can_PduType PduInfo[ 2 ];
+
+    Det_ReportError_IgnoreAndReturn( E_OK );
+
+    uint8 Accepted = Can_WriteBatch( CAN_HRH_0_CTRL_0, PduInfo, 2 );
+
+    TEST_ASSERT_EQUAL_MESSAGE( 0, Accepted, "No message should be accepted" );
+}
+
+/**
+ * @brief   **Test Can_WriteBatch when PduInfo is NULL**
+ *
+ * The test checks that the function does not call the Can_Arch_WriteBatch function when the
+ * PduInfo is NULL.
+ */
+void test__Can_WriteBatch__when_PduInfo_is_NULL( void )
+{
+    Det_ReportError_IgnoreAndReturn( E_OK );
+
+    uint8 Accepted = Can_WriteBatch( CAN_HTH_0_CTRL_0, NULL_PTR, 2 );
+
+    TEST_ASSERT_EQUAL_MESSAGE( 0, Accepted, "No message should be accepted" );
+}
+
+/**
+ * @brief   **Test Can_WriteBatch when a lenght is bigger than 8 in frame classic**
+ *
+ * The test checks that only the messages before the one with an invalid lenght are passed to the
+ * Can_Arch_WriteBatch function.
+ */
+void test__Can_WriteBatch__when_second_lenght_is_invalid( void )
+{
+    uint8 message[ 8 ];
+    Can_PduType PduInfo[ 3 ] = {
+    { .length = 8, .id = 0x000007ff, .sdu = message },
+    { .length = 9, .id = 0x000007ff, .sdu = message },
+    { .length = 8, .id = 0x000007ff, .sdu = message } };
+
+    Det_ReportError_IgnoreAndReturn( E_OK );
+    Can_Arch_WriteBatch_ExpectAndReturn( &HwUnit, CAN_HTH_0_CTRL_0, PduInfo, 1, 1 );
+
+    uint8 Accepted = Can_WriteBatch( CAN_HTH_0_CTRL_0, PduInfo, 3 );
+
+    TEST_ASSERT_EQUAL_MESSAGE( 1, Accepted, "Only the first message should be accepted" );
+}
+
+/**
+ * @brief   **Test Can_WriteBatch when all paramters are right**
+ *
+ * The test checks that the function passes all the messages to the Can_Arch_WriteBatch function
+ * and returns the number of messages accepted.
+ */
+void test__Can_WriteBatch__when_all_paramters_are_right( void )
+{
+    uint8 message[ 8 ];
+    Can_PduType PduInfo[ 3 ] = {
+    { .length = 8, .id = 0x000007ff, .sdu = message },
+    { .length = 4, .id = 0x00000123, .sdu = message },
+    { .length = 0, .id = 0x00000456, .sdu = message } };
+
+    Can_Arch_WriteBatch_ExpectAndReturn( &HwUnit, CAN_HTH_0_CTRL_0, PduInfo, 3, 2 );
+
+    uint8 Accepted = Can_WriteBatch( CAN_HTH_0_CTRL_0, PduInfo, 3 );
+
+    TEST_ASSERT_EQUAL_MESSAGE( 2, Accepted, "Two messages should be accepted" );
+}
+
+/**
+ * @brief   **Test Can_MainFunction_Write when not initialized**
+ *
+ * The test checks that the function reports CAN_E_UNINIT and does not poll any controller when the
+ * driver is not initialized.
+ */
+void test__Can_MainFunction_Write__when_not_ready_value_in_HwUnitState( void )
+{
+    HwUnit.HwUnitState = CAN_CS_UNINIT;
+
+    Det_ReportError_IgnoreAndReturn( E_OK );
+
+    Can_MainFunction_Write( );
+
+    /* test is testing if Det_ReportError was called */
+}
+
+/**
+ * @brief   **Test Can_MainFunction_Write when all values are correct**
+ *
+ * The test checks that the function polls the transmit confirmations of every controller.
+ */
+void test__Can_MainFunction_Write__when_all_values_are_correct( void )
+{
+    Can_Arch_MainFunction_Write_Expect( &HwUnit, CAN_CONTROLLER_0 );
+    Can_Arch_MainFunction_Write_Expect( &HwUnit, CAN_CONTROLLER_1 );
+
+    Can_MainFunction_Write( );
+}
+
+/**
+ * @brief   **Test Can_MainFunction_Read when not initialized**
+ *
+ * The test checks that the function reports CAN_E_UNINIT and does not poll any controller when the
+ * driver is not initialized.
+ */
+void test__Can_MainFunction_Read__when_not_ready_value_in_HwUnitState( void )
+{
+    HwUnit.HwUnitState = CAN_CS_UNINIT;
+
+    Det_ReportError_IgnoreAndReturn( E_OK );
+
+    Can_MainFunction_Read( );
+
+    /* test is testing if Det_ReportError was called */
+}
+
+/**
+ * @brief   **Test Can_MainFunction_Read when all values are correct**
+ *
+ * The test checks that the function polls the receptions of every controller.
+ */
+void test__Can_MainFunction_Read__when_all_values_are_correct( void )
+{
+    Can_Arch_MainFunction_Read_Expect( &HwUnit, CAN_CONTROLLER_0 );
+    Can_Arch_MainFunction_Read_Expect( &HwUnit, CAN_CONTROLLER_1 );
+
+    Can_MainFunction_Read( );
+}
+
+/**
+ * @brief   **Test Can_MainFunction_BusOff when not initialized**
+ *
+ * The test checks that the function reports CAN_E_UNINIT and does not poll any controller when the
+ * driver is not initialized.
+ */
+void test__Can_MainFunction_BusOff__when_not_ready_value_in_HwUnitState( void )
+{
+    HwUnit.HwUnitState = CAN_CS_UNINIT;
+
+    Det_ReportError_IgnoreAndReturn( E_OK );
+
+    Can_MainFunction_BusOff( );
+
+    /* test is testing if Det_ReportError was called */
+}
+
+/**
+ * @brief   **Test Can_MainFunction_BusOff when all values are correct**
+ *
+ * The test checks that the function polls the bus off events of every controller.
+ */
+void test__Can_MainFunction_BusOff__when_all_values_are_correct( void )
+{
+    Can_Arch_MainFunction_BusOff_Expect( &HwUnit, CAN_CONTROLLER_0 );
+    Can_Arch_MainFunction_BusOff_Expect( &HwUnit, CAN_CONTROLLER_1 );
+
+    Can_MainFunction_BusOff( );
+}
+
+/**
+ * @brief   **Test Can_MainFunction_Mode when not initialized**
+ *
+ * The test checks that the function reports CAN_E_UNINIT and does not poll any controller when the
+ * driver is not initialized.
+ */
+void test__Can_MainFunction_Mode__when_not_ready_value_in_HwUnitState( void )
+{
+    HwUnit.HwUnitState = CAN_CS_UNINIT;
+
+    Det_ReportError_IgnoreAndReturn( E_OK );
+
+    Can_MainFunction_Mode( );
+
+    /* test is testing if Det_ReportError was called */
+}
+
+/**
+ * @brief   **Test Can_MainFunction_Mode when all values are correct**
+ *
+ * The test checks that the function polls the mode transitions of every controller.
+ */
+void test__Can_MainFunction_Mode__when_all_values_are_correct( void )
+{
+    Can_Arch_MainFunction_Mode_Expect( &HwUnit, CAN_CONTROLLER_0 );
+    Can_Arch_MainFunction_Mode_Expect( &HwUnit, CAN_CONTROLLER_1 );
+
+    Can_MainFunction_Mode( );
+}
+
 /**
  * @brief   **Test Can_GetVersionInfo when null**
  *
@@ -10,9 +10,12 @@
 #include "unity.h"
 #include "Registers.h"
 #include "Bfx.h"
+#include "Mem.h"
 #include "Can_Cfg.h"
 #include "Can.h"
 #include "Can_Arch.h"
+#include "Nvic.h"
+#include "SchM.h"
 #include "mock_Det.h"
 #include "mock_CanIf_Can.h"
 #include <string.h>
@@ -57,14 +60,51 @@ SramCan_RegisterType SRAMCAN1_BASE;
  */
 SramCan_RegisterType SRAMCAN2_BASE;
 
+/**
+ * @brief   Mock register for NVIC
+ */
+Nvic_RegisterType NVIC_BASE;
+
+/**
+ * @brief   Mock register for SysTick
+ */
+SysTick_RegisterType SYSTICK_BASE;
+
 extern Can_HwUnit HwUnit;
 
+/**
+ * @brief   Message IDs passed to CanIf_RxIndication and number of calls
+ */
+static Can_IdType RxIndicationIds[ 3u ];
+static uint8 RxIndicationCount;
+
+/**
+ * @brief   Rx FIFO status register updated by CanIf_RxIndication_Callback as the hardware does
+ */
+static volatile uint32 *RxFifoStatus;
+
+/**
+ * @brief   Number of calls to CanIf_TxConfirmation
+ */
+static uint8 TxConfirmationCount;
+
+/**
+ * @brief   Number of calls to the timer handler sharing the Can interrupt lines
+ */
+static uint8 TimerIsrCount;
+
 void Can_SetupBaudrateConfig( const Can_ControllerBaudrateConfig *Baudrate, Can_RegisterType *Can );
 void Can_SetupConfiguredFilters( const Can_ConfigType *Config, uint8 Controller );
 void Can_SetupConfiguredInterrupts( const Can_Controller *Controller, Can_RegisterType *Can );
-uint8 Can_GetClosestDlcWithPadding( uint8 Dlc, uint32 *RamBuffer, uint8 PaddingValue );
+uint8 Can_GetClosestDlc( uint8 Length );
+void Can_WriteTxPayload( volatile uint32 *Payload, const uint8 *Sdu, uint8 Length, uint8 Bytes, uint8 PaddingValue );
+uint32 Can_MergeTxBytes( const uint8 *Sdu, uint8 Count, uint32 Padding );
 uint8 Can_GetTxPduId( const Can_Controller *Controller, PduIdType *CanPduId );
 void Can_GetMessage( volatile uint32 *Fifo, PduInfoType *PduInfo, uint32 *CanId );
+uint32 Can_GetLineFlags( uint32 Routing, uint8 Line );
+void Can_Isr_Lines( uint8 Line );
+void Can_Isr_Line0( void );
+void Can_Isr_Line1( void );
 void Can_Isr_RxFifo0NewMessage( Can_HwUnit *HwUnit, uint8 Controller );
 void Can_Isr_RxFifo0Full( Can_HwUnit *HwUnit, uint8 Controller );
 void Can_Isr_RxFifo0MessageLost( Can_HwUnit *HwUnit, uint8 Controller );
@@ -126,6 +166,45 @@ void tearDown( void )
 {
 }
 
+/*keep the id of each message passed to the upper layer*/
+static void CanIf_RxIndication_Callback( const Can_HwType *Mailbox, const PduInfoType *PduInfoPtr, int cmock_num_calls )
+{
+    (void)PduInfoPtr;
+
+    if( cmock_num_calls < 3 )
+    {
+        RxIndicationIds[ cmock_num_calls ] = Mailbox->CanId;
+    }
+    RxIndicationCount++;
+
+    /*release the element read, one less on the fill level and the get index to the next one*/
+    if( RxFifoStatus != NULL_PTR )
+    {
+        uint32 Index = ( ( *RxFifoStatus >> 8u ) + 1u ) % 3u;
+        *RxFifoStatus = ( Index << 8u ) | ( ( *RxFifoStatus & 0x0Fu ) - 1u );
+    }
+}
+
+/*run the Can interrupt handler again while its line is set pending, as the NVIC does*/
+static void Can_ServePendingLines( void )
+{
+    for( uint8 Calls = 0u; ( Calls < 5u ) && ( ( NVIC->ISPR[ 0u ] & ( 1UL << TIM16_FDCAN_IT0_IRQn ) ) != 0u ); Calls++ )
+    {
+        NVIC->ISPR[ 0u ] = 0u;
+        CAN1->IR         = 0u; /* the flags written by the handler are cleared by the hardware */
+        Can_Arch_IsrMainHandler( &HwUnit, CAN_CONTROLLER_0, CAN_INTERRUPT_LINE0 );
+    }
+}
+
+/*count the messages confirmed to the upper layer*/
+static void CanIf_TxConfirmation_Callback( PduIdType TxPduId, int cmock_num_calls )
+{
+    (void)TxPduId;
+    (void)cmock_num_calls;
+
+    TxConfirmationCount++;
+}
+
 /**
  * @brief   Test case for CKDIV reg in Can_Init function.
  *
@@ -636,6 +715,124 @@ void test__Can_Arch_write__transmit_standard_id_classic_frame( void )
     TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x08070605, *Data1, "Wrong Data1 value" );
 }
 
+/**
+ * @brief   Test case Write funtion std id and classic frame shorter than a word
+ *
+ * This test case will to transmit a message of 3 bytes with standard id and classic frame, the
+ * last byte of the word shall be zero and the next word shall not be written
+ */
+void test__Can_Arch_write__transmit_standard_id_classic_frame_3_bytes( void )
+{
+    uint8 message[ 3 ] = { 0x01, 0x02, 0x03 };
+
+    Can_PduType PduInfo = {
+    .id          = 0x7FF,
+    .length      = 3,
+    .sdu         = message,
+    .swPduHandle = 0x01 };
+
+    volatile uint32 *Header1 = &SRAMCAN1->TBSA[ 0u ];
+    volatile uint32 *Header2 = &SRAMCAN1->TBSA[ 1u ];
+    volatile uint32 *Data0   = &SRAMCAN1->TBSA[ 2u ];
+    volatile uint32 *Data1   = &SRAMCAN1->TBSA[ 3u ];
+
+    SRAMCAN1->TBSA[ 2u ] = 0xFFFFFFFF;
+    SRAMCAN1->TBSA[ 3u ] = 0xFFFFFFFF;
+
+    Std_ReturnType Retval = Can_Arch_Write( &HwUnit, CANARCH_HTH_0_CTRL_0, &PduInfo );
+
+    TEST_ASSERT_EQUAL_MESSAGE( E_OK, Retval, "Wrong retval value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x1FFC0000, *Header1, "Wrong Header1 value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x01830000, *Header2, "Wrong Header2 value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00030201, *Data0, "Wrong Data0 value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0xFFFFFFFF, *Data1, "Wrong Data1 value" );
+}
+
+/**
+ * @brief   Test case WriteBatch funtion with less free elements than messages on FIFO operation
+ *
+ * With two free elements from the put index 2, the first two messages shall be written to the
+ * elements 2 and 0 and both transmissions requested with a single write
+ */
+void test__Can_Arch_WriteBatch__fifo_free_elements( void )
+{
+    uint8 message[ 8 ] = { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08 };
+
+    const Can_PduType PduInfo[ 3 ] = {
+    { .id = 0x123, .length = 8, .sdu = message, .swPduHandle = 0x55 },
+    { .id = 0x456, .length = 4, .sdu = message, .swPduHandle = 0x56 },
+    { .id = 0x789, .length = 2, .sdu = message, .swPduHandle = 0x57 } };
+
+    CAN1->TXFQS = 0x00020002; /* put index 2, free level 2 */
+    CAN1->TXBAR = 0x00000000;
+
+    uint8 Accepted = Can_Arch_WriteBatch( &HwUnit, CANARCH_HTH_0_CTRL_0, PduInfo, 3 );
+
+    TEST_ASSERT_EQUAL_MESSAGE( 2, Accepted, "Wrong number of messages accepted" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x048C0000, SRAMCAN1->TBSA[ 36u ], "Wrong element 2 Header1 value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x55880000, SRAMCAN1->TBSA[ 37u ], "Wrong element 2 Header2 value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x08070605, SRAMCAN1->TBSA[ 39u ], "Wrong element 2 Data1 value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x11580000, SRAMCAN1->TBSA[ 0u ], "Wrong element 0 Header1 value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x56840000, SRAMCAN1->TBSA[ 1u ], "Wrong element 0 Header2 value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x04030201, SRAMCAN1->TBSA[ 2u ], "Wrong element 0 Data0 value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000005, CAN1->TXBAR, "Wrong TXBAR value" );
+}
+
+/**
+ * @brief   Test case WriteBatch funtion with the Tx FIFO full
+ *
+ * No message shall be accepted and no transmission requested
+ */
+void test__Can_Arch_WriteBatch__fifo_full( void )
+{
+    uint8 message[ 8 ] = { 0 };
+
+    const Can_PduType PduInfo[ 2 ] = {
+    { .id = 0x123, .length = 8, .sdu = message, .swPduHandle = 0x55 },
+    { .id = 0x456, .length = 8, .sdu = message, .swPduHandle = 0x56 } };
+
+    CAN1->TXFQS = 0x00210000; /* full, put index 1, free level 0 */
+    CAN1->TXBAR = 0x00000000;
+
+    uint8 Accepted = Can_Arch_WriteBatch( &HwUnit, CANARCH_HTH_0_CTRL_0, PduInfo, 2 );
+
+    TEST_ASSERT_EQUAL_MESSAGE( 0, Accepted, "Wrong number of messages accepted" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000000, CAN1->TXBAR, "Wrong TXBAR value" );
+}
+
+/**
+ * @brief   Test case WriteBatch funtion on queue operation
+ *
+ * With the buffer 1 pending, the first two messages shall be written to the buffers 0 and 2 and
+ * both transmissions requested with a single write
+ */
+void test__Can_Arch_WriteBatch__queue_free_buffers( void )
+{
+    uint8 message[ 8 ] = { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08 };
+
+    const Can_PduType PduInfo[ 3 ] = {
+    { .id = 0x123, .length = 8, .sdu = message, .swPduHandle = 0x55 },
+    { .id = 0x456, .length = 8, .sdu = message, .swPduHandle = 0x56 },
+    { .id = 0x789, .length = 8, .sdu = message, .swPduHandle = 0x57 } };
+
+    /* clang-format off */
+    const Can_Controller Controller = { .CanReference = CAN_FDCAN1, .TxFifoQueueMode = CAN_TX_QUEUE_OPERATION };
+    const Can_HardwareObject Hoh    = { .ObjectType = CAN_HOH_TYPE_TRANSMIT, .ControllerRef = &Controller };
+    const Can_ConfigType Config     = { .Hohs = &Hoh, .HohsCount = 1 };
+    Can_HwUnit Unit                 = { .Config = &Config };
+    /* clang-format on */
+
+    CAN1->TXBRP = 0x00000002;
+    CAN1->TXBAR = 0x00000000;
+
+    uint8 Accepted = Can_Arch_WriteBatch( &Unit, 0, PduInfo, 3 );
+
+    TEST_ASSERT_EQUAL_MESSAGE( 2, Accepted, "Wrong number of messages accepted" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x048C0000, SRAMCAN1->TBSA[ 0u ], "Wrong buffer 0 Header1 value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x11580000, SRAMCAN1->TBSA[ 36u ], "Wrong buffer 2 Header1 value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000005, CAN1->TXBAR, "Wrong TXBAR value" );
+}
+
 /**
  * @brief   Test case Write funtion ext id and fd frame with padding
  *
@@ -760,14 +957,14 @@ void test__Can_Arch_GetIngressTimeStamp__void_test( void )
  * @brief   Test case for calling a given subrutine
  *
  * This test case will check that the subrutine is called when the interrupt is triggered
- * and the subrutine is set in the HwUnit.
+ * and the subrutine is set in the HwUnit, the flag group is routed to line 1 at initialization.
  */
 void test__Can_Arch_IsrMainHandler__call_subrutine( void )
 {
     CAN1->IR = 0x00100000;
     CAN1->IE = 0x00100000;
 
-    Can_Arch_IsrMainHandler( &HwUnit, CAN_CONTROLLER_0 );
+    Can_Arch_IsrMainHandler( &HwUnit, CAN_CONTROLLER_0, CAN_INTERRUPT_LINE1 );
 }
 
 /**
@@ -781,7 +978,140 @@ void test__Can_Arch_IsrMainHandler__call_no_subrutine( void )
     CAN1->IR = 0x00000008;
     CAN1->IE = 0x00000000;
 
-    Can_Arch_IsrMainHandler( &HwUnit, CAN_CONTROLLER_0 );
+    Can_Arch_IsrMainHandler( &HwUnit, CAN_CONTROLLER_0, CAN_INTERRUPT_LINE0 );
+}
+
+/**
+ * @brief   Test case for clearing the served flags with a single write
+ *
+ * The pending and enabled flags shall be written once to the write 1 to clear IR register, on the
+ * host register mock the register keeps that last write so the flag of the disabled interrupt is
+ * not part of it
+ */
+void test__Can_Arch_IsrMainHandler__clear_served_flags_at_once( void )
+{
+    CAN1->ILS = 0x00000000;
+    CAN1->IR  = 0x00108008;
+    CAN1->IE  = 0x00108000;
+
+    Can_Arch_IsrMainHandler( &HwUnit, CAN_CONTROLLER_0, CAN_INTERRUPT_LINE0 );
+
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00108000, CAN1->IR, "Wrong flags cleared" );
+}
+
+/**
+ * @brief   Test case for serving only the flags routed to the line
+ *
+ * With the Misc group on line 0 and the Protocol Error group routed to line 1, each line shall
+ * clear only the flags of its own groups and leave the other ones for the other line handler
+ */
+void test__Can_Arch_IsrMainHandler__serve_only_line_flags( void )
+{
+    CAN1->ILS = 0x00000040;
+    CAN1->IR  = 0x00108000;
+    CAN1->IE  = 0x00108000;
+
+    Can_Arch_IsrMainHandler( &HwUnit, CAN_CONTROLLER_0, CAN_INTERRUPT_LINE0 );
+
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00008000, CAN1->IR, "Wrong flags cleared on line 0" );
+
+    CAN1->IR = 0x00108000;
+
+    Can_Arch_IsrMainHandler( &HwUnit, CAN_CONTROLLER_0, CAN_INTERRUPT_LINE1 );
+
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00100000, CAN1->IR, "Wrong flags cleared on line 1" );
+}
+
+/**
+ * @brief   Test case for the flags of each interrupt line
+ *
+ * With the Bit and Line Error and the Protocol Error groups routed to line 1, line 1 shall get
+ * only the flags of both groups and line 0 all the rest
+ */
+void test__Can_GetLineFlags__groups_routed_to_line1( void )
+{
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00FF0000, Can_GetLineFlags( 0x00000060, CAN_INTERRUPT_LINE1 ), "Wrong line 1 flags" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0xFF00FFFF, Can_GetLineFlags( 0x00000060, CAN_INTERRUPT_LINE0 ), "Wrong line 0 flags" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000000, Can_GetLineFlags( 0x00000000, CAN_INTERRUPT_LINE1 ), "Flags on line 1" );
+}
+
+/**
+ * @brief   Test case for serving only the enabled flags
+ *
+ * With new messages flagged on both Rx FIFOs but only the Rx FIFO 0 interrupt enabled, only the
+ * message on FIFO 0 shall be read
+ */
+void test__Can_Arch_IsrMainHandler__serve_only_enabled_flags( void )
+{
+    RxIndicationCount = 0u;
+    CAN1->IR          = 0x00000009;
+    CAN1->IE          = 0x00000001;
+    CAN1->RXF0S       = 0x00000001; /* get index 0, fill level 1 */
+    CAN1->RXF1S       = 0x00000001; /* get index 0, fill level 1 */
+    CAN1->RXF1A       = 0x00000007;
+
+    CanIf_RxIndication_StubWithCallback( CanIf_RxIndication_Callback );
+
+    Can_Arch_IsrMainHandler( &HwUnit, CAN_CONTROLLER_0, CAN_INTERRUPT_LINE0 );
+
+    TEST_ASSERT_EQUAL_MESSAGE( 1, RxIndicationCount, "Wrong number of messages read" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000007, CAN1->RXF1A, "Rx FIFO 1 acknowledged" );
+}
+
+/**
+ * @brief   Test case for the interrupt lines handlers
+ *
+ * This test case will check that Can_Arch_Init installs the driver handlers on both interrupt
+ * lines of the RAM vector table.
+ */
+void test__Can_Arch_Init__install_line_handlers( void )
+{
+    TEST_ASSERT_EQUAL_PTR( Can_Isr_Line0, CDD_Nvic_GetHandler( TIM16_FDCAN_IT0_IRQn ) );
+    TEST_ASSERT_EQUAL_PTR( Can_Isr_Line1, CDD_Nvic_GetHandler( TIM17_FDCAN_IT1_IRQn ) );
+}
+
+/*timer handler installed on the vectors shared with the Can interrupt lines*/
+static void Timer_Isr( void )
+{
+    TimerIsrCount++;
+}
+
+/**
+ * @brief   Test case for the handlers shared with the interrupt lines
+ *
+ * This test case will check that the handlers found on the vectors are called after the Can
+ * flags, and that a second initialization does not chain the driver handlers to themselves.
+ */
+void test__Can_Arch_Init__chain_previous_line_handlers( void )
+{
+    CAN1->IR      = 0x00000000;
+    CAN1->IE      = 0x00000000;
+    TimerIsrCount = 0u;
+    CDD_Nvic_SetHandler( TIM16_FDCAN_IT0_IRQn, Timer_Isr );
+    CDD_Nvic_SetHandler( TIM17_FDCAN_IT1_IRQn, Timer_Isr );
+
+    Can_Arch_Init( &HwUnit, HwUnit.Config, CANARCH_CONTROLLER_0 );
+    Can_Arch_Init( &HwUnit, HwUnit.Config, CANARCH_CONTROLLER_0 );
+
+    CDD_Nvic_GetHandler( TIM16_FDCAN_IT0_IRQn )( );
+    CDD_Nvic_GetHandler( TIM17_FDCAN_IT1_IRQn )( );
+
+    TEST_ASSERT_EQUAL_PTR( Can_Isr_Line0, CDD_Nvic_GetHandler( TIM16_FDCAN_IT0_IRQn ) );
+    TEST_ASSERT_EQUAL_UINT8_MESSAGE( 2u, TimerIsrCount, "Timer handlers not called once per line" );
+}
+
+/**
+ * @brief   Test case for calling a given subrutine from the interrupt lines handler
+ *
+ * This test case will check that the subrutine is called when the interrupt is triggered
+ * and the line 1 handler is called from the vector table.
+ */
+void test__Can_Isr_Lines__call_subrutine( void )
+{
+    CAN1->IR = 0x00100000;
+    CAN1->IE = 0x00100000;
+
+    Can_Isr_Lines( CAN_INTERRUPT_LINE1 );
 }
 
 /**
@@ -1394,173 +1724,229 @@ void test__Can_SetupConfiguredInterrupts__setup_interrupts_with_no_tx( void )
 }
 
 /**
- * @brief   get close DLC with padding fo 8 bytes
+ * @brief   get close DLC for 8 bytes
  *
- * This test case will check that the function returns the correct DLC value and the padding
- * value is set to 0xAA
+ * This test case will check that the function returns the correct DLC value for a message of
+ * 4 bytes
  */
-void test__Can_GetClosestDlcWithPadding__padding_4_bytes( void )
+void test__Can_GetClosestDlc__length_4_bytes( void )
 {
-    uint32 Buffer[ 2 ] = { 0 };
-    uint8 Reference[ 8 ];
-
-    memset( Reference, 0xAA, 8 );
-
-    uint8 Dlc = Can_GetClosestDlcWithPadding( 4, Buffer, 0xAA );
+    uint8 Dlc = Can_GetClosestDlc( 4 );
 
     TEST_ASSERT_EQUAL_HEX8_MESSAGE( CAN_OBJECT_PL_8, Dlc, "Wrong DLC value" );
-    TEST_ASSERT_EQUAL_MEMORY_MESSAGE( Reference, Buffer, 8, "Wrong padding value" );
 }
 
 /**
- * @brief   get close DLC with padding fo 12 bytes
+ * @brief   get close DLC for 12 bytes
  *
- * This test case will check that the function returns the correct DLC value and the padding
- * value is set to 0xAA
+ * This test case will check that the function returns the correct DLC value for a message of
+ * 10 bytes
  */
-void test__Can_GetClosestDlcWithPadding__padding_12_bytes( void )
+void test__Can_GetClosestDlc__length_12_bytes( void )
 {
-    uint32 Buffer[ 3 ] = { 0 };
-    uint8 Reference[ 12 ];
-
-    memset( Reference, 0xAA, 12 );
-
-    uint8 Dlc = Can_GetClosestDlcWithPadding( 10, Buffer, 0xAA );
+    uint8 Dlc = Can_GetClosestDlc( 10 );
 
     TEST_ASSERT_EQUAL_HEX8_MESSAGE( CAN_OBJECT_PL_12, Dlc, "Wrong DLC value" );
-    TEST_ASSERT_EQUAL_MEMORY_MESSAGE( Reference, Buffer, 12, "Wrong padding value" );
 }
+
 /**
- * @brief   get close DLC with padding fo 16 bytes
+ * @brief   get close DLC for 16 bytes
  *
- * This test case will check that the function returns the correct DLC value and the padding
- * value is set to 0xAA
+ * This test case will check that the function returns the correct DLC value for a message of
+ * 14 bytes
  */
-void test__Can_GetClosestDlcWithPadding__padding_16_bytes( void )
+void test__Can_GetClosestDlc__length_16_bytes( void )
 {
-    uint32 Buffer[ 4 ] = { 0 };
-    uint8 Reference[ 16 ];
-
-    memset( Reference, 0xAA, 16 );
-
-    uint8 Dlc = Can_GetClosestDlcWithPadding( 14, Buffer, 0xAA );
+    uint8 Dlc = Can_GetClosestDlc( 14 );
 
     TEST_ASSERT_EQUAL_HEX8_MESSAGE( CAN_OBJECT_PL_16, Dlc, "Wrong DLC value" );
-    TEST_ASSERT_EQUAL_MEMORY_MESSAGE( Reference, Buffer, 16, "Wrong padding value" );
 }
 
 /**
- * @brief   get close DLC with padding fo 20 bytes
+ * @brief   get close DLC for 20 bytes
  *
- * This test case will check that the function returns the correct DLC value and the padding
- * value is set to 0xAA
+ * This test case will check that the function returns the correct DLC value for a message of
+ * 18 bytes
  */
-void test__Can_GetClosestDlcWithPadding__padding_20_bytes( void )
+void test__Can_GetClosestDlc__length_20_bytes( void )
 {
-    uint32 Buffer[ 5 ] = { 0 };
-    uint8 Reference[ 20 ];
+    uint8 Dlc = Can_GetClosestDlc( 18 );
 
-    memset( Reference, 0xAA, 20 );
+    TEST_ASSERT_EQUAL_HEX8_MESSAGE( CAN_OBJECT_PL_20, Dlc, "Wrong DLC value" );
+}
 
-    uint8 Dlc = Can_GetClosestDlcWithPadding( 18, Buffer, 0xAA );
+/**
+ * @brief   get close DLC for 24 bytes
+ *
+ * This test case will check that the function returns the correct DLC value for a message of
+ * 22 bytes
+ */
+void test__Can_GetClosestDlc__length_24_bytes( void )
+{
+    uint8 Dlc = Can_GetClosestDlc( 22 );
 
-    TEST_ASSERT_EQUAL_HEX8_MESSAGE( CAN_OBJECT_PL_20, Dlc, "Wrong DLC value" );
-    TEST_ASSERT_EQUAL_MEMORY_MESSAGE( Reference, Buffer, 20, "Wrong padding value" );
+    TEST_ASSERT_EQUAL_HEX8_MESSAGE( CAN_OBJECT_PL_24, Dlc, "Wrong DLC value" );
 }
 
 /**
- * @brief   get close DLC with padding fo 24 bytes
+ * @brief   get close DLC for 32 bytes
  *
- * This test case will check that the function returns the correct DLC value and the padding
- * value is set to 0xAA
+ * This test case will check that the function returns the correct DLC value for a message of
+ * 30 bytes
  */
-void test__Can_GetClosestDlcWithPadding__padding_24_bytes( void )
+void test__Can_GetClosestDlc__length_32_bytes( void )
 {
-    uint32 Buffer[ 6 ] = { 0 };
-    uint8 Reference[ 24 ];
+    uint8 Dlc = Can_GetClosestDlc( 30 );
 
-    memset( Reference, 0xAA, 24 );
+    TEST_ASSERT_EQUAL_HEX8_MESSAGE( CAN_OBJECT_PL_32, Dlc, "Wrong DLC value" );
+}
 
-    uint8 Dlc = Can_GetClosestDlcWithPadding( 22, Buffer, 0xAA );
+/**
+ * @brief   get close DLC for 48 bytes
+ *
+ * This test case will check that the function returns the correct DLC value for a message of
+ * 46 bytes
+ */
+void test__Can_GetClosestDlc__length_48_bytes( void )
+{
+    uint8 Dlc = Can_GetClosestDlc( 46 );
 
-    TEST_ASSERT_EQUAL_HEX8_MESSAGE( CAN_OBJECT_PL_24, Dlc, "Wrong DLC value" );
-    TEST_ASSERT_EQUAL_MEMORY_MESSAGE( Reference, Buffer, 24, "Wrong padding value" );
+    TEST_ASSERT_EQUAL_HEX8_MESSAGE( CAN_OBJECT_PL_48, Dlc, "Wrong DLC value" );
 }
 
 /**
- * @brief   get close DLC with padding fo 32 bytes
+ * @brief   get close DLC for 64 bytes
  *
- * This test case will check that the function returns the correct DLC value and the padding
- * value is set to 0xAA
+ * This test case will check that the function returns the correct DLC value for a message of
+ * 51 bytes
  */
-void test__Can_GetClosestDlcWithPadding__padding_32_bytes( void )
+void test__Can_GetClosestDlc__length_64_bytes( void )
 {
-    uint32 Buffer[ 8 ] = { 0 };
-    uint8 Reference[ 32 ];
+    uint8 Dlc = Can_GetClosestDlc( 51 );
 
-    memset( Reference, 0xAA, 32 );
+    TEST_ASSERT_EQUAL_HEX8_MESSAGE( CAN_OBJECT_PL_64, Dlc, "Wrong DLC value" );
+}
 
-    uint8 Dlc = Can_GetClosestDlcWithPadding( 30, Buffer, 0xAA );
+/**
+ * @brief   get close DLC for more then 64 bytes
+ *
+ * This test case will check that the function returns the 8 bytes DLC value for an invalid length
+ */
+void test__Can_GetClosestDlc__more_than_64( void )
+{
+    uint8 Dlc = Can_GetClosestDlc( 70 );
 
-    TEST_ASSERT_EQUAL_HEX8_MESSAGE( CAN_OBJECT_PL_32, Dlc, "Wrong DLC value" );
-    TEST_ASSERT_EQUAL_MEMORY_MESSAGE( Reference, Buffer, 32, "Wrong padding value" );
+    TEST_ASSERT_EQUAL_HEX8_MESSAGE( CAN_OBJECT_PL_8, Dlc, "Wrong DLC value" );
 }
 
 /**
- * @brief   get close DLC with padding fo 48 bytes
+ * @brief   get close DLC on the limits of each data length
  *
- * This test case will check that the function returns the correct DLC value and the padding
- * value is set to 0xAA
+ * This test case will check that each valid length takes the smallest data length that fits it
  */
-void test__Can_GetClosestDlcWithPadding__padding_48_bytes( void )
+void test__Can_GetClosestDlc__length_limits( void )
 {
-    uint32 Buffer[ 12 ] = { 0 };
-    uint8 Reference[ 48 ];
+    const uint8 Lengths[] = { 0, 8, 9, 12, 13, 16, 17, 20, 21, 24, 25, 32, 33, 48, 49, 64 };
+    const uint8 Dlcs[]    = { CAN_OBJECT_PL_8, CAN_OBJECT_PL_8, CAN_OBJECT_PL_12, CAN_OBJECT_PL_12,
+                              CAN_OBJECT_PL_16, CAN_OBJECT_PL_16, CAN_OBJECT_PL_20, CAN_OBJECT_PL_20,
+                              CAN_OBJECT_PL_24, CAN_OBJECT_PL_24, CAN_OBJECT_PL_32, CAN_OBJECT_PL_32,
+                              CAN_OBJECT_PL_48, CAN_OBJECT_PL_48, CAN_OBJECT_PL_64, CAN_OBJECT_PL_64 };
 
-    memset( Reference, 0xAA, 48 );
+    for( uint8 i = 0u; i < sizeof( Lengths ); i++ )
+    {
+        TEST_ASSERT_EQUAL_HEX8_MESSAGE( Dlcs[ i ], Can_GetClosestDlc( Lengths[ i ] ), "Wrong DLC value" );
+    }
+}
 
-    uint8 Dlc = Can_GetClosestDlcWithPadding( 46, Buffer, 0xAA );
+/**
+ * @brief   write a payload with padding
+ *
+ * This test case will check that a message of 5 bytes is written by words with the last word and
+ * the following ones up to 12 bytes completed with the padding value, without touching the rest
+ * of the element
+ */
+void test__Can_WriteTxPayload__padding_12_bytes( void )
+{
+    const uint8 Message[] = { 0x01, 0x02, 0x03, 0x04, 0x05 };
+    uint32 Payload[ 4 ]   = { 0x11111111, 0x11111111, 0x11111111, 0x11111111 };
 
-    TEST_ASSERT_EQUAL_HEX8_MESSAGE( CAN_OBJECT_PL_48, Dlc, "Wrong DLC value" );
-    TEST_ASSERT_EQUAL_MEMORY_MESSAGE( Reference, Buffer, 48, "Wrong padding value" );
+    Can_WriteTxPayload( Payload, Message, 5, 12, 0xAA );
+
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x04030201, Payload[ 0 ], "Wrong Data0 value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0xAAAAAA05, Payload[ 1 ], "Wrong Data1 value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0xAAAAAAAA, Payload[ 2 ], "Wrong Data2 value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x11111111, Payload[ 3 ], "Wrong Data3 value" );
 }
 
 /**
- * @brief   get close DLC with padding fo 64 bytes
+ * @brief   write a payload not aligned
  *
- * This test case will check that the function returns the correct DLC value and the padding
- * value is set to 0xAA
+ * This test case will check that a message starting at an odd address is written in the same
+ * byte order
  */
-void test__Can_GetClosestDlcWithPadding__padding_64_bytes( void )
+void test__Can_WriteTxPayload__unaligned_message( void )
 {
-    uint32 Buffer[ 16 ] = { 0 };
-    uint8 Reference[ 64 ];
+    const uint8 Message[] = { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08 };
+    uint32 Payload[ 2 ]   = { 0 };
 
-    memset( Reference, 0xAA, 64 );
+    Can_WriteTxPayload( Payload, &Message[ 1 ], 8, 8, 0x00 );
 
-    uint8 Dlc = Can_GetClosestDlcWithPadding( 51, Buffer, 0xAA );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x04030201, Payload[ 0 ], "Wrong Data0 value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x08070605, Payload[ 1 ], "Wrong Data1 value" );
+}
 
-    TEST_ASSERT_EQUAL_HEX8_MESSAGE( CAN_OBJECT_PL_64, Dlc, "Wrong DLC value" );
-    TEST_ASSERT_EQUAL_MEMORY_MESSAGE( Reference, Buffer, 64, "Wrong padding value" );
+/**
+ * @brief   write a classic payload with a partial second word
+ *
+ * This test case will check that a message of 6 bytes is written in two words with the last two
+ * bytes of the second one completed with the padding value, without touching the rest of the
+ * element
+ */
+void test__Can_WriteTxPayload__classic_6_bytes( void )
+{
+    const uint8 Message[] = { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06 };
+    uint32 Payload[ 3 ]   = { 0x11111111, 0x11111111, 0x11111111 };
+
+    Can_WriteTxPayload( Payload, Message, 6, 6, 0xCC );
+
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x04030201, Payload[ 0 ], "Wrong Data0 value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0xCCCC0605, Payload[ 1 ], "Wrong Data1 value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x11111111, Payload[ 2 ], "Wrong Data2 value" );
 }
 
 /**
- * @brief   get close DLC with padding for more then 64 bytes
+ * @brief   build the last payload word
  *
- * This test case will check that the function returns the correct DLC value and the padding
- * value is set to 0xAA
+ * This test case will check that one, two and three bytes are packed in the lower positions of
+ * the word and the rest keeps the padding value
  */
-void test__Can_GetClosestDlcWithPadding__more_than_64( void )
+void test__Can_MergeTxBytes__one_to_three_bytes( void )
 {
-    uint32 Buffer[ 2 ] = { 0 };
-    uint8 Reference[ 8 ];
+    const uint8 Message[] = { 0x01, 0x02, 0x03 };
 
-    memset( Reference, 0xAA, 8 );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0xAAAAAA01, Can_MergeTxBytes( Message, 1, 0xAAAAAAAA ), "Wrong one byte word" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0xAAAA0201, Can_MergeTxBytes( Message, 2, 0xAAAAAAAA ), "Wrong two bytes word" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0xAA030201, Can_MergeTxBytes( Message, 3, 0xAAAAAAAA ), "Wrong three bytes word" );
+}
 
-    uint8 Dlc = Can_GetClosestDlcWithPadding( 70, Buffer, 0xAA );
+/**
+ * @brief   write a payload with words of padding only
+ *
+ * This test case will check that a message of 8 bytes sent with an FD data lenght of 16 bytes
+ * gets its whole words copied and the following words filled with the padding value
+ */
+void test__Can_WriteTxPayload__padding_words_16_bytes( void )
+{
+    const uint8 Message[] = { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08 };
+    uint32 Payload[ 5 ]   = { 0x11111111, 0x11111111, 0x11111111, 0x11111111, 0x11111111 };
 
-    TEST_ASSERT_EQUAL_HEX8_MESSAGE( CAN_OBJECT_PL_8, Dlc, "Wrong DLC value" );
-    TEST_ASSERT_EQUAL_MEMORY_MESSAGE( Reference, Buffer, 8, "Wrong padding value" );
+    Can_WriteTxPayload( Payload, Message, 8, 16, 0x55 );
+
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x04030201, Payload[ 0 ], "Wrong Data0 value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x08070605, Payload[ 1 ], "Wrong Data1 value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x55555555, Payload[ 2 ], "Wrong Data2 value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x55555555, Payload[ 3 ], "Wrong Data3 value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x11111111, Payload[ 4 ], "Wrong Data4 value" );
 }
 
 /**
@@ -1659,6 +2045,66 @@ void test__Can_Isr_RxFifo0NewMessage__call_rx_indication( void )
     Can_Isr_RxFifo0NewMessage( &HwUnit, CAN_CONTROLLER_0 );
 }
 
+/**
+ * @brief   Drain the whole Rx FIFO 0 with a budget of one message per interrupt
+ *
+ * With three messages pending starting at element 1 and CAN_RX_FIFO_ISR_BUDGET set to 1, the
+ * line shall be set pending again until the three are passed to the upper layer in order, the
+ * last element acknowledged shall be 0
+ */
+void test__Can_Isr_RxFifo0NewMessage__read_all_pending_messages( void )
+{
+    RxIndicationCount = 0u;
+    RxFifoStatus      = &CAN1->RXF0S;
+    NVIC->ISPR[ 0u ]  = 0u;
+    CAN1->ILS         = 0x00000000;
+    CAN1->IR          = 0x00000001;
+    CAN1->IE          = 0x00000001;
+    CAN1->RXF0S       = 0x00000103; /* get index 1, fill level 3 */
+    CAN1->RXF0A       = 0x00000007;
+
+    SRAMCAN1->F0SA[ 18u ] = 0x04440000; /* element 1, standard id 0x111 */
+    SRAMCAN1->F0SA[ 19u ] = 0x00080000;
+    SRAMCAN1->F0SA[ 36u ] = 0x08880000; /* element 2, standard id 0x222 */
+    SRAMCAN1->F0SA[ 37u ] = 0x00080000;
+    SRAMCAN1->F0SA[ 0u ]  = 0x0CCC0000; /* element 0, standard id 0x333 */
+    SRAMCAN1->F0SA[ 1u ]  = 0x00080000;
+
+    CanIf_RxIndication_StubWithCallback( CanIf_RxIndication_Callback );
+
+    Can_Arch_IsrMainHandler( &HwUnit, CAN_CONTROLLER_0, CAN_INTERRUPT_LINE0 );
+    Can_ServePendingLines( );
+    RxFifoStatus = NULL_PTR;
+
+    TEST_ASSERT_EQUAL_MESSAGE( 3, RxIndicationCount, "Wrong number of messages read" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000000, CAN1->RXF0S & 0x0Fu, "Messages left on the FIFO" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000111, RxIndicationIds[ 0u ], "Wrong first message" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000222, RxIndicationIds[ 1u ], "Wrong second message" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000333, RxIndicationIds[ 2u ], "Wrong third message" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000000, CAN1->RXF0A, "Wrong acknowledged element" );
+}
+
+/**
+ * @brief   Pend the interrupt line of the Rx FIFO 0 group with messages left
+ *
+ * With three messages pending, a budget of one and the Rx FIFO 0 group routed to line 1, one
+ * message shall be read and the line 1 set pending
+ */
+void test__Can_Isr_RxFifo0NewMessage__pend_line_with_messages_left( void )
+{
+    RxIndicationCount = 0u;
+    NVIC->ISPR[ 0u ]  = 0u;
+    CAN1->ILS         = 0x00000001;
+    CAN1->RXF0S       = 0x00000003; /* get index 0, fill level 3 */
+
+    CanIf_RxIndication_StubWithCallback( CanIf_RxIndication_Callback );
+
+    Can_Isr_RxFifo0NewMessage( &HwUnit, CAN_CONTROLLER_0 );
+
+    TEST_ASSERT_EQUAL_MESSAGE( 1, RxIndicationCount, "Wrong number of messages read" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 1UL << TIM17_FDCAN_IT1_IRQn, NVIC->ISPR[ 0u ], "Wrong line pending" );
+}
+
 /**
  * @brief   test to check that the CanIf_ErrorNotification is called
  *
@@ -1699,6 +2145,43 @@ void test__Can_Isr_RxFifo1NewMessage__call_rx_indication( void )
     Can_Isr_RxFifo1NewMessage( &HwUnit, CAN_CONTROLLER_0 );
 }
 
+/**
+ * @brief   Drain the whole Rx FIFO 1 with a budget of one message per interrupt
+ *
+ * With two messages pending starting at element 2 and CAN_RX_FIFO_ISR_BUDGET set to 1, the line
+ * shall be set pending again until both are passed to the upper layer, the last element
+ * acknowledged shall be 0
+ */
+void test__Can_Isr_RxFifo1NewMessage__read_all_pending_messages( void )
+{
+    RxIndicationCount = 0u;
+    RxFifoStatus      = &CAN1->RXF1S;
+    NVIC->ISPR[ 0u ]  = 0u;
+    CAN1->ILS         = 0x00000000;
+    CAN1->IR          = 0x00000008;
+    CAN1->IE          = 0x00000008;
+    CAN1->RXF0S       = 0x00000000;
+    CAN1->RXF1S       = 0x00000202; /* get index 2, fill level 2 */
+    CAN1->RXF1A       = 0x00000007;
+
+    SRAMCAN1->F1SA[ 36u ] = 0x41234567; /* element 2, extended id 0x01234567 */
+    SRAMCAN1->F1SA[ 37u ] = 0x00080000;
+    SRAMCAN1->F1SA[ 0u ]  = 0x04440000; /* element 0, standard id 0x111 */
+    SRAMCAN1->F1SA[ 1u ]  = 0x00080000;
+
+    CanIf_RxIndication_StubWithCallback( CanIf_RxIndication_Callback );
+
+    Can_Arch_IsrMainHandler( &HwUnit, CAN_CONTROLLER_0, CAN_INTERRUPT_LINE0 );
+    Can_ServePendingLines( );
+    RxFifoStatus = NULL_PTR;
+
+    TEST_ASSERT_EQUAL_MESSAGE( 2, RxIndicationCount, "Wrong number of messages read" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000000, CAN1->RXF1S & 0x0Fu, "Messages left on the FIFO" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x81234567, RxIndicationIds[ 0u ], "Wrong first message" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000111, RxIndicationIds[ 1u ], "Wrong second message" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000000, CAN1->RXF1A, "Wrong acknowledged element" );
+}
+
 /**
  * @brief   test to check that the CanIf_ErrorNotification is called
  *
@@ -1926,4 +2409,158 @@ void test__Can_Isr_ProtocolErrorInDataPhase__error( void )
 {
     CanIf_ErrorNotification_Ignore( );
     Can_Isr_ProtocolErrorInDataPhase( &HwUnit, CAN_CONTROLLER_0 );
-}
\ No newline at end of file
+}
+/**
+ * @brief   Polled reception reads a bounded batch
+ *
+ * With three messages on Rx FIFO 0 and two on Rx FIFO 1, a call shall read the three messages of
+ * FIFO 0 and only one of FIFO 1 to stay within CAN_MAIN_FUNCTION_READ_BATCH
+ */
+void test__Can_Arch_MainFunction_Read__polled_batch( void )
+{
+    RxIndicationCount = 0u;
+    CAN2->RXF0S       = 0x00000003; /* get index 0, fill level 3 */
+    CAN2->RXF0A       = 0x00000007;
+    CAN2->RXF1S       = 0x00000002; /* get index 0, fill level 2 */
+    CAN2->RXF1A       = 0x00000007;
+
+    CanIf_RxIndication_StubWithCallback( CanIf_RxIndication_Callback );
+
+    Can_Arch_MainFunction_Read( &HwUnit, CANARCH_CONTROLLER_1 );
+
+    TEST_ASSERT_EQUAL_MESSAGE( CAN_MAIN_FUNCTION_READ_BATCH, RxIndicationCount, "Wrong number of messages read" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000002, CAN2->RXF0A, "Wrong acknowledged element on FIFO 0" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000000, CAN2->RXF1A, "Wrong acknowledged element on FIFO 1" );
+}
+
+/**
+ * @brief   Reception on interrupts is not polled
+ *
+ * A controller with its reception on interrupts shall not read its Rx FIFOs from the main function
+ */
+void test__Can_Arch_MainFunction_Read__interrupt_controller( void )
+{
+    RxIndicationCount = 0u;
+    CAN1->RXF0S       = 0x00000003;
+
+    CanIf_RxIndication_StubWithCallback( CanIf_RxIndication_Callback );
+
+    Can_Arch_MainFunction_Read( &HwUnit, CANARCH_CONTROLLER_0 );
+
+    TEST_ASSERT_EQUAL_MESSAGE( 0, RxIndicationCount, "Messages read on a controller with interrupts" );
+}
+
+/**
+ * @brief   Polled transmit confirmation confirms a bounded batch
+ *
+ * With more elements on the Tx event FIFO than the batch, a call shall only confirm
+ * CAN_MAIN_FUNCTION_WRITE_BATCH messages
+ */
+void test__Can_Arch_MainFunction_Write__polled_batch( void )
+{
+    TxConfirmationCount = 0u;
+    CAN2->TXEFS         = 0x00000006; /* get index 0, fill level 6 */
+
+    CanIf_TxConfirmation_StubWithCallback( CanIf_TxConfirmation_Callback );
+
+    Can_Arch_MainFunction_Write( &HwUnit, CANARCH_CONTROLLER_1 );
+
+    TEST_ASSERT_EQUAL_MESSAGE( CAN_MAIN_FUNCTION_WRITE_BATCH, TxConfirmationCount, "Wrong number of confirmations" );
+}
+
+/**
+ * @brief   Transmit confirmation on interrupts is not polled
+ *
+ * A controller with its transmit confirmation on interrupts shall not read its Tx event FIFO from
+ * the main function
+ */
+void test__Can_Arch_MainFunction_Write__interrupt_controller( void )
+{
+    TxConfirmationCount = 0u;
+    CAN1->TXEFS         = 0x00000002;
+
+    CanIf_TxConfirmation_StubWithCallback( CanIf_TxConfirmation_Callback );
+
+    Can_Arch_MainFunction_Write( &HwUnit, CANARCH_CONTROLLER_0 );
+
+    TEST_ASSERT_EQUAL_MESSAGE( 0, TxConfirmationCount, "Confirmations given on a controller with interrupts" );
+}
+
+/**
+ * @brief   Polled bus off on a started controller
+ *
+ * The bus off shall stop the controller and be notified to the upper layer
+ */
+void test__Can_Arch_MainFunction_BusOff__started_controller( void )
+{
+    HwUnit.ControllerState[ CANARCH_CONTROLLER_1 ] = CAN_CS_STARTED;
+    CAN2->PSR                                      = 0x00000080;
+    CAN2->CCCR                                     = 0x00000001;
+
+    CanIf_ControllerBusOff_Expect( CANARCH_CONTROLLER_1 );
+
+    Can_Arch_MainFunction_BusOff( &HwUnit, CANARCH_CONTROLLER_1 );
+
+    TEST_ASSERT_EQUAL_MESSAGE( CAN_CS_STOPPED, HwUnit.ControllerState[ CANARCH_CONTROLLER_1 ], "Wrong controller state" );
+}
+
+/**
+ * @brief   Polled bus off on a stopped controller
+ *
+ * The bus off flag stays set after the controller is stopped, it shall not be notified again
+ */
+void test__Can_Arch_MainFunction_BusOff__stopped_controller( void )
+{
+    HwUnit.ControllerState[ CANARCH_CONTROLLER_1 ] = CAN_CS_STOPPED;
+    CAN2->PSR                                      = 0x00000080;
+    CAN2->CCCR                                     = 0x00000001;
+
+    Can_Arch_MainFunction_BusOff( &HwUnit, CANARCH_CONTROLLER_1 );
+
+    TEST_ASSERT_EQUAL_MESSAGE( CAN_CS_STOPPED, HwUnit.ControllerState[ CANARCH_CONTROLLER_1 ], "Wrong controller state" );
+}
+
+/**
+ * @brief   Polled mode transition
+ *
+ * A new controller state shall be indicated once to the upper layer
+ */
+void test__Can_Arch_MainFunction_Mode__indicate_new_state( void )
+{
+    HwUnit.ModeIndicated[ CANARCH_CONTROLLER_0 ]   = CAN_CS_STOPPED;
+    HwUnit.ControllerState[ CANARCH_CONTROLLER_0 ] = CAN_CS_STARTED;
+
+    CanIf_ControllerModeIndication_Expect( CANARCH_CONTROLLER_0, CAN_CS_STARTED );
+
+    Can_Arch_MainFunction_Mode( &HwUnit, CANARCH_CONTROLLER_0 );
+    Can_Arch_MainFunction_Mode( &HwUnit, CANARCH_CONTROLLER_0 );
+
+    TEST_ASSERT_EQUAL_MESSAGE( CAN_CS_STARTED, HwUnit.ModeIndicated[ CANARCH_CONTROLLER_0 ], "Wrong indicated state" );
+}
+
+/**
+ * @brief   Polled interrupts left disabled
+ *
+ * The reception, transmission and bus off interrupts of a controller with polled events shall not
+ * be enabled even if they are on its active interrupts
+ */
+void test__Can_SetupConfiguredInterrupts__polled_events_disabled( void )
+{
+    /* clang-format off */
+    Can_Controller Controller =
+    {
+        .ActiveITs        = CAN_IT_RX_FIFO0_NEW_MESSAGE | CAN_IT_TX_COMPLETE | CAN_IT_BUS_OFF | CAN_IT_TIMEOUT_OCCURRED,
+        .RxProcessing     = CAN_PROCESSING_POLLING,
+        .TxProcessing     = CAN_PROCESSING_POLLING,
+        .BusoffProcessing = CAN_PROCESSING_POLLING
+    };
+    /* clang-format on */
+
+    CAN1->TXBTIE = 0x00000000;
+
+    Can_SetupConfiguredInterrupts( &Controller, CAN1 );
+
+    TEST_ASSERT_BITS_LOW_MESSAGE( CAN_IT_RX_FIFO0_NEW_MESSAGE | CAN_IT_TX_COMPLETE | CAN_IT_BUS_OFF, CAN1->IE, "Polled interrupts enabled" );
+    TEST_ASSERT_BITS_HIGH_MESSAGE( CAN_IT_TIMEOUT_OCCURRED, CAN1->IE, "Interrupt not enabled" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000000, CAN1->TXBTIE, "Tx buffer interrupts enabled" );
+}
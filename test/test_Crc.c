@@ -8,7 +8,17 @@
 
 #include "unity.h"
 #include "Std_Types.h"
+#include "Registers.h"
 #include "Crc.h"
+#include "mock_Crc_Arch.h"
+
+extern volatile Crc_RegionStateType Crc_RegionState;
+extern uint32 Crc_RegionResult;
+
+/*values received by the region notification*/
+static uint32 CallbackCalls;
+static Crc_RegionStateType CallbackState;
+static uint32 CallbackResult;
 
 /**
  * @brief   **setUp**
@@ -17,6 +27,11 @@
  */
 void setUp( void )
 {
+    Crc_RegionState  = CRC_REGION_IDLE;
+    Crc_RegionResult = 0u;
+    CallbackCalls    = 0u;
+    CallbackState    = CRC_REGION_IDLE;
+    CallbackResult   = 0u;
 }
 
 /**
@@ -711,4 +726,606 @@ void test_Crc_GetVersionInfo( void )
     Std_VersionInfoType VersionInfo;
     uint8 VersionValue = Crc_GetVersionInfo( &VersionInfo );
     TEST_ASSERT_EQUAL_HEX8_MESSAGE( 0x01, VersionValue, "Get version was not the supposed value" );
-}
\ No newline at end of file
+}
+/**
+ * @defgroup Crc_Equivalence_Values values used to compare the configured routines against the
+ * bit by bit reference calculation
+ * @{ */
+#define CRC_TEST_ITERATIONS 200u /*!< Number of random buffers to compare */
+#define CRC_TEST_MAX_LENGTH 300u /*!< Maximum length of each random buffer */
+/**
+ * @} */
+
+/**
+ * @brief   Seed of the pseudo random generator, fixed to get the same buffers on every run
+ */
+static uint32 RandomSeed;
+
+/**
+ * @brief   **Pseudo random generator**
+ *
+ * Linear congruential generator, used instead of rand() to obtain the same sequence of buffers
+ * in any host the test runs.
+ *
+ * @retval  Next pseudo random 32 bits value
+ */
+static uint32 Random_Next( void )
+{
+    RandomSeed = ( RandomSeed * 1664525u ) + 1013904223u;
+    return RandomSeed;
+}
+
+/**
+ * @brief   **Fill a buffer with random data**
+ *
+ * @param   Buffer Buffer to fill
+ * @param   Length Number of bytes to fill
+ */
+static void Random_Fill( uint8 *Buffer, uint32 Length )
+{
+    for( uint32 i = 0; i < Length; i++ )
+    {
+        Buffer[ i ] = (uint8)( Random_Next( ) >> 24u );
+    }
+}
+
+/**
+ * @brief   **Bit by bit reference for not reflected CRCs**
+ *
+ * Same algorithm the library uses when the mode is CRC_RUNTIME, process the data MSB first.
+ *
+ * @param   Data Pointer to the data
+ * @param   Length Number of bytes
+ * @param   Crc Initial value of the crc register
+ * @param   Width Width of the crc in bits (8 or 16)
+ * @param   Poly Polynomial of the crc
+ *
+ * @retval  Value of the crc register after processing all bytes
+ */
+static uint64 Reference_CrcMsb( const uint8 *Data, uint32 Length, uint64 Crc, uint8 Width, uint64 Poly )
+{
+    uint64 topBit = (uint64)1u << ( Width - 1u );
+    uint64 mask   = ( topBit << 1u ) - 1u;
+
+    for( uint32 i = 0; i < Length; i++ )
+    {
+        Crc ^= (uint64)Data[ i ] << ( Width - 8u );
+        for( uint8 bit = 0; bit < 8u; bit++ )
+        {
+            Crc = ( ( Crc & topBit ) != 0u ) ? ( ( Crc << 1u ) ^ Poly ) : ( Crc << 1u );
+            Crc &= mask;
+        }
+    }
+    return Crc;
+}
+
+/**
+ * @brief   **Bit by bit reference for reflected CRCs**
+ *
+ * Same algorithm the library uses when the mode is CRC_RUNTIME, process the data LSB first.
+ *
+ * @param   Data Pointer to the data
+ * @param   Length Number of bytes
+ * @param   Crc Initial value of the crc register
+ * @param   Poly Reflected polynomial of the crc
+ *
+ * @retval  Value of the crc register after processing all bytes
+ */
+static uint64 Reference_CrcLsb( const uint8 *Data, uint32 Length, uint64 Crc, uint64 Poly )
+{
+    for( uint32 i = 0; i < Length; i++ )
+    {
+        Crc ^= (uint64)Data[ i ];
+        for( uint8 bit = 0; bit < 8u; bit++ )
+        {
+            Crc = ( ( Crc & 1u ) != 0u ) ? ( ( Crc >> 1u ) ^ Poly ) : ( Crc >> 1u );
+        }
+    }
+    return Crc;
+}
+
+/**
+ * @brief   **Test Crc_CalculateCRC8 against the bit by bit reference using random buffers**
+ *
+ * Random buffers with random lengths, start values and first call flags are calculated using the
+ * configured method and the bit by bit reference, both results shall be the same.
+ */
+void test_Crc_8bits_equivalence_random_buffers( void )
+{
+    uint8 data[ CRC_TEST_MAX_LENGTH ];
+    RandomSeed = 0x12345678u;
+
+    for( uint32 n = 0; n < CRC_TEST_ITERATIONS; n++ )
+    {
+        uint32 length       = Random_Next( ) % CRC_TEST_MAX_LENGTH;
+        uint8 startValue    = (uint8)Random_Next( );
+        boolean isFirstCall = ( ( Random_Next( ) & 1u ) != 0u ) ? TRUE : FALSE;
+        Random_Fill( data, length );
+
+        uint8 expected = (uint8)Reference_CrcMsb( data, length, ( isFirstCall == TRUE ) ? 0xFFu : startValue, 8u, 0x1Du ) ^ 0xFFu;
+        uint8 crcResult = Crc_CalculateCRC8( data, length, startValue, isFirstCall );
+        TEST_ASSERT_EQUAL_HEX8_MESSAGE( expected, crcResult, "Crc result was not the supposed value" );
+    }
+}
+
+/**
+ * @brief   **Test Crc_CalculateCRC8H2F against the bit by bit reference using random buffers**
+ *
+ * Random buffers with random lengths, start values and first call flags are calculated using the
+ * configured method and the bit by bit reference, both results shall be the same.
+ */
+void test_Crc_8bitsH2F_equivalence_random_buffers( void )
+{
+    uint8 data[ CRC_TEST_MAX_LENGTH ];
+    RandomSeed = 0x23456789u;
+
+    for( uint32 n = 0; n < CRC_TEST_ITERATIONS; n++ )
+    {
+        uint32 length       = Random_Next( ) % CRC_TEST_MAX_LENGTH;
+        uint8 startValue    = (uint8)Random_Next( );
+        boolean isFirstCall = ( ( Random_Next( ) & 1u ) != 0u ) ? TRUE : FALSE;
+        Random_Fill( data, length );
+
+        uint8 expected = ~(uint8)Reference_CrcMsb( data, length, ( isFirstCall == TRUE ) ? 0xFFu : startValue, 8u, 0x2Fu );
+        uint8 crcResult = Crc_CalculateCRC8H2F( data, length, startValue, isFirstCall );
+        TEST_ASSERT_EQUAL_HEX8_MESSAGE( expected, crcResult, "Crc result was not the supposed value" );
+    }
+}
+
+/**
+ * @brief   **Test Crc_CalculateCRC16 against the bit by bit reference using random buffers**
+ *
+ * Random buffers with random lengths, start values and first call flags are calculated using the
+ * configured method and the bit by bit reference, both results shall be the same.
+ */
+void test_Crc_16bits_equivalence_random_buffers( void )
+{
+    uint8 data[ CRC_TEST_MAX_LENGTH ];
+    RandomSeed = 0x3456789Au;
+
+    for( uint32 n = 0; n < CRC_TEST_ITERATIONS; n++ )
+    {
+        uint32 length       = Random_Next( ) % CRC_TEST_MAX_LENGTH;
+        uint16 startValue   = (uint16)Random_Next( );
+        boolean isFirstCall = ( ( Random_Next( ) & 1u ) != 0u ) ? TRUE : FALSE;
+        Random_Fill( data, length );
+
+        uint16 expected  = (uint16)Reference_CrcMsb( data, length, ( isFirstCall == TRUE ) ? 0xFFFFu : startValue, 16u, 0x1021u );
+        uint16 crcResult = Crc_CalculateCRC16( data, length, startValue, isFirstCall );
+        TEST_ASSERT_EQUAL_HEX16_MESSAGE( expected, crcResult, "Crc result was not the supposed value" );
+    }
+}
+
+/**
+ * @brief   **Test Crc_CalculateCRC16ARC against the bit by bit reference using random buffers**
+ *
+ * Random buffers with random lengths, start values and first call flags are calculated using the
+ * configured method and the bit by bit reference, both results shall be the same.
+ */
+void test_Crc_16bitsARC_equivalence_random_buffers( void )
+{
+    uint8 data[ CRC_TEST_MAX_LENGTH ];
+    RandomSeed = 0x456789ABu;
+
+    for( uint32 n = 0; n < CRC_TEST_ITERATIONS; n++ )
+    {
+        uint32 length       = Random_Next( ) % CRC_TEST_MAX_LENGTH;
+        uint16 startValue   = (uint16)Random_Next( );
+        boolean isFirstCall = ( ( Random_Next( ) & 1u ) != 0u ) ? TRUE : FALSE;
+        Random_Fill( data, length );
+
+        uint16 expected  = (uint16)Reference_CrcLsb( data, length, ( isFirstCall == TRUE ) ? 0x0000u : startValue, 0xA001u );
+        uint16 crcResult = Crc_CalculateCRC16ARC( data, length, startValue, isFirstCall );
+        TEST_ASSERT_EQUAL_HEX16_MESSAGE( expected, crcResult, "Crc result was not the supposed value" );
+    }
+}
+
+/**
+ * @brief   **Test Crc_CalculateCRC32 against the bit by bit reference using random buffers**
+ *
+ * Random buffers with random lengths, start values and first call flags are calculated using the
+ * configured method and the bit by bit reference, both results shall be the same.
+ */
+void test_Crc_32bits_equivalence_random_buffers( void )
+{
+    uint8 data[ CRC_TEST_MAX_LENGTH ];
+    RandomSeed = 0x56789ABCu;
+
+    for( uint32 n = 0; n < CRC_TEST_ITERATIONS; n++ )
+    {
+        uint32 length       = Random_Next( ) % CRC_TEST_MAX_LENGTH;
+        uint32 startValue   = Random_Next( );
+        boolean isFirstCall = ( ( Random_Next( ) & 1u ) != 0u ) ? TRUE : FALSE;
+        Random_Fill( data, length );
+
+        uint32 expected  = (uint32)Reference_CrcLsb( data, length, ( isFirstCall == TRUE ) ? 0xFFFFFFFFu : ( startValue ^ 0xFFFFFFFFu ), 0xEDB88320u ) ^ 0xFFFFFFFFu;
+        uint32 crcResult = Crc_CalculateCRC32( data, length, startValue, isFirstCall );
+        TEST_ASSERT_EQUAL_HEX32_MESSAGE( expected, crcResult, "Crc result was not the supposed value" );
+    }
+}
+
+/**
+ * @brief   **Test Crc_CalculateCRC32P4 against the bit by bit reference using random buffers**
+ *
+ * Random buffers with random lengths, start values and first call flags are calculated using the
+ * configured method and the bit by bit reference, both results shall be the same.
+ */
+void test_Crc_32bitsP4_equivalence_random_buffers( void )
+{
+    uint8 data[ CRC_TEST_MAX_LENGTH ];
+    RandomSeed = 0x6789ABCDu;
+
+    for( uint32 n = 0; n < CRC_TEST_ITERATIONS; n++ )
+    {
+        uint32 length       = Random_Next( ) % CRC_TEST_MAX_LENGTH;
+        uint32 startValue   = Random_Next( );
+        boolean isFirstCall = ( ( Random_Next( ) & 1u ) != 0u ) ? TRUE : FALSE;
+        Random_Fill( data, length );
+
+        uint32 expected  = (uint32)Reference_CrcLsb( data, length, ( isFirstCall == TRUE ) ? 0xFFFFFFFFu : ( startValue ^ 0xFFFFFFFFu ), 0xC8DF352Fu ) ^ 0xFFFFFFFFu;
+        uint32 crcResult = Crc_CalculateCRC32P4( data, length, startValue, isFirstCall );
+        TEST_ASSERT_EQUAL_HEX32_MESSAGE( expected, crcResult, "Crc result was not the supposed value" );
+    }
+}
+
+/**
+ * @brief   **Test Crc_CalculateCRC64 against the bit by bit reference using random buffers**
+ *
+ * Random buffers with random lengths, start values and first call flags are calculated using the
+ * configured method and the bit by bit reference, both results shall be the same. A zero length
+ * buffer shall return the start value untouched.
+ */
+void test_Crc_64bits_equivalence_random_buffers( void )
+{
+    uint8 data[ CRC_TEST_MAX_LENGTH ];
+    RandomSeed = 0x789ABCDEu;
+
+    for( uint32 n = 0; n < CRC_TEST_ITERATIONS; n++ )
+    {
+        uint32 length       = Random_Next( ) % CRC_TEST_MAX_LENGTH;
+        uint64 startValue   = ( (uint64)Random_Next( ) << 32u ) | Random_Next( );
+        boolean isFirstCall = ( ( Random_Next( ) & 1u ) != 0u ) ? TRUE : FALSE;
+        Random_Fill( data, length );
+
+        uint64 expected = startValue;
+        if( length != 0u )
+        {
+            expected = Reference_CrcLsb( data, length, ( isFirstCall == TRUE ) ? 0xFFFFFFFFFFFFFFFFu : ( startValue ^ 0xFFFFFFFFFFFFFFFFu ), 0xC96C5795D7870F42u ) ^ 0xFFFFFFFFFFFFFFFFu;
+        }
+        uint64 crcResult = Crc_CalculateCRC64( data, length, startValue, isFirstCall );
+        TEST_ASSERT_EQUAL_HEX64_MESSAGE( expected, crcResult, "Crc result was not the supposed value" );
+    }
+}
+
+/**
+ * @brief   **Test Crc_CalculateCRC32 with unaligned buffers around the word wise threshold**
+ *
+ * The buffer is calculated starting at every possible misalignment and with lengths below, at and
+ * above the minimum length processed word wise, in order to exercise the unaligned head, the word
+ * loop and the tail bytes. Results shall be the same as the bit by bit reference.
+ */
+void test_Crc_32bits_unaligned_buffers( void )
+{
+    static const uint32 lengths[] = { 0u, 1u, 3u, 4u, 15u, 16u, 17u, 18u, 19u, 31u, 64u, 255u };
+    uint32 data[ ( CRC_TEST_MAX_LENGTH / 4u ) + 1u ];
+    uint8 *bytes = (uint8 *)data;
+    RandomSeed   = 0x0BADCAFEu;
+    Random_Fill( bytes, sizeof( data ) );
+
+    for( uint32 offset = 0; offset < 4u; offset++ )
+    {
+        for( uint32 n = 0; n < ( sizeof( lengths ) / sizeof( lengths[ 0 ] ) ); n++ )
+        {
+            uint32 expected  = (uint32)Reference_CrcLsb( &bytes[ offset ], lengths[ n ], 0xFFFFFFFFu, 0xEDB88320u ) ^ 0xFFFFFFFFu;
+            uint32 crcResult = Crc_CalculateCRC32( &bytes[ offset ], lengths[ n ], 0xFFFFFFFFu, TRUE );
+            TEST_ASSERT_EQUAL_HEX32_MESSAGE( expected, crcResult, "Crc result was not the supposed value" );
+        }
+    }
+}
+
+/**
+ * @brief   **Test Crc_CalculateCRC32P4 with unaligned buffers around the word wise threshold**
+ *
+ * The buffer is calculated starting at every possible misalignment and with lengths below, at and
+ * above the minimum length processed word wise, in order to exercise the unaligned head, the word
+ * loop and the tail bytes. Results shall be the same as the bit by bit reference.
+ */
+void test_Crc_32bitsP4_unaligned_buffers( void )
+{
+    static const uint32 lengths[] = { 0u, 1u, 3u, 4u, 15u, 16u, 17u, 18u, 19u, 31u, 64u, 255u };
+    uint32 data[ ( CRC_TEST_MAX_LENGTH / 4u ) + 1u ];
+    uint8 *bytes = (uint8 *)data;
+    RandomSeed   = 0x0DEFACEDu;
+    Random_Fill( bytes, sizeof( data ) );
+
+    for( uint32 offset = 0; offset < 4u; offset++ )
+    {
+        for( uint32 n = 0; n < ( sizeof( lengths ) / sizeof( lengths[ 0 ] ) ); n++ )
+        {
+            uint32 expected  = (uint32)Reference_CrcLsb( &bytes[ offset ], lengths[ n ], 0xFFFFFFFFu, 0xC8DF352Fu ) ^ 0xFFFFFFFFu;
+            uint32 crcResult = Crc_CalculateCRC32P4( &bytes[ offset ], lengths[ n ], 0xFFFFFFFFu, TRUE );
+            TEST_ASSERT_EQUAL_HEX32_MESSAGE( expected, crcResult, "Crc result was not the supposed value" );
+        }
+    }
+}
+
+/**
+ * @brief   **Test Crc_CalculateCRC64 with unaligned buffers around the word wise threshold**
+ *
+ * The buffer is calculated starting at every possible misalignment and with lengths below, at and
+ * above the minimum length processed word wise, in order to exercise the unaligned head, the word
+ * loop and the tail bytes. Results shall be the same as the bit by bit reference.
+ */
+void test_Crc_64bits_unaligned_buffers( void )
+{
+    static const uint32 lengths[] = { 1u, 3u, 4u, 15u, 16u, 17u, 18u, 19u, 31u, 64u, 255u };
+    uint32 data[ ( CRC_TEST_MAX_LENGTH / 4u ) + 1u ];
+    uint8 *bytes = (uint8 *)data;
+    RandomSeed   = 0x0FACADE5u;
+    Random_Fill( bytes, sizeof( data ) );
+
+    for( uint32 offset = 0; offset < 4u; offset++ )
+    {
+        for( uint32 n = 0; n < ( sizeof( lengths ) / sizeof( lengths[ 0 ] ) ); n++ )
+        {
+            uint64 expected  = Reference_CrcLsb( &bytes[ offset ], lengths[ n ], 0xFFFFFFFFFFFFFFFFu, 0xC96C5795D7870F42u ) ^ 0xFFFFFFFFFFFFFFFFu;
+            uint64 crcResult = Crc_CalculateCRC64( &bytes[ offset ], lengths[ n ], 0xFFFFFFFFFFFFFFFFu, TRUE );
+            TEST_ASSERT_EQUAL_HEX64_MESSAGE( expected, crcResult, "Crc result was not the supposed value" );
+        }
+    }
+}
+
+/**
+ * @brief   **Test Crc_CombineCRC32 against the crc of the whole buffer**
+ *
+ * Random buffers are split at a random point, the crc of each chunk is calculated on its own and
+ * combined, the result shall be the same as the crc of the whole buffer.
+ */
+void test_Crc_CombineCRC32_random_splits( void )
+{
+    uint8 data[ CRC_TEST_MAX_LENGTH ];
+    RandomSeed = 0x600DF00Du;
+
+    for( uint32 n = 0; n < CRC_TEST_ITERATIONS; n++ )
+    {
+        uint32 length = ( Random_Next( ) % ( CRC_TEST_MAX_LENGTH - 2u ) ) + 2u;
+        uint32 split  = ( Random_Next( ) % ( length - 1u ) ) + 1u;
+        Random_Fill( data, length );
+
+        uint32 expected  = Crc_CalculateCRC32( data, length, 0xFFFFFFFFu, TRUE );
+        uint32 crc1      = Crc_CalculateCRC32( data, split, 0xFFFFFFFFu, TRUE );
+        uint32 crc2      = Crc_CalculateCRC32( &data[ split ], length - split, 0xFFFFFFFFu, TRUE );
+        uint32 crcResult = Crc_CombineCRC32( crc1, crc2, length - split );
+        TEST_ASSERT_EQUAL_HEX32_MESSAGE( expected, crcResult, "Crc result was not the supposed value" );
+    }
+}
+
+/**
+ * @brief   **Test Crc_CombineCRC32P4 against the crc of the whole buffer**
+ *
+ * Random buffers are split at a random point, the crc of each chunk is calculated on its own and
+ * combined, the result shall be the same as the crc of the whole buffer.
+ */
+void test_Crc_CombineCRC32P4_random_splits( void )
+{
+    uint8 data[ CRC_TEST_MAX_LENGTH ];
+    RandomSeed = 0x5EED1234u;
+
+    for( uint32 n = 0; n < CRC_TEST_ITERATIONS; n++ )
+    {
+        uint32 length = ( Random_Next( ) % ( CRC_TEST_MAX_LENGTH - 2u ) ) + 2u;
+        uint32 split  = ( Random_Next( ) % ( length - 1u ) ) + 1u;
+        Random_Fill( data, length );
+
+        uint32 expected  = Crc_CalculateCRC32P4( data, length, 0xFFFFFFFFu, TRUE );
+        uint32 crc1      = Crc_CalculateCRC32P4( data, split, 0xFFFFFFFFu, TRUE );
+        uint32 crc2      = Crc_CalculateCRC32P4( &data[ split ], length - split, 0xFFFFFFFFu, TRUE );
+        uint32 crcResult = Crc_CombineCRC32P4( crc1, crc2, length - split );
+        TEST_ASSERT_EQUAL_HEX32_MESSAGE( expected, crcResult, "Crc result was not the supposed value" );
+    }
+}
+
+/**
+ * @brief   **Test Crc_CombineCRC64 against the crc of the whole buffer**
+ *
+ * Random buffers are split at a random point, the crc of each chunk is calculated on its own and
+ * combined, the result shall be the same as the crc of the whole buffer.
+ */
+void test_Crc_CombineCRC64_random_splits( void )
+{
+    uint8 data[ CRC_TEST_MAX_LENGTH ];
+    RandomSeed = 0xC0FFEE00u;
+
+    for( uint32 n = 0; n < CRC_TEST_ITERATIONS; n++ )
+    {
+        uint32 length = ( Random_Next( ) % ( CRC_TEST_MAX_LENGTH - 2u ) ) + 2u;
+        uint32 split  = ( Random_Next( ) % ( length - 1u ) ) + 1u;
+        Random_Fill( data, length );
+
+        uint64 expected  = Crc_CalculateCRC64( data, length, 0xFFFFFFFFFFFFFFFFu, TRUE );
+        uint64 crc1      = Crc_CalculateCRC64( data, split, 0xFFFFFFFFFFFFFFFFu, TRUE );
+        uint64 crc2      = Crc_CalculateCRC64( &data[ split ], length - split, 0xFFFFFFFFFFFFFFFFu, TRUE );
+        uint64 crcResult = Crc_CombineCRC64( crc1, crc2, length - split );
+        TEST_ASSERT_EQUAL_HEX64_MESSAGE( expected, crcResult, "Crc result was not the supposed value" );
+    }
+}
+
+/**
+ * @brief   **Test the Crc_Combine routines with an empty second chunk**
+ *
+ * The crc of the first chunk shall be returned as is.
+ */
+void test_Crc_Combine_empty_second_chunk( void )
+{
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0xCBF43926u, Crc_CombineCRC32( 0xCBF43926u, 0x00000000u, 0u ), "Crc result was not the supposed value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x1697D06Au, Crc_CombineCRC32P4( 0x1697D06Au, 0x00000000u, 0u ), "Crc result was not the supposed value" );
+    TEST_ASSERT_EQUAL_HEX64_MESSAGE( 0x995DC9BBDF1939FAu, Crc_CombineCRC64( 0x995DC9BBDF1939FAu, 0x0000000000000000u, 0u ), "Crc result was not the supposed value" );
+}
+
+/**
+ * @brief   **Notification used to test the region calculation**
+ *
+ * Records the values received so the test cases can check them.
+ */
+static void Region_Callback( Crc_RegionStateType Crc_State, uint32 Crc_Result )
+{
+    CallbackCalls++;
+    CallbackState  = Crc_State;
+    CallbackResult = Crc_Result;
+}
+
+/**
+ * @brief   **Test a short region is calculated right away**
+ *
+ * Regions shorter than the minimum length shall not use the DMA, the result shall be the same
+ * Crc_CalculateCRC32 gives and the notification shall be called before the function returns.
+ */
+void test_Crc_StartRegionCRC32_short_region( void )
+{
+    uint8 data[]  = { 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39 };
+    uint32 result = 0u;
+
+    Std_ReturnType Status = Crc_StartRegionCRC32( data, sizeof( data ), 0xFFFFFFFFu, TRUE, Region_Callback );
+
+    TEST_ASSERT_EQUAL_MESSAGE( E_OK, Status, "Calculation shall be accepted" );
+    TEST_ASSERT_EQUAL_MESSAGE( CRC_REGION_DONE, Crc_GetRegionResult( &result ), "Calculation shall be done" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0xCBF43926u, result, "Crc result was not the supposed value" );
+    TEST_ASSERT_EQUAL_MESSAGE( 1u, CallbackCalls, "Notification shall be called once" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0xCBF43926u, CallbackResult, "Notification received a wrong result" );
+}
+
+/**
+ * @brief   **Test a long region is started on the crc unit**
+ *
+ * Crc_RegionIsr shall be installed on the vector of the DMA channel, the crc unit shall be
+ * started with the initial value of the crc register (start value with the final xor undone for
+ * consecutive calls) and the state shall be busy until the interrupt.
+ */
+void test_Crc_StartRegionCRC32_long_region( void )
+{
+    uint8 data[ 64 ] = { 0 };
+    uint32 result    = 0u;
+
+    Crc_Arch_InstallRegionIsr_Expect( Crc_RegionIsr );
+    Crc_Arch_StartRegion_ExpectAndReturn( NULL_PTR, data, sizeof( data ), 0x0000FFFFu, E_OK );
+    Crc_Arch_StartRegion_IgnoreArg_Config( );
+
+    Std_ReturnType Status = Crc_StartRegionCRC32( data, sizeof( data ), 0xFFFF0000u, FALSE, Region_Callback );
+
+    TEST_ASSERT_EQUAL_MESSAGE( E_OK, Status, "Calculation shall be accepted" );
+    TEST_ASSERT_EQUAL_MESSAGE( CRC_REGION_BUSY, Crc_GetRegionResult( &result ), "Calculation shall be in progress" );
+    TEST_ASSERT_EQUAL_MESSAGE( 0u, CallbackCalls, "Notification shall not be called yet" );
+}
+
+/**
+ * @brief   **Test a region is rejected while another one is in progress**
+ */
+void test_Crc_StartRegionCRC32_region_busy( void )
+{
+    uint8 data[ 64 ] = { 0 };
+    Crc_RegionState  = CRC_REGION_BUSY;
+
+    Std_ReturnType Status = Crc_StartRegionCRC32( data, sizeof( data ), 0xFFFFFFFFu, TRUE, Region_Callback );
+
+    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, Status, "Calculation shall be rejected" );
+}
+
+/**
+ * @brief   **Test a region is rejected when the crc unit is busy**
+ *
+ * The state of the previous calculation shall be kept.
+ */
+void test_Crc_StartRegionCRC32_unit_busy( void )
+{
+    uint8 data[ 64 ] = { 0 };
+    uint32 result    = 0u;
+    Crc_RegionState  = CRC_REGION_DONE;
+    Crc_RegionResult = 0x12345678u;
+
+    Crc_Arch_InstallRegionIsr_Expect( Crc_RegionIsr );
+    Crc_Arch_StartRegion_ExpectAnyArgsAndReturn( E_NOT_OK );
+
+    Std_ReturnType Status = Crc_StartRegionCRC32( data, sizeof( data ), 0xFFFFFFFFu, TRUE, Region_Callback );
+
+    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, Status, "Calculation shall be rejected" );
+    TEST_ASSERT_EQUAL_MESSAGE( CRC_REGION_DONE, Crc_GetRegionResult( &result ), "Previous state shall be kept" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x12345678u, result, "Previous result shall be kept" );
+}
+
+/**
+ * @brief   **Test the region result is stored once the crc unit finishes**
+ *
+ * The final xor shall be applied to the crc register value and the notification called.
+ */
+void test_Crc_RegionIsr_region_done( void )
+{
+    uint8 data[ 64 ] = { 0 };
+    uint32 value     = 0x0F0F0F0Fu;
+    uint32 result    = 0u;
+
+    Crc_Arch_InstallRegionIsr_Expect( Crc_RegionIsr );
+    Crc_Arch_StartRegion_ExpectAnyArgsAndReturn( E_OK );
+    Crc_Arch_RegionIsr_ExpectAnyArgsAndReturn( CRC_ARCH_REGION_DONE );
+    Crc_Arch_RegionIsr_ReturnThruPtr_Crc_Value( &value );
+
+    (void)Crc_StartRegionCRC32( data, sizeof( data ), 0xFFFFFFFFu, TRUE, Region_Callback );
+    Crc_RegionIsr( );
+
+    TEST_ASSERT_EQUAL_MESSAGE( CRC_REGION_DONE, Crc_GetRegionResult( &result ), "Calculation shall be done" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0xF0F0F0F0u, result, "Final xor not applied" );
+    TEST_ASSERT_EQUAL_MESSAGE( 1u, CallbackCalls, "Notification shall be called once" );
+    TEST_ASSERT_EQUAL_MESSAGE( CRC_REGION_DONE, CallbackState, "Notification received a wrong state" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0xF0F0F0F0u, CallbackResult, "Notification received a wrong result" );
+}
+
+/**
+ * @brief   **Test the region keeps going while chunks are pending**
+ */
+void test_Crc_RegionIsr_region_ongoing( void )
+{
+    uint8 data[ 64 ] = { 0 };
+    uint32 result    = 0u;
+
+    Crc_Arch_InstallRegionIsr_Expect( Crc_RegionIsr );
+    Crc_Arch_StartRegion_ExpectAnyArgsAndReturn( E_OK );
+    Crc_Arch_RegionIsr_ExpectAnyArgsAndReturn( CRC_ARCH_REGION_ONGOING );
+
+    (void)Crc_StartRegionCRC32( data, sizeof( data ), 0xFFFFFFFFu, TRUE, Region_Callback );
+    Crc_RegionIsr( );
+
+    TEST_ASSERT_EQUAL_MESSAGE( CRC_REGION_BUSY, Crc_GetRegionResult( &result ), "Calculation shall be in progress" );
+    TEST_ASSERT_EQUAL_MESSAGE( 0u, CallbackCalls, "Notification shall not be called yet" );
+}
+
+/**
+ * @brief   **Test the region fails on a DMA error**
+ *
+ * The state shall be failed and the notification called, even without notification the state
+ * shall be updated.
+ */
+void test_Crc_RegionIsr_region_failed( void )
+{
+    uint8 data[ 64 ] = { 0 };
+    uint32 result    = 0u;
+
+    Crc_Arch_InstallRegionIsr_Expect( Crc_RegionIsr );
+    Crc_Arch_StartRegion_ExpectAnyArgsAndReturn( E_OK );
+    Crc_Arch_RegionIsr_ExpectAnyArgsAndReturn( CRC_ARCH_REGION_ERROR );
+
+    (void)Crc_StartRegionCRC32( data, sizeof( data ), 0xFFFFFFFFu, TRUE, Region_Callback );
+    Crc_RegionIsr( );
+
+    TEST_ASSERT_EQUAL_MESSAGE( CRC_REGION_FAILED, Crc_GetRegionResult( &result ), "Calculation shall fail" );
+    TEST_ASSERT_EQUAL_MESSAGE( 1u, CallbackCalls, "Notification shall be called once" );
+    TEST_ASSERT_EQUAL_MESSAGE( CRC_REGION_FAILED, CallbackState, "Notification received a wrong state" );
+
+    Crc_Arch_InstallRegionIsr_Expect( Crc_RegionIsr );
+    Crc_Arch_StartRegion_ExpectAnyArgsAndReturn( E_OK );
+    Crc_Arch_RegionIsr_ExpectAnyArgsAndReturn( CRC_ARCH_REGION_ERROR );
+
+    (void)Crc_StartRegionCRC32( data, sizeof( data ), 0xFFFFFFFFu, TRUE, NULL_PTR );
+    Crc_RegionIsr( );
+
+    TEST_ASSERT_EQUAL_MESSAGE( CRC_REGION_FAILED, Crc_GetRegionResult( &result ), "Calculation shall fail" );
+    TEST_ASSERT_EQUAL_MESSAGE( 1u, CallbackCalls, "Notification shall not be called" );
+}
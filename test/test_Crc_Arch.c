@@ -0,0 +1,344 @@
+/**
+ * @file    test_Crc_Arch.c
+ * @brief   **Unit testing for Crc hardware calculation unit**
+ *
+ * group of unit test cases for Crc_Arch.h file
+ */
+#include <string.h>
+#include "unity.h"
+#include "Registers.h"
+#include "Crc_Cfg.h"
+#include "Crc_Arch.h"
+#include "mock_Nvic.h"
+
+/*mock microcontroller registers with its initial values*/
+/*                            DR    IDR   CR    Reserved INIT  POL*/
+Crc_RegisterType CRC_BASE = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+Dma_RegisterType DMA1_BASE = { 0 };
+
+extern volatile boolean Crc_Arch_Busy;
+extern const uint8 *Crc_Arch_RegionPtr;
+extern uint32 Crc_Arch_RegionLength;
+extern Crc_Arch_IsrType Crc_Arch_RegionChained;
+
+/*calls received by the handlers installed on the DMA vector*/
+static uint32 RegionCalls;
+static uint32 ChainedCalls;
+
+/*region used by the DMA tests, words are declared to get an aligned address*/
+static uint32 Region[ ( CRC_REGION_CHUNK_WORDS + 4u ) ];
+
+/*reflected 32 bits polynomial used by the DMA tests*/
+static const Crc_Arch_ConfigType Crc32Config = { .Polynomial = 0x04C11DB7, .PolySize = CRC_ARCH_POLYSIZE_32, .Width = 32u, .Reflected = TRUE };
+
+/*this function is required by Ceedling to run any code before the test cases*/
+void setUp( void )
+{
+    CRC_BASE.DR   = 0x00;
+    CRC_BASE.IDR  = 0x00;
+    CRC_BASE.CR   = 0x00;
+    CRC_BASE.INIT = 0x00;
+    CRC_BASE.POL  = 0x00;
+    Crc_Arch_Busy = FALSE;
+    memset( &DMA1_BASE, 0, sizeof( DMA1_BASE ) );
+    Crc_Arch_RegionPtr     = NULL_PTR;
+    Crc_Arch_RegionLength  = 0u;
+    Crc_Arch_RegionChained = NULL_PTR;
+    RegionCalls            = 0u;
+    ChainedCalls           = 0u;
+}
+
+/*this function is required by Ceedling to run any code after the test cases*/
+void tearDown( void )
+{
+}
+
+/*handler of the region installed on the DMA vector*/
+static void Region_Isr( void )
+{
+    RegionCalls++;
+}
+
+/*handler of another DMA channel sharing the vector*/
+static void Region_ChainedIsr( void )
+{
+    ChainedCalls++;
+}
+
+/**
+ * @brief   **Test the crc unit is programmed for a 8 bits polynomial**
+ *
+ * The polynomial, initial value and polynomial size shall be programmed without reflection, four
+ * bytes shall be written as a single word (first byte in the most significant position) and the
+ * remaining byte with a 8 bits access. The result is read back from the DR register.
+ */
+void test__Crc_Arch_Calculate__8bits_polynomial( void )
+{
+    const Crc_Arch_ConfigType Config = { .Polynomial = 0x1D, .PolySize = CRC_ARCH_POLYSIZE_8, .Width = 8u, .Reflected = FALSE };
+    uint8 data[]                     = { 0x11, 0x22, 0x33, 0x44, 0x55 };
+    uint32 crcValue                  = 0xFFu;
+
+    Std_ReturnType Status = Crc_Arch_Calculate( &Config, data, sizeof( data ), &crcValue );
+
+    TEST_ASSERT_EQUAL_MESSAGE( E_OK, Status, "Calculation shall be accepted" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x0000001Du, CRC->POL, "POL register not programmed correctly" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x000000FFu, CRC->INIT, "INIT register not programmed correctly" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000011u, CRC->CR, "CR register not programmed correctly" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x11223355u, CRC->DR, "Data not fed to the unit correctly" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x11223355u, crcValue, "Result not read from the unit" );
+}
+
+/**
+ * @brief   **Test the crc unit is programmed for a 16 bits polynomial**
+ *
+ * The initial value shall be loaded as is and the polynomial size set to 16 bits.
+ */
+void test__Crc_Arch_Calculate__16bits_polynomial( void )
+{
+    const Crc_Arch_ConfigType Config = { .Polynomial = 0x1021, .PolySize = CRC_ARCH_POLYSIZE_16, .Width = 16u, .Reflected = FALSE };
+    uint8 data[]                     = { 0xA1, 0xB2, 0xC3, 0xD4, 0xE5, 0xF6, 0x07, 0x18 };
+    uint32 crcValue                  = 0x1234u;
+
+    Std_ReturnType Status = Crc_Arch_Calculate( &Config, data, sizeof( data ), &crcValue );
+
+    TEST_ASSERT_EQUAL_MESSAGE( E_OK, Status, "Calculation shall be accepted" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00001021u, CRC->POL, "POL register not programmed correctly" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00001234u, CRC->INIT, "INIT register not programmed correctly" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000009u, CRC->CR, "CR register not programmed correctly" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0xE5F60718u, crcValue, "Result not read from the unit" );
+}
+
+/**
+ * @brief   **Test the crc unit is programmed for a reflected 32 bits polynomial**
+ *
+ * Input reversal by byte and output reversal shall be enabled and the initial value shall be
+ * loaded bit reversed since the unit keeps the crc register in normal representation.
+ */
+void test__Crc_Arch_Calculate__32bits_reflected_polynomial( void )
+{
+    const Crc_Arch_ConfigType Config = { .Polynomial = 0x04C11DB7, .PolySize = CRC_ARCH_POLYSIZE_32, .Width = 32u, .Reflected = TRUE };
+    uint8 data[]                     = { 0x01, 0x02, 0x03, 0x04 };
+    uint32 crcValue                  = 0x12345678u;
+
+    Std_ReturnType Status = Crc_Arch_Calculate( &Config, data, sizeof( data ), &crcValue );
+
+    TEST_ASSERT_EQUAL_MESSAGE( E_OK, Status, "Calculation shall be accepted" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x04C11DB7u, CRC->POL, "POL register not programmed correctly" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x1E6A2C48u, CRC->INIT, "INIT register not programmed correctly" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x000000A1u, CRC->CR, "CR register not programmed correctly" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x01020304u, crcValue, "Result not read from the unit" );
+}
+
+/**
+ * @brief   **Test the calculation is rejected when the unit is busy**
+ *
+ * If the unit is already performing a calculation the function shall return E_NOT_OK without
+ * touching the unit registers nor the crc value, so the caller can calculate by software.
+ */
+void test__Crc_Arch_Calculate__unit_busy( void )
+{
+    const Crc_Arch_ConfigType Config = { .Polynomial = 0x1D, .PolySize = CRC_ARCH_POLYSIZE_8, .Width = 8u, .Reflected = FALSE };
+    uint8 data[]                     = { 0x11, 0x22, 0x33, 0x44, 0x55 };
+    uint32 crcValue                  = 0xFFu;
+    Crc_Arch_Busy                    = TRUE;
+
+    Std_ReturnType Status = Crc_Arch_Calculate( &Config, data, sizeof( data ), &crcValue );
+
+    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, Status, "Calculation shall be rejected" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000000u, CRC->CR, "CR register shall not be touched" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x000000FFu, crcValue, "Crc value shall not be touched" );
+}
+
+/**
+ * @brief   **Test the unit is released after a calculation**
+ *
+ * Once the calculation is done the unit shall be available for the next request.
+ */
+void test__Crc_Arch_Calculate__unit_released( void )
+{
+    const Crc_Arch_ConfigType Config = { .Polynomial = 0x1D, .PolySize = CRC_ARCH_POLYSIZE_8, .Width = 8u, .Reflected = FALSE };
+    uint8 data[]                     = { 0x11 };
+    uint32 crcValue                  = 0xFFu;
+
+    (void)Crc_Arch_Calculate( &Config, data, sizeof( data ), &crcValue );
+
+    TEST_ASSERT_FALSE_MESSAGE( Crc_Arch_Busy, "Unit shall be released" );
+}
+
+/**
+ * @brief   **Test the crc unit and the DMA channel are programmed to start a region**
+ *
+ * The leading bytes until the word alignment shall be written by the cpu, then the unit shall be
+ * switched to input reversal by word and the DMA channel programmed to transfer the full words of
+ * the region from memory to the DR register, leaving the trailing bytes for the end.
+ */
+void test__Crc_Arch_StartRegion__dma_programmed( void )
+{
+    uint8 *data = &( (uint8 *)Region )[ 1 ];
+
+    Std_ReturnType Status = Crc_Arch_StartRegion( &Crc32Config, data, 10u, 0x12345678u );
+
+    TEST_ASSERT_EQUAL_MESSAGE( E_OK, Status, "Calculation shall be accepted" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x1E6A2C48u, CRC->INIT, "INIT register not programmed correctly" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x000000E0u, CRC->CR, "CR register not programmed correctly" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00004A9Bu, DMA1->CH[ 0 ].CCR, "CCR register not programmed correctly" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 1u, DMA1->CH[ 0 ].CNDTR, "CNDTR register not programmed correctly" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( (uint32)&Region[ 1 ], DMA1->CH[ 0 ].CMAR, "CMAR shall point to the first aligned word" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( (uint32)&CRC->DR, DMA1->CH[ 0 ].CPAR, "CPAR shall point to the DR register" );
+    TEST_ASSERT_EQUAL_MESSAGE( 3u, Crc_Arch_RegionLength, "Trailing bytes shall be left for the cpu" );
+    TEST_ASSERT_TRUE_MESSAGE( Crc_Arch_Busy, "Unit shall remain busy" );
+}
+
+/**
+ * @brief   **Test the region is rejected when the unit is busy**
+ *
+ * Neither the unit nor the DMA channel shall be touched.
+ */
+void test__Crc_Arch_StartRegion__unit_busy( void )
+{
+    Crc_Arch_Busy = TRUE;
+
+    Std_ReturnType Status = Crc_Arch_StartRegion( &Crc32Config, (uint8 *)Region, 64u, 0xFFFFFFFFu );
+
+    TEST_ASSERT_EQUAL_MESSAGE( E_NOT_OK, Status, "Calculation shall be rejected" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000000u, CRC->CR, "CR register shall not be touched" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000000u, DMA1->CH[ 0 ].CCR, "CCR register shall not be touched" );
+}
+
+/**
+ * @brief   **Test a region bigger than a chunk is transferred in several chunks**
+ *
+ * The first chunk shall be limited to CRC_REGION_CHUNK_WORDS words, and the transfer complete
+ * interrupt shall start the next chunk with the remaining words.
+ */
+void test__Crc_Arch_RegionIsr__next_chunk( void )
+{
+    (void)Crc_Arch_StartRegion( &Crc32Config, (uint8 *)Region, sizeof( Region ), 0xFFFFFFFFu );
+
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( CRC_REGION_CHUNK_WORDS, DMA1->CH[ 0 ].CNDTR, "First chunk shall be limited" );
+
+    DMA1->ISR    = 0x00000003u;
+    uint32 Value = 0u;
+    uint8 Status = Crc_Arch_RegionIsr( &Value );
+
+    TEST_ASSERT_EQUAL_MESSAGE( CRC_ARCH_REGION_ONGOING, Status, "Calculation shall continue" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000001u, DMA1->IFCR, "Channel flags shall be cleared" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 4u, DMA1->CH[ 0 ].CNDTR, "Second chunk shall have the remaining words" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( (uint32)&Region[ CRC_REGION_CHUNK_WORDS ], DMA1->CH[ 0 ].CMAR, "CMAR shall point to the next chunk" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00004A9Bu, DMA1->CH[ 0 ].CCR, "Channel shall be enabled again" );
+    TEST_ASSERT_TRUE_MESSAGE( Crc_Arch_Busy, "Unit shall remain busy" );
+}
+
+/**
+ * @brief   **Test the region finishes with the trailing bytes**
+ *
+ * When no full words remain the trailing bytes shall be written by the cpu with input reversal
+ * by byte, the result read back from the DR register and the unit released.
+ */
+void test__Crc_Arch_RegionIsr__region_done( void )
+{
+    uint8 *data = (uint8 *)Region;
+    data[ 4 ]   = 0x55u;
+    data[ 5 ]   = 0xAAu;
+
+    (void)Crc_Arch_StartRegion( &Crc32Config, data, 6u, 0xFFFFFFFFu );
+
+    DMA1->ISR    = 0x00000003u;
+    uint32 Value = 0u;
+    uint8 Status = Crc_Arch_RegionIsr( &Value );
+
+    TEST_ASSERT_EQUAL_MESSAGE( CRC_ARCH_REGION_DONE, Status, "Calculation shall be done" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x000000A0u, CRC->CR, "Input reversal shall be back to byte" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000000u, DMA1->CH[ 0 ].CCR, "Channel shall be disabled" );
+    TEST_ASSERT_EQUAL_HEX8_MESSAGE( 0xAAu, CRC->DR, "Trailing bytes not fed to the unit" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( CRC->DR, Value, "Result not read from the unit" );
+    TEST_ASSERT_FALSE_MESSAGE( Crc_Arch_Busy, "Unit shall be released" );
+}
+
+/**
+ * @brief   **Test the region is aborted on a DMA transfer error**
+ *
+ * The channel shall be disabled, its flags cleared and the unit released.
+ */
+void test__Crc_Arch_RegionIsr__transfer_error( void )
+{
+    (void)Crc_Arch_StartRegion( &Crc32Config, (uint8 *)Region, 64u, 0xFFFFFFFFu );
+
+    DMA1->ISR    = 0x00000009u;
+    uint32 Value = 0u;
+    uint8 Status = Crc_Arch_RegionIsr( &Value );
+
+    TEST_ASSERT_EQUAL_MESSAGE( CRC_ARCH_REGION_ERROR, Status, "Calculation shall be aborted" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000000u, DMA1->CH[ 0 ].CCR, "Channel shall be disabled" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000001u, DMA1->IFCR, "Channel flags shall be cleared" );
+    TEST_ASSERT_FALSE_MESSAGE( Crc_Arch_Busy, "Unit shall be released" );
+}
+
+/**
+ * @brief   **Test an interrupt without flags of the channel is ignored**
+ */
+void test__Crc_Arch_RegionIsr__spurious_interrupt( void )
+{
+    (void)Crc_Arch_StartRegion( &Crc32Config, (uint8 *)Region, 64u, 0xFFFFFFFFu );
+
+    DMA1->ISR    = 0x00000030u;
+    uint32 Value = 0u;
+    uint8 Status = Crc_Arch_RegionIsr( &Value );
+
+    TEST_ASSERT_EQUAL_MESSAGE( CRC_ARCH_REGION_ONGOING, Status, "Calculation shall continue" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x00000000u, DMA1->IFCR, "Flags shall not be cleared" );
+    TEST_ASSERT_TRUE_MESSAGE( Crc_Arch_Busy, "Unit shall remain busy" );
+}
+
+/**
+ * @brief   **Test the region handler is installed and enabled on the DMA vector**
+ *
+ * The handler shall be installed on the vector of the channel and the vector enabled, the handler
+ * found on the vector shall be kept to be chained.
+ */
+void test__Crc_Arch_InstallRegionIsr__installed_and_enabled( void )
+{
+    CDD_Nvic_GetHandler_ExpectAndReturn( DMA1_Channel1_IRQn, Region_ChainedIsr );
+    CDD_Nvic_SetHandler_Expect( DMA1_Channel1_IRQn, Region_Isr );
+    CDD_Nvic_EnableIrq_Expect( DMA1_Channel1_IRQn );
+
+    Crc_Arch_InstallRegionIsr( Region_Isr );
+
+    TEST_ASSERT_EQUAL_PTR_MESSAGE( Region_ChainedIsr, Crc_Arch_RegionChained, "Previous handler shall be kept" );
+}
+
+/**
+ * @brief   **Test the region handler is installed only once**
+ *
+ * When the vector already holds the handler nothing shall be written and the handler chained the
+ * first time shall stay.
+ */
+void test__Crc_Arch_InstallRegionIsr__installed_once( void )
+{
+    Crc_Arch_RegionChained = Region_ChainedIsr;
+    CDD_Nvic_GetHandler_ExpectAndReturn( DMA1_Channel1_IRQn, Region_Isr );
+
+    Crc_Arch_InstallRegionIsr( Region_Isr );
+
+    TEST_ASSERT_EQUAL_PTR_MESSAGE( Region_ChainedIsr, Crc_Arch_RegionChained, "Previous handler shall be kept" );
+    TEST_ASSERT_EQUAL_MESSAGE( 0u, RegionCalls, "Handler shall not be called" );
+}
+
+/**
+ * @brief   **Test the handler sharing the vector is chained**
+ *
+ * The chained handler shall be called on every interrupt, with flags of the channel or without.
+ */
+void test__Crc_Arch_RegionIsr__chained_handler( void )
+{
+    uint32 Value           = 0u;
+    Crc_Arch_RegionChained = Region_ChainedIsr;
+    (void)Crc_Arch_StartRegion( &Crc32Config, (uint8 *)Region, 64u, 0xFFFFFFFFu );
+
+    DMA1->ISR = 0x00000030u;
+    (void)Crc_Arch_RegionIsr( &Value );
+    DMA1->ISR = 0x00000003u;
+    (void)Crc_Arch_RegionIsr( &Value );
+
+    TEST_ASSERT_EQUAL_MESSAGE( 2u, ChainedCalls, "Chained handler shall be called on each interrupt" );
+}
@@ -0,0 +1,357 @@
+/**
+ * @file    test_Crc_Hw.c
+ * @brief   **Unit testing for the Crc library using the crc unit**
+ *
+ * group of unit test cases for the CRC_HARDWARE paths of Crc.c, project.yml builds the library
+ * with CRC8, CRC8H2F, CRC16 and CRC32 set to CRC_HARDWARE for this file. The crc unit is replaced
+ * by a model of Crc_Arch_Calculate and the results are compared against the bit by bit software
+ * path the library takes when the unit is busy. CRC32P4 is built with CRC_TABLE, its word wise
+ * path is compared against the same model.
+ */
+#include "unity.h"
+#include "Std_Types.h"
+#include "Registers.h"
+#include "Crc.h"
+#include "mock_Crc_Arch.h"
+
+/**
+ * @defgroup Crc_Hw_Values values used to compare the crc unit against the software path
+ * @{ */
+#define CRC_TEST_ITERATIONS 200u /*!< Number of random buffers to compare */
+#define CRC_TEST_MAX_LENGTH 300u /*!< Maximum length of each random buffer */
+/**
+ * @} */
+
+/*standard check string "123456789"*/
+static const uint8 CheckData[] = { 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39 };
+
+/*crc width selected by each value of the CR POLYSIZE field*/
+static const uint8 PolySizeWidth[] = { 32u, 16u, 8u, 7u };
+
+/*unit busy, the model refuses the calculation and the library falls back to the software path*/
+static boolean UnitBusy;
+
+/*configuration and start value received by the last hardware calculation*/
+static Crc_Arch_ConfigType LastConfig;
+static uint32 LastStartValue;
+
+/**
+ * @brief   Seed of the pseudo random generator, fixed to get the same buffers on every run
+ */
+static uint32 RandomSeed;
+
+/**
+ * @brief   **Pseudo random generator**
+ *
+ * Linear congruential generator, used instead of rand() to obtain the same sequence of buffers
+ * in any host the test runs.
+ *
+ * @retval  Next pseudo random 32 bits value
+ */
+static uint32 Random_Next( void )
+{
+    RandomSeed = ( RandomSeed * 1664525u ) + 1013904223u;
+    return RandomSeed;
+}
+
+/**
+ * @brief   **Fill a buffer with random data**
+ *
+ * @param   Buffer Buffer to fill
+ * @param   Length Number of bytes to fill
+ */
+static void Random_Fill( uint8 *Buffer, uint32 Length )
+{
+    for( uint32 i = 0; i < Length; i++ )
+    {
+        Buffer[ i ] = (uint8)( Random_Next( ) >> 24u );
+    }
+}
+
+/**
+ * @brief   **Reverse the bit order of a value**
+ *
+ * @param   Value Value to reverse
+ * @param   Width Number of bits to reverse
+ *
+ * @retval  Value with its lower Width bits in the opposite order
+ */
+static uint32 Model_Reverse( uint32 Value, uint8 Width )
+{
+    uint32 Reversed = 0u;
+
+    for( uint8 bit = 0; bit < Width; bit++ )
+    {
+        Reversed = ( Reversed << 1u ) | ( ( Value >> bit ) & 1u );
+    }
+    return Reversed;
+}
+
+/**
+ * @brief   **Model of the crc unit behind Crc_Arch_Calculate**
+ *
+ * The width is taken from the POLYSIZE value and not from the Width field, so a wrong POLYSIZE
+ * gives a wrong result. INIT holds the start value, bit reversed for reflected polynomials as
+ * Crc_Arch does. Each byte is shifted MSB first into the register, reflected polynomials set
+ * REV_IN by byte and REV_OUT, so the bytes and the result are bit reversed. When the unit is
+ * busy E_NOT_OK is returned without touching the value.
+ */
+static Std_ReturnType Crc_Arch_Calculate_Model( const Crc_Arch_ConfigType *Config, const uint8 *Crc_DataPtr, uint32 Crc_Length, uint32 *Crc_Value, int cmock_num_calls )
+{
+    (void)cmock_num_calls;
+
+    if( UnitBusy == TRUE )
+    {
+        return E_NOT_OK;
+    }
+
+    LastConfig     = *Config;
+    LastStartValue = *Crc_Value;
+
+    uint8 width   = PolySizeWidth[ Config->PolySize ];
+    uint32 topBit = 1UL << ( width - 1u );
+    uint32 mask   = ( width == 32u ) ? 0xFFFFFFFFu : ( ( topBit << 1u ) - 1u );
+    uint32 reg    = ( Config->Reflected == TRUE ) ? Model_Reverse( *Crc_Value, width ) : *Crc_Value;
+
+    for( uint32 i = 0; i < Crc_Length; i++ )
+    {
+        uint32 byte = ( Config->Reflected == TRUE ) ? Model_Reverse( Crc_DataPtr[ i ], 8u ) : Crc_DataPtr[ i ];
+        for( uint8 bit = 0; bit < 8u; bit++ )
+        {
+            uint32 feedback = ( ( reg & topBit ) != 0u ) ^ ( ( ( byte >> ( 7u - bit ) ) & 1u ) != 0u );
+            reg             = ( reg << 1u ) & mask;
+            if( feedback != 0u )
+            {
+                reg ^= Config->Polynomial & mask;
+            }
+        }
+    }
+
+    *Crc_Value = ( Config->Reflected == TRUE ) ? Model_Reverse( reg, width ) : reg;
+    return E_OK;
+}
+
+/**
+ * @brief   **setUp**
+ *
+ * This function is required by Ceedling to run any code before the test cases.
+ */
+void setUp( void )
+{
+    UnitBusy       = FALSE;
+    LastStartValue = 0u;
+    LastConfig     = (Crc_Arch_ConfigType){ 0 };
+    Crc_Arch_Calculate_StubWithCallback( Crc_Arch_Calculate_Model );
+}
+
+/**
+ * @brief   **tearDown**
+ *
+ * This function is required by Ceedling to run any code after the test cases.
+ */
+void tearDown( void )
+{
+}
+
+/**
+ * @brief   **Test the CRC8 SAE-J1850 check value using the crc unit**
+ *
+ * The unit is programmed with a 8 bits polynomial 0x1D without reflection and the initial value
+ * 0xFF, the result after the final XOR shall be the standard check value 0x4B.
+ */
+void test_Crc_Hw_8bits_check_value( void )
+{
+    uint8 crcResult = Crc_CalculateCRC8( CheckData, sizeof( CheckData ), 0x00, TRUE );
+
+    TEST_ASSERT_EQUAL_MESSAGE( CRC_ARCH_POLYSIZE_8, LastConfig.PolySize, "Wrong POLYSIZE" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x1Du, LastConfig.Polynomial, "Wrong polynomial" );
+    TEST_ASSERT_FALSE_MESSAGE( LastConfig.Reflected, "REV_IN/REV_OUT shall not be set" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0xFFu, LastStartValue, "Wrong INIT value" );
+    TEST_ASSERT_EQUAL_HEX8_MESSAGE( 0x4B, crcResult, "Crc result was not the supposed value" );
+}
+
+/**
+ * @brief   **Test the CRC8H2F check value using the crc unit**
+ *
+ * The unit is programmed with a 8 bits polynomial 0x2F without reflection and the initial value
+ * 0xFF, the result after the final XOR shall be the standard check value 0xDF.
+ */
+void test_Crc_Hw_8bitsH2F_check_value( void )
+{
+    uint8 crcResult = Crc_CalculateCRC8H2F( CheckData, sizeof( CheckData ), 0x00, TRUE );
+
+    TEST_ASSERT_EQUAL_MESSAGE( CRC_ARCH_POLYSIZE_8, LastConfig.PolySize, "Wrong POLYSIZE" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x2Fu, LastConfig.Polynomial, "Wrong polynomial" );
+    TEST_ASSERT_FALSE_MESSAGE( LastConfig.Reflected, "REV_IN/REV_OUT shall not be set" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0xFFu, LastStartValue, "Wrong INIT value" );
+    TEST_ASSERT_EQUAL_HEX8_MESSAGE( 0xDF, crcResult, "Crc result was not the supposed value" );
+}
+
+/**
+ * @brief   **Test the CRC16 CCITT check value using the crc unit**
+ *
+ * The unit is programmed with a 16 bits polynomial 0x1021 without reflection and the initial
+ * value 0xFFFF, the result without final XOR shall be the standard check value 0x29B1.
+ */
+void test_Crc_Hw_16bits_check_value( void )
+{
+    uint16 crcResult = Crc_CalculateCRC16( CheckData, sizeof( CheckData ), 0x0000, TRUE );
+
+    TEST_ASSERT_EQUAL_MESSAGE( CRC_ARCH_POLYSIZE_16, LastConfig.PolySize, "Wrong POLYSIZE" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x1021u, LastConfig.Polynomial, "Wrong polynomial" );
+    TEST_ASSERT_FALSE_MESSAGE( LastConfig.Reflected, "REV_IN/REV_OUT shall not be set" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0xFFFFu, LastStartValue, "Wrong INIT value" );
+    TEST_ASSERT_EQUAL_HEX16_MESSAGE( 0x29B1, crcResult, "Crc result was not the supposed value" );
+}
+
+/**
+ * @brief   **Test the CRC32 check value using the crc unit**
+ *
+ * The unit is programmed with a 32 bits polynomial 0x04C11DB7 with the input and output
+ * reflected and the initial value 0xFFFFFFFF, the result after the final XOR shall be the
+ * standard check value 0xCBF43926.
+ */
+void test_Crc_Hw_32bits_check_value( void )
+{
+    uint32 crcResult = Crc_CalculateCRC32( CheckData, sizeof( CheckData ), 0x00000000, TRUE );
+
+    TEST_ASSERT_EQUAL_MESSAGE( CRC_ARCH_POLYSIZE_32, LastConfig.PolySize, "Wrong POLYSIZE" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0x04C11DB7u, LastConfig.Polynomial, "Wrong polynomial" );
+    TEST_ASSERT_TRUE_MESSAGE( LastConfig.Reflected, "REV_IN/REV_OUT shall be set" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0xFFFFFFFFu, LastStartValue, "Wrong INIT value" );
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE( 0xCBF43926u, crcResult, "Crc result was not the supposed value" );
+}
+
+/**
+ * @brief   **Test Crc_CalculateCRC8 with the crc unit against the software path**
+ *
+ * Random buffers with random lengths, start values and first call flags are calculated with the
+ * unit available and with the unit busy, both results shall be the same.
+ */
+void test_Crc_Hw_8bits_equivalence_software_path( void )
+{
+    uint8 data[ CRC_TEST_MAX_LENGTH ];
+    RandomSeed = 0x12345678u;
+
+    for( uint32 n = 0; n < CRC_TEST_ITERATIONS; n++ )
+    {
+        uint32 length       = Random_Next( ) % CRC_TEST_MAX_LENGTH;
+        uint8 startValue    = (uint8)Random_Next( );
+        boolean isFirstCall = ( ( Random_Next( ) & 1u ) != 0u ) ? TRUE : FALSE;
+        Random_Fill( data, length );
+
+        UnitBusy        = TRUE;
+        uint8 expected  = Crc_CalculateCRC8( data, length, startValue, isFirstCall );
+        UnitBusy        = FALSE;
+        uint8 crcResult = Crc_CalculateCRC8( data, length, startValue, isFirstCall );
+        TEST_ASSERT_EQUAL_HEX8_MESSAGE( expected, crcResult, "Crc result was not the supposed value" );
+    }
+}
+
+/**
+ * @brief   **Test Crc_CalculateCRC8H2F with the crc unit against the software path**
+ *
+ * Random buffers with random lengths, start values and first call flags are calculated with the
+ * unit available and with the unit busy, both results shall be the same.
+ */
+void test_Crc_Hw_8bitsH2F_equivalence_software_path( void )
+{
+    uint8 data[ CRC_TEST_MAX_LENGTH ];
+    RandomSeed = 0x23456789u;
+
+    for( uint32 n = 0; n < CRC_TEST_ITERATIONS; n++ )
+    {
+        uint32 length       = Random_Next( ) % CRC_TEST_MAX_LENGTH;
+        uint8 startValue    = (uint8)Random_Next( );
+        boolean isFirstCall = ( ( Random_Next( ) & 1u ) != 0u ) ? TRUE : FALSE;
+        Random_Fill( data, length );
+
+        UnitBusy        = TRUE;
+        uint8 expected  = Crc_CalculateCRC8H2F( data, length, startValue, isFirstCall );
+        UnitBusy        = FALSE;
+        uint8 crcResult = Crc_CalculateCRC8H2F( data, length, startValue, isFirstCall );
+        TEST_ASSERT_EQUAL_HEX8_MESSAGE( expected, crcResult, "Crc result was not the supposed value" );
+    }
+}
+
+/**
+ * @brief   **Test Crc_CalculateCRC16 with the crc unit against the software path**
+ *
+ * Random buffers with random lengths, start values and first call flags are calculated with the
+ * unit available and with the unit busy, both results shall be the same.
+ */
+void test_Crc_Hw_16bits_equivalence_software_path( void )
+{
+    uint8 data[ CRC_TEST_MAX_LENGTH ];
+    RandomSeed = 0x3456789Au;
+
+    for( uint32 n = 0; n < CRC_TEST_ITERATIONS; n++ )
+    {
+        uint32 length       = Random_Next( ) % CRC_TEST_MAX_LENGTH;
+        uint16 startValue   = (uint16)Random_Next( );
+        boolean isFirstCall = ( ( Random_Next( ) & 1u ) != 0u ) ? TRUE : FALSE;
+        Random_Fill( data, length );
+
+        UnitBusy         = TRUE;
+        uint16 expected  = Crc_CalculateCRC16( data, length, startValue, isFirstCall );
+        UnitBusy         = FALSE;
+        uint16 crcResult = Crc_CalculateCRC16( data, length, startValue, isFirstCall );
+        TEST_ASSERT_EQUAL_HEX16_MESSAGE( expected, crcResult, "Crc result was not the supposed value" );
+    }
+}
+
+/**
+ * @brief   **Test Crc_CalculateCRC32 with the crc unit against the software path**
+ *
+ * Random buffers with random lengths, start values and first call flags are calculated with the
+ * unit available and with the unit busy, both results shall be the same.
+ */
+void test_Crc_Hw_32bits_equivalence_software_path( void )
+{
+    uint8 data[ CRC_TEST_MAX_LENGTH ];
+    RandomSeed = 0x456789ABu;
+
+    for( uint32 n = 0; n < CRC_TEST_ITERATIONS; n++ )
+    {
+        uint32 length       = Random_Next( ) % CRC_TEST_MAX_LENGTH;
+        uint32 startValue   = Random_Next( );
+        boolean isFirstCall = ( ( Random_Next( ) & 1u ) != 0u ) ? TRUE : FALSE;
+        Random_Fill( data, length );
+
+        UnitBusy         = TRUE;
+        uint32 expected  = Crc_CalculateCRC32( data, length, startValue, isFirstCall );
+        UnitBusy         = FALSE;
+        uint32 crcResult = Crc_CalculateCRC32( data, length, startValue, isFirstCall );
+        TEST_ASSERT_EQUAL_HEX32_MESSAGE( expected, crcResult, "Crc result was not the supposed value" );
+    }
+}
+
+/**
+ * @brief   **Test Crc_CalculateCRC32P4 word wise table path against the crc unit model**
+ *
+ * Random buffers are calculated starting at every possible misalignment, with random lengths
+ * around and above the minimum length processed word wise, using the 256 entries table and using
+ * the model programmed with the 0xF4ACFB13 polynomial reflected, both results shall be the same.
+ */
+void test_Crc_Hw_32bitsP4_word_table_path( void )
+{
+    static const Crc_Arch_ConfigType config32P4 = { 0xF4ACFB13u, CRC_ARCH_POLYSIZE_32, 32u, TRUE };
+    uint32 data[ ( CRC_TEST_MAX_LENGTH / 4u ) + 1u ];
+    uint8 *bytes = (uint8 *)data;
+    RandomSeed   = 0x56789ABCu;
+
+    for( uint32 n = 0; n < CRC_TEST_ITERATIONS; n++ )
+    {
+        uint32 offset       = n % 4u;
+        uint32 length       = Random_Next( ) % CRC_TEST_MAX_LENGTH;
+        uint32 startValue   = Random_Next( );
+        boolean isFirstCall = ( ( Random_Next( ) & 1u ) != 0u ) ? TRUE : FALSE;
+        Random_Fill( &bytes[ offset ], length );
+
+        uint32 expected = ( isFirstCall == TRUE ) ? 0xFFFFFFFFu : ( startValue ^ 0xFFFFFFFFu );
+        (void)Crc_Arch_Calculate_Model( &config32P4, &bytes[ offset ], length, &expected, 0 );
+        expected ^= 0xFFFFFFFFu;
+        uint32 crcResult = Crc_CalculateCRC32P4( &bytes[ offset ], length, startValue, isFirstCall );
+        TEST_ASSERT_EQUAL_HEX32_MESSAGE( expected, crcResult, "Crc result was not the supposed value" );
+    }
+}
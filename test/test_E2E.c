@@ -0,0 +1,558 @@
+/**
+ * @file    test_E2E.c
+ * @brief   **This file contains the unit testing of the E2E library.**
+ *
+ * The file is designed to test the protect and check functions of each E2E profile, the Crc
+ * library is not mocked so the expected CRC values were calculated with a bitwise reference
+ * implementation of each polynomial.
+ */
+#include "unity.h"
+#include "Std_Types.h"
+#include "Registers.h"
+#include "Crc.h"
+#include "Crc_Arch.h"
+#include "E2E.h"
+#include "mock_Nvic.h"
+
+/*mock microcontroller registers used by the Crc library*/
+Crc_RegisterType CRC_BASE  = { 0 };
+Dma_RegisterType DMA1_BASE = { 0 };
+
+/*profile 1, CRC on byte 0, counter on the low nibble of byte 1*/
+static const E2E_P01ConfigType P01Config = {
+    .CounterOffset          = 8u,
+    .CRCOffset              = 0u,
+    .DataID                 = 0x1234u,
+    .DataIDNibbleOffset     = 12u,
+    .DataIDMode             = E2E_P01_DATAID_BOTH,
+    .DataLength             = 64u,
+    .MaxDeltaCounterInit    = 1u,
+    .MaxNoNewOrRepeatedData = 2u,
+    .SyncCounterInit        = 0u,
+};
+
+/*profile 2, the Data ID list is 1 to 16*/
+static const E2E_P02ConfigType P02Config = {
+    .DataLength             = 64u,
+    .DataIDList             = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 },
+    .MaxDeltaCounterInit    = 1u,
+    .MaxNoNewOrRepeatedData = 2u,
+    .SyncCounterInit        = 0u,
+};
+
+/*profile 4, header at the beginning of the data*/
+static const E2E_P04ConfigType P04Config = {
+    .DataID          = 0x0A0B0C0Du,
+    .Offset          = 0u,
+    .MinDataLength   = 96u,
+    .MaxDataLength   = 512u,
+    .MaxDeltaCounter = 2u,
+};
+
+/*profile 5, header at the beginning of the data*/
+static const E2E_P05ConfigType P05Config = {
+    .Offset          = 0u,
+    .DataLength      = 64u,
+    .DataID          = 0x1234u,
+    .MaxDeltaCounter = 2u,
+};
+
+/*profile 11, CRC on byte 0, counter on the low nibble of byte 1 and Data ID nibble on the high*/
+static const E2E_P11ConfigType P11Config = {
+    .CounterOffset      = 8u,
+    .CRCOffset          = 0u,
+    .DataID             = 0x0A34u,
+    .DataIDNibbleOffset = 12u,
+    .DataIDMode         = E2E_P11_DATAID_NIBBLE,
+    .DataLength         = 64u,
+    .MaxDeltaCounter    = 2u,
+};
+
+/*this function is required by Ceedling to run any code before the test cases*/
+void setUp( void )
+{
+}
+
+/*this function is required by Ceedling to run any code after the test cases*/
+void tearDown( void )
+{
+}
+
+/**
+ * @brief   **Profile 1 protection writes counter and CRC**
+ *
+ * The CRC of the first two data is checked against the reference values and the counter nibble
+ * written in byte 1.
+ */
+void test_E2E_P01Protect_writes_counter_and_crc( void )
+{
+    E2E_P01ProtectStateType State;
+    uint8 Data[ 8 ] = { 0x00, 0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66 };
+
+    E2E_P01ProtectInit( &State );
+    TEST_ASSERT_EQUAL( E2E_E_OK, E2E_P01Protect( &P01Config, &State, Data ) );
+    TEST_ASSERT_EQUAL_HEX8( 0x9D, Data[ 0 ] );
+    TEST_ASSERT_EQUAL_HEX8( 0x00, Data[ 1 ] );
+
+    TEST_ASSERT_EQUAL( E2E_E_OK, E2E_P01Protect( &P01Config, &State, Data ) );
+    TEST_ASSERT_EQUAL_HEX8( 0xC0, Data[ 0 ] );
+    TEST_ASSERT_EQUAL_HEX8( 0x01, Data[ 1 ] );
+    TEST_ASSERT_EQUAL( 2u, State.Counter );
+}
+
+/**
+ * @brief   **Profile 1 counter wraps after 14**
+ */
+void test_E2E_P01Protect_counter_wraps( void )
+{
+    E2E_P01ProtectStateType State = { .Counter = 14u };
+    uint8 Data[ 8 ]               = { 0 };
+
+    E2E_P01Protect( &P01Config, &State, Data );
+    TEST_ASSERT_EQUAL_HEX8( 0x0E, Data[ 1 ] );
+    TEST_ASSERT_EQUAL( 0u, State.Counter );
+}
+
+/**
+ * @brief   **Profile 1 protect and check sequence**
+ *
+ * First data is INITIAL, the next one OK, the same data again REPEATED, no new data NONEWDATA
+ * and a data with a corrupted byte WRONGCRC.
+ */
+void test_E2E_P01Check_sequence( void )
+{
+    E2E_P01ProtectStateType Protect;
+    E2E_P01CheckStateType Check;
+    uint8 Data[ 8 ] = { 0x00, 0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66 };
+
+    E2E_P01ProtectInit( &Protect );
+    E2E_P01CheckInit( &Check );
+    Check.NewDataAvailable = TRUE;
+
+    E2E_P01Protect( &P01Config, &Protect, Data );
+    TEST_ASSERT_EQUAL( E2E_E_OK, E2E_P01Check( &P01Config, &Check, Data ) );
+    TEST_ASSERT_EQUAL( E2E_P01STATUS_INITIAL, Check.Status );
+
+    E2E_P01Protect( &P01Config, &Protect, Data );
+    E2E_P01Check( &P01Config, &Check, Data );
+    TEST_ASSERT_EQUAL( E2E_P01STATUS_OK, Check.Status );
+
+    E2E_P01Check( &P01Config, &Check, Data );
+    TEST_ASSERT_EQUAL( E2E_P01STATUS_REPEATED, Check.Status );
+
+    Check.NewDataAvailable = FALSE;
+    E2E_P01Check( &P01Config, &Check, Data );
+    TEST_ASSERT_EQUAL( E2E_P01STATUS_NONEWDATA, Check.Status );
+
+    Check.NewDataAvailable = TRUE;
+    E2E_P01Protect( &P01Config, &Protect, Data );
+    Data[ 5 ] ^= 0x01u;
+    E2E_P01Check( &P01Config, &Check, Data );
+    TEST_ASSERT_EQUAL( E2E_P01STATUS_WRONGCRC, Check.Status );
+}
+
+/**
+ * @brief   **Profile 1 lost data**
+ *
+ * With MaxDeltaCounterInit 1 a gap of one data is accepted on the next call because the maximum
+ * delta is incremented on every call, a bigger gap is a wrong sequence.
+ */
+void test_E2E_P01Check_lost_data( void )
+{
+    E2E_P01ProtectStateType Protect;
+    E2E_P01CheckStateType Check;
+    uint8 Data[ 8 ] = { 0 };
+
+    E2E_P01ProtectInit( &Protect );
+    E2E_P01CheckInit( &Check );
+    Check.NewDataAvailable = TRUE;
+
+    E2E_P01Protect( &P01Config, &Protect, Data );
+    E2E_P01Check( &P01Config, &Check, Data );
+
+    E2E_P01Protect( &P01Config, &Protect, Data );
+    E2E_P01Protect( &P01Config, &Protect, Data );
+    E2E_P01Check( &P01Config, &Check, Data );
+    TEST_ASSERT_EQUAL( E2E_P01STATUS_OKSOMELOST, Check.Status );
+    TEST_ASSERT_EQUAL( 1u, Check.LostData );
+
+    for( uint8 i = 0u; i < 5u; i++ )
+    {
+        E2E_P01Protect( &P01Config, &Protect, Data );
+    }
+    E2E_P01Check( &P01Config, &Check, Data );
+    TEST_ASSERT_EQUAL( E2E_P01STATUS_WRONGSEQUENCE, Check.Status );
+}
+
+/**
+ * @brief   **Profile 1 Data ID alternating and low modes**
+ *
+ * Protect and check shall agree on every counter value using only one byte of the Data ID.
+ */
+void test_E2E_P01_alt_and_low_modes( void )
+{
+    E2E_P01ConfigType Config = P01Config;
+    E2E_P01ProtectStateType Protect;
+    E2E_P01CheckStateType Check;
+    uint8 Data[ 8 ] = { 0x00, 0x00, 0xA5, 0x5A, 0xA5, 0x5A, 0xA5, 0x5A };
+
+    Config.DataIDMode = E2E_P01_DATAID_ALT;
+    for( uint8 Mode = 0u; Mode < 2u; Mode++ )
+    {
+        E2E_P01ProtectInit( &Protect );
+        E2E_P01CheckInit( &Check );
+        Check.NewDataAvailable = TRUE;
+
+        E2E_P01Protect( &Config, &Protect, Data );
+        E2E_P01Check( &Config, &Check, Data );
+        for( uint8 i = 0u; i < 20u; i++ )
+        {
+            E2E_P01Protect( &Config, &Protect, Data );
+            E2E_P01Check( &Config, &Check, Data );
+            TEST_ASSERT_EQUAL( E2E_P01STATUS_OK, Check.Status );
+        }
+        Config.DataIDMode = E2E_P01_DATAID_LOW;
+    }
+}
+
+/**
+ * @brief   **Profile 1 wrong parameters**
+ */
+void test_E2E_P01_wrong_parameters( void )
+{
+    E2E_P01ConfigType Config            = P01Config;
+    E2E_P01ProtectStateType Protect     = { 0 };
+    E2E_P01CheckStateType Check;
+    uint8 Data[ 8 ]                     = { 0 };
+
+    E2E_P01CheckInit( &Check );
+    TEST_ASSERT_EQUAL( E2E_E_INPUTERR_NULL, E2E_P01Protect( NULL_PTR, &Protect, Data ) );
+    TEST_ASSERT_EQUAL( E2E_E_INPUTERR_NULL, E2E_P01Protect( &Config, &Protect, NULL_PTR ) );
+    TEST_ASSERT_EQUAL( E2E_E_INPUTERR_NULL, E2E_P01Check( &Config, NULL_PTR, Data ) );
+    TEST_ASSERT_EQUAL( E2E_E_INPUTERR_NULL, E2E_P01ProtectInit( NULL_PTR ) );
+    TEST_ASSERT_EQUAL( E2E_E_INPUTERR_NULL, E2E_P01CheckInit( NULL_PTR ) );
+
+    Protect.Counter = 15u;
+    TEST_ASSERT_EQUAL( E2E_E_INPUTERR_WRONG, E2E_P01Protect( &Config, &Protect, Data ) );
+
+    Config.CRCOffset = 4u;
+    TEST_ASSERT_EQUAL( E2E_E_INPUTERR_WRONG, E2E_P01Check( &Config, &Check, Data ) );
+}
+
+/**
+ * @brief   **Profile 2 protection writes counter and CRC**
+ */
+void test_E2E_P02Protect_writes_counter_and_crc( void )
+{
+    E2E_P02ProtectStateType State;
+    uint8 Data[ 8 ] = { 0x00, 0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66 };
+
+    E2E_P02ProtectInit( &State );
+    TEST_ASSERT_EQUAL( E2E_E_OK, E2E_P02Protect( &P02Config, &State, Data ) );
+    TEST_ASSERT_EQUAL_HEX8( 0x31, Data[ 0 ] );
+    TEST_ASSERT_EQUAL( 1u, State.Counter );
+
+    State.Counter = 15u;
+    E2E_P02Protect( &P02Config, &State, Data );
+    TEST_ASSERT_EQUAL_HEX8( 0x0F, Data[ 1 ] );
+    TEST_ASSERT_EQUAL( 0u, State.Counter );
+}
+
+/**
+ * @brief   **Profile 2 protect and check sequence**
+ */
+void test_E2E_P02Check_sequence( void )
+{
+    E2E_P02ProtectStateType Protect;
+    E2E_P02CheckStateType Check;
+    uint8 Data[ 8 ] = { 0x00, 0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66 };
+
+    E2E_P02ProtectInit( &Protect );
+    E2E_P02CheckInit( &Check );
+    Check.NewDataAvailable = TRUE;
+
+    E2E_P02Protect( &P02Config, &Protect, Data );
+    E2E_P02Check( &P02Config, &Check, Data );
+    TEST_ASSERT_EQUAL( E2E_P02STATUS_INITIAL, Check.Status );
+
+    for( uint8 i = 0u; i < 20u; i++ )
+    {
+        E2E_P02Protect( &P02Config, &Protect, Data );
+        TEST_ASSERT_EQUAL( E2E_E_OK, E2E_P02Check( &P02Config, &Check, Data ) );
+        TEST_ASSERT_EQUAL( E2E_P02STATUS_OK, Check.Status );
+    }
+
+    E2E_P02Check( &P02Config, &Check, Data );
+    TEST_ASSERT_EQUAL( E2E_P02STATUS_REPEATED, Check.Status );
+
+    E2E_P02Protect( &P02Config, &Protect, Data );
+    Data[ 7 ] ^= 0x80u;
+    E2E_P02Check( &P02Config, &Check, Data );
+    TEST_ASSERT_EQUAL( E2E_P02STATUS_WRONGCRC, Check.Status );
+}
+
+/**
+ * @brief   **Profile 2 wrong parameters**
+ */
+void test_E2E_P02_wrong_parameters( void )
+{
+    E2E_P02ConfigType Config        = P02Config;
+    E2E_P02ProtectStateType Protect = { .Counter = 16u };
+    uint8 Data[ 8 ]                 = { 0 };
+
+    TEST_ASSERT_EQUAL( E2E_E_INPUTERR_NULL, E2E_P02Protect( &Config, NULL_PTR, Data ) );
+    TEST_ASSERT_EQUAL( E2E_E_INPUTERR_NULL, E2E_P02Check( NULL_PTR, NULL_PTR, Data ) );
+    TEST_ASSERT_EQUAL( E2E_E_INPUTERR_WRONG, E2E_P02Protect( &Config, &Protect, Data ) );
+
+    Protect.Counter   = 0u;
+    Config.DataLength = 8u;
+    TEST_ASSERT_EQUAL( E2E_E_INPUTERR_WRONG, E2E_P02Protect( &Config, &Protect, Data ) );
+}
+
+/**
+ * @brief   **Profile 4 protection writes the header**
+ *
+ * Length, counter and Data ID are written in big endian followed by the CRC32P4 over the data
+ * excluding the CRC field.
+ */
+void test_E2E_P04Protect_writes_header( void )
+{
+    E2E_P04ProtectStateType State;
+    uint8 Data[ 16 ]           = { 0 };
+    const uint8 Expected[ 16 ] = { 0x00, 0x10, 0x00, 0x00, 0x0A, 0x0B, 0x0C, 0x0D,
+                                   0xB2, 0x9F, 0xAA, 0xB0, 0x11, 0x22, 0x33, 0x44 };
+
+    Data[ 12 ] = 0x11u;
+    Data[ 13 ] = 0x22u;
+    Data[ 14 ] = 0x33u;
+    Data[ 15 ] = 0x44u;
+
+    E2E_P04ProtectInit( &State );
+    TEST_ASSERT_EQUAL( E2E_E_OK, E2E_P04Protect( &P04Config, &State, Data, sizeof( Data ) ) );
+    TEST_ASSERT_EQUAL_HEX8_ARRAY( Expected, Data, sizeof( Data ) );
+    TEST_ASSERT_EQUAL( 1u, State.Counter );
+}
+
+/**
+ * @brief   **Profile 4 protect and check sequence on a CAN FD frame**
+ *
+ * A 64 bytes frame is protected and checked, repeated, lost and corrupted data are detected.
+ */
+void test_E2E_P04Check_sequence( void )
+{
+    E2E_P04ProtectStateType Protect;
+    E2E_P04CheckStateType Check;
+    uint8 Data[ 64 ];
+
+    for( uint8 i = 0u; i < sizeof( Data ); i++ )
+    {
+        Data[ i ] = i * 3u;
+    }
+
+    E2E_P04ProtectInit( &Protect );
+    E2E_P04CheckInit( &Check );
+
+    E2E_P04Protect( &P04Config, &Protect, Data, sizeof( Data ) );
+    TEST_ASSERT_EQUAL( E2E_E_OK, E2E_P04Check( &P04Config, &Check, Data, sizeof( Data ) ) );
+    TEST_ASSERT_EQUAL( E2E_P04STATUS_OK, Check.Status );
+
+    E2E_P04Check( &P04Config, &Check, Data, sizeof( Data ) );
+    TEST_ASSERT_EQUAL( E2E_P04STATUS_REPEATED, Check.Status );
+
+    E2E_P04Protect( &P04Config, &Protect, Data, sizeof( Data ) );
+    E2E_P04Protect( &P04Config, &Protect, Data, sizeof( Data ) );
+    E2E_P04Check( &P04Config, &Check, Data, sizeof( Data ) );
+    TEST_ASSERT_EQUAL( E2E_P04STATUS_OKSOMELOST, Check.Status );
+
+    E2E_P04Protect( &P04Config, &Protect, Data, sizeof( Data ) );
+    E2E_P04Protect( &P04Config, &Protect, Data, sizeof( Data ) );
+    E2E_P04Protect( &P04Config, &Protect, Data, sizeof( Data ) );
+    E2E_P04Check( &P04Config, &Check, Data, sizeof( Data ) );
+    TEST_ASSERT_EQUAL( E2E_P04STATUS_WRONGSEQUENCE, Check.Status );
+
+    E2E_P04Protect( &P04Config, &Protect, Data, sizeof( Data ) );
+    Data[ 40 ] ^= 0x10u;
+    E2E_P04Check( &P04Config, &Check, Data, sizeof( Data ) );
+    TEST_ASSERT_EQUAL( E2E_P04STATUS_ERROR, Check.Status );
+
+    E2E_P04Check( &P04Config, &Check, NULL_PTR, 0u );
+    TEST_ASSERT_EQUAL( E2E_P04STATUS_NONEWDATA, Check.Status );
+}
+
+/**
+ * @brief   **Profile 4 header not at the beginning of the data**
+ *
+ * With a header offset of 32 bits the CRC also covers the bytes in front of the header.
+ */
+void test_E2E_P04_header_offset( void )
+{
+    E2E_P04ConfigType Config = P04Config;
+    E2E_P04ProtectStateType Protect;
+    E2E_P04CheckStateType Check;
+    uint8 Data[ 20 ] = { 0x55, 0x66, 0x77, 0x88 };
+
+    Config.Offset = 32u;
+    E2E_P04ProtectInit( &Protect );
+    E2E_P04CheckInit( &Check );
+
+    E2E_P04Protect( &Config, &Protect, Data, sizeof( Data ) );
+    E2E_P04Check( &Config, &Check, Data, sizeof( Data ) );
+    TEST_ASSERT_EQUAL( E2E_P04STATUS_OK, Check.Status );
+
+    E2E_P04Protect( &Config, &Protect, Data, sizeof( Data ) );
+    Data[ 0 ] ^= 0x01u;
+    E2E_P04Check( &Config, &Check, Data, sizeof( Data ) );
+    TEST_ASSERT_EQUAL( E2E_P04STATUS_ERROR, Check.Status );
+}
+
+/**
+ * @brief   **Profile 4 wrong parameters**
+ */
+void test_E2E_P04_wrong_parameters( void )
+{
+    E2E_P04ProtectStateType Protect = { 0 };
+    E2E_P04CheckStateType Check;
+    uint8 Data[ 16 ]                = { 0 };
+
+    E2E_P04CheckInit( &Check );
+    TEST_ASSERT_EQUAL( E2E_E_INPUTERR_NULL, E2E_P04Protect( &P04Config, &Protect, NULL_PTR, sizeof( Data ) ) );
+    TEST_ASSERT_EQUAL( E2E_E_INPUTERR_WRONG, E2E_P04Protect( &P04Config, &Protect, Data, 11u ) );
+    TEST_ASSERT_EQUAL( E2E_E_INPUTERR_WRONG, E2E_P04Check( &P04Config, &Check, Data, 0u ) );
+    TEST_ASSERT_EQUAL( E2E_E_INPUTERR_WRONG, E2E_P04Check( &P04Config, &Check, NULL_PTR, 16u ) );
+
+    TEST_ASSERT_EQUAL( E2E_E_OK, E2E_P04Check( &P04Config, &Check, Data, 11u ) );
+    TEST_ASSERT_EQUAL( E2E_P04STATUS_ERROR, Check.Status );
+}
+
+/**
+ * @brief   **Profile 5 protection writes the header**
+ */
+void test_E2E_P05Protect_writes_header( void )
+{
+    E2E_P05ProtectStateType State;
+    uint8 Data[ 8 ] = { 0x00, 0x00, 0x00, 0x11, 0x22, 0x33, 0x44, 0x55 };
+
+    E2E_P05ProtectInit( &State );
+    TEST_ASSERT_EQUAL( E2E_E_OK, E2E_P05Protect( &P05Config, &State, Data, sizeof( Data ) ) );
+    TEST_ASSERT_EQUAL_HEX8( 0x21, Data[ 0 ] );
+    TEST_ASSERT_EQUAL_HEX8( 0x08, Data[ 1 ] );
+    TEST_ASSERT_EQUAL_HEX8( 0x00, Data[ 2 ] );
+    TEST_ASSERT_EQUAL( 1u, State.Counter );
+}
+
+/**
+ * @brief   **Profile 5 protect and check sequence**
+ *
+ * The counter goes through its full range and wraps, corrupted data is detected.
+ */
+void test_E2E_P05Check_sequence( void )
+{
+    E2E_P05ProtectStateType Protect;
+    E2E_P05CheckStateType Check;
+    uint8 Data[ 8 ] = { 0x00, 0x00, 0x00, 0x11, 0x22, 0x33, 0x44, 0x55 };
+
+    E2E_P05ProtectInit( &Protect );
+    E2E_P05CheckInit( &Check );
+
+    for( uint16 i = 0u; i < 300u; i++ )
+    {
+        E2E_P05Protect( &P05Config, &Protect, Data, sizeof( Data ) );
+        TEST_ASSERT_EQUAL( E2E_E_OK, E2E_P05Check( &P05Config, &Check, Data, sizeof( Data ) ) );
+        TEST_ASSERT_EQUAL( E2E_P05STATUS_OK, Check.Status );
+    }
+
+    E2E_P05Check( &P05Config, &Check, Data, sizeof( Data ) );
+    TEST_ASSERT_EQUAL( E2E_P05STATUS_REPEATED, Check.Status );
+
+    E2E_P05Protect( &P05Config, &Protect, Data, sizeof( Data ) );
+    Data[ 3 ] ^= 0x04u;
+    E2E_P05Check( &P05Config, &Check, Data, sizeof( Data ) );
+    TEST_ASSERT_EQUAL( E2E_P05STATUS_ERROR, Check.Status );
+
+    E2E_P05Check( &P05Config, &Check, NULL_PTR, 0u );
+    TEST_ASSERT_EQUAL( E2E_P05STATUS_NONEWDATA, Check.Status );
+}
+
+/**
+ * @brief   **Profile 5 wrong parameters**
+ */
+void test_E2E_P05_wrong_parameters( void )
+{
+    E2E_P05ProtectStateType Protect = { 0 };
+    E2E_P05CheckStateType Check;
+    uint8 Data[ 8 ]                 = { 0 };
+
+    E2E_P05CheckInit( &Check );
+    TEST_ASSERT_EQUAL( E2E_E_INPUTERR_NULL, E2E_P05Protect( NULL_PTR, &Protect, Data, sizeof( Data ) ) );
+    TEST_ASSERT_EQUAL( E2E_E_INPUTERR_NULL, E2E_P05Check( &P05Config, NULL_PTR, Data, sizeof( Data ) ) );
+    TEST_ASSERT_EQUAL( E2E_E_INPUTERR_WRONG, E2E_P05Protect( &P05Config, &Protect, Data, 7u ) );
+
+    TEST_ASSERT_EQUAL( E2E_E_OK, E2E_P05Check( &P05Config, &Check, Data, 7u ) );
+    TEST_ASSERT_EQUAL( E2E_P05STATUS_ERROR, Check.Status );
+}
+
+/**
+ * @brief   **Profile 11 protection writes the nibbles and CRC**
+ */
+void test_E2E_P11Protect_writes_nibbles_and_crc( void )
+{
+    E2E_P11ProtectStateType State;
+    uint8 Data[ 8 ] = { 0x00, 0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66 };
+
+    E2E_P11ProtectInit( &State );
+    TEST_ASSERT_EQUAL( E2E_E_OK, E2E_P11Protect( &P11Config, &State, Data, sizeof( Data ) ) );
+    TEST_ASSERT_EQUAL_HEX8( 0x74, Data[ 0 ] );
+    TEST_ASSERT_EQUAL_HEX8( 0xA0, Data[ 1 ] );
+    TEST_ASSERT_EQUAL( 1u, State.Counter );
+}
+
+/**
+ * @brief   **Profile 11 protect and check sequence**
+ *
+ * A wrong Data ID nibble is detected even when the CRC is correct.
+ */
+void test_E2E_P11Check_sequence( void )
+{
+    E2E_P11ConfigType Config = P11Config;
+    E2E_P11ProtectStateType Protect;
+    E2E_P11CheckStateType Check;
+    uint8 Data[ 8 ] = { 0x00, 0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66 };
+
+    E2E_P11ProtectInit( &Protect );
+    E2E_P11CheckInit( &Check );
+
+    for( uint8 i = 0u; i < 20u; i++ )
+    {
+        E2E_P11Protect( &P11Config, &Protect, Data, sizeof( Data ) );
+        TEST_ASSERT_EQUAL( E2E_E_OK, E2E_P11Check( &P11Config, &Check, Data, sizeof( Data ) ) );
+        TEST_ASSERT_EQUAL( E2E_P11STATUS_OK, Check.Status );
+    }
+
+    E2E_P11Protect( &P11Config, &Protect, Data, sizeof( Data ) );
+    E2E_P11Protect( &P11Config, &Protect, Data, sizeof( Data ) );
+    E2E_P11Check( &P11Config, &Check, Data, sizeof( Data ) );
+    TEST_ASSERT_EQUAL( E2E_P11STATUS_OKSOMELOST, Check.Status );
+
+    E2E_P11Protect( &P11Config, &Protect, Data, sizeof( Data ) );
+    Config.DataID = 0x0B34u;
+    E2E_P11Check( &Config, &Check, Data, sizeof( Data ) );
+    TEST_ASSERT_EQUAL( E2E_P11STATUS_ERROR, Check.Status );
+
+    E2E_P11Check( &P11Config, &Check, NULL_PTR, 0u );
+    TEST_ASSERT_EQUAL( E2E_P11STATUS_NONEWDATA, Check.Status );
+}
+
+/**
+ * @brief   **Profile 11 wrong parameters**
+ */
+void test_E2E_P11_wrong_parameters( void )
+{
+    E2E_P11ProtectStateType Protect = { .Counter = 15u };
+    E2E_P11CheckStateType Check;
+    uint8 Data[ 8 ]                 = { 0 };
+
+    E2E_P11CheckInit( &Check );
+    TEST_ASSERT_EQUAL( E2E_E_INPUTERR_NULL, E2E_P11Protect( &P11Config, &Protect, NULL_PTR, sizeof( Data ) ) );
+    TEST_ASSERT_EQUAL( E2E_E_INPUTERR_WRONG, E2E_P11Protect( &P11Config, &Protect, Data, sizeof( Data ) ) );
+    TEST_ASSERT_EQUAL( E2E_E_INPUTERR_WRONG, E2E_P11Check( &P11Config, &Check, NULL_PTR, sizeof( Data ) ) );
+}
@@ -0,0 +1,157 @@
+/**
+ * @file    test_Mcu_Arch.c
+ * @brief   **Unit testing for Mcu hardware specific driver**
+ *
+ * group of unit test cases for the reset reason and the no-init RAM validation of Mcu_Arch.c
+ */
+#include <string.h>
+#include "unity.h"
+#include "Registers.h"
+#include "Mcu_Cfg.h"
+#include "Mcu_Arch.h"
+#include "Crc.h"
+#include "Crc_Arch.h"
+#include "mock_Nvic.h"
+
+/*mock microcontroller registers with its initial values*/
+Rcc_RegisterType RCC_BASE  = { 0 };
+Scb_RegisterType SCB_BASE  = { 0 };
+Crc_RegisterType CRC_BASE  = { 0 };
+Dma_RegisterType DMA1_BASE = { 0 };
+
+/*linker script symbols, the tests point the no-init RAM to NoInitRam instead*/
+uint32 _snoinit;
+uint32 _enoinit;
+
+extern Mcu_NoInitStampType Mcu_NoInitStamp;
+extern const uint8 *Mcu_NoInitStart;
+extern const uint8 *Mcu_NoInitEnd;
+
+/*simulated no-init RAM*/
+static uint32 NoInitRam[ 16 ];
+
+static Mcu_HwUnit HwUnit;
+static const Mcu_ConfigType Config = { 0 };
+
+/*this function is required by Ceedling to run any code before the test cases*/
+void setUp( void )
+{
+    memset( &RCC_BASE, 0, sizeof( RCC_BASE ) );
+    memset( &SCB_BASE, 0, sizeof( SCB_BASE ) );
+    memset( &HwUnit, 0, sizeof( HwUnit ) );
+    memset( &Mcu_NoInitStamp, 0, sizeof( Mcu_NoInitStamp ) );
+
+    for( uint8 i = 0u; i < 16u; i++ )
+    {
+        NoInitRam[ i ] = 0x11111111u * i;
+    }
+    Mcu_NoInitStart = (const uint8 *)&NoInitRam[ 0 ];
+    Mcu_NoInitEnd   = (const uint8 *)&NoInitRam[ 16 ];
+}
+
+/*this function is required by Ceedling to run any code after the test cases*/
+void tearDown( void )
+{
+}
+
+/**
+ * @brief   **Test the reset flags are latched and cleared at init**
+ */
+void test__Mcu_Arch_Init__latch_and_clear_reset_flags( void )
+{
+    RCC_BASE.CSR = 0x10000000u | 0x00000001u;
+
+    Mcu_Arch_Init( &HwUnit, &Config );
+
+    TEST_ASSERT_EQUAL_HEX32( 0x10000000u, Mcu_Arch_GetResetRawValue( &HwUnit ) );
+    TEST_ASSERT_BITS_HIGH( 0x00800000u, RCC_BASE.CSR );
+}
+
+/**
+ * @brief   **Test the reset reason is decoded from the latched flags**
+ */
+void test__Mcu_Arch_GetResetReason__decode_flags( void )
+{
+    HwUnit.ResetRawValue = 0x08000000u | 0x04000000u;
+    TEST_ASSERT_EQUAL( MCU_POWER_ON_RESET, Mcu_Arch_GetResetReason( &HwUnit ) );
+
+    HwUnit.ResetRawValue = 0x20000000u;
+    TEST_ASSERT_EQUAL( MCU_WATCHDOG_RESET, Mcu_Arch_GetResetReason( &HwUnit ) );
+
+    HwUnit.ResetRawValue = 0x40000000u;
+    TEST_ASSERT_EQUAL( MCU_WATCHDOG_RESET, Mcu_Arch_GetResetReason( &HwUnit ) );
+
+    HwUnit.ResetRawValue = 0x10000000u | 0x04000000u;
+    TEST_ASSERT_EQUAL( MCU_SW_RESET, Mcu_Arch_GetResetReason( &HwUnit ) );
+
+    HwUnit.ResetRawValue = 0x04000000u;
+    TEST_ASSERT_EQUAL( MCU_RESET_UNDEFINED, Mcu_Arch_GetResetReason( &HwUnit ) );
+}
+
+/**
+ * @brief   **Test the no-init RAM is valid after a software reset**
+ *
+ * Mcu_Arch_PerformReset stamps the RAM and requests the reset, the next init with the software
+ * reset flag reports the RAM as valid only once.
+ */
+void test__Mcu_Arch_GetRamState__valid_after_perform_reset( void )
+{
+    Mcu_Arch_PerformReset( &HwUnit );
+    TEST_ASSERT_EQUAL_HEX32( 0x05FA0004u, SCB_BASE.AIRCR );
+
+    RCC_BASE.CSR = 0x10000000u;
+    Mcu_Arch_Init( &HwUnit, &Config );
+    TEST_ASSERT_EQUAL( MCU_RAMSTATE_VALID, Mcu_Arch_GetRamState( &HwUnit ) );
+
+    RCC_BASE.CSR = 0x04000000u;
+    Mcu_Arch_Init( &HwUnit, &Config );
+    TEST_ASSERT_EQUAL( MCU_RAMSTATE_INVALID, Mcu_Arch_GetRamState( &HwUnit ) );
+}
+
+/**
+ * @brief   **Test the reset request keeps the priority grouping**
+ *
+ * The AIRCR write carries the key and the reset request along with the PRIGROUP bits already in
+ * the register, any other bit is dropped.
+ */
+void test__Mcu_Arch_PerformReset__keep_prigroup_bits( void )
+{
+    SCB_BASE.AIRCR = 0xFA050000u | 0x00000700u | 0x00000002u;
+    Mcu_Arch_PerformReset( &HwUnit );
+    TEST_ASSERT_EQUAL_HEX32( 0x05FA0704u, SCB_BASE.AIRCR );
+}
+
+/**
+ * @brief   **Test the no-init RAM is invalid when modified after the stamp**
+ */
+void test__Mcu_Arch_GetRamState__invalid_when_content_changes( void )
+{
+    Mcu_Arch_PerformReset( &HwUnit );
+    NoInitRam[ 7 ] ^= 0x00000100u;
+
+    RCC_BASE.CSR = 0x10000000u;
+    Mcu_Arch_Init( &HwUnit, &Config );
+    TEST_ASSERT_EQUAL( MCU_RAMSTATE_INVALID, Mcu_Arch_GetRamState( &HwUnit ) );
+}
+
+/**
+ * @brief   **Test the no-init RAM is invalid after a power on reset**
+ */
+void test__Mcu_Arch_GetRamState__invalid_after_power_on( void )
+{
+    Mcu_Arch_PerformReset( &HwUnit );
+
+    RCC_BASE.CSR = 0x08000000u | 0x04000000u;
+    Mcu_Arch_Init( &HwUnit, &Config );
+    TEST_ASSERT_EQUAL( MCU_RAMSTATE_INVALID, Mcu_Arch_GetRamState( &HwUnit ) );
+}
+
+/**
+ * @brief   **Test the no-init RAM is invalid without stamp**
+ */
+void test__Mcu_Arch_GetRamState__invalid_without_stamp( void )
+{
+    RCC_BASE.CSR = 0x04000000u;
+    Mcu_Arch_Init( &HwUnit, &Config );
+    TEST_ASSERT_EQUAL( MCU_RAMSTATE_INVALID, Mcu_Arch_GetRamState( &HwUnit ) );
+}
@@ -0,0 +1,218 @@
+/**
+ * @file    test_Mem.c
+ * @brief   **Unit testing for the memory routines**
+ *
+ * The routines take different paths depending on the alignment of the pointers and the length, so
+ * each one is compared against a plain byte loop for every alignment of the pointers (0 to 3) and
+ * every length from 0 to TEST_MAX_LENGTH.
+ */
+#include <string.h>
+#include "unity.h"
+#include "Mem.h"
+
+#define TEST_MAX_LENGTH 72u                       /*!< Longest block tested */
+#define TEST_BUFFER     ( TEST_MAX_LENGTH + 8u ) /*!< Size of the buffers, room for the offsets */
+
+/*buffers are word aligned, the offsets give the four possible alignments*/
+static uint32 SrcBuffer[ TEST_BUFFER / 4u ];
+static uint32 DstBuffer[ TEST_BUFFER / 4u ];
+static uint32 RefBuffer[ TEST_BUFFER / 4u ];
+
+/*this function is required by Ceedling to run any code before the test cases*/
+void setUp( void )
+{
+    for( uint32 i = 0u; i < TEST_BUFFER; i++ )
+    {
+        ( (uint8 *)SrcBuffer )[ i ] = (uint8)( ( i * 7u ) + 1u );
+    }
+}
+
+/*this function is required by Ceedling to run any code after the test cases*/
+void tearDown( void )
+{
+}
+
+/**
+ * @brief   **Test copy for every alignment and length**
+ *
+ * The bytes before and after the destination block shall not be modified.
+ */
+void test__Mem_Copy__all_alignments_and_lengths( void )
+{
+    for( uint32 SrcOffset = 0u; SrcOffset < 4u; SrcOffset++ )
+    {
+        for( uint32 DstOffset = 0u; DstOffset < 4u; DstOffset++ )
+        {
+            for( uint32 Length = 0u; Length <= TEST_MAX_LENGTH; Length++ )
+            {
+                memset( DstBuffer, 0xEE, sizeof( DstBuffer ) );
+                memset( RefBuffer, 0xEE, sizeof( RefBuffer ) );
+                for( uint32 i = 0u; i < Length; i++ )
+                {
+                    ( (uint8 *)RefBuffer )[ DstOffset + i ] = ( (uint8 *)SrcBuffer )[ SrcOffset + i ];
+                }
+
+                Mem_Copy( (uint8 *)DstBuffer + DstOffset, (uint8 *)SrcBuffer + SrcOffset, Length );
+                TEST_ASSERT_EQUAL_MEMORY( RefBuffer, DstBuffer, TEST_BUFFER );
+            }
+        }
+    }
+}
+
+/**
+ * @brief   **Test fill for every alignment and length**
+ *
+ * The bytes before and after the destination block shall not be modified.
+ */
+void test__Mem_Set__all_alignments_and_lengths( void )
+{
+    for( uint32 DstOffset = 0u; DstOffset < 4u; DstOffset++ )
+    {
+        for( uint32 Length = 0u; Length <= TEST_MAX_LENGTH; Length++ )
+        {
+            memset( DstBuffer, 0xEE, sizeof( DstBuffer ) );
+            memset( RefBuffer, 0xEE, sizeof( RefBuffer ) );
+            for( uint32 i = 0u; i < Length; i++ )
+            {
+                ( (uint8 *)RefBuffer )[ DstOffset + i ] = 0xA5u;
+            }
+
+            Mem_Set( (uint8 *)DstBuffer + DstOffset, 0xA5u, Length );
+            TEST_ASSERT_EQUAL_MEMORY( RefBuffer, DstBuffer, TEST_BUFFER );
+        }
+    }
+}
+
+/**
+ * @brief   **Test compare of equal blocks for every alignment and length**
+ */
+void test__Mem_Compare__equal_blocks( void )
+{
+    for( uint32 Offset1 = 0u; Offset1 < 4u; Offset1++ )
+    {
+        for( uint32 Offset2 = 0u; Offset2 < 4u; Offset2++ )
+        {
+            memcpy( (uint8 *)DstBuffer + Offset2, (uint8 *)SrcBuffer + Offset1, TEST_MAX_LENGTH );
+
+            for( uint32 Length = 0u; Length <= TEST_MAX_LENGTH; Length++ )
+            {
+                TEST_ASSERT_EQUAL_INT32( 0, Mem_Compare( (uint8 *)SrcBuffer + Offset1, (uint8 *)DstBuffer + Offset2, Length ) );
+            }
+        }
+    }
+}
+
+/**
+ * @brief   **Test compare with one different byte at every position**
+ *
+ * The result shall have the sign of the difference of the first different bytes taken as unsigned.
+ */
+void test__Mem_Compare__different_byte_at_every_position( void )
+{
+    for( uint32 Offset1 = 0u; Offset1 < 4u; Offset1++ )
+    {
+        for( uint32 Offset2 = 0u; Offset2 < 4u; Offset2++ )
+        {
+            for( uint32 Position = 0u; Position < TEST_MAX_LENGTH; Position++ )
+            {
+                uint8 *Block1 = (uint8 *)SrcBuffer + Offset1;
+                uint8 *Block2 = (uint8 *)DstBuffer + Offset2;
+
+                memcpy( Block2, Block1, TEST_MAX_LENGTH );
+                Block2[ Position ] = (uint8)( Block1[ Position ] + 0x80u );
+                /*a second difference after the first one shall not change the result*/
+                if( ( Position + 1u ) < TEST_MAX_LENGTH )
+                {
+                    Block2[ Position + 1u ] = (uint8)( Block1[ Position + 1u ] - 0x80u );
+                }
+
+                sint32 Expected = (sint32)Block1[ Position ] - (sint32)Block2[ Position ];
+                TEST_ASSERT_EQUAL_INT32( Expected, Mem_Compare( Block1, Block2, TEST_MAX_LENGTH ) );
+                TEST_ASSERT_EQUAL_INT32( -Expected, Mem_Compare( Block2, Block1, TEST_MAX_LENGTH ) );
+                TEST_ASSERT_EQUAL_INT32( 0, Mem_Compare( Block1, Block2, Position ) );
+            }
+        }
+    }
+}
+
+/**
+ * @brief   **Test scan with the value at every position for every alignment**
+ *
+ * The value is placed twice so the scan shall return the first one.
+ */
+void test__Mem_Find__value_at_every_position( void )
+{
+    for( uint32 Offset = 0u; Offset < 4u; Offset++ )
+    {
+        uint8 *Block = (uint8 *)DstBuffer + Offset;
+
+        for( uint32 Position = 0u; Position < TEST_MAX_LENGTH; Position++ )
+        {
+            memset( DstBuffer, 0x81, sizeof( DstBuffer ) );
+            Block[ Position ] = 0x01u;
+            Block[ TEST_MAX_LENGTH - 1u ] = 0x01u;
+
+            TEST_ASSERT_EQUAL_PTR( &Block[ Position ], Mem_Find( Block, 0x01u, TEST_MAX_LENGTH ) );
+            TEST_ASSERT_NULL( Mem_Find( Block, 0x01u, Position ) );
+        }
+    }
+}
+
+/**
+ * @brief   **Test scan of a block without the value**
+ *
+ * Bytes with the high bit set next to the value are a false positive of the word test when the
+ * borrow is not masked, the scan shall not return any of them.
+ */
+void test__Mem_Find__value_not_present( void )
+{
+    memset( DstBuffer, 0x00, sizeof( DstBuffer ) );
+    TEST_ASSERT_NULL( Mem_Find( DstBuffer, 0x01u, TEST_MAX_LENGTH ) );
+
+    memset( DstBuffer, 0x80, sizeof( DstBuffer ) );
+    TEST_ASSERT_NULL( Mem_Find( DstBuffer, 0x00u, TEST_MAX_LENGTH ) );
+    TEST_ASSERT_EQUAL_PTR( (uint8 *)DstBuffer, Mem_Find( DstBuffer, 0x80u, TEST_MAX_LENGTH ) );
+}
+
+/**
+ * @brief   **Test copy to a word only memory for every source alignment and length**
+ *
+ * The last word shall be completed with zeros and no word after it shall be written.
+ */
+void test__Mem_CopyToVolatile32__all_alignments_and_lengths( void )
+{
+    for( uint32 SrcOffset = 0u; SrcOffset < 4u; SrcOffset++ )
+    {
+        for( uint32 Length = 0u; Length <= TEST_MAX_LENGTH; Length++ )
+        {
+            uint32 Words = ( Length + 3u ) / 4u;
+
+            memset( DstBuffer, 0xEE, sizeof( DstBuffer ) );
+            memset( RefBuffer, 0xEE, sizeof( RefBuffer ) );
+            memset( RefBuffer, 0x00, Words * 4u );
+            memcpy( RefBuffer, (uint8 *)SrcBuffer + SrcOffset, Length );
+
+            Mem_CopyToVolatile32( DstBuffer, (uint8 *)SrcBuffer + SrcOffset, Length );
+            TEST_ASSERT_EQUAL_MEMORY( RefBuffer, DstBuffer, TEST_BUFFER );
+        }
+    }
+}
+
+/**
+ * @brief   **Test fill of a word only memory for every number of words**
+ */
+void test__Mem_SetVolatile32__all_lengths( void )
+{
+    for( uint32 Words = 0u; Words <= ( TEST_MAX_LENGTH / 4u ); Words++ )
+    {
+        memset( DstBuffer, 0xEE, sizeof( DstBuffer ) );
+        memset( RefBuffer, 0xEE, sizeof( RefBuffer ) );
+        for( uint32 i = 0u; i < Words; i++ )
+        {
+            RefBuffer[ i ] = 0x12345678u;
+        }
+
+        Mem_SetVolatile32( DstBuffer, 0x12345678u, Words );
+        TEST_ASSERT_EQUAL_MEMORY( RefBuffer, DstBuffer, TEST_BUFFER );
+    }
+}
@@ -30,6 +30,14 @@ Nvic_RegisterType NVIC_BASE = { { 0 }, { 0 }, { 0 }, { 0 }, { 0 }, { 0 }, { 0 },
 /** @brief Starting index for NVIC register */
 #define FIRST_INDEX      0U
 
+/*RAM vector table from Nvic.c*/
+extern Nvic_HandlerType Nvic_RamVectors[];
+
+/*dummy handler to install on the RAM vector table*/
+static void Dummy_Handler( void )
+{
+}
+
 
 /**
  * @brief   **setUp**
@@ -505,3 +513,72 @@ void test__CDD_Nvic_ClearPendingIrq_UpperrManIrq( void )
     CDD_Nvic_ClearPendingIrq( irq );
     TEST_ASSERT_EQUAL_HEX32( expected_ICRP, NVIC->ICPR[ FIRST_INDEX ] );
 }
+
+/**
+ * @brief   **Test set handler for a valid IRQ**
+ *
+ * This test validates that the handler is written on the RAM vector table entry of the IRQ, which
+ * is placed after the 16 core exceptions.
+ */
+void test__CDD_Nvic_SetHandler_ValidIrq( void )
+{
+    Nvic_RamVectors[ 16 + NVIC_IRQ ] = NULL_PTR;
+
+    CDD_Nvic_SetHandler( NVIC_IRQ, Dummy_Handler );
+    TEST_ASSERT_EQUAL_PTR( Dummy_Handler, Nvic_RamVectors[ 16 + NVIC_IRQ ] );
+    TEST_ASSERT_EQUAL_PTR( Dummy_Handler, CDD_Nvic_GetHandler( NVIC_IRQ ) );
+}
+
+/**
+ * @brief   **Test set handler for a core exception**
+ *
+ * This test validates that the handler of a core exception with negative number is written on
+ * its entry of the RAM vector table.
+ */
+void test__CDD_Nvic_SetHandler_CoreException( void )
+{
+    Nvic_RamVectors[ 15 ] = NULL_PTR;
+
+    CDD_Nvic_SetHandler( SysTick_IRQn, Dummy_Handler );
+    TEST_ASSERT_EQUAL_PTR( Dummy_Handler, Nvic_RamVectors[ 15 ] );
+}
+
+/**
+ * @brief   **Test set handler for an upper NVIC_MAX_IRQ irq**
+ *
+ * This test validates that the RAM vector table is not modified when the IRQ is out of range.
+ */
+void test__CDD_Nvic_SetHandler_UpperMaxIrq( void )
+{
+    Det_ReportError_IgnoreAndReturn( E_OK );
+
+    CDD_Nvic_SetHandler( NVIC_MAX_IRQ + 1, Dummy_Handler );
+}
+
+/**
+ * @brief   **Test set a NULL handler**
+ *
+ * This test validates that a NULL handler is not written on the RAM vector table.
+ */
+void test__CDD_Nvic_SetHandler_NullHandler( void )
+{
+    Nvic_RamVectors[ 16 + NVIC_IRQ ] = Dummy_Handler;
+
+    Det_ReportError_IgnoreAndReturn( E_OK );
+
+    CDD_Nvic_SetHandler( NVIC_IRQ, NULL_PTR );
+    TEST_ASSERT_EQUAL_PTR( Dummy_Handler, Nvic_RamVectors[ 16 + NVIC_IRQ ] );
+}
+
+/**
+ * @brief   **Test get handler for an invalid IRQ**
+ *
+ * This test validates that a NULL handler is returned when the IRQ is out of range.
+ */
+void test__CDD_Nvic_GetHandler_InvalidIrq( void )
+{
+    Det_ReportError_IgnoreAndReturn( E_OK );
+
+    Nvic_HandlerType Handler = CDD_Nvic_GetHandler( NonMaskableInt_IRQn - 1 );
+    TEST_ASSERT_NULL( Handler );
+}
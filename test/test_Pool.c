@@ -0,0 +1,194 @@
+/**
+ * @file    test_Pool.c
+ * @brief   **Unit testing for the fixed block memory pools**
+ *
+ * The pools are configured in test/support/Pool_Cfg.h with 4 blocks of 8 bytes, 2 of 64 and 1 of
+ * 256, small enough to run every class out of blocks.
+ */
+#include "unity.h"
+#include "Pool.h"
+#include "Pool_Cfg.h"
+
+/*this function is required by Ceedling to run any code before the test cases*/
+void setUp( void )
+{
+    Pool_Init( );
+}
+
+/*this function is required by Ceedling to run any code after the test cases*/
+void tearDown( void )
+{
+}
+
+/**
+ * @brief   **Test allocation from the smallest class that fits**
+ *
+ * Each size shall be served from the smallest class that fits it, with word aligned blocks.
+ */
+void test__Pool_Alloc__smallest_class_that_fits( void )
+{
+    Pool_StatsType Stats;
+    void *Block8   = Pool_Alloc( 8u );
+    void *Block64  = Pool_Alloc( 9u );
+    void *Block256 = Pool_Alloc( 65u );
+
+    TEST_ASSERT_NOT_NULL( Block8 );
+    TEST_ASSERT_NOT_NULL( Block64 );
+    TEST_ASSERT_NOT_NULL( Block256 );
+    TEST_ASSERT_EQUAL_HEX32( 0u, (uint32_least)Block8 & 3u );
+    TEST_ASSERT_EQUAL_HEX32( 0u, (uint32_least)Block64 & 3u );
+    TEST_ASSERT_EQUAL_HEX32( 0u, (uint32_least)Block256 & 3u );
+
+    TEST_ASSERT_EQUAL( E_OK, Pool_GetStats( POOL_CLASS_8, &Stats ) );
+    TEST_ASSERT_EQUAL_UINT32( 8u, Stats.BlockSize );
+    TEST_ASSERT_EQUAL_UINT16( 1u, Stats.Used );
+    TEST_ASSERT_EQUAL( E_OK, Pool_GetStats( POOL_CLASS_64, &Stats ) );
+    TEST_ASSERT_EQUAL_UINT32( 64u, Stats.BlockSize );
+    TEST_ASSERT_EQUAL_UINT16( 1u, Stats.Used );
+    TEST_ASSERT_EQUAL( E_OK, Pool_GetStats( POOL_CLASS_256, &Stats ) );
+    TEST_ASSERT_EQUAL_UINT32( 256u, Stats.BlockSize );
+    TEST_ASSERT_EQUAL_UINT16( 1u, Stats.Used );
+}
+
+/**
+ * @brief   **Test allocation with invalid sizes**
+ *
+ * A size of zero or larger than the largest block shall not be served.
+ */
+void test__Pool_Alloc__invalid_size( void )
+{
+    TEST_ASSERT_NULL( Pool_Alloc( 0u ) );
+    TEST_ASSERT_NULL( Pool_Alloc( 257u ) );
+}
+
+/**
+ * @brief   **Test allocation when the class is exhausted**
+ *
+ * The requests shall move to the next larger classes, and when none has a free block the request
+ * shall fail and be counted on the class that fits it.
+ */
+void test__Pool_Alloc__fallback_to_larger_classes( void )
+{
+    Pool_StatsType Stats;
+    uint8 *Blocks[ POOL_BLOCKS_8 + POOL_BLOCKS_64 + POOL_BLOCKS_256 ];
+
+    for( uint8 i = 0u; i < ( POOL_BLOCKS_8 + POOL_BLOCKS_64 + POOL_BLOCKS_256 ); i++ )
+    {
+        Blocks[ i ] = (uint8 *)Pool_Alloc( 4u );
+        TEST_ASSERT_NOT_NULL( Blocks[ i ] );
+    }
+    TEST_ASSERT_NULL( Pool_Alloc( 4u ) );
+    TEST_ASSERT_NULL( Pool_Alloc( 100u ) );
+
+    /*the blocks shall not overlap*/
+    for( uint8 i = 1u; i < POOL_BLOCKS_8; i++ )
+    {
+        TEST_ASSERT_TRUE( Blocks[ i ] >= ( Blocks[ i - 1u ] + 8u ) );
+    }
+
+    TEST_ASSERT_EQUAL( E_OK, Pool_GetStats( POOL_CLASS_8, &Stats ) );
+    TEST_ASSERT_EQUAL_UINT16( POOL_BLOCKS_8, Stats.Used );
+    TEST_ASSERT_EQUAL_UINT16( 1u, Stats.Failed );
+    TEST_ASSERT_EQUAL( E_OK, Pool_GetStats( POOL_CLASS_64, &Stats ) );
+    TEST_ASSERT_EQUAL_UINT16( POOL_BLOCKS_64, Stats.Used );
+    TEST_ASSERT_EQUAL_UINT16( 0u, Stats.Failed );
+    TEST_ASSERT_EQUAL( E_OK, Pool_GetStats( POOL_CLASS_256, &Stats ) );
+    TEST_ASSERT_EQUAL_UINT16( POOL_BLOCKS_256, Stats.Used );
+    TEST_ASSERT_EQUAL_UINT16( 1u, Stats.Failed );
+}
+
+/**
+ * @brief   **Test free and reuse of a block**
+ *
+ * A freed block shall be given again, and the high water mark shall keep the largest use.
+ */
+void test__Pool_Free__block_reused( void )
+{
+    Pool_StatsType Stats;
+    void *Block1 = Pool_Alloc( 64u );
+    void *Block2 = Pool_Alloc( 64u );
+
+    TEST_ASSERT_EQUAL( E_OK, Pool_Free( Block1 ) );
+    TEST_ASSERT_EQUAL_PTR( Block1, Pool_Alloc( 33u ) );
+    TEST_ASSERT_EQUAL( E_OK, Pool_Free( Block1 ) );
+    TEST_ASSERT_EQUAL( E_OK, Pool_Free( Block2 ) );
+
+    TEST_ASSERT_EQUAL( E_OK, Pool_GetStats( POOL_CLASS_64, &Stats ) );
+    TEST_ASSERT_EQUAL_UINT16( POOL_BLOCKS_64, Stats.Blocks );
+    TEST_ASSERT_EQUAL_UINT16( 0u, Stats.Used );
+    TEST_ASSERT_EQUAL_UINT16( 2u, Stats.HighWater );
+}
+
+/**
+ * @brief   **Test free of invalid pointers**
+ *
+ * A double free, a pointer to the middle of a block and a pointer outside the pools shall be
+ * rejected without changing the pools.
+ */
+void test__Pool_Free__invalid_pointers( void )
+{
+    Pool_StatsType Stats;
+    uint32 Outside;
+    uint8 *Block = (uint8 *)Pool_Alloc( 8u );
+
+    TEST_ASSERT_EQUAL( E_NOT_OK, Pool_Free( &Block[ 4 ] ) );
+    TEST_ASSERT_EQUAL( E_NOT_OK, Pool_Free( &Outside ) );
+    TEST_ASSERT_EQUAL( E_NOT_OK, Pool_Free( NULL_PTR ) );
+    TEST_ASSERT_EQUAL( E_OK, Pool_Free( Block ) );
+    TEST_ASSERT_EQUAL( E_NOT_OK, Pool_Free( Block ) );
+
+    TEST_ASSERT_EQUAL( E_OK, Pool_GetStats( POOL_CLASS_8, &Stats ) );
+    TEST_ASSERT_EQUAL_UINT16( 0u, Stats.Used );
+    TEST_ASSERT_EQUAL_PTR( Block, Pool_Alloc( 1u ) );
+    TEST_ASSERT_NOT_NULL( Pool_Alloc( 1u ) );
+}
+
+/**
+ * @brief   **Test a block shared by two owners**
+ *
+ * The block shall go back to the pool only when both owners free it.
+ */
+void test__Pool_Retain__shared_block( void )
+{
+    Pool_StatsType Stats;
+    void *Block = Pool_Alloc( 200u );
+
+    TEST_ASSERT_EQUAL( E_OK, Pool_Retain( Block ) );
+    TEST_ASSERT_EQUAL( E_OK, Pool_Free( Block ) );
+    TEST_ASSERT_EQUAL( E_OK, Pool_GetStats( POOL_CLASS_256, &Stats ) );
+    TEST_ASSERT_EQUAL_UINT16( 1u, Stats.Used );
+    TEST_ASSERT_NULL( Pool_Alloc( 200u ) );
+
+    TEST_ASSERT_EQUAL( E_OK, Pool_Free( Block ) );
+    TEST_ASSERT_EQUAL( E_OK, Pool_GetStats( POOL_CLASS_256, &Stats ) );
+    TEST_ASSERT_EQUAL_UINT16( 0u, Stats.Used );
+    TEST_ASSERT_EQUAL( E_NOT_OK, Pool_Retain( Block ) );
+}
+
+/**
+ * @brief   **Test the limit of owners of a block**
+ *
+ * A block shall not take more than 255 owners.
+ */
+void test__Pool_Retain__owners_limit( void )
+{
+    void *Block = Pool_Alloc( 8u );
+
+    for( uint16 i = 1u; i < 255u; i++ )
+    {
+        TEST_ASSERT_EQUAL( E_OK, Pool_Retain( Block ) );
+    }
+    TEST_ASSERT_EQUAL( E_NOT_OK, Pool_Retain( Block ) );
+    TEST_ASSERT_EQUAL( E_NOT_OK, Pool_Retain( NULL_PTR ) );
+}
+
+/**
+ * @brief   **Test statistics with invalid parameters**
+ */
+void test__Pool_GetStats__invalid_parameters( void )
+{
+    Pool_StatsType Stats;
+
+    TEST_ASSERT_EQUAL( E_NOT_OK, Pool_GetStats( POOL_CLASSES, &Stats ) );
+    TEST_ASSERT_EQUAL( E_NOT_OK, Pool_GetStats( POOL_CLASS_8, NULL_PTR ) );
+}
@@ -0,0 +1,406 @@
+/**
+ * @file    test_Ring.c
+ * @brief   **Unit testing for the single producer single consumer ring buffer**
+ *
+ * The first group of test cases checks the ring from a single thread, including every start
+ * position for the batches and the overflow of the free running indexes. The stress test cases
+ * run the producer and the consumer on two threads, as stand-ins for an interrupt and a task, and
+ * check every element arrives once, in order and not torn, a missing barrier between the element
+ * copy and the index update shows up as a corrupted element. Each thread yields the CPU when the
+ * ring is full or empty, so the test also runs on a host with a single core.
+ */
+#include <pthread.h>
+#include <sched.h>
+#include "unity.h"
+#include "Ring.h"
+#include "Mem.h"
+
+#define TEST_RING_SIZE     8u       /*!< Elements on the ring used by the single thread tests */
+#define TEST_STRESS_COUNT  200000u  /*!< Elements moved from the producer to the consumer on each stress test */
+#define TEST_STRESS_BATCH  5u       /*!< Largest batch used by the stress threads, not a power of two on purpose */
+
+/**
+ * @brief   Element with a size that is not a power of two, the three words shall stay consistent
+ */
+typedef struct _Test_ElementType
+{
+    uint32 Sequence;
+    uint32 Inverted;
+    uint32 Scrambled;
+} Test_ElementType;
+
+static Ring_BufferType Ring;
+static Test_ElementType Storage[ TEST_RING_SIZE ];
+
+/*build the element with the given sequence number*/
+static Test_ElementType Test_Element( uint32 Sequence )
+{
+    Test_ElementType Element = { Sequence, ~Sequence, Sequence * 0x9E3779B1u };
+    return Element;
+}
+
+/*check the element has the expected sequence number and is consistent*/
+static void Test_CheckElement( const Test_ElementType *Element, uint32 Sequence )
+{
+    TEST_ASSERT_EQUAL_HEX32( Sequence, Element->Sequence );
+    TEST_ASSERT_EQUAL_HEX32( ~Sequence, Element->Inverted );
+    TEST_ASSERT_EQUAL_HEX32( Sequence * 0x9E3779B1u, Element->Scrambled );
+}
+
+/*this function is required by Ceedling to run any code before the test cases*/
+void setUp( void )
+{
+    (void)Ring_Init( &Ring, Storage, TEST_RING_SIZE, sizeof( Test_ElementType ) );
+}
+
+/*this function is required by Ceedling to run any code after the test cases*/
+void tearDown( void )
+{
+}
+
+/**
+ * @brief   **Test init with invalid parameters**
+ *
+ * A null pointer, a size of zero or a number of elements that is not a power of two shall be
+ * rejected.
+ */
+void test__Ring_Init__invalid_parameters( void )
+{
+    TEST_ASSERT_EQUAL( E_NOT_OK, Ring_Init( NULL_PTR, Storage, 8u, 4u ) );
+    TEST_ASSERT_EQUAL( E_NOT_OK, Ring_Init( &Ring, NULL_PTR, 8u, 4u ) );
+    TEST_ASSERT_EQUAL( E_NOT_OK, Ring_Init( &Ring, Storage, 0u, 4u ) );
+    TEST_ASSERT_EQUAL( E_NOT_OK, Ring_Init( &Ring, Storage, 6u, 4u ) );
+    TEST_ASSERT_EQUAL( E_NOT_OK, Ring_Init( &Ring, Storage, 0xFFFFFFFFu, 4u ) );
+    TEST_ASSERT_EQUAL( E_NOT_OK, Ring_Init( &Ring, Storage, 8u, 0u ) );
+    TEST_ASSERT_EQUAL( E_OK, Ring_Init( &Ring, Storage, 1u, 4u ) );
+    TEST_ASSERT_EQUAL( E_OK, Ring_Init( &Ring, Storage, 0x80000000u, 1u ) );
+}
+
+/**
+ * @brief   **Test push until full and pop until empty**
+ *
+ * The elements shall come out in the same order and the counters shall follow each operation.
+ */
+void test__Ring_Push_Pop__fill_and_empty( void )
+{
+    Test_ElementType Element;
+
+    for( uint32 i = 0u; i < TEST_RING_SIZE; i++ )
+    {
+        Element = Test_Element( i );
+        TEST_ASSERT_TRUE( Ring_Push( &Ring, &Element ) );
+        TEST_ASSERT_EQUAL_UINT32( i + 1u, Ring_GetCount( &Ring ) );
+    }
+    Element = Test_Element( TEST_RING_SIZE );
+    TEST_ASSERT_FALSE( Ring_Push( &Ring, &Element ) );
+    TEST_ASSERT_EQUAL_UINT32( 0u, Ring_GetFree( &Ring ) );
+
+    for( uint32 i = 0u; i < TEST_RING_SIZE; i++ )
+    {
+        TEST_ASSERT_TRUE( Ring_Pop( &Ring, &Element ) );
+        Test_CheckElement( &Element, i );
+        TEST_ASSERT_EQUAL_UINT32( i + 1u, Ring_GetFree( &Ring ) );
+    }
+    TEST_ASSERT_FALSE( Ring_Pop( &Ring, &Element ) );
+    TEST_ASSERT_EQUAL_UINT32( 0u, Ring_GetCount( &Ring ) );
+}
+
+/**
+ * @brief   **Test batches from every start position**
+ *
+ * A batch larger than the room left shall be cut, and a batch that wraps around the end of the
+ * storage shall keep the order of the elements.
+ */
+void test__Ring_PushBatch_PopBatch__every_start_and_length( void )
+{
+    Test_ElementType Input[ TEST_RING_SIZE + 2u ] = { 0 };
+    Test_ElementType Output[ TEST_RING_SIZE + 2u ] = { 0 };
+
+    for( uint32 Start = 0u; Start < TEST_RING_SIZE; Start++ )
+    {
+        for( uint32 Length = 0u; Length < ( TEST_RING_SIZE + 2u ); Length++ )
+        {
+            uint32 Expected = ( Length < TEST_RING_SIZE ) ? Length : TEST_RING_SIZE;
+
+            /*move the indexes to the start position with the ring empty*/
+            setUp( );
+            TEST_ASSERT_EQUAL_UINT32( Start, Ring_PushBatch( &Ring, Input, Start ) );
+            TEST_ASSERT_EQUAL_UINT32( Start, Ring_PopBatch( &Ring, Output, Start ) );
+
+            for( uint32 i = 0u; i < Length; i++ )
+            {
+                Input[ i ] = Test_Element( i );
+            }
+            TEST_ASSERT_EQUAL_UINT32( Expected, Ring_PushBatch( &Ring, Input, Length ) );
+            TEST_ASSERT_EQUAL_UINT32( Expected, Ring_GetCount( &Ring ) );
+            TEST_ASSERT_EQUAL_UINT32( Expected, Ring_PopBatch( &Ring, Output, TEST_RING_SIZE + 2u ) );
+            for( uint32 i = 0u; i < Expected; i++ )
+            {
+                Test_CheckElement( &Output[ i ], i );
+            }
+            TEST_ASSERT_EQUAL_UINT32( 0u, Ring_GetCount( &Ring ) );
+        }
+    }
+}
+
+/**
+ * @brief   **Test reserve and commit around the end of the storage**
+ *
+ * Reserve shall only give the slots up to the end of the storage, and the slots written in place
+ * shall not be visible until they are committed.
+ */
+void test__Ring_Reserve_Commit__wrap_around( void )
+{
+    Test_ElementType Output[ TEST_RING_SIZE ] = { 0 };
+    Test_ElementType *Slots;
+    uint32 Count;
+
+    /*leave the indexes at 6, two slots before the end*/
+    TEST_ASSERT_EQUAL_UINT32( 6u, Ring_PushBatch( &Ring, Output, 6u ) );
+    TEST_ASSERT_EQUAL_UINT32( 6u, Ring_PopBatch( &Ring, Output, 6u ) );
+
+    Slots = (Test_ElementType *)Ring_Reserve( &Ring, &Count );
+    TEST_ASSERT_EQUAL_PTR( &Storage[ 6 ], Slots );
+    TEST_ASSERT_EQUAL_UINT32( 2u, Count );
+    Slots[ 0 ] = Test_Element( 0u );
+    Slots[ 1 ] = Test_Element( 1u );
+    TEST_ASSERT_EQUAL_UINT32( 0u, Ring_GetCount( &Ring ) );
+    Ring_Commit( &Ring, 2u );
+    TEST_ASSERT_EQUAL_UINT32( 2u, Ring_GetCount( &Ring ) );
+
+    Slots = (Test_ElementType *)Ring_Reserve( &Ring, &Count );
+    TEST_ASSERT_EQUAL_PTR( &Storage[ 0 ], Slots );
+    TEST_ASSERT_EQUAL_UINT32( 6u, Count );
+    for( uint32 i = 0u; i < Count; i++ )
+    {
+        Slots[ i ] = Test_Element( i + 2u );
+    }
+    Ring_Commit( &Ring, Count );
+
+    TEST_ASSERT_NULL( Ring_Reserve( &Ring, &Count ) );
+    TEST_ASSERT_EQUAL_UINT32( 0u, Count );
+    TEST_ASSERT_EQUAL_UINT32( TEST_RING_SIZE, Ring_PopBatch( &Ring, Output, TEST_RING_SIZE ) );
+    for( uint32 i = 0u; i < TEST_RING_SIZE; i++ )
+    {
+        Test_CheckElement( &Output[ i ], i );
+    }
+}
+
+/**
+ * @brief   **Test peek and release around the end of the storage**
+ *
+ * Peek shall only give the elements up to the end of the storage, and the slots shall not be given
+ * back to the producer until they are released.
+ */
+void test__Ring_Peek_Release__wrap_around( void )
+{
+    Test_ElementType Input[ TEST_RING_SIZE ] = { 0 };
+    const Test_ElementType *Slots;
+    uint32 Count;
+
+    TEST_ASSERT_NULL( Ring_Peek( &Ring, &Count ) );
+    TEST_ASSERT_EQUAL_UINT32( 0u, Count );
+
+    /*leave the indexes at 5 and store 6 elements, 3 before the end and 3 after*/
+    TEST_ASSERT_EQUAL_UINT32( 5u, Ring_PushBatch( &Ring, Input, 5u ) );
+    TEST_ASSERT_EQUAL_UINT32( 5u, Ring_PopBatch( &Ring, Input, 5u ) );
+    for( uint32 i = 0u; i < 6u; i++ )
+    {
+        Input[ i ] = Test_Element( i );
+    }
+    TEST_ASSERT_EQUAL_UINT32( 6u, Ring_PushBatch( &Ring, Input, 6u ) );
+
+    Slots = (const Test_ElementType *)Ring_Peek( &Ring, &Count );
+    TEST_ASSERT_EQUAL_PTR( &Storage[ 5 ], Slots );
+    TEST_ASSERT_EQUAL_UINT32( 3u, Count );
+    Test_CheckElement( &Slots[ 0 ], 0u );
+    Ring_Release( &Ring, 1u );
+    TEST_ASSERT_EQUAL_UINT32( 3u, Ring_GetFree( &Ring ) );
+
+    Slots = (const Test_ElementType *)Ring_Peek( &Ring, &Count );
+    TEST_ASSERT_EQUAL_UINT32( 2u, Count );
+    Test_CheckElement( &Slots[ 0 ], 1u );
+    Test_CheckElement( &Slots[ 1 ], 2u );
+    Ring_Release( &Ring, Count );
+
+    Slots = (const Test_ElementType *)Ring_Peek( &Ring, &Count );
+    TEST_ASSERT_EQUAL_PTR( &Storage[ 0 ], Slots );
+    TEST_ASSERT_EQUAL_UINT32( 3u, Count );
+    for( uint32 i = 0u; i < Count; i++ )
+    {
+        Test_CheckElement( &Slots[ i ], i + 3u );
+    }
+    Ring_Release( &Ring, Count );
+    TEST_ASSERT_EQUAL_UINT32( 0u, Ring_GetCount( &Ring ) );
+}
+
+/**
+ * @brief   **Test the overflow of the free running indexes**
+ *
+ * With both indexes just before the overflow of a 32 bits counter the ring shall keep working the
+ * same, since the count is always Head - Tail.
+ */
+void test__Ring_PushBatch_PopBatch__index_overflow( void )
+{
+    Test_ElementType Input[ TEST_RING_SIZE ] = { 0 };
+    Test_ElementType Output[ TEST_RING_SIZE ] = { 0 };
+
+    Ring.Head = 0xFFFFFFFDu;
+    Ring.Tail = 0xFFFFFFFDu;
+    for( uint32 i = 0u; i < TEST_RING_SIZE; i++ )
+    {
+        Input[ i ] = Test_Element( i );
+    }
+
+    TEST_ASSERT_EQUAL_UINT32( TEST_RING_SIZE, Ring_PushBatch( &Ring, Input, TEST_RING_SIZE ) );
+    TEST_ASSERT_EQUAL_UINT32( TEST_RING_SIZE, Ring_GetCount( &Ring ) );
+    TEST_ASSERT_EQUAL_UINT32( 0u, Ring_PushBatch( &Ring, Input, 1u ) );
+    TEST_ASSERT_EQUAL_UINT32( TEST_RING_SIZE, Ring_PopBatch( &Ring, Output, TEST_RING_SIZE ) );
+    for( uint32 i = 0u; i < TEST_RING_SIZE; i++ )
+    {
+        Test_CheckElement( &Output[ i ], i );
+    }
+    TEST_ASSERT_EQUAL_UINT32( 0u, Ring_GetCount( &Ring ) );
+    TEST_ASSERT_EQUAL_HEX32( 5u, Ring.Tail );
+}
+
+/*producer thread, pushes the sequence numbers with the three push methods in turns*/
+static void *Test_Producer( void *Arg )
+{
+    Test_ElementType Batch[ TEST_STRESS_BATCH ];
+    uint32 Sequence = 0u;
+    uint32 Turn     = 0u;
+
+    (void)Arg;
+    while( Sequence < TEST_STRESS_COUNT )
+    {
+        uint32 Length = ( Turn % TEST_STRESS_BATCH ) + 1u;
+        uint32 Count;
+
+        if( ( Sequence + Length ) > TEST_STRESS_COUNT )
+        {
+            Length = TEST_STRESS_COUNT - Sequence;
+        }
+
+        switch( Turn % 3u )
+        {
+            case 0u:
+                Batch[ 0 ] = Test_Element( Sequence );
+                Sequence += ( Ring_Push( &Ring, &Batch[ 0 ] ) == TRUE ) ? 1u : 0u;
+                break;
+            case 1u:
+                for( uint32 i = 0u; i < Length; i++ )
+                {
+                    Batch[ i ] = Test_Element( Sequence + i );
+                }
+                Sequence += Ring_PushBatch( &Ring, Batch, Length );
+                break;
+            default:
+            {
+                Test_ElementType *Slots = (Test_ElementType *)Ring_Reserve( &Ring, &Count );
+                Count = ( Count < Length ) ? Count : Length;
+                for( uint32 i = 0u; i < Count; i++ )
+                {
+                    Slots[ i ] = Test_Element( Sequence + i );
+                }
+                Ring_Commit( &Ring, Count );
+                Sequence += Count;
+                break;
+            }
+        }
+        if( Ring_GetFree( &Ring ) == 0u )
+        {
+            (void)sched_yield( );
+        }
+        Turn++;
+    }
+
+    return NULL;
+}
+
+/*consumer side, pops with the three pop methods in turns and counts the wrong elements*/
+static uint32 Test_Consumer( void )
+{
+    Test_ElementType Batch[ TEST_STRESS_BATCH ];
+    const Test_ElementType *Slots;
+    uint32 Sequence = 0u;
+    uint32 Turn     = 0u;
+    uint32 Errors   = 0u;
+    uint32 Count    = 0u;
+
+    while( Sequence < TEST_STRESS_COUNT )
+    {
+        switch( Turn % 3u )
+        {
+            case 0u:
+                Count = ( Ring_Pop( &Ring, &Batch[ 0 ] ) == TRUE ) ? 1u : 0u;
+                Slots = Batch;
+                break;
+            case 1u:
+                Count = Ring_PopBatch( &Ring, Batch, ( Turn % TEST_STRESS_BATCH ) + 1u );
+                Slots = Batch;
+                break;
+            default:
+                Slots = (const Test_ElementType *)Ring_Peek( &Ring, &Count );
+                break;
+        }
+
+        for( uint32 i = 0u; i < Count; i++ )
+        {
+            const Test_ElementType Expected = Test_Element( Sequence + i );
+            if( ( Slots[ i ].Sequence != Expected.Sequence ) || ( Slots[ i ].Inverted != Expected.Inverted ) ||
+                ( Slots[ i ].Scrambled != Expected.Scrambled ) )
+            {
+                Errors++;
+            }
+        }
+        if( ( Turn % 3u ) == 2u )
+        {
+            Ring_Release( &Ring, Count );
+        }
+        if( Count == 0u )
+        {
+            (void)sched_yield( );
+        }
+        Sequence += Count;
+        Turn++;
+    }
+
+    return Errors;
+}
+
+/*run the producer on a second thread and the consumer on this one over a ring of the given size*/
+static void Test_Stress( uint32 Elements )
+{
+    pthread_t Producer;
+
+    TEST_ASSERT_EQUAL( E_OK, Ring_Init( &Ring, Storage, Elements, sizeof( Test_ElementType ) ) );
+    TEST_ASSERT_EQUAL_INT( 0, pthread_create( &Producer, NULL, Test_Producer, NULL ) );
+    uint32 Errors = Test_Consumer( );
+    TEST_ASSERT_EQUAL_INT( 0, pthread_join( Producer, NULL ) );
+
+    TEST_ASSERT_EQUAL_UINT32( 0u, Errors );
+    TEST_ASSERT_EQUAL_UINT32( 0u, Ring_GetCount( &Ring ) );
+    TEST_ASSERT_EQUAL_HEX32( TEST_STRESS_COUNT, Ring.Head );
+}
+
+/**
+ * @brief   **Stress test with a producer and a consumer thread**
+ *
+ * Every element shall be received once, in order and consistent.
+ */
+void test__Ring__stress_two_threads( void )
+{
+    Test_Stress( TEST_RING_SIZE );
+}
+
+/**
+ * @brief   **Stress test with a ring of a single element**
+ *
+ * Each element goes through the only slot, so the producer and the consumer access the same
+ * memory on every turn.
+ */
+void test__Ring__stress_two_threads_single_slot( void )
+{
+    Test_Stress( 1u );
+}
@@ -0,0 +1,175 @@
+/**
+ * @file    test_SchM.c
+ * @brief   **Unit testing for the exclusive areas**
+ *
+ * The areas are configured in test/support/SchM_Lcfg.c, the NVIC and SysTick registers are plain
+ * variables, so writing ICER does not clear ISER, the tests check the values written instead.
+ */
+#include "unity.h"
+#include "Registers.h"
+#include "SchM.h"
+
+/*Mock of the NVIC and SysTick registers*/
+Nvic_RegisterType NVIC_BASE;
+SysTick_RegisterType SYSTICK_BASE;
+
+/*Runtime data of the areas, not static when testing*/
+extern SchM_AreaStateType SchM_Areas[ SCHM_NUMBER_OF_AREAS ];
+
+/*this function is required by Ceedling to run any code before the test cases*/
+void setUp( void )
+{
+    for( uint8 i = 0u; i < SCHM_NUMBER_OF_AREAS; i++ )
+    {
+        SchM_Areas[ i ].Saved       = 0u;
+        SchM_Areas[ i ].Start       = 0u;
+        SchM_Areas[ i ].MaxHoldTime = 0u;
+        SchM_Areas[ i ].Nesting     = 0u;
+    }
+    NVIC->ISER[ 0u ] = 0u;
+    NVIC->ICER[ 0u ] = 0u;
+    SYSTICK->LOAD    = 999u;
+    SYSTICK->VAL     = 500u;
+}
+
+/*this function is required by Ceedling to run any code after the test cases*/
+void tearDown( void )
+{
+}
+
+/**
+ * @brief   **Test the lines cleared by the outermost enter**
+ *
+ * Only the lines of the area that were enabled shall be cleared on the NVIC, the rest of the
+ * interrupts keep running.
+ */
+void test__SchM_Enter__clears_only_enabled_lines_of_the_area( void )
+{
+    NVIC->ISER[ 0u ] = ( 1UL << TIM16_FDCAN_IT0_IRQn ) | ( 1UL << SPI1_IRQn ) | ( 1UL << FLASH_IRQn );
+
+    SchM_Enter( SCHM_CAN_EXCLUSIVE_AREA_0 );
+
+    TEST_ASSERT_EQUAL_HEX32( ( 1UL << TIM16_FDCAN_IT0_IRQn ), NVIC->ICER[ 0u ] );
+    TEST_ASSERT_EQUAL_UINT8( 1u, SchM_Areas[ SCHM_CAN_EXCLUSIVE_AREA_0 ].Nesting );
+}
+
+/**
+ * @brief   **Test nested enters and exits**
+ *
+ * The inner enter and exit shall not touch the NVIC, the outermost exit shall enable again the
+ * lines cleared by the outermost enter.
+ */
+void test__SchM_Exit__outermost_exit_restores_lines( void )
+{
+    NVIC->ISER[ 0u ] = ( 1UL << TIM16_FDCAN_IT0_IRQn ) | ( 1UL << TIM17_FDCAN_IT1_IRQn );
+
+    SchM_Enter( SCHM_CAN_EXCLUSIVE_AREA_1 );
+    NVIC->ISER[ 0u ] = 0u;
+    NVIC->ICER[ 0u ] = 0u;
+    SchM_Enter( SCHM_CAN_EXCLUSIVE_AREA_1 );
+    TEST_ASSERT_EQUAL_HEX32( 0u, NVIC->ICER[ 0u ] );
+    SchM_Exit( SCHM_CAN_EXCLUSIVE_AREA_1 );
+    TEST_ASSERT_EQUAL_HEX32( 0u, NVIC->ISER[ 0u ] );
+
+    SchM_Exit( SCHM_CAN_EXCLUSIVE_AREA_1 );
+    TEST_ASSERT_EQUAL_HEX32( ( 1UL << TIM16_FDCAN_IT0_IRQn ) | ( 1UL << TIM17_FDCAN_IT1_IRQn ), NVIC->ISER[ 0u ] );
+    TEST_ASSERT_EQUAL_UINT8( 0u, SchM_Areas[ SCHM_CAN_EXCLUSIVE_AREA_1 ].Nesting );
+}
+
+/**
+ * @brief   **Test a line disabled while inside the area**
+ *
+ * A line of the area that was already disabled at the enter shall stay disabled after the exit.
+ */
+void test__SchM_Exit__disabled_line_stays_disabled( void )
+{
+    NVIC->ISER[ 0u ] = ( 1UL << SPI2_3_IRQn );
+
+    SchM_Enter( SCHM_SPI_EXCLUSIVE_AREA_0 );
+    NVIC->ISER[ 0u ] = 0u;
+    SchM_Exit( SCHM_SPI_EXCLUSIVE_AREA_0 );
+
+    TEST_ASSERT_EQUAL_HEX32( ( 1UL << SPI2_3_IRQn ), NVIC->ISER[ 0u ] );
+}
+
+/**
+ * @brief   **Test the hold time measure**
+ *
+ * The longest time from the outermost enter to its exit shall be kept, also when SysTick reloads
+ * in between.
+ */
+void test__SchM_GetMaxHoldTime__keeps_longest_section( void )
+{
+    SYSTICK->VAL = 500u;
+    SchM_Enter( SCHM_FLS_EXCLUSIVE_AREA_0 );
+    SYSTICK->VAL = 450u;
+    SchM_Exit( SCHM_FLS_EXCLUSIVE_AREA_0 );
+    TEST_ASSERT_EQUAL_UINT32( 50u, SchM_GetMaxHoldTime( SCHM_FLS_EXCLUSIVE_AREA_0 ) );
+
+    SYSTICK->VAL = 100u;
+    SchM_Enter( SCHM_FLS_EXCLUSIVE_AREA_0 );
+    SYSTICK->VAL = 900u;
+    SchM_Exit( SCHM_FLS_EXCLUSIVE_AREA_0 );
+    TEST_ASSERT_EQUAL_UINT32( 200u, SchM_GetMaxHoldTime( SCHM_FLS_EXCLUSIVE_AREA_0 ) );
+
+    SYSTICK->VAL = 300u;
+    SchM_Enter( SCHM_FLS_EXCLUSIVE_AREA_0 );
+    SYSTICK->VAL = 290u;
+    SchM_Exit( SCHM_FLS_EXCLUSIVE_AREA_0 );
+    TEST_ASSERT_EQUAL_UINT32( 200u, SchM_GetMaxHoldTime( SCHM_FLS_EXCLUSIVE_AREA_0 ) );
+}
+
+/**
+ * @brief   **Test the hold time of nested sections**
+ *
+ * Only the outermost section shall be measured.
+ */
+void test__SchM_GetMaxHoldTime__nested_measures_outermost( void )
+{
+    SYSTICK->VAL = 800u;
+    SchM_Enter( SCHM_CAN_EXCLUSIVE_AREA_0 );
+    SYSTICK->VAL = 700u;
+    SchM_Enter( SCHM_CAN_EXCLUSIVE_AREA_0 );
+    SYSTICK->VAL = 690u;
+    SchM_Exit( SCHM_CAN_EXCLUSIVE_AREA_0 );
+    TEST_ASSERT_EQUAL_UINT32( 0u, SchM_GetMaxHoldTime( SCHM_CAN_EXCLUSIVE_AREA_0 ) );
+    SYSTICK->VAL = 600u;
+    SchM_Exit( SCHM_CAN_EXCLUSIVE_AREA_0 );
+
+    TEST_ASSERT_EQUAL_UINT32( 200u, SchM_GetMaxHoldTime( SCHM_CAN_EXCLUSIVE_AREA_0 ) );
+}
+
+/**
+ * @brief   **Test no hold time is measured with SysTick stopped**
+ *
+ * The startup leaves SysTick with LOAD zero, the sections shall not be measured.
+ */
+void test__SchM_GetMaxHoldTime__systick_stopped( void )
+{
+    SYSTICK->LOAD = 0u;
+    SYSTICK->VAL  = 0u;
+    SchM_Enter( SCHM_FLS_EXCLUSIVE_AREA_0 );
+    SYSTICK->VAL = 10u;
+    SchM_Exit( SCHM_FLS_EXCLUSIVE_AREA_0 );
+
+    TEST_ASSERT_EQUAL_UINT32( 0u, SchM_GetMaxHoldTime( SCHM_FLS_EXCLUSIVE_AREA_0 ) );
+}
+
+/**
+ * @brief   **Test an exit without its enter and invalid areas**
+ *
+ * They shall be ignored without touching the NVIC or the areas.
+ */
+void test__SchM_Exit__without_enter_and_invalid_area( void )
+{
+    NVIC->ISER[ 0u ] = 0u;
+    SchM_Exit( SCHM_CAN_EXCLUSIVE_AREA_0 );
+    TEST_ASSERT_EQUAL_HEX32( 0u, NVIC->ISER[ 0u ] );
+    TEST_ASSERT_EQUAL_UINT8( 0u, SchM_Areas[ SCHM_CAN_EXCLUSIVE_AREA_0 ].Nesting );
+
+    NVIC->ISER[ 0u ] = 0xFFFFFFFFu;
+    SchM_Enter( SCHM_NUMBER_OF_AREAS );
+    SchM_Exit( SCHM_NUMBER_OF_AREAS );
+    TEST_ASSERT_EQUAL_HEX32( 0u, NVIC->ICER[ 0u ] );
+    TEST_ASSERT_EQUAL_UINT32( 0u, SchM_GetMaxHoldTime( SCHM_NUMBER_OF_AREAS ) );
+}
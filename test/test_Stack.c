@@ -0,0 +1,104 @@
+/**
+ * @file    test_Stack.c
+ * @brief   **Unit testing for the stack usage monitor**
+ *
+ * group of unit test cases for the scan of the painted stack in Stack.c, the stack reservation is
+ * simulated with an array painted the same way the startup code does
+ */
+#include "unity.h"
+#include "Stack.h"
+
+/*linker script symbols, the tests point the stack to StackRam instead*/
+uint32 _sstack;
+uint32 _estack;
+
+extern const uint32 *Stack_Start;
+extern const uint32 *Stack_End;
+
+uint32 Stack_CountPainted( const uint32 *Start, const uint32 *End );
+
+/*simulated stack reservation*/
+static uint32 StackRam[ 64 ];
+
+/*this function is required by Ceedling to run any code before the test cases*/
+void setUp( void )
+{
+    for( uint8 i = 0u; i < 64u; i++ )
+    {
+        StackRam[ i ] = STACK_PAINT_PATTERN;
+    }
+    Stack_Start = &StackRam[ 0 ];
+    Stack_End   = &StackRam[ 64 ];
+}
+
+/*this function is required by Ceedling to run any code after the test cases*/
+void tearDown( void )
+{
+}
+
+/**
+ * @brief   **Test the stack size is taken from the linker symbols**
+ */
+void test__Stack_GetSize__reservation_size( void )
+{
+    TEST_ASSERT_EQUAL_UINT32( 256u, Stack_GetSize( ) );
+}
+
+/**
+ * @brief   **Test a stack never used reports no usage**
+ */
+void test__Stack_GetHighWaterMark__untouched_stack( void )
+{
+    TEST_ASSERT_EQUAL_UINT32( 0u, Stack_GetHighWaterMark( ) );
+    TEST_ASSERT_EQUAL_UINT32( 256u, Stack_GetUnused( ) );
+}
+
+/**
+ * @brief   **Test the usage is counted from the lowest overwritten word**
+ *
+ * The stack grows downwards, the deepest frame overwrote the word 40 so the words from 40 to 63
+ * are reported as used.
+ */
+void test__Stack_GetHighWaterMark__deepest_word( void )
+{
+    StackRam[ 63 ] = 0x20000100u;
+    StackRam[ 40 ] = 0x00000000u;
+
+    TEST_ASSERT_EQUAL_UINT32( 96u, Stack_GetHighWaterMark( ) );
+    TEST_ASSERT_EQUAL_UINT32( 160u, Stack_GetUnused( ) );
+}
+
+/**
+ * @brief   **Test the painted holes above the deepest word are counted as used**
+ *
+ * Local variables never written leave painted words in the middle of the frames, the scan stops
+ * at the first overwritten word from the bottom.
+ */
+void test__Stack_GetHighWaterMark__painted_holes( void )
+{
+    StackRam[ 20 ] = 0x12345678u;
+    StackRam[ 50 ] = 0x12345678u;
+
+    TEST_ASSERT_EQUAL_UINT32( 176u, Stack_GetHighWaterMark( ) );
+}
+
+/**
+ * @brief   **Test the whole reservation is reported as used on overflow**
+ */
+void test__Stack_GetHighWaterMark__exhausted( void )
+{
+    StackRam[ 0 ] = 0x00000000u;
+
+    TEST_ASSERT_EQUAL_UINT32( 256u, Stack_GetHighWaterMark( ) );
+    TEST_ASSERT_EQUAL_UINT32( 0u, Stack_GetUnused( ) );
+}
+
+/**
+ * @brief   **Test the scan stops at the end of the reservation**
+ */
+void test__Stack_CountPainted__limits( void )
+{
+    TEST_ASSERT_EQUAL_UINT32( 64u, Stack_CountPainted( &StackRam[ 0 ], &StackRam[ 64 ] ) );
+    TEST_ASSERT_EQUAL_UINT32( 10u, Stack_CountPainted( &StackRam[ 0 ], &StackRam[ 10 ] ) );
+    TEST_ASSERT_EQUAL_UINT32( 0u, Stack_CountPainted( &StackRam[ 5 ], &StackRam[ 5 ] ) );
+}